@@ -0,0 +1,263 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryRecording.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Source file for the class cedar::aux::BinaryRecording.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/auxiliaries/BinaryRecording.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// SYSTEM INCLUDES
+#include <cstddef>
+#include <algorithm>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef CEDAR_COMPILER_MSVC
+const unsigned int cedar::aux::BinaryRecording::MAX_DIMENSIONALITY;
+const uint32_t cedar::aux::BinaryRecording::VERSION;
+const uint32_t cedar::aux::BinaryRecording::HEADER_SIZE;
+#endif // CEDAR_COMPILER_MSVC
+
+namespace
+{
+  const char MAGIC[8] = {'C', 'E', 'D', 'A', 'R', 'R', 'E', 'C'};
+
+  // time stamps are stored as doubles at the beginning of each frame
+  const size_t TIME_STAMP_SIZE = sizeof(double);
+
+  // frames are padded to a multiple of this
+  const size_t FRAME_ALIGNMENT = 8;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::BinaryRecording::BinaryRecording(const std::string& path)
+{
+  try
+  {
+    this->mFile = boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_only);
+    this->mRegion = boost::interprocess::mapped_region(this->mFile, boost::interprocess::read_only);
+  }
+  catch (const boost::interprocess::interprocess_exception& e)
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not map recording \"" + path + "\": " + e.what());
+  }
+
+  if (this->mRegion.get_size() < sizeof(Header))
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "The file \"" + path + "\" is too small to be a binary recording.");
+  }
+
+  std::memcpy(&this->mHeader, this->mRegion.get_address(), sizeof(Header));
+  checkHeader(this->mHeader);
+
+  // only count frames that are completely contained in the file
+  size_t available = 0;
+  if (this->mRegion.get_size() > this->mHeader.mHeaderSize)
+  {
+    available = (this->mRegion.get_size() - this->mHeader.mHeaderSize) / this->mHeader.mFrameStride;
+  }
+  this->mFrameCount = std::min(static_cast<size_t>(this->mHeader.mFrameCount), available);
+}
+
+cedar::aux::BinaryRecording::~BinaryRecording()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+size_t cedar::aux::BinaryRecording::getFrameCount() const
+{
+  return this->mFrameCount;
+}
+
+int cedar::aux::BinaryRecording::getMatrixType() const
+{
+  return this->mHeader.mMatrixType;
+}
+
+std::vector<int> cedar::aux::BinaryRecording::getSizes() const
+{
+  return std::vector<int>(this->mHeader.mSizes, this->mHeader.mSizes + this->mHeader.mDimensionality);
+}
+
+const char* cedar::aux::BinaryRecording::getFrameStart(size_t index) const
+{
+  if (index >= this->mFrameCount)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::IndexOutOfRangeException,
+      "Frame " + cedar::aux::toString(index) + " does not exist; the recording has "
+        + cedar::aux::toString(this->mFrameCount) + " frames."
+    );
+  }
+
+  return static_cast<const char*>(this->mRegion.get_address())
+         + this->mHeader.mHeaderSize
+         + index * this->mHeader.mFrameStride;
+}
+
+cv::Mat cedar::aux::BinaryRecording::getFrame(size_t index) const
+{
+  // cv::Mat needs a non-const pointer; the memory is mapped read-only, so the matrix must not be written to
+  char* data = const_cast<char*>(this->getFrameStart(index)) + TIME_STAMP_SIZE;
+  return cv::Mat
+         (
+           static_cast<int>(this->mHeader.mDimensionality),
+           this->mHeader.mSizes,
+           this->mHeader.mMatrixType,
+           data
+         );
+}
+
+cedar::unit::Time cedar::aux::BinaryRecording::getTimeStamp(size_t index) const
+{
+  double seconds;
+  std::memcpy(&seconds, this->getFrameStart(index), sizeof(double));
+  return seconds * cedar::unit::seconds;
+}
+
+cedar::aux::BinaryRecording::Header cedar::aux::BinaryRecording::createHeader(const cv::Mat& matrix)
+{
+  if (static_cast<unsigned int>(matrix.dims) > MAX_DIMENSIONALITY)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::RangeException,
+      "Matrices with more than " + cedar::aux::toString(MAX_DIMENSIONALITY) + " dimensions cannot be recorded in the "
+        "binary format."
+    );
+  }
+
+  Header header;
+  std::memset(&header, 0, sizeof(Header));
+  std::memcpy(header.mMagic, MAGIC, sizeof(MAGIC));
+  header.mVersion = VERSION;
+  header.mHeaderSize = HEADER_SIZE;
+  header.mMatrixType = matrix.type();
+  header.mDimensionality = static_cast<uint32_t>(matrix.dims);
+  for (int d = 0; d < matrix.dims; ++d)
+  {
+    header.mSizes[d] = matrix.size[d];
+  }
+  header.mFrameStride = TIME_STAMP_SIZE + getDataSize(header) + getPaddingSize(header);
+  header.mFrameCount = 0;
+  return header;
+}
+
+void cedar::aux::BinaryRecording::writeHeader(std::ostream& stream, const cv::Mat& matrix)
+{
+  Header header = createHeader(matrix);
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  std::vector<char> padding(header.mHeaderSize - sizeof(Header), '\0');
+  stream.write(padding.data(), padding.size());
+}
+
+cedar::aux::BinaryRecording::Header cedar::aux::BinaryRecording::readHeader(std::istream& stream)
+{
+  Header header;
+  stream.read(reinterpret_cast<char*>(&header), sizeof(Header));
+  if (stream.fail())
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "Could not read the header of a binary recording.");
+  }
+  checkHeader(header);
+  stream.ignore(header.mHeaderSize - sizeof(Header));
+  return header;
+}
+
+void cedar::aux::BinaryRecording::checkHeader(const Header& header)
+{
+  if (std::memcmp(header.mMagic, MAGIC, sizeof(MAGIC)) != 0)
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "Not a binary recording: the file does not start with \"CEDARREC\".");
+  }
+
+  if (header.mVersion > VERSION)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::ParseException,
+      "The binary recording has version " + cedar::aux::toString(header.mVersion) + ", but only versions up to "
+        + cedar::aux::toString(VERSION) + " can be read."
+    );
+  }
+
+  if
+  (
+    header.mHeaderSize < sizeof(Header)
+    || header.mDimensionality > MAX_DIMENSIONALITY
+    || header.mFrameStride < TIME_STAMP_SIZE + getDataSize(header)
+  )
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "The header of the binary recording is corrupt.");
+  }
+}
+
+size_t cedar::aux::BinaryRecording::getDataSize(const Header& header)
+{
+  size_t size = CV_ELEM_SIZE(header.mMatrixType);
+  for (uint32_t d = 0; d < header.mDimensionality; ++d)
+  {
+    size *= static_cast<size_t>(header.mSizes[d]);
+  }
+  return size;
+}
+
+size_t cedar::aux::BinaryRecording::getPaddingSize(const Header& header)
+{
+  size_t unpadded = TIME_STAMP_SIZE + getDataSize(header);
+  return (FRAME_ALIGNMENT - unpadded % FRAME_ALIGNMENT) % FRAME_ALIGNMENT;
+}
+
+size_t cedar::aux::BinaryRecording::getFrameCountOffset()
+{
+  return offsetof(Header, mFrameCount);
+}
@@ -0,0 +1,202 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryRecording.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Header file for the class cedar::aux::BinaryRecording.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+#ifndef CEDAR_AUX_BINARY_RECORDING_H
+#define CEDAR_AUX_BINARY_RECORDING_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/BinaryRecording.fwd.h"
+
+// SYSTEM INCLUDES
+#ifndef Q_MOC_RUN
+  #include <boost/interprocess/file_mapping.hpp>
+  #include <boost/interprocess/mapped_region.hpp>
+#endif // Q_MOC_RUN
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*!@brief Read access to files written in the binary serialization format (cedar::aux::SerializationFormat::Binary).
+ *
+ *        A binary recording consists of a fixed-size header (see Header) followed by frames of equal size. Each frame
+ *        starts with the time stamp of the recording in seconds (as a double), followed by the raw, contiguous matrix
+ *        data and padding up to the next multiple of eight bytes. Frame i thus starts at byte
+ *        mHeaderSize + i * mFrameStride, so frames can be accessed directly without parsing the file.
+ *
+ *        The file may be larger than the frames it contains, because the recorder allocates it in advance; only the
+ *        first mFrameCount frames are valid.
+ *
+ *        An instance of this class maps a recording into memory. Frames returned by getFrame point into the mapped
+ *        file and stay valid as long as the instance exists.
+ */
+class cedar::aux::BinaryRecording
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! The maximum number of dimensions of recorded matrices.
+  static const unsigned int MAX_DIMENSIONALITY = 16;
+
+  //! The header at the beginning of each binary recording. All values are stored in the byte order of the machine.
+  struct Header
+  {
+    //! Identifies the file as a binary recording, always "CEDARREC".
+    char mMagic[8];
+    //! Version of the file format.
+    uint32_t mVersion;
+    //! Size of the header in bytes, i.e., the offset of the first frame.
+    uint32_t mHeaderSize;
+    //! OpenCV type of the recorded matrix, e.g., CV_32F.
+    int32_t mMatrixType;
+    //! Number of dimensions of the recorded matrix.
+    uint32_t mDimensionality;
+    //! Sizes of the recorded matrix along each dimension.
+    int32_t mSizes[MAX_DIMENSIONALITY];
+    //! Distance in bytes from the start of one frame to the start of the next one.
+    uint64_t mFrameStride;
+    //! Number of frames written so far.
+    uint64_t mFrameCount;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Maps the recording at the given path into memory.
+  BinaryRecording(const std::string& path);
+
+  //!@brief Destructor
+  virtual ~BinaryRecording();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Returns the number of frames in the recording.
+  size_t getFrameCount() const;
+
+  //! Returns the OpenCV type of the recorded matrices.
+  int getMatrixType() const;
+
+  //! Returns the sizes of the recorded matrices.
+  std::vector<int> getSizes() const;
+
+  /*!@brief Returns the matrix of the given frame.
+   *
+   *        The matrix is not copied, it points to the mapped file. Clone it if it is needed after this object is
+   *        destroyed.
+   *
+   * @throws cedar::aux::IndexOutOfRangeException if there is no frame with the given index.
+   */
+  cv::Mat getFrame(size_t index) const;
+
+  //! Returns the time at which the given frame was recorded.
+  cedar::unit::Time getTimeStamp(size_t index) const;
+
+  //! Creates the header for recording the given matrix.
+  static Header createHeader(const cv::Mat& matrix);
+
+  //! Writes the header for recording the given matrix to the stream, padded to its full size.
+  static void writeHeader(std::ostream& stream, const cv::Mat& matrix);
+
+  /*!@brief Reads a header from the stream and moves the stream to the first frame.
+   *
+   * @throws cedar::aux::ParseException if the stream does not start with a valid header.
+   */
+  static Header readHeader(std::istream& stream);
+
+  //! Returns the number of bytes used to store the data of one frame, i.e., without time stamp and padding.
+  static size_t getDataSize(const Header& header);
+
+  //! Returns the number of padding bytes at the end of each frame.
+  static size_t getPaddingSize(const Header& header);
+
+  //! Returns the offset of the frame count in the file; the recorder updates it after writing frames.
+  static size_t getFrameCountOffset();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Returns a pointer to the beginning of the given frame.
+  const char* getFrameStart(size_t index) const;
+
+  //! Checks the header for consistency; throws a cedar::aux::ParseException if it is not a valid header.
+  static void checkHeader(const Header& header);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Version of the file format written by this version of cedar.
+  static const uint32_t VERSION = 1;
+
+  //! Size of the header in files written by this version of cedar; leaves room for future extensions.
+  static const uint32_t HEADER_SIZE = 256;
+
+protected:
+  // none yet
+private:
+  //! The mapped file.
+  boost::interprocess::file_mapping mFile;
+
+  //! The mapped memory region.
+  boost::interprocess::mapped_region mRegion;
+
+  //! A copy of the header of the file.
+  Header mHeader;
+
+  //! Number of complete frames in the file.
+  size_t mFrameCount;
+};
+
+#endif // CEDAR_AUX_BINARY_RECORDING_H
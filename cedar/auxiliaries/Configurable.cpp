@@ -54,6 +54,8 @@
   #include <boost/property_tree/ini_parser.hpp>
   #include <boost/filesystem.hpp>
 #endif
+#include <QReadLocker>
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <fstream> // only used for legacy configurable compatibility
@@ -701,6 +703,35 @@ void cedar::aux::Configurable::resetChangedStates(bool newChangedFlagValue) cons
   }
 }
 
+unsigned long long cedar::aux::Configurable::getParameterVersion() const
+{
+  QReadLocker locker(&this->mConfigurableLock);
+
+  unsigned long long version = 0;
+  for (const auto& parameter : this->mParameterList)
+  {
+    version = std::max(version, parameter->getVersion());
+
+    if (parameter->canHaveConfigurableChildren())
+    {
+      for (size_t i = 0; i < parameter->getNumberOfConfigurableChildren(); ++i)
+      {
+        if (auto child = parameter->getConfigurableChild(i))
+        {
+          version = std::max(version, child->getParameterVersion());
+        }
+      }
+    }
+  }
+
+  for (const auto& name_child_pair : this->mChildren)
+  {
+    version = std::max(version, name_child_pair.second->getParameterVersion());
+  }
+
+  return version;
+}
+
 void cedar::aux::Configurable::writeConfiguration(cedar::aux::ConfigurationNode& root) const
 {
   for
@@ -142,6 +142,13 @@ public:
   //!@brief get a list of all parameters registered at this Configurable
   ParameterList& getParameters();
 
+  /*!@brief Returns the largest version of all parameters of this configurable, its children and the configurables
+   *        held by its parameters.
+   *
+   *        The result changes whenever any of these parameters is changed; see cedar::aux::Parameter::getVersion.
+   */
+  unsigned long long getParameterVersion() const;
+
   /*!@brief add a Configurable as a child to this instance of Configurable - if name is duplicate, an exception is
    * thrown
    */
@@ -52,7 +52,9 @@
 cedar::aux::Data::Data()
 :
 mpLock(new QReadWriteLock()),
-mpeOwner(NULL)
+mpeOwner(NULL),
+mVersion(0),
+mpSnapshotChannel(new cedar::aux::DataSnapshotChannel())
 {
 }
 
@@ -122,3 +124,47 @@ cedar::aux::DataPtr cedar::aux::Data::clone() const
     "Cloning is not implemented for the  \"" + cedar::aux::objectTypeToString(this) + "\"."
   );
 }
+
+bool cedar::aux::Data::writeSnapshot(cv::Mat& /* snapshot */) const
+{
+  return false;
+}
+
+cedar::aux::DataSnapshotChannel& cedar::aux::Data::getSnapshotChannel() const
+{
+  return *this->mpSnapshotChannel;
+}
+
+void cedar::aux::Data::publishSnapshot() const
+{
+  this->mpSnapshotChannel->publish
+  (
+    this->getVersion(),
+    [this](cv::Mat& matrix, cedar::aux::annotation::Annotatable& annotations)
+    {
+      if (!this->writeSnapshot(matrix))
+      {
+        return false;
+      }
+      annotations = *this;
+      return true;
+    }
+  );
+}
+
+cedar::aux::DataSnapshotChannel::Snapshot cedar::aux::Data::getSnapshot() const
+{
+  // acquiring first also tells the channel that somebody reads the snapshots, so that they get published at all
+  auto snapshot = this->mpSnapshotChannel->acquire();
+
+  if (this->mpSnapshotChannel->isDue() && this->mpLock->tryLockForRead())
+  {
+    // the writer has not published anything recently; take the snapshot here instead
+    snapshot.release();
+    this->publishSnapshot();
+    this->mpLock->unlock();
+    snapshot = this->mpSnapshotChannel->acquire();
+  }
+
+  return snapshot;
+}
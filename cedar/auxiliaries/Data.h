@@ -45,6 +45,7 @@
 #include "cedar/auxiliaries/annotation/Annotation.h"
 #include "cedar/auxiliaries/annotation/Annotatable.h"
 #include "cedar/auxiliaries/SerializationFormat.h"
+#include "cedar/auxiliaries/DataSnapshotChannel.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/Configurable.fwd.h"
@@ -55,6 +56,8 @@
 #include <QReadWriteLock>
 #include <iostream>
 #include <fstream>
+#include <atomic>
+#include <memory>
 
 /*!@brief This is an abstract interface for all kinds of data.
  *
@@ -157,11 +160,50 @@ public:
   //! Clones this data object.
   virtual cedar::aux::DataPtr clone() const;
 
+  /*!@brief Returns the version of the data, i.e., a number that changes whenever the data is marked as changed.
+   *
+   *        Steps mark their outputs as changed after each compute call; setData and copyValueFrom mark the data as
+   *        changed, too. Code that writes into the data by other means has to call markChanged itself.
+   */
+  inline unsigned long long getVersion() const
+  {
+    return this->mVersion.load(std::memory_order_acquire);
+  }
+
+  //! Marks the data as changed by increasing its version.
+  inline void markChanged()
+  {
+    this->mVersion.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  /*!@brief Returns the newest snapshot of the data, i.e., a copy that can be read without locking the data.
+   *
+   *        Snapshots are published by the writer of the data, see publishSnapshot. If none has been published for a
+   *        period of the snapshot channel, e.g., because the data is not written by a step or the architecture is
+   *        paused, the snapshot is taken here, but only if the data can be locked for reading without waiting. The
+   *        snapshot is invalid if there is none yet or if the data cannot be represented as a matrix.
+   */
+  cedar::aux::DataSnapshotChannel::Snapshot getSnapshot() const;
+
+  /*!@brief Publishes a snapshot of the data if somebody reads snapshots and the maximum rate of the channel permits it.
+   *
+   *        Never blocks. The caller must hold at least a read lock on the data; steps call this for their outputs
+   *        after each compute call.
+   */
+  void publishSnapshot() const;
+
+  //! Returns the channel through which snapshots of this data are published, e.g., to change its maximum rate.
+  cedar::aux::DataSnapshotChannel& getSnapshotChannel() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  // none yet
+  /*!@brief Writes a copy of the data into the given matrix, reusing its memory where possible.
+   *
+   *        Returns false if the data cannot be represented as a matrix, which is what the default implementation does.
+   */
+  virtual bool writeSnapshot(cv::Mat& snapshot) const;
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
@@ -180,6 +222,12 @@ private:
   //!@todo This should be a DataOwner* (if that would exist as interface)
   cedar::aux::Configurable* mpeOwner;
 
+  //! Version of the data, see getVersion.
+  std::atomic<unsigned long long> mVersion;
+
+  //! Snapshots of the data, see getSnapshot.
+  std::unique_ptr<cedar::aux::DataSnapshotChannel> mpSnapshotChannel;
+
 }; // class cedar::aux::Data
 
 #endif // CEDAR_AUX_DATA_H
@@ -0,0 +1,246 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        DataSnapshotChannel.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Publishes copies of a data object so that readers do not have to lock it.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/DataSnapshotChannel.h"
+#include "cedar/auxiliaries/assert.h"
+
+// SYSTEM INCLUDES
+#include <chrono>
+
+namespace
+{
+  //! Snapshots are published as long as one has been acquired within this time, in nanoseconds.
+  const int64_t READER_TIMEOUT = 1000000000;
+
+  //! Marks times at which nothing has happened yet.
+  const int64_t NEVER = -1;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// snapshot
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::DataSnapshotChannel::Snapshot::Snapshot()
+:
+mpSlots(nullptr),
+mIndex(-1)
+{
+}
+
+cedar::aux::DataSnapshotChannel::Snapshot::Snapshot(const cedar::aux::NewestSlotPool<Slot>* pSlots, int index)
+:
+mpSlots(pSlots),
+mIndex(index)
+{
+}
+
+cedar::aux::DataSnapshotChannel::Snapshot::Snapshot(Snapshot&& other)
+:
+mpSlots(other.mpSlots),
+mIndex(other.mIndex)
+{
+  other.mpSlots = nullptr;
+}
+
+cedar::aux::DataSnapshotChannel::Snapshot& cedar::aux::DataSnapshotChannel::Snapshot::operator=(Snapshot&& other)
+{
+  if (this != &other)
+  {
+    this->release();
+    this->mpSlots = other.mpSlots;
+    this->mIndex = other.mIndex;
+    other.mpSlots = nullptr;
+  }
+  return *this;
+}
+
+cedar::aux::DataSnapshotChannel::Snapshot::~Snapshot()
+{
+  this->release();
+}
+
+void cedar::aux::DataSnapshotChannel::Snapshot::release()
+{
+  if (this->mpSlots != nullptr)
+  {
+    this->mpSlots->unpin(this->mIndex);
+    this->mpSlots = nullptr;
+  }
+}
+
+const cedar::aux::DataSnapshotChannel::Slot& cedar::aux::DataSnapshotChannel::Snapshot::getSlot() const
+{
+  CEDAR_DEBUG_ASSERT(this->isValid());
+  return this->mpSlots->at(this->mIndex);
+}
+
+const cv::Mat& cedar::aux::DataSnapshotChannel::Snapshot::getMatrix() const
+{
+  return this->getSlot().mMatrix;
+}
+
+const cedar::aux::annotation::Annotatable& cedar::aux::DataSnapshotChannel::Snapshot::getAnnotations() const
+{
+  return this->getSlot().mAnnotations;
+}
+
+unsigned long long cedar::aux::DataSnapshotChannel::Snapshot::getVersion() const
+{
+  return this->getSlot().mVersion;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::DataSnapshotChannel::DataSnapshotChannel(unsigned int numberOfSlots)
+:
+mSlots(numberOfSlots),
+mPublishing(false),
+mPeriod(0),
+mLastPublished(NEVER),
+mLastAcquired(NEVER),
+mPublishedCount(0)
+{
+  this->setMaximumRate(30.0);
+}
+
+cedar::aux::DataSnapshotChannel::~DataSnapshotChannel()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+int64_t cedar::aux::DataSnapshotChannel::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>
+         (
+           std::chrono::steady_clock::now().time_since_epoch()
+         ).count();
+}
+
+void cedar::aux::DataSnapshotChannel::setMaximumRate(double rate)
+{
+  CEDAR_ASSERT(rate > 0.0);
+  this->mPeriod = static_cast<int64_t>(1e9 / rate);
+}
+
+double cedar::aux::DataSnapshotChannel::getMaximumRate() const
+{
+  return 1e9 / static_cast<double>(this->mPeriod.load());
+}
+
+unsigned long long cedar::aux::DataSnapshotChannel::getPublishedCount() const
+{
+  return this->mPublishedCount.load();
+}
+
+bool cedar::aux::DataSnapshotChannel::hasReaders() const
+{
+  int64_t last_acquired = this->mLastAcquired.load(std::memory_order_relaxed);
+  return last_acquired != NEVER && now() - last_acquired < READER_TIMEOUT;
+}
+
+bool cedar::aux::DataSnapshotChannel::isDue() const
+{
+  int64_t last_published = this->mLastPublished.load(std::memory_order_relaxed);
+  return last_published == NEVER || now() - last_published >= this->mPeriod.load(std::memory_order_relaxed);
+}
+
+bool cedar::aux::DataSnapshotChannel::publish
+(
+  unsigned long long version,
+  const std::function<bool(cv::Mat&, cedar::aux::annotation::Annotatable&)>& write
+)
+{
+  if (!this->hasReaders() || !this->isDue())
+  {
+    return false;
+  }
+
+  if (this->mPublishing.exchange(true))
+  {
+    // somebody else is publishing right now
+    return false;
+  }
+
+  // if all slots are pinned, the snapshot is skipped rather than waiting for a reader
+  int slot_index = this->mSlots.findFreeSlot();
+  Slot* p_slot = slot_index < 0 ? nullptr : &this->mSlots.at(slot_index);
+
+  bool written = false;
+  try
+  {
+    written = p_slot != nullptr && write(p_slot->mMatrix, p_slot->mAnnotations);
+  }
+  catch (...)
+  {
+    this->mPublishing.store(false);
+    throw;
+  }
+
+  bool published = false;
+  if (written)
+  {
+    p_slot->mVersion = version;
+    this->mSlots.makeNewest(slot_index);
+    this->mLastPublished.store(now(), std::memory_order_relaxed);
+    this->mPublishedCount.fetch_add(1, std::memory_order_relaxed);
+    published = true;
+  }
+
+  this->mPublishing.store(false);
+  return published;
+}
+
+cedar::aux::DataSnapshotChannel::Snapshot cedar::aux::DataSnapshotChannel::acquire() const
+{
+  this->mLastAcquired.store(now(), std::memory_order_relaxed);
+
+  int index = this->mSlots.pinNewest();
+  if (index < 0)
+  {
+    return Snapshot();
+  }
+  return Snapshot(&this->mSlots, index);
+}
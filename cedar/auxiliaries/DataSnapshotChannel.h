@@ -0,0 +1,231 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        DataSnapshotChannel.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Publishes copies of a data object so that readers do not have to lock it.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+#ifndef CEDAR_AUX_DATA_SNAPSHOT_CHANNEL_H
+#define CEDAR_AUX_DATA_SNAPSHOT_CHANNEL_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/annotation/Annotatable.h"
+#include "cedar/auxiliaries/NewestSlotPool.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/DataSnapshotChannel.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/core/core.hpp>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+
+/*!@brief Publishes copies (snapshots) of a data object into a small pool of buffers so that readers, e.g., plots, can
+ *        access the newest one without taking the lock of the data.
+ *
+ *        The buffers are kept in a cedar::aux::NewestSlotPool. The writer copies the data into a buffer that is neither
+ *        the newest one nor read by anybody and then makes it the newest one; readers pin the newest buffer while they
+ *        use it. Neither side ever waits for the other: if all buffers are pinned, the writer skips the snapshot.
+ *        Snapshots are only published while somebody reads them, and at most at the maximum rate of the channel.
+ *
+ *        Each data object owns a channel, see cedar::aux::Data::getSnapshot.
+ */
+class cedar::aux::DataSnapshotChannel
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! A buffer of the pool.
+  struct Slot
+  {
+    Slot()
+    :
+    mVersion(0)
+    {
+    }
+
+    cv::Mat mMatrix;
+    //! Copy of the annotations of the data, which may change along with the matrix (e.g., its dimensions).
+    cedar::aux::annotation::Annotatable mAnnotations;
+    unsigned long long mVersion;
+  };
+
+public:
+  /*!@brief A published snapshot. The buffer it refers to is not overwritten while the snapshot exists.
+   *
+   *        Snapshots should be short-lived, i.e., released as soon as the data has been converted. A snapshot must not
+   *        outlive its channel.
+   */
+  class Snapshot
+  {
+    friend class cedar::aux::DataSnapshotChannel;
+
+  public:
+    //! Creates an invalid snapshot.
+    Snapshot();
+
+    //! Moves the snapshot.
+    Snapshot(Snapshot&& other);
+
+    //! Moves the snapshot.
+    Snapshot& operator=(Snapshot&& other);
+
+    //! Releases the buffer.
+    ~Snapshot();
+
+    //! Returns false if no snapshot was available.
+    bool isValid() const
+    {
+      return this->mpSlots != nullptr;
+    }
+
+    //! The copy of the data. Must not be modified.
+    const cv::Mat& getMatrix() const;
+
+    //! The annotations the data had when the snapshot was taken.
+    const cedar::aux::annotation::Annotatable& getAnnotations() const;
+
+    //! The version the data had when the snapshot was taken, see cedar::aux::Data::getVersion.
+    unsigned long long getVersion() const;
+
+    //! Releases the buffer early; afterwards, the snapshot is invalid.
+    void release();
+
+  private:
+    Snapshot(const cedar::aux::NewestSlotPool<Slot>* pSlots, int index);
+
+    //! The slot the snapshot refers to.
+    const Slot& getSlot() const;
+
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+  private:
+    //! The pool in which the slot of this snapshot is pinned; null if the snapshot is invalid.
+    const cedar::aux::NewestSlotPool<Slot>* mpSlots;
+
+    //! Index of the pinned slot.
+    int mIndex;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  DataSnapshotChannel(unsigned int numberOfSlots = 3);
+
+  //!@brief Destructor
+  ~DataSnapshotChannel();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Publishes a snapshot by letting the given function write the data and its annotations into a buffer of the
+   *        pool.
+   *
+   *        Never blocks. Returns false without calling the function if nobody read a snapshot recently, the last
+   *        snapshot was published less than one period (the inverse of the maximum rate) ago, another thread is
+   *        currently publishing or all buffers are in use. The function itself may return false if it cannot represent
+   *        the data; the buffer is then not published.
+   *
+   * @param version The version of the data that is written.
+   * @param write   Writes the data into the given matrix and annotations; should reuse the memory of the matrix,
+   *                e.g., via cv::Mat::copyTo.
+   */
+  bool publish
+  (
+    unsigned long long version,
+    const std::function<bool(cv::Mat&, cedar::aux::annotation::Annotatable&)>& write
+  );
+
+  /*!@brief Returns the newest published snapshot. Never blocks.
+   *
+   *        The returned snapshot is invalid if none has been published yet.
+   */
+  Snapshot acquire() const;
+
+  //! True if no snapshot has been published for at least one period.
+  bool isDue() const;
+
+  //! True if a snapshot has been acquired recently, i.e., if publishing snapshots is worth its cost.
+  bool hasReaders() const;
+
+  //! Sets how often snapshots are published at most, in Hertz.
+  void setMaximumRate(double rate);
+
+  //! Returns how often snapshots are published at most, in Hertz.
+  double getMaximumRate() const;
+
+  //! Returns the number of snapshots that have been published.
+  unsigned long long getPublishedCount() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Current time in nanoseconds of a monotonic clock.
+  static int64_t now();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! The pool of buffers; there is no newest one until something has been published.
+  cedar::aux::NewestSlotPool<Slot> mSlots;
+
+  //! Set while a thread publishes; makes concurrent publishing calls skip instead of waiting.
+  std::atomic<bool> mPublishing;
+
+  //! Minimal time between two published snapshots, in nanoseconds.
+  std::atomic<int64_t> mPeriod;
+
+  //! Time of the last published snapshot.
+  std::atomic<int64_t> mLastPublished;
+
+  //! Time of the last acquired snapshot.
+  mutable std::atomic<int64_t> mLastAcquired;
+
+  //! Number of snapshots that have been published.
+  std::atomic<unsigned long long> mPublishedCount;
+
+}; // class cedar::aux::DataSnapshotChannel
+
+#endif // CEDAR_AUX_DATA_SNAPSHOT_CHANNEL_H
@@ -38,13 +38,19 @@
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/DataSpectator.h"
 #include "cedar/auxiliaries/Recorder.h"
+#include "cedar/auxiliaries/BinaryRecording.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/Log.h"
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/units/Time.h"
 
 #include <boost/regex.hpp>
 
 // SYSTEM INCLUDES
+#include <algorithm>
 
 #ifndef Q_MOC_RUN
   #include <boost/algorithm/string/replace.hpp>
@@ -59,15 +65,29 @@
 
 cedar::aux::DataSpectator::DataSpectator
 (
+  cedar::aux::Recorder* recorder,
   cedar::aux::ConstDataPtr toSpectate,
   cedar::unit::Time recordIntervall,
   const std::string& name
 )
 :
+mpRecorder(recorder),
+// the spectator's thread does not see the clock scopes of the registering thread, so the clock is fixed here
+mClock(cedar::aux::GlobalClockSingleton::getInstance()),
 mData(toSpectate),
 mpOfstreamLock(new QReadWriteLock()),
-mpQueueLock(new QReadWriteLock()),
-mName(name)
+mWriteIndex(0),
+mReadIndex(0),
+mDroppedFrames(0),
+mOverflows(0),
+mIsOverflowing(false),
+mCopyByCloning(false),
+mName(name),
+mMode(cedar::aux::SerializationFormat::CSV),
+mFrameCount(0),
+mAllocatedFrames(0),
+mHeaderSize(0),
+mFrameStride(0)
 {
   this->setStepSize(recordIntervall);
 
@@ -83,7 +103,6 @@ cedar::aux::DataSpectator::~DataSpectator()
     mOutputStream.close();
   }
   delete mpOfstreamLock;
-  delete mpQueueLock;
 }
 
 void cedar::aux::DataSpectator::step(cedar::unit::Time)
@@ -93,9 +112,23 @@ void cedar::aux::DataSpectator::step(cedar::unit::Time)
 
 void cedar::aux::DataSpectator::prepareStart()
 {
-  auto mode = cedar::aux::RecorderSingleton::getInstance()->getSerializationMode();
+  mMode = this->mpRecorder->getSerializationMode();
+  if
+  (
+    mMode == cedar::aux::SerializationFormat::Binary
+    && !boost::dynamic_pointer_cast<const cedar::aux::MatData>(mData)
+  )
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Only matrices can be recorded in the binary format; recording \"" + mName + "\" in the compact format instead.",
+      "cedar::aux::DataSpectator::prepareStart()"
+    );
+    mMode = cedar::aux::SerializationFormat::Compact;
+  }
+
   std::string extension;
-  switch (mode)
+  switch (mMode)
   {
     case cedar::aux::SerializationFormat::Compact:
       extension = "data";
@@ -104,100 +137,230 @@ void cedar::aux::DataSpectator::prepareStart()
     case cedar::aux::SerializationFormat::CSV:
       extension = "csv";
       break;
+
+    case cedar::aux::SerializationFormat::Binary:
+      extension = "bin";
+      break;
   }
 
   boost::regex re("[[:space:]/]");
 
-  mOutputPath = cedar::aux::RecorderSingleton::getInstance()->getOutputDirectory() + "/" +
+  mOutputPath = this->mpRecorder->getOutputDirectory() + "/" +
           boost::regex_replace(mName,re,"_") + "." + extension;
-  mOutputStream.open(mOutputPath, std::ios::out | std::ios::app);
-  writeHeader(mode);
+  if (mMode == cedar::aux::SerializationFormat::Binary)
+  {
+    // frames are written to fixed positions, so the file cannot be opened for appending
+    mOutputStream.open(mOutputPath, std::ios::out | std::ios::binary | std::ios::trunc);
+  }
+  else
+  {
+    mOutputStream.open(mOutputPath, std::ios::out | std::ios::app);
+  }
+  writeHeader();
+
+  this->allocateSlots(this->mpRecorder->getBufferSize());
+}
+
+void cedar::aux::DataSpectator::allocateSlots(unsigned int count)
+{
+  // the consumer may still be writing data of a previous recording
+  QWriteLocker locker(mpOfstreamLock);
+
+  count = std::max(count, 1u);
+  mSlots.clear();
+  mSlots.resize(count);
+  for (auto& slot : mSlots)
+  {
+    slot.mData = mData->clone();
+  }
+
+  // find out once whether values can be copied; otherwise, each sample has to be cloned
+  mCopyByCloning = false;
+  try
+  {
+    this->copyIntoSlot(mSlots.front());
+  }
+  catch (const cedar::aux::NotImplementedException&)
+  {
+    mCopyByCloning = true;
+  }
+
+  mWriteIndex = 0;
+  mReadIndex = 0;
+  mDroppedFrames = 0;
+  mOverflows = 0;
+  mIsOverflowing = false;
 }
 
 void cedar::aux::DataSpectator::processQuit()
 {
-  writeAllRecordData(cedar::aux::RecorderSingleton::getInstance()->getSerializationMode());
+  writeQueuedRecordData();
+
+  if (mDroppedFrames > 0)
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Dropped " + cedar::aux::toString(mDroppedFrames.load()) + " samples of \"" + mName + "\" because the "
+      "recording buffer was full (" + cedar::aux::toString(mOverflows.load()) + " overflows).",
+      "cedar::aux::DataSpectator::processQuit()"
+    );
+  }
   
   {
     QWriteLocker locker(mpOfstreamLock);
     mOutputStream.close();
+
+    // release the space that was allocated in advance but not used
+    if (mMode == cedar::aux::SerializationFormat::Binary && mAllocatedFrames > mFrameCount)
+    {
+      boost::filesystem::resize_file(mOutputPath, mHeaderSize + mFrameCount * mFrameStride);
+      mAllocatedFrames = mFrameCount;
+    }
   }
 }
 
-void cedar::aux::DataSpectator::writeHeader(cedar::aux::SerializationFormat::Id mode)
+void cedar::aux::DataSpectator::writeHeader()
 {
   QWriteLocker locker(mpOfstreamLock);
-  mData->serializeHeader(mOutputStream, mode);
-  mOutputStream << std::endl;
+  mData->serializeHeader(mOutputStream, mMode);
+
+  if (mMode == cedar::aux::SerializationFormat::Binary)
+  {
+    auto mat_data = boost::dynamic_pointer_cast<const cedar::aux::MatData>(mData);
+    QReadLocker data_locker(&mat_data->getLock());
+    auto header = cedar::aux::BinaryRecording::createHeader(mat_data->getData());
+    data_locker.unlock();
+
+    mHeaderSize = header.mHeaderSize;
+    mFrameStride = static_cast<size_t>(header.mFrameStride);
+    mFrameCount = 0;
+    mAllocatedFrames = 0;
+  }
+  else
+  {
+    mOutputStream << std::endl;
+  }
 }
 
 void cedar::aux::DataSpectator::record()
 {
-  // Copy the Data
-  cedar::aux::DataPtr data = mData->clone();
+  // thread context: the spectator's own thread, i.e., the only producer
+  uint64_t write_index = mWriteIndex.load(std::memory_order_relaxed);
+  if (write_index - mReadIndex.load(std::memory_order_acquire) >= mSlots.size())
+  {
+    ++mDroppedFrames;
+    if (!mIsOverflowing)
+    {
+      ++mOverflows;
+      mIsOverflowing = true;
+    }
+    return;
+  }
+  mIsOverflowing = false;
 
-  //Create new recordData
-  RecordData rec;
-  rec.mData = data;
-  rec.mRecordTime = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
-  //Lock the Queue and push record Data
-  QWriteLocker locker(mpQueueLock);
-  mDataQueue.push_back(rec);
+  RecordData& slot = mSlots[write_index % mSlots.size()];
+  this->copyIntoSlot(slot);
+  slot.mRecordTime = this->mClock->getTime();
+
+  // publish the slot to the consumer
+  mWriteIndex.store(write_index + 1, std::memory_order_release);
 }
 
-void cedar::aux::DataSpectator::writeFirstRecordData(cedar::aux::SerializationFormat::Id mode)
+void cedar::aux::DataSpectator::copyIntoSlot(RecordData& slot)
 {
-  // thread context: called from Recorder's thread.
-  /* This function uses a lot of locks. It is important to don't lock the queue during the serialization (takes 25-30ms)
-   * to not block the record function for pushing new RecordData into the queue.
-   */
-  unsigned int size;
+  if (mCopyByCloning)
+  {
+    slot.mData = mData->clone();
+  }
+  else if (auto mat_data = boost::dynamic_pointer_cast<const cedar::aux::MatData>(mData))
+  {
+    // copyTo reuses the memory of the slot's matrix as long as size and type stay the same
+    auto slot_data = boost::static_pointer_cast<cedar::aux::MatData>(slot.mData);
+    QReadLocker locker(&mat_data->getLock());
+    mat_data->getData().copyTo(slot_data->getData());
+  }
+  else
+  {
+    slot.mData->copyValueFrom(mData);
+  }
+}
 
+void cedar::aux::DataSpectator::writeQueuedRecordData()
+{
+  // thread context: called from Recorder's thread, and from the spectator's thread when it stops. Holding the lock of
+  // the output stream while taking data out of the ring ensures that there is only ever one consumer.
+  QWriteLocker locker(mpOfstreamLock);
+
+  uint64_t read_index = mReadIndex.load(std::memory_order_relaxed);
+  uint64_t write_index = mWriteIndex.load(std::memory_order_acquire);
+  if (read_index == write_index)
   {
-    QReadLocker locker(mpQueueLock);
-    size = mDataQueue.size();
+    return;
   }
 
-  if (size > 0)
+  for (; read_index != write_index; ++read_index)
   {
-    // Save data to disk.
-    RecordData data;
-    {
-      QWriteLocker locker(mpQueueLock);
-      data = mDataQueue.front();
-      mDataQueue.pop_front();
-    }
+    this->writeRecordData(mSlots[read_index % mSlots.size()]);
+    // hand the slot back to the producer
+    mReadIndex.store(read_index + 1, std::memory_order_release);
+  }
 
-    {
-      QWriteLocker locker(mpOfstreamLock);
-      mOutputStream << data.mRecordTime << ",";
-      data.mData->serializeData(mOutputStream, mode);
-      mOutputStream << std::endl;
-    }
+  if (mMode == cedar::aux::SerializationFormat::Binary)
+  {
+    this->updateBinaryFrameCount();
   }
 }
 
-void cedar::aux::DataSpectator::writeAllRecordData(cedar::aux::SerializationFormat::Id mode)
+void cedar::aux::DataSpectator::writeRecordData(const RecordData& data)
 {
-  // thread context: called from Recorder's thread.
-  // here a single lock is enough. No new recordData will be created so the list can be blocked.
+  if (mMode == cedar::aux::SerializationFormat::Binary)
+  {
+    this->writeBinaryFrame(data);
+  }
+  else
+  {
+    mOutputStream << data.mRecordTime << ",";
+    data.mData->serializeData(mOutputStream, mMode);
+    mOutputStream << std::endl;
+  }
+}
 
-  QWriteLocker locker(mpQueueLock);
+void cedar::aux::DataSpectator::writeBinaryFrame(const RecordData& data)
+{
+  auto mat_data = boost::static_pointer_cast<cedar::aux::MatData>(data.mData);
+  // all frames must have the same size; matrices that changed their size cannot be stored
+  if (cedar::aux::BinaryRecording::createHeader(mat_data->getData()).mFrameStride != mFrameStride)
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "The size of \"" + mName + "\" changed during recording; skipping frame in the binary recording.",
+      "cedar::aux::DataSpectator::writeBinaryFrame(const RecordData&)"
+    );
+    return;
+  }
 
-  while (mDataQueue.size() > 0)
+  // allocate space for further frames in advance, doubling the allocated space each time
+  if (mFrameCount == mAllocatedFrames)
   {
-    RecordData data;
-    data = mDataQueue.front();
+    mAllocatedFrames = std::max(static_cast<uint64_t>(1024), 2 * mAllocatedFrames);
+    mOutputStream.flush();
+    boost::filesystem::resize_file(mOutputPath, mHeaderSize + mAllocatedFrames * mFrameStride);
+  }
 
-    {
-      QWriteLocker locker(mpOfstreamLock);
-      mOutputStream << data.mRecordTime << ",";
-      data.mData->serializeData(mOutputStream, mode);
-      mOutputStream << std::endl;
-    }
-    mDataQueue.pop_front();
+  double time_stamp = data.mRecordTime / cedar::unit::seconds;
+  mOutputStream.seekp(static_cast<std::streamoff>(mHeaderSize + mFrameCount * mFrameStride));
+  mOutputStream.write(reinterpret_cast<const char*>(&time_stamp), sizeof(double));
+  mat_data->serializeData(mOutputStream, cedar::aux::SerializationFormat::Binary);
+  ++mFrameCount;
+}
 
-  }
+void cedar::aux::DataSpectator::updateBinaryFrameCount()
+{
+  // the frames have to be on disk before readers are told about them
+  mOutputStream.flush();
+  mOutputStream.seekp(static_cast<std::streamoff>(cedar::aux::BinaryRecording::getFrameCountOffset()));
+  mOutputStream.write(reinterpret_cast<const char*>(&mFrameCount), sizeof(uint64_t));
+  mOutputStream.flush();
 }
 
 
@@ -222,11 +385,21 @@ cedar::unit::Time cedar::aux::DataSpectator::getRecordIntervalTime() const
   return this->getStepSize();
 }
 
+uint64_t cedar::aux::DataSpectator::getDroppedFrameCount() const
+{
+  return this->mDroppedFrames;
+}
+
+uint64_t cedar::aux::DataSpectator::getOverflowCount() const
+{
+  return this->mOverflows;
+}
+
 void cedar::aux::DataSpectator::makeSnapshot()
 {
   // Create Directory
-  std::string project_name = cedar::aux::RecorderSingleton::getInstance()->getRecorderProjectName();
-  std::string time_stamp = cedar::aux::RecorderSingleton::getInstance()->getTimeStamp();
+  std::string project_name = this->mpRecorder->getRecorderProjectName();
+  std::string time_stamp = this->mpRecorder->getTimeStamp();
   std::string output_dir = cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory()
                            + "/"+project_name+"/Snapshots/snapshot_"+ time_stamp;
   boost::filesystem::create_directories(output_dir);
@@ -241,7 +414,7 @@ void cedar::aux::DataSpectator::makeSnapshot()
   output_stream.open(output_path, std::ios::out | std::ios::app);
   data->serializeHeader(output_stream);
   output_stream << std::endl;
-  output_stream << cedar::aux::GlobalClockSingleton::getInstance()->getTime() << ",";
+  output_stream << this->mClock->getTime() << ",";
   data->serializeData(output_stream);
   output_stream << std::endl;
   output_stream.close();
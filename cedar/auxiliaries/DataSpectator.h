@@ -46,16 +46,24 @@
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/DataSpectator.fwd.h"
 #include "cedar/auxiliaries/Recorder.fwd.h"
+#include "cedar/auxiliaries/GlobalClock.fwd.h"
 
 // SYSTEM INCLUDES
 #include <QTime>
 #include <string>
 #include <fstream>
-#include <list>
+#include <vector>
+#include <atomic>
+#include <cstdint>
 
 /*!@brief The Recorder uses this class to observe the registered DataPtr.
  *        This class copies the observed DataPtr in each time step and stores the copy in a queue together with time
  *        stamp. The recorder can access this queue and write the elements to disk.
+ *
+ *        The queue is a bounded ring of preallocated slots with a single producer (the spectator's thread) and a
+ *        single consumer (the thread writing to disk). Neither side takes a lock on it, and as long as the size of the
+ *        recorded data does not change, recording does not allocate memory. If the ring is full, new samples are
+ *        dropped and counted.
  */
 class cedar::aux::DataSpectator : public cedar::aux::LoopedThread
 {
@@ -72,7 +80,7 @@ class cedar::aux::DataSpectator : public cedar::aux::LoopedThread
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  //!@brief A data structure to store all the DataPtr with time stamp (in ms) in a list.
+  //!@brief A data structure to store a copy of the data together with its time stamp; used for the slots of the ring.
   struct RecordData
   {
     cedar::unit::Time mRecordTime;
@@ -87,8 +95,16 @@ public:
 private:
   /*!@brief The private Constructor. Can only called by friend classes such as cedar::aux::Recorder. name is a unique
    * name for this DataPtr, so a file with this name can be created in the output dictionary.
+   *
+   * The samples are stamped with the time of the clock that is current in the constructing thread.
    */
-  DataSpectator(cedar::aux::ConstDataPtr toSpectate, cedar::unit::Time recordInterval, const std::string& name);
+  DataSpectator
+  (
+    cedar::aux::Recorder* recorder,
+    cedar::aux::ConstDataPtr toSpectate,
+    cedar::unit::Time recordInterval,
+    const std::string& name
+  );
 
 
   //--------------------------------------------------------------------------------------------------------------------
@@ -110,6 +126,12 @@ public:
   //!@brief Makes a snapshot of the data.
   void makeSnapshot();
 
+  //!@brief Returns the number of samples that were discarded because the ring buffer was full.
+  uint64_t getDroppedFrameCount() const;
+
+  //!@brief Returns how often the ring buffer ran full, i.e., the number of uninterrupted sequences of dropped samples.
+  uint64_t getOverflowCount() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -124,17 +146,29 @@ private:
   void step(cedar::unit::Time time);
 
   //!@brief Writes the header for the DataPtr to the output file.
-  void writeHeader(cedar::aux::SerializationFormat::Id mode);
+  void writeHeader();
+
+  //!@brief Writes all RecordData that is currently in the ring buffer to the output file.
+  void writeQueuedRecordData();
 
-  //!@brief Writes the first element of the RecordData queue to the output file.
-  void writeFirstRecordData(cedar::aux::SerializationFormat::Id mode);
+  //!@brief Writes a single RecordData to the output file. The output stream must be locked.
+  void writeRecordData(const RecordData& data);
 
-  //!@brief Writes the whole RecordData queue to the output file.
-  void writeAllRecordData(cedar::aux::SerializationFormat::Id mode);
+  //!@brief Writes a frame of a binary recording, allocating more space in the file if necessary.
+  void writeBinaryFrame(const RecordData& data);
 
-  //!@brief Copies the DataPtr and stores it as new RecordData in the queue.
+  //!@brief Writes the number of frames into the header of a binary recording, so that readers can access them.
+  void updateBinaryFrameCount();
+
+  //!@brief Copies the DataPtr into the next free slot of the ring buffer.
   void record();
 
+  //!@brief Copies the value of the observed data into the given slot, reusing its memory where possible.
+  void copyIntoSlot(RecordData& slot);
+
+  //!@brief Allocates the slots of the ring buffer.
+  void allocateSlots(unsigned int count);
+
   //!@brief Starts the DataSpectator: Before starting the output file will be opened and the header be written.
   void prepareStart();
 
@@ -149,6 +183,12 @@ protected:
   // none yet
 
 private:
+  //!@brief The recorder owning this spectator; its settings determine where and how the data is written.
+  cedar::aux::Recorder* mpRecorder;
+
+  //!@brief The clock used for the time stamps of the samples.
+  cedar::aux::GlobalClockPtr mClock;
+
   //!@brief The pointer to the Data.
   cedar::aux::ConstDataPtr mData;
 
@@ -161,14 +201,42 @@ private:
   //!@brief The Lock for mOutputStream.
   QReadWriteLock* mpOfstreamLock;
 
-  //!@brief This queue will be write to disk every time step is called.
-  std::list<RecordData> mDataQueue;
+  //!@brief The slots of the ring buffer; they are allocated when recording starts.
+  std::vector<RecordData> mSlots;
+
+  //!@brief Number of samples written into the ring so far; only modified by the producer.
+  std::atomic<uint64_t> mWriteIndex;
 
-  //!@brief Locks mDataQueue.
-  QReadWriteLock* mpQueueLock;
+  //!@brief Number of samples taken out of the ring so far; only modified by the consumer.
+  std::atomic<uint64_t> mReadIndex;
+
+  //!@brief Number of samples dropped because the ring was full.
+  std::atomic<uint64_t> mDroppedFrames;
+
+  //!@brief Number of times the ring ran full.
+  std::atomic<uint64_t> mOverflows;
+
+  //!@brief Whether the last sample was dropped; used for counting overflows.
+  bool mIsOverflowing;
+
+  //!@brief True if the data does not support copyValueFrom, in which case it is cloned for every sample.
+  bool mCopyByCloning;
 
   //!@brief Unique name of the DataPtr.
   std::string mName;
+
+  //!@brief The format in which the data is written; determined when recording starts.
+  cedar::aux::SerializationFormat::Id mMode;
+
+  //!@brief Binary format only: The number of frames written to the file.
+  uint64_t mFrameCount;
+
+  //!@brief Binary format only: The number of frames for which space is allocated in the file.
+  uint64_t mAllocatedFrames;
+
+  //!@brief Binary format only: Size of the header and of each frame in bytes.
+  size_t mHeaderSize;
+  size_t mFrameStride;
 };
 
 #endif // CEDAR_AUX_DATASPECTATOR_H_
@@ -119,6 +119,7 @@ public:
   void setData(const T& data)
   {
     this->mData = data;
+    this->markChanged();
   }
 
   //! Copies the value in this data object from the given data.
@@ -101,6 +101,7 @@ public:
   void setData(double value)
   {
     this->Super::getData().at<double>(0, 0) = value;
+    this->markChanged();
   }
 
   //--------------------------------------------------------------------------------------------------------------------
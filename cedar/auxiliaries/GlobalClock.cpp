@@ -37,13 +37,21 @@
 //CEDAR INCLUDES
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/assert.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <limits>
+
 cedar::aux::GlobalClock::GlobalClock()
 :
 mpAccessLock(new QReadWriteLock()),
-mRunning(false)
+mRunning(false),
+mLockstep(false),
+mLockstepRunning(0),
+mLockstepHolds(0)
 {
   this->mGlobalTimeFactorConnection = cedar::aux::SettingsSingleton::getInstance()->connectToGlobalTimeFactorChangedSignal
   (
@@ -114,8 +122,15 @@ void cedar::aux::GlobalClock::start()
 
 void cedar::aux::GlobalClock::reset()
 {
+  QMutexLocker lockstep_locker(&this->mLockstepMutex);
   QWriteLocker w_locker(this->mpAccessLock);
 
+  // keep the relative schedule of threads running in lockstep
+  for (auto& thread : this->mLockstepThreads)
+  {
+    thread.second.mNextStepTime = std::max(0.0, thread.second.mNextStepTime - this->mAdditionalElapsedTime);
+  }
+
   this->mAdditionalElapsedTime = 0;
   this->mTimer.restart();
 }
@@ -146,7 +161,7 @@ cedar::unit::Time cedar::aux::GlobalClock::getTime() const
   QReadLocker locker(this->mpAccessLock);
   double time_msecs = this->mAdditionalElapsedTime;
 
-  if (this->mRunning)
+  if (this->mRunning && !this->mLockstep)
   {
     time_msecs += this->getCurrentElapsedMSec();
   }
@@ -154,5 +169,162 @@ cedar::unit::Time cedar::aux::GlobalClock::getTime() const
   return cedar::unit::Time(static_cast<double>(time_msecs) * cedar::unit::milli * cedar::unit::seconds);
 }
 
+void cedar::aux::GlobalClock::setLockstep(bool lockstep)
+{
+  QMutexLocker lockstep_locker(&this->mLockstepMutex);
+  QWriteLocker locker(this->mpAccessLock);
+  if (lockstep == this->mLockstep)
+  {
+    return;
+  }
+
+  // freeze (or resume from) the time measured so far
+  if (this->mRunning)
+  {
+    this->addCurrentToAdditionalElapsedTime();
+  }
+  this->mLockstep = lockstep;
+}
+
+bool cedar::aux::GlobalClock::isLockstep() const
+{
+  QReadLocker locker(this->mpAccessLock);
+  bool copy = this->mLockstep;
+  return copy;
+}
+
+void cedar::aux::GlobalClock::registerLockstepThread(const cedar::aux::LoopedThread* thread)
+{
+  QMutexLocker locker(&this->mLockstepMutex);
+
+  if (this->mLockstepThreads.find(thread) != this->mLockstepThreads.end())
+  {
+    return;
+  }
+
+  LockstepThread& entry = this->mLockstepThreads[thread];
+  entry.mNextStepTime = this->getTime() / (0.001 * cedar::unit::seconds);
+  entry.mStepSize = 0.0;
+  entry.mDue = false;
+}
+
+void cedar::aux::GlobalClock::unregisterLockstepThread(const cedar::aux::LoopedThread* thread)
+{
+  QMutexLocker locker(&this->mLockstepMutex);
+
+  auto iter = this->mLockstepThreads.find(thread);
+  if (iter == this->mLockstepThreads.end())
+  {
+    return;
+  }
+
+  // a thread that was released but did not step must not hold up the others
+  if (iter->second.mDue)
+  {
+    --this->mLockstepRunning;
+  }
+  this->mLockstepThreads.erase(iter);
+
+  if (this->mLockstepRunning == 0)
+  {
+    this->scheduleNextLockstepStep();
+  }
+}
+
+bool cedar::aux::GlobalClock::waitForLockstepTurn
+(
+  const cedar::aux::LoopedThread* thread,
+  const cedar::unit::Time& stepSize,
+  const boost::function<bool()>& stopRequested
+)
+{
+  QMutexLocker locker(&this->mLockstepMutex);
+
+  auto iter = this->mLockstepThreads.find(thread);
+  CEDAR_DEBUG_ASSERT(iter != this->mLockstepThreads.end());
+  iter->second.mStepSize = stepSize / (0.001 * cedar::unit::seconds);
+
+  if (this->mLockstepRunning == 0)
+  {
+    this->scheduleNextLockstepStep();
+  }
+
+  while (!iter->second.mDue)
+  {
+    // wake up regularly to check whether the thread should stop
+    this->mLockstepCondition.wait(&this->mLockstepMutex, 10);
+    if (!iter->second.mDue && stopRequested())
+    {
+      return false;
+    }
+  }
+  return true;
+}
 
+void cedar::aux::GlobalClock::finishLockstepStep(const cedar::aux::LoopedThread* thread)
+{
+  QMutexLocker locker(&this->mLockstepMutex);
+
+  auto iter = this->mLockstepThreads.find(thread);
+  CEDAR_DEBUG_ASSERT(iter != this->mLockstepThreads.end());
+  CEDAR_DEBUG_ASSERT(iter->second.mDue);
+
+  iter->second.mDue = false;
+  iter->second.mNextStepTime += iter->second.mStepSize;
+  --this->mLockstepRunning;
+
+  if (this->mLockstepRunning == 0)
+  {
+    this->scheduleNextLockstepStep();
+  }
+}
+
+void cedar::aux::GlobalClock::holdLockstep()
+{
+  QMutexLocker locker(&this->mLockstepMutex);
+  ++this->mLockstepHolds;
+}
 
+void cedar::aux::GlobalClock::releaseLockstep()
+{
+  QMutexLocker locker(&this->mLockstepMutex);
+  CEDAR_ASSERT(this->mLockstepHolds > 0);
+  --this->mLockstepHolds;
+
+  if (this->mLockstepRunning == 0)
+  {
+    this->scheduleNextLockstepStep();
+  }
+}
+
+void cedar::aux::GlobalClock::scheduleNextLockstepStep()
+{
+  if (this->mLockstepThreads.empty() || this->mLockstepHolds > 0)
+  {
+    return;
+  }
+
+  double next_time = std::numeric_limits<double>::max();
+  for (const auto& thread : this->mLockstepThreads)
+  {
+    next_time = std::min(next_time, thread.second.mNextStepTime);
+  }
+
+  // advance the clock; it never runs backwards, e.g., when a thread joins after time was added manually
+  {
+    QWriteLocker locker(this->mpAccessLock);
+    this->mAdditionalElapsedTime = std::max(this->mAdditionalElapsedTime, next_time);
+  }
+
+  // release all threads whose step begins at this time; tolerate rounding in the accumulated step times
+  const double tolerance = 1e-9;
+  for (auto& thread : this->mLockstepThreads)
+  {
+    if (thread.second.mNextStepTime <= next_time + tolerance)
+    {
+      thread.second.mDue = true;
+      ++this->mLockstepRunning;
+    }
+  }
+  this->mLockstepCondition.wakeAll();
+}
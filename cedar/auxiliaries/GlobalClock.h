@@ -42,17 +42,44 @@
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/GlobalClock.fwd.h"
+#include "cedar/auxiliaries/LoopedThread.fwd.h"
 
 // SYSTEM INCLUDES
 #include <QTime>
 #ifndef Q_MOC_RUN
   #include <boost/signals2.hpp>
+  #include <boost/function.hpp>
 #endif // Q_MOC_RUN
 #include <QReadWriteLock>
-
-//!@brief Can start, stop and reset the network time and should be used as a central time giver in a network.
+#include <QMutex>
+#include <QWaitCondition>
+#include <map>
+
+/*!@brief Can start, stop and reset the network time and should be used as a central time giver in a network.
+ *
+ *        In lockstep mode, the clock acts as a discrete-event scheduler for all looped threads running in the
+ *        simulated loop mode: simulated time only advances once every thread due at the current time has finished its
+ *        step, and the threads due next are then released immediately, without sleeping. Threads with different step
+ *        sizes thus stay synchronized, and runs are as fast as the steps can be computed.
+ */
 class cedar::aux::GlobalClock
 {
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Scheduling information for a thread running in lockstep.
+  struct LockstepThread
+  {
+    //! Simulated time (in ms) at which the thread's next step begins.
+    double mNextStepTime;
+
+    //! Duration of the thread's current step in ms.
+    double mStepSize;
+
+    //! Whether the thread may run (or is running) its step for the current time.
+    bool mDue;
+  };
 
   //--------------------------------------------------------------------------------------------------------------------
   // friends
@@ -93,6 +120,50 @@ public:
   //! Adds the given amount of time to the global clock.
   void addTime(const cedar::unit::Time& time);
 
+  /*!@brief Enables or disables lockstep mode.
+   *
+   *        While in lockstep mode, the time returned by getTime only advances through the scheduling of looped threads
+   *        (or through addTime), not with the wall clock. Threads decide whether to take part in lockstep scheduling
+   *        when they start, so this should only be changed while no looped threads are running.
+   */
+  void setLockstep(bool lockstep);
+
+  //! Returns true if the clock is in lockstep mode.
+  bool isLockstep() const;
+
+  /*!@brief Adds a thread to the lockstep schedule; its first step begins at the current time.
+   *
+   *        Does nothing if the thread is already in the schedule.
+   */
+  void registerLockstepThread(const cedar::aux::LoopedThread* thread);
+
+  //! Removes a thread from the lockstep schedule.
+  void unregisterLockstepThread(const cedar::aux::LoopedThread* thread);
+
+  /*!@brief Blocks until the given thread may run its next step of the given size.
+   *
+   * @returns false, if stopRequested returned true while waiting; in this case, the thread must not step.
+   */
+  bool waitForLockstepTurn
+  (
+    const cedar::aux::LoopedThread* thread,
+    const cedar::unit::Time& stepSize,
+    const boost::function<bool()>& stopRequested
+  );
+
+  //! Tells the scheduler that the given thread has finished the step it was waiting for.
+  void finishLockstepStep(const cedar::aux::LoopedThread* thread);
+
+  /*!@brief Keeps the lockstep schedule from releasing any thread until releaseLockstep is called as often as this.
+   *
+   *        This is used as a start barrier: threads started while the schedule is held all take their first step
+   *        together, rather than the first one running ahead before the others have been registered.
+   */
+  void holdLockstep();
+
+  //! Undoes one call to holdLockstep; releases the threads that are due once no more holds are left.
+  void releaseLockstep();
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -104,6 +175,9 @@ private:
 
   double getCurrentElapsedMSec() const;
 
+  //! Advances the time to the next scheduled step and releases all threads due then. mpLockstepMutex must be locked.
+  void scheduleNextLockstepStep();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -129,6 +203,24 @@ private:
 
   //! Connected to the change signal of the global time factor.
   boost::signals2::scoped_connection mGlobalTimeFactorConnection;
+
+  //! Whether the clock is in lockstep mode.
+  bool mLockstep;
+
+  //! Guards the lockstep schedule. When both are needed, this is locked before mpAccessLock.
+  QMutex mLockstepMutex;
+
+  //! Used for waking up threads whose turn has come.
+  QWaitCondition mLockstepCondition;
+
+  //! All threads taking part in lockstep scheduling.
+  std::map<const cedar::aux::LoopedThread*, LockstepThread> mLockstepThreads;
+
+  //! Number of threads that are due but have not finished their step yet.
+  unsigned int mLockstepRunning;
+
+  //! Number of holds on the lockstep schedule, see holdLockstep.
+  unsigned int mLockstepHolds;
 };
 
 #include "cedar/auxiliaries/Singleton.h"
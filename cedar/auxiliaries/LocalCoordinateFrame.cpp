@@ -41,6 +41,7 @@
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/math/screwCalculus.h"
 #include "cedar/auxiliaries/assert.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/units/Length.h"
 #include "cedar/units/PlaneAngle.h"
 
@@ -48,6 +49,7 @@
 #include <opencv2/opencv.hpp>
 #include <QReadLocker>
 #include <QWriteLocker>
+#include <algorithm>
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -146,7 +148,33 @@ cv::Mat cedar::aux::LocalCoordinateFrame::getTransformation() const
 void cedar::aux::LocalCoordinateFrame::setTransformation(cv::Mat transformation)
 {
   QWriteLocker locker(&mLock);
-  mTransformation = transformation;
+  // copy, so the transformation never shares memory with the caller's matrix (it is modified in place elsewhere)
+  transformation.copyTo(mTransformation);
+}
+
+void cedar::aux::LocalCoordinateFrame::getTransformation(cv::Matx<float, 4, 4>& result) const
+{
+  QReadLocker locker(&mLock);
+  // setTransformation(cv::Mat) takes over the type of its argument, so this is not guaranteed
+  if (mTransformation.type() != CV_32F || mTransformation.rows != 4 || mTransformation.cols != 4)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::TypeMismatchException,
+      "The transformation is not a 4x4 matrix of type CV_32F, so it cannot be read into a cv::Matx<float, 4, 4>."
+    );
+  }
+  CEDAR_DEBUG_ASSERT(mTransformation.isContinuous());
+  const float* data = mTransformation.ptr<float>();
+  std::copy(data, data + 16, result.val);
+}
+
+void cedar::aux::LocalCoordinateFrame::setTransformation(const cv::Matx<float, 4, 4>& transformation)
+{
+  QWriteLocker locker(&mLock);
+  // only allocates if the matrix was replaced by one of another type or size
+  mTransformation.create(4, 4, CV_32F);
+  std::copy(transformation.val, transformation.val + 16, mTransformation.ptr<float>());
 }
 
 void cedar::aux::LocalCoordinateFrame::update()
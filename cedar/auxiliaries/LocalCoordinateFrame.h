@@ -115,6 +115,17 @@ public:
    */
   void setTransformation(cv::Mat transformation);
 
+  /*!@brief writes the transformation matrix into a fixed-size matrix, without allocating memory
+   * @param result \f$4 \times 4\f$ rigid transformation matrix of the object frame relative to the world frame
+   * @throws cedar::aux::TypeMismatchException if the transformation was set to a matrix that is not 4x4 CV_32F
+   */
+  void getTransformation(cv::Matx<float, 4, 4>& result) const;
+
+  /*!@brief sets the transformation matrix from a fixed-size matrix, without allocating memory
+   * @param transformation \f$4 \times 4\f$ rigid transformation matrix of the object frame relative to the world frame
+   */
+  void setTransformation(const cv::Matx<float, 4, 4>& transformation);
+
 public slots:
   //!@brief updates the model
   virtual void update();
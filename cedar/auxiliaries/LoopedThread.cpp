@@ -36,6 +36,7 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/LoopedThread.h"
+#include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/auxiliaries/Log.h"
 #include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/units/Time.h"
@@ -207,6 +208,7 @@ void cedar::aux::LoopedThread::init()
 
   mStartConnection = this->connectToStartSignal(boost::bind(&cedar::aux::LoopedThread::makeParametersConst, this, true));
   mStopConnection = this->connectToStopSignal(boost::bind(&cedar::aux::LoopedThread::makeParametersConst, this, false));
+  mLockstepConnection = this->connectToStartSignal(boost::bind(&cedar::aux::LoopedThread::joinLockstep, this));
 }
 
 cedar::aux::LoopedThread::~LoopedThread()
@@ -325,6 +327,23 @@ void cedar::aux::LoopedThread::singleStep()
 void cedar::aux::LoopedThread::processStop()
 {
   stopStatistics();
+
+  // the worker leaves the schedule itself, but not if it was stopped before it got to run
+  cedar::aux::GlobalClockSingleton::getInstance()->unregisterLockstepThread(this);
+}
+
+bool cedar::aux::LoopedThread::isInLockstep() const
+{
+  return this->getLoopModeParameter() == cedar::aux::LoopMode::Simulated
+         && cedar::aux::GlobalClockSingleton::getInstance()->isLockstep();
+}
+
+void cedar::aux::LoopedThread::joinLockstep()
+{
+  if (this->isInLockstep())
+  {
+    cedar::aux::GlobalClockSingleton::getInstance()->registerLockstepThread(this);
+  }
 }
 
 void cedar::aux::LoopedThread::setStepSize(cedar::unit::Time stepSize)
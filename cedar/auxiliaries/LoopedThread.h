@@ -335,6 +335,9 @@ public:
 
   double getNumberOfStepsMissed() const;
 
+  //! True if the steps of this thread are scheduled by the lockstep mode of the global clock.
+  bool isInLockstep() const;
+
   inline void setDebugMe(bool b)
   {
     CEDAR_ASSERT(mpWorker != NULL);
@@ -372,6 +375,12 @@ private:
   //! Called when the thread is started and stopped; marks some parameters that cannot be changed at runtime const.
   void makeParametersConst(bool makeConst);
 
+  /*!@brief Called when the thread is started; adds it to the lockstep schedule if it takes part in it.
+   *
+   *        This happens in the starting thread, so threads started together are all scheduled before any of them runs.
+   */
+  void joinLockstep();
+
 private slots:
   void modeChanged();
   //----------------------------------------------------------------------------
@@ -385,6 +394,7 @@ private:
 
   boost::signals2::scoped_connection mStartConnection;
   boost::signals2::scoped_connection mStopConnection;
+  boost::signals2::scoped_connection mLockstepConnection;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
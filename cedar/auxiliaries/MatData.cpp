@@ -39,6 +39,7 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/BinaryRecording.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/stringFunctions.h"
 
@@ -144,13 +145,30 @@ std::string cedar::aux::MatData::getDescription() const
 void cedar::aux::MatData::serialize(std::ostream& stream, cedar::aux::SerializationFormat::Id mode) const
 {
   this->serializeHeader(stream, mode);
-  stream << std::endl;
+  // the binary header has a fixed size, it is not terminated by a line break
+  if (mode != cedar::aux::SerializationFormat::Binary)
+  {
+    stream << std::endl;
+  }
   this->serializeData(stream, mode);
 }
 
 void cedar::aux::MatData::deserialize(std::istream& stream, cedar::aux::SerializationFormat::Id mode)
 {
   //!@todo The serialization mode should be deduced from the header, no need to pass it here.
+  if (mode == cedar::aux::SerializationFormat::Binary)
+  {
+    cedar::aux::BinaryRecording::Header header = cedar::aux::BinaryRecording::readHeader(stream);
+    cv::Mat mat(static_cast<int>(header.mDimensionality), header.mSizes, header.mMatrixType);
+    stream.read(reinterpret_cast<char*>(mat.data), cedar::aux::BinaryRecording::getDataSize(header));
+    CEDAR_ASSERT(!stream.fail());
+    stream.ignore(cedar::aux::BinaryRecording::getPaddingSize(header));
+
+    QWriteLocker locker(this->mpLock);
+    this->setData(mat);
+    return;
+  }
+
   // read header
   std::string header;
   std::getline(stream, header);
@@ -340,13 +358,18 @@ void cedar::aux::MatData::serializeData(std::ostream& stream, cedar::aux::Serial
     {
       // we can only handle matrices that are continuous, i.e., those, that are written linearly in memory
       CEDAR_ASSERT(this->mData.isContinuous());
-      // create a string buffer that will hold the binary representation of all elements
-      std::string buffer(this->mData.elemSize() * this->mData.total(), '\0');
-      for (size_t i = 0; i < mData.total() * this->mData.elemSize(); ++i)
-      {
-        buffer[i] = this->mData.data[i];
-      }
-      stream.write(buffer.c_str(), buffer.size());
+      stream.write(reinterpret_cast<const char*>(this->mData.data), this->mData.elemSize() * this->mData.total());
+      break;
+    }
+
+    case cedar::aux::SerializationFormat::Binary:
+    {
+      // raw data, padded so that the next frame of a recording starts at an aligned address
+      CEDAR_ASSERT(this->mData.isContinuous());
+      stream.write(reinterpret_cast<const char*>(this->mData.data), this->mData.elemSize() * this->mData.total());
+      static const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+      auto header = cedar::aux::BinaryRecording::createHeader(this->mData);
+      stream.write(padding, cedar::aux::BinaryRecording::getPaddingSize(header));
       break;
     }
   }
@@ -357,6 +380,12 @@ void cedar::aux::MatData::serializeHeader(std::ostream& stream, cedar::aux::Seri
 {
   //!@todo When any non-default serialization mode is used, this should probably be indicated in the header. Replace Mat by, e.g., CompactMat?
   QReadLocker locker(this->mpLock);
+  if (mode == cedar::aux::SerializationFormat::Binary)
+  {
+    cedar::aux::BinaryRecording::writeHeader(stream, this->mData);
+    return;
+  }
+
   stream << "Mat" << ",";
   stream << cedar::aux::math::matrixTypeToString(mData) << ",";
   for(int i =0; i < mData.dims;i++)
@@ -386,3 +415,10 @@ unsigned int cedar::aux::MatData::getDimensionality() const
 {
   return cedar::aux::math::getDimensionalityOf(this->mData);
 }
+
+bool cedar::aux::MatData::writeSnapshot(cv::Mat& snapshot) const
+{
+  // copyTo only reallocates the snapshot if the size or type of the matrix changed
+  this->mData.copyTo(snapshot);
+  return true;
+}
@@ -138,7 +138,8 @@ public:
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  // none yet
+  //! Copies the matrix into the snapshot.
+  bool writeSnapshot(cv::Mat& snapshot) const;
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
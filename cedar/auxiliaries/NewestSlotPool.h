@@ -0,0 +1,266 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        NewestSlotPool.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: A pool of slots through which writers hand the newest value to readers without locking.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_NEWEST_SLOT_POOL_H
+#define CEDAR_AUX_NEWEST_SLOT_POOL_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/assert.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/NewestSlotPool.fwd.h"
+
+// SYSTEM INCLUDES
+#include <atomic>
+#include <memory>
+#include <thread>
+
+
+/*!@brief A small pool of slots through which a writer hands the newest value of something to its readers without either
+ *        side taking a lock.
+ *
+ *        The writer fills a slot that is neither the newest one nor pinned by a reader (see findFreeSlot) and then
+ *        makes it the newest one (see makeNewest). Readers pin the newest slot while they use it (see pinNewest and
+ *        readNewest). A reader re-checks that the slot it pinned is still the newest one and otherwise lets go of it
+ *        and starts over; as all of this is sequentially consistent, a reader can never pin a slot after the writer
+ *        has chosen it and still use it. Readers are thus lock-free, but not wait-free: a steady stream of writes can
+ *        make a reader start over again and again.
+ *
+ *        Besides the newest slot, only slots whose readers pinned them while they were the newest (and still use them)
+ *        or that readers are just letting go of can be pinned. With at least three slots, there is a free one unless
+ *        more readers than there are spare slots are still using older values.
+ *
+ *        The pool does not serialize writers; there must only be one at a time, e.g., by means of a lock that only
+ *        writers take. Used by cedar::aux::DataSnapshotChannel, cedar::dev::SampleExchange and
+ *        cedar::dev::sensors::visual::FramePool.
+ */
+template <typename T>
+class cedar::aux::NewestSlotPool
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! A slot of the pool.
+  struct Slot
+  {
+    Slot()
+    :
+    mReaders(0)
+    {
+    }
+
+    T mValue;
+
+    //! Number of readers currently pinning this slot; the writer only reuses slots without readers.
+    std::atomic<unsigned int> mReaders;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor. Initially, there is no newest slot.
+  NewestSlotPool(unsigned int numberOfSlots = 3)
+  :
+  mSlots(new Slot[numberOfSlots]),
+  mNumberOfSlots(numberOfSlots),
+  mNewest(-1)
+  {
+    // besides the newest slot, there has to be one to write into even while a reader is still backing off another one
+    CEDAR_ASSERT(numberOfSlots >= 3);
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Returns the number of slots.
+  unsigned int getNumberOfSlots() const
+  {
+    return this->mNumberOfSlots;
+  }
+
+  /*!@brief Returns the value of the given slot.
+   *
+   *        Readers must only access slots they pinned; the writer may access the newest slot and the slot it writes.
+   */
+  T& at(int index)
+  {
+    CEDAR_DEBUG_ASSERT(index >= 0 && static_cast<unsigned int>(index) < this->mNumberOfSlots);
+    return this->mSlots[index].mValue;
+  }
+
+  //! Returns the value of the given slot; see the non-const version.
+  const T& at(int index) const
+  {
+    CEDAR_DEBUG_ASSERT(index >= 0 && static_cast<unsigned int>(index) < this->mNumberOfSlots);
+    return this->mSlots[index].mValue;
+  }
+
+  //! Returns the index of the newest slot, -1 if there is none.
+  int getNewest() const
+  {
+    return this->mNewest.load();
+  }
+
+  //! True if the writer may write into the given slot, i.e., if it is neither the newest one nor pinned by a reader.
+  bool isFree(int index) const
+  {
+    return index != this->mNewest.load() && this->mSlots[index].mReaders.load() == 0;
+  }
+
+  //! Returns the index of a slot the writer may write into, -1 if all slots are in use right now. Never blocks.
+  int findFreeSlot() const
+  {
+    for (unsigned int i = 0; i < this->mNumberOfSlots; ++i)
+    {
+      if (this->isFree(static_cast<int>(i)))
+      {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  }
+
+  /*!@brief Returns the index of a slot the writer may write into, waiting for one if necessary.
+   *
+   *        All slots are only in use while readers that pinned older values still use them. Thus, the wait lasts at
+   *        most as long as the readers take to use a value; the thread yields between two attempts.
+   */
+  int waitForFreeSlot() const
+  {
+    int index = this->findFreeSlot();
+    while (index < 0)
+    {
+      std::this_thread::yield();
+      index = this->findFreeSlot();
+    }
+    return index;
+  }
+
+  //! Makes the given slot the newest one; -1 means that there is no newest slot until the next call.
+  void makeNewest(int index)
+  {
+    CEDAR_DEBUG_ASSERT(index >= -1 && index < static_cast<int>(this->mNumberOfSlots));
+    this->mNewest.store(index);
+  }
+
+  /*!@brief Pins the newest slot and returns its index, -1 if there is none. Never takes a lock.
+   *
+   *        The slot is not written while it is pinned; every call must be matched by a call to unpin.
+   */
+  int pinNewest() const
+  {
+    while (true)
+    {
+      int newest = this->mNewest.load();
+      if (newest < 0)
+      {
+        return -1;
+      }
+
+      Slot& slot = this->mSlots[newest];
+      slot.mReaders.fetch_add(1);
+      if (this->mNewest.load() == newest)
+      {
+        return newest;
+      }
+
+      // the writer made another slot the newest in the meantime and may be about to overwrite this one
+      slot.mReaders.fetch_sub(1);
+    }
+  }
+
+  //! Releases a slot pinned by pinNewest.
+  void unpin(int index) const
+  {
+    CEDAR_DEBUG_ASSERT(index >= 0 && static_cast<unsigned int>(index) < this->mNumberOfSlots);
+    this->mSlots[index].mReaders.fetch_sub(1);
+  }
+
+  /*!@brief Calls the function with the value of the newest slot, which is pinned during the call.
+   *
+   * @returns False, without calling the function, if there is no newest slot.
+   */
+  template <typename Function>
+  bool readNewest(Function function) const
+  {
+    int index = this->pinNewest();
+    if (index < 0)
+    {
+      return false;
+    }
+
+    try
+    {
+      function(static_cast<const T&>(this->mSlots[index].mValue));
+    }
+    catch (...)
+    {
+      this->unpin(index);
+      throw;
+    }
+    this->unpin(index);
+    return true;
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  NewestSlotPool(const NewestSlotPool&);
+  NewestSlotPool& operator=(const NewestSlotPool&);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! The slots of the pool.
+  std::unique_ptr<Slot[]> mSlots;
+
+  //! Number of slots.
+  unsigned int mNumberOfSlots;
+
+  //! Index of the newest slot, -1 if there is none.
+  std::atomic<int> mNewest;
+
+}; // class cedar::aux::NewestSlotPool
+
+#endif // CEDAR_AUX_NEWEST_SLOT_POOL_H
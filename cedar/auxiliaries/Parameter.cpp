@@ -50,6 +50,11 @@
 #include <QReadLocker>
 #include <QWriteLocker>
 
+namespace
+{
+  //! Source of the parameter versions; shared so that versions of different parameters can be compared.
+  std::atomic<unsigned long long> parameter_version_counter(0);
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -65,7 +70,8 @@ mChanged(false),
 mAdvanced(false),
 mIsLinked(false),
 mLastLockType(cedar::aux::LOCK_TYPE_DONT_LOCK),
-mpLock(new QReadWriteLock())
+mpLock(new QReadWriteLock()),
+mVersion(0)
 {
   this->setName(name);
 
@@ -242,6 +248,7 @@ void cedar::aux::Parameter::setChangedFlag(bool changed)
 
 void cedar::aux::Parameter::emitChangedSignal()
 {
+  this->mVersion.store(++parameter_version_counter, std::memory_order_release);
   this->setChangedFlag(true);
   emit valueChanged();
 }
@@ -55,6 +55,7 @@
 // SYSTEM INCLUDES
 #include <QObject>
 #include <QReadWriteLock>
+#include <atomic>
 #include <set>
 #include <string>
 
@@ -221,6 +222,16 @@ public:
   //!@brief emit the property changed signal
   void emitPropertyChangedSignal();
 
+  /*!@brief Returns the version of the parameter's value.
+   *
+   *        Versions are drawn from a counter shared by all parameters and increase whenever emitChangedSignal is
+   *        called, so a later change of any parameter always results in a larger version.
+   */
+  unsigned long long getVersion() const
+  {
+    return this->mVersion.load(std::memory_order_acquire);
+  }
+
   //!@brief Returns the value of the @em mChanged flag.
   bool isChanged() const
   {
@@ -391,6 +402,9 @@ private:
   //! Lock for the parameter.
   mutable QReadWriteLock* mpLock;
 
+  //! Version of the parameter's value, see getVersion.
+  std::atomic<unsigned long long> mVersion;
+
 }; // class cedar::aux::Parameter
 
 
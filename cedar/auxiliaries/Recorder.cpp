@@ -38,6 +38,7 @@
 
 #include "cedar/auxiliaries/Recorder.h"
 #include "cedar/auxiliaries/assert.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/ThreadWrapper.h"
 #include "cedar/auxiliaries/Settings.h"
 #include "cedar/units/Time.h"
@@ -62,7 +63,8 @@
 cedar::aux::Recorder::Recorder()
 :
 mpListLock(new QReadWriteLock()),
-mSubFolder("recording_#T#")
+mSubFolder("recording_#T#"),
+mBufferSize(64)
 {
   mProjectName = "Unnamed";
 
@@ -95,13 +97,52 @@ void cedar::aux::Recorder::setSerializationMode(cedar::aux::SerializationFormat:
 
 void cedar::aux::Recorder::step(cedar::unit::Time)
 {
-  auto mode = this->getSerializationMode();
-
-  // Writing the first value of every DataSpectator queue.
+  // Writing everything that is queued in the DataSpectators' buffers.
   for (auto data_spectator : mDataSpectators)
   {
-    boost::static_pointer_cast<cedar::aux::DataSpectator>(data_spectator.second)->writeFirstRecordData(mode);
+    boost::static_pointer_cast<cedar::aux::DataSpectator>(data_spectator.second)->writeQueuedRecordData();
+  }
+}
+
+unsigned int cedar::aux::Recorder::getBufferSize() const
+{
+  return this->mBufferSize;
+}
+
+void cedar::aux::Recorder::setBufferSize(unsigned int frames)
+{
+  // throw exception if running
+  if (this->isRunningNolocking())
+  {
+    CEDAR_THROW(cedar::aux::RecorderException, "Cannot change the buffer size while recorder is running");
+  }
+  if (frames == 0)
+  {
+    CEDAR_THROW(cedar::aux::RangeException, "The buffer of the recorder must hold at least one sample.");
+  }
+  this->mBufferSize = frames;
+}
+
+uint64_t cedar::aux::Recorder::getDroppedFrameCount(const std::string& name) const
+{
+  QReadLocker locker(mpListLock);
+  auto it = mDataSpectators.find(name);
+  if (it == mDataSpectators.end())
+  {
+    CEDAR_THROW(cedar::aux::NotFoundException, "No data of name \"" + name + "\" registered.");
+  }
+  return it->second->getDroppedFrameCount();
+}
+
+uint64_t cedar::aux::Recorder::getOverflowCount(const std::string& name) const
+{
+  QReadLocker locker(mpListLock);
+  auto it = mDataSpectators.find(name);
+  if (it == mDataSpectators.end())
+  {
+    CEDAR_THROW(cedar::aux::NotFoundException, "No data of name \"" + name + "\" registered.");
   }
+  return it->second->getOverflowCount();
 }
 
 bool cedar::aux::Recorder::hasDataToRecord() const
@@ -120,7 +161,7 @@ void cedar::aux::Recorder::registerData(cedar::aux::ConstDataPtr toSpectate, ced
   }
 
   // create new DataSpectator and push it to the DataSpectator list
-  cedar::aux::DataSpectatorPtr spec(new cedar::aux::DataSpectator(toSpectate, recordInterval, name));
+  cedar::aux::DataSpectatorPtr spec(new cedar::aux::DataSpectator(this, toSpectate, recordInterval, name));
   QWriteLocker locker(mpListLock);
   if (mDataSpectators.find(name) != mDataSpectators.end())
   {
@@ -167,6 +167,25 @@ public:
   //! Sets the serialization mode for writing data.
   void setSerializationMode(cedar::aux::SerializationFormat::Id mode);
 
+  //! Returns the number of samples each DataSpectator can hold before they are written to disk.
+  unsigned int getBufferSize() const;
+
+  /*!@brief Sets the number of samples each DataSpectator can hold before they are written to disk.
+   *
+   *        The buffers are allocated when recording starts. Samples that arrive while a buffer is full are dropped.
+   */
+  void setBufferSize(unsigned int frames);
+
+  /*!@brief Returns the number of samples of the data 'name' that were dropped because its buffer was full.
+   *          If 'name' is not registered it will throw a NotFoundException.
+   */
+  uint64_t getDroppedFrameCount(const std::string& name) const;
+
+  /*!@brief Returns how often the buffer of the data 'name' ran full during the last recording.
+   *          If 'name' is not registered it will throw a NotFoundException.
+   */
+  uint64_t getOverflowCount(const std::string& name) const;
+
 signals:
   //! Emitted whenver data is added or removed.
   void recordedDataChanged();
@@ -219,6 +238,9 @@ private:
   std::string mProjectName;
 
   std::string mSubFolder;
+
+  //!@brief The number of samples each DataSpectator can buffer.
+  unsigned int mBufferSize;
 };
 
 
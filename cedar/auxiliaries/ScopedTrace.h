@@ -0,0 +1,119 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        ScopedTrace.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Header file for the class cedar::aux::ScopedTrace.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+#ifndef CEDAR_AUX_SCOPED_TRACE_H
+#define CEDAR_AUX_SCOPED_TRACE_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Tracer.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/ScopedTrace.fwd.h"
+
+// SYSTEM INCLUDES
+#include <string>
+
+
+/*!@brief Records an event with the tracer that lasts from the construction to the destruction of this object.
+ *
+ *        If tracing is disabled when the object is created, nothing is recorded. The name is referenced, not copied,
+ *        so it must outlive this object.
+ *
+ * @see CEDAR_TRACE_SCOPE
+ */
+class cedar::aux::ScopedTrace
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief Starts an event with the given name.
+  ScopedTrace
+  (
+    const std::string& name,
+    cedar::aux::Tracer::Category category = cedar::aux::Tracer::CATEGORY_USER
+  )
+  :
+  mName(name),
+  mCategory(category),
+  mBegin(-1)
+  {
+    auto tracer = cedar::aux::TracerSingleton::getInstance();
+    if (tracer->isEnabled())
+    {
+      this->mBegin = tracer->now();
+    }
+  }
+
+  //!@brief Ends the event.
+  ~ScopedTrace()
+  {
+    if (this->mBegin >= 0)
+    {
+      auto tracer = cedar::aux::TracerSingleton::getInstance();
+      tracer->record(this->mName, this->mCategory, this->mBegin, tracer->now());
+    }
+  }
+
+private:
+  ScopedTrace(const ScopedTrace&);
+  ScopedTrace& operator=(const ScopedTrace&);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  const std::string& mName;
+
+  cedar::aux::Tracer::Category mCategory;
+
+  //! Start of the event in nanoseconds; negative if the event is not recorded.
+  int64_t mBegin;
+
+}; // class cedar::aux::ScopedTrace
+
+//! Helper macros that paste the line number into the name of the trace object.
+#define CEDAR_TRACE_SCOPE_CONCATENATE_IMPL(a, b) a ## b
+#define CEDAR_TRACE_SCOPE_CONCATENATE(a, b) CEDAR_TRACE_SCOPE_CONCATENATE_IMPL(a, b)
+
+//! Traces the enclosing scope under the given name, e.g., CEDAR_TRACE_SCOPE(this->getName()) in a compute method.
+#define CEDAR_TRACE_SCOPE(name) cedar::aux::ScopedTrace CEDAR_TRACE_SCOPE_CONCATENATE(cedar_trace_scope_, __LINE__)(name)
+
+#endif // CEDAR_AUX_SCOPED_TRACE_H
@@ -104,6 +104,11 @@ public:
   //! Write data in a compact (binary) format.
   static const Id Compact = 1;
 
+  /*! Write data as raw frames of fixed size after a fixed header, so that files can be memory-mapped and frames can be
+   *  accessed directly. See cedar::aux::BinaryRecording for details.
+   */
+  static const Id Binary = 2;
+
 protected:
   // none yet
 private:
@@ -140,7 +140,7 @@ public:
   void set(const std::set<T>& values)
   {
     this->mValues = values;
-    emit valueChanged();
+    this->emitChangedSignal();
   }
 
   //!@brief set the std::set to default
@@ -0,0 +1,499 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        SharedMemoryChannel.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Implementation of the class cedar::aux::SharedMemoryChannel.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/auxiliaries/SharedMemoryChannel.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/Log.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <new>
+#include <random>
+#include <thread>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef CEDAR_COMPILER_MSVC
+const unsigned int cedar::aux::SharedMemoryChannel::MAX_DIMENSIONALITY;
+#endif // CEDAR_COMPILER_MSVC
+
+namespace
+{
+  const char MAGIC[8] = {'C', 'E', 'D', 'A', 'R', 'S', 'H', 'M'};
+
+  // the matrix data starts at the first cache line behind the header
+  const size_t DATA_OFFSET = ((sizeof(cedar::aux::SharedMemoryChannel::Header) + 63) / 64) * 64;
+
+  // readers give up after this many attempts that were interrupted by the writer; they will try again on the next read
+  const unsigned int MAX_READ_ATTEMPTS = 1000;
+
+  // readers check for a new writer at most this often, and only if theirs is inactive or has not written for this long
+  const std::chrono::milliseconds WRITER_CHECK_INTERVAL(200);
+
+  uint64_t createGeneration()
+  {
+    std::random_device random;
+    uint64_t generation = (static_cast<uint64_t>(random()) << 32) ^ static_cast<uint64_t>(random());
+    return generation == 0 ? 1 : generation;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::SharedMemoryChannel::SharedMemoryChannel(const std::string& name, Role role)
+:
+mName(name),
+mSegmentName(cedar::aux::SharedMemoryChannel::toSegmentName(name)),
+mRole(role),
+mLastSequence(0),
+mGeneration(0)
+{
+  if (this->mRole == ROLE_READER)
+  {
+    this->open();
+    return;
+  }
+
+  uint64_t existing_generation = 0;
+  bool existing_writer_active = false;
+  if
+  (
+    cedar::aux::SharedMemoryChannel::getSegmentState(this->mSegmentName, existing_generation, existing_writer_active)
+    && existing_writer_active
+  )
+  {
+    // the other writer may also have crashed, so its segment is replaced anyway; its readers will follow this writer
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Shared memory channel \"" + this->mName + "\" already has a writer that has not shut down properly or is still "
+      "running. Its segment is replaced.",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+  }
+
+  try
+  {
+    boost::interprocess::shared_memory_object::remove(this->mSegmentName.c_str());
+    this->mpSegment.reset
+    (
+      new boost::interprocess::shared_memory_object
+      (
+        boost::interprocess::create_only,
+        this->mSegmentName.c_str(),
+        boost::interprocess::read_write
+      )
+    );
+    this->mpSegment->truncate(static_cast<boost::interprocess::offset_t>(DATA_OFFSET));
+    this->map();
+  }
+  catch (const boost::interprocess::interprocess_exception& e)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::InitializationException,
+      "Could not create the shared memory segment \"" + this->mSegmentName + "\": " + std::string(e.what())
+    );
+  }
+
+  Header* header = new (this->mpRegion->get_address()) Header();
+  header->mCapacity = 0;
+  header->mDataSize = 0;
+  header->mMatrixType = CV_32F;
+  header->mDimensionality = 0;
+  this->mGeneration = createGeneration();
+  header->mGeneration.store(this->mGeneration, std::memory_order_relaxed);
+  header->mWriterActive.store(1, std::memory_order_relaxed);
+  // the magic number comes last so that readers do not attach to a half-initialized segment
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(header->mMagic, MAGIC, sizeof(MAGIC));
+}
+
+cedar::aux::SharedMemoryChannel::~SharedMemoryChannel()
+{
+  if (this->mRole == ROLE_WRITER && this->mpRegion)
+  {
+    this->getHeader()->mWriterActive.store(0, std::memory_order_release);
+  }
+
+  this->mpRegion.reset();
+  this->mpSegment.reset();
+
+  if (this->mRole == ROLE_WRITER)
+  {
+    // another writer may have replaced the segment in the meantime; its segment must stay
+    uint64_t generation = 0;
+    bool writer_active = false;
+    if
+    (
+      cedar::aux::SharedMemoryChannel::getSegmentState(this->mSegmentName, generation, writer_active)
+      && generation == this->mGeneration
+    )
+    {
+      boost::interprocess::shared_memory_object::remove(this->mSegmentName.c_str());
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+std::string cedar::aux::SharedMemoryChannel::toSegmentName(const std::string& name)
+{
+  // segment names must be valid file names on all platforms
+  std::string segment_name = "cedar_" + name;
+  for (auto& character : segment_name)
+  {
+    if (!std::isalnum(static_cast<unsigned char>(character)) && character != '-' && character != '.')
+    {
+      character = '_';
+    }
+  }
+  return segment_name;
+}
+
+const std::string& cedar::aux::SharedMemoryChannel::getName() const
+{
+  return this->mName;
+}
+
+cedar::aux::SharedMemoryChannel::Role cedar::aux::SharedMemoryChannel::getRole() const
+{
+  return this->mRole;
+}
+
+bool cedar::aux::SharedMemoryChannel::isOpen() const
+{
+  return static_cast<bool>(this->mpRegion);
+}
+
+uint64_t cedar::aux::SharedMemoryChannel::getWriteCount() const
+{
+  return this->mLastSequence / 2;
+}
+
+cedar::aux::SharedMemoryChannel::Header* cedar::aux::SharedMemoryChannel::getHeader() const
+{
+  return reinterpret_cast<Header*>(this->mpRegion->get_address());
+}
+
+char* cedar::aux::SharedMemoryChannel::getDataStart() const
+{
+  return reinterpret_cast<char*>(this->mpRegion->get_address()) + DATA_OFFSET;
+}
+
+void cedar::aux::SharedMemoryChannel::map()
+{
+  auto mode = (this->mRole == ROLE_WRITER) ? boost::interprocess::read_write : boost::interprocess::read_only;
+  this->mpRegion.reset();
+  this->mpRegion.reset(new boost::interprocess::mapped_region(*this->mpSegment, mode));
+}
+
+bool cedar::aux::SharedMemoryChannel::getSegmentState
+     (
+       const std::string& segmentName,
+       uint64_t& generation,
+       bool& writerActive
+     )
+{
+  try
+  {
+    boost::interprocess::shared_memory_object segment
+    (
+      boost::interprocess::open_only,
+      segmentName.c_str(),
+      boost::interprocess::read_only
+    );
+    // a writer that is just creating the segment may not have resized it yet
+    boost::interprocess::offset_t size = 0;
+    if (!segment.get_size(size) || size < static_cast<boost::interprocess::offset_t>(DATA_OFFSET))
+    {
+      return false;
+    }
+    boost::interprocess::mapped_region region(segment, boost::interprocess::read_only, 0, DATA_OFFSET);
+    const Header* header = reinterpret_cast<const Header*>(region.get_address());
+    if (std::memcmp(header->mMagic, MAGIC, sizeof(MAGIC)) != 0)
+    {
+      return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    generation = header->mGeneration.load(std::memory_order_relaxed);
+    writerActive = header->mWriterActive.load(std::memory_order_acquire) != 0;
+    return true;
+  }
+  catch (const boost::interprocess::interprocess_exception&)
+  {
+    // no segment of that name, or it is still too small
+    return false;
+  }
+}
+
+void cedar::aux::SharedMemoryChannel::followNewWriter()
+{
+  auto now = std::chrono::steady_clock::now();
+  if (now - this->mLastWriterCheck < WRITER_CHECK_INTERVAL)
+  {
+    return;
+  }
+
+  bool writer_active = this->getHeader()->mWriterActive.load(std::memory_order_acquire) != 0;
+  if (writer_active && now - this->mLastNewData < WRITER_CHECK_INTERVAL)
+  {
+    return;
+  }
+
+  this->mLastWriterCheck = now;
+  uint64_t generation = 0;
+  bool new_writer_active = false;
+  if
+  (
+    cedar::aux::SharedMemoryChannel::getSegmentState(this->mSegmentName, generation, new_writer_active)
+    && generation != this->mGeneration
+  )
+  {
+    // the mapping of the old segment is released; if opening fails, the next read tries again
+    this->open();
+  }
+}
+
+bool cedar::aux::SharedMemoryChannel::open()
+{
+  try
+  {
+    this->mpSegment.reset
+    (
+      new boost::interprocess::shared_memory_object
+      (
+        boost::interprocess::open_only,
+        this->mSegmentName.c_str(),
+        boost::interprocess::read_only
+      )
+    );
+    this->map();
+  }
+  catch (const boost::interprocess::interprocess_exception&)
+  {
+    // there is no writer (yet)
+    this->mpRegion.reset();
+    this->mpSegment.reset();
+    return false;
+  }
+
+  if
+  (
+    this->mpRegion->get_size() < DATA_OFFSET
+    || std::memcmp(this->getHeader()->mMagic, MAGIC, sizeof(MAGIC)) != 0
+  )
+  {
+    // the writer has not finished setting up the segment
+    this->mpRegion.reset();
+    this->mpSegment.reset();
+    return false;
+  }
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  this->mGeneration = this->getHeader()->mGeneration.load(std::memory_order_relaxed);
+  this->mLastSequence = 0;
+  this->mLastNewData = std::chrono::steady_clock::now();
+  return true;
+}
+
+void cedar::aux::SharedMemoryChannel::write(const cv::Mat& matrix)
+{
+  if (this->mRole != ROLE_WRITER)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::InvalidValueException,
+      "Cannot write to shared memory channel \"" + this->mName + "\" because it was opened for reading."
+    );
+  }
+
+  if (matrix.dims > static_cast<int>(MAX_DIMENSIONALITY))
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::InvalidValueException,
+      "Cannot write matrices with " + cedar::aux::toString(matrix.dims) + " dimensions to shared memory channel \""
+      + this->mName + "\"."
+    );
+  }
+
+  cv::Mat continuous = matrix.isContinuous() ? matrix : matrix.clone();
+  uint64_t data_size = static_cast<uint64_t>(continuous.total() * continuous.elemSize());
+
+  Header* header = this->getHeader();
+  if (data_size > header->mCapacity)
+  {
+    // grow the segment before taking the lock; readers keep using their old mapping until they see the new capacity
+    this->mpSegment->truncate(static_cast<boost::interprocess::offset_t>(DATA_OFFSET + data_size));
+    this->map();
+    header = this->getHeader();
+  }
+
+  uint64_t sequence = this->mLastSequence;
+  header->mSequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  header->mCapacity = std::max(header->mCapacity, data_size);
+  header->mDataSize = data_size;
+  header->mMatrixType = continuous.type();
+  header->mDimensionality = static_cast<uint32_t>(continuous.dims);
+  for (int d = 0; d < continuous.dims; ++d)
+  {
+    header->mSizes[d] = continuous.size[d];
+  }
+  if (data_size > 0)
+  {
+    std::memcpy(this->getDataStart(), continuous.data, data_size);
+  }
+
+  header->mSequence.store(sequence + 2, std::memory_order_release);
+  this->mLastSequence = sequence + 2;
+}
+
+bool cedar::aux::SharedMemoryChannel::read(cv::Mat& target)
+{
+  if (this->mRole != ROLE_READER)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::InvalidValueException,
+      "Cannot read from shared memory channel \"" + this->mName + "\" because it was opened for writing."
+    );
+  }
+
+  if (!this->isOpen() && !this->open())
+  {
+    return false;
+  }
+
+  this->followNewWriter();
+  if (!this->isOpen())
+  {
+    return false;
+  }
+
+  for (unsigned int attempt = 0; attempt < MAX_READ_ATTEMPTS; ++attempt)
+  {
+    const Header* header = this->getHeader();
+    uint64_t begin = header->mSequence.load(std::memory_order_acquire);
+    if (begin == this->mLastSequence)
+    {
+      // nothing new
+      return false;
+    }
+    if (begin % 2 == 1)
+    {
+      // the writer is busy
+      std::this_thread::yield();
+      continue;
+    }
+
+    uint64_t capacity = header->mCapacity;
+    if (DATA_OFFSET + capacity > this->mpRegion->get_size())
+    {
+      // the writer has grown the segment
+      this->map();
+      continue;
+    }
+
+    // the header may be inconsistent if the writer interfered, so check it before using it
+    uint64_t data_size = header->mDataSize;
+    int type = header->mMatrixType;
+    int dimensionality = static_cast<int>(header->mDimensionality);
+    int sizes[MAX_DIMENSIONALITY];
+    bool empty = dimensionality == 0 && data_size == 0;
+    bool valid = empty
+                 || (
+                      dimensionality >= 2
+                      && dimensionality <= static_cast<int>(MAX_DIMENSIONALITY)
+                      && data_size <= capacity
+                    );
+    uint64_t expected_size = empty ? 0 : CV_ELEM_SIZE(type);
+    for (int d = 0; valid && d < dimensionality; ++d)
+    {
+      sizes[d] = header->mSizes[d];
+      valid = sizes[d] >= 0;
+      expected_size *= static_cast<uint64_t>(std::max(sizes[d], 0));
+    }
+    valid = valid && expected_size == data_size;
+
+    // the target is only touched once the copy is known to be consistent
+    if (valid && !empty)
+    {
+      this->mReadBuffer.create(dimensionality, sizes, type);
+      if (data_size > 0)
+      {
+        std::memcpy(this->mReadBuffer.data, this->getDataStart(), data_size);
+      }
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (valid && header->mSequence.load(std::memory_order_relaxed) == begin)
+    {
+      if (empty)
+      {
+        target = cv::Mat();
+      }
+      else
+      {
+        // hand the consistent copy over instead of copying it again; the old memory of the target is used for the
+        // next read, which only reallocates it if the size or type of the matrix changes
+        cv::swap(this->mReadBuffer, target);
+      }
+      this->mLastSequence = begin;
+      this->mLastNewData = std::chrono::steady_clock::now();
+      return true;
+    }
+  }
+
+  return false;
+}
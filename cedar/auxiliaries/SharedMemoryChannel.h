@@ -0,0 +1,234 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        SharedMemoryChannel.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Header file for the class cedar::aux::SharedMemoryChannel.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+#ifndef CEDAR_AUX_SHARED_MEMORY_CHANNEL_H
+#define CEDAR_AUX_SHARED_MEMORY_CHANNEL_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/SharedMemoryChannel.fwd.h"
+
+// SYSTEM INCLUDES
+#ifndef Q_MOC_RUN
+  #include <boost/interprocess/shared_memory_object.hpp>
+  #include <boost/interprocess/mapped_region.hpp>
+  #include <boost/scoped_ptr.hpp>
+#endif // Q_MOC_RUN
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/*!@brief Transports matrices between processes on the same machine through a named shared memory segment.
+ *
+ *        A channel is created either as the (single) writer or as one of any number of readers of a segment. The
+ *        segment starts with a Header describing the last matrix written, followed by the matrix data. Access is
+ *        synchronized by a sequence lock: the writer makes the sequence number odd while it writes and even again when
+ *        it is done; readers copy the matrix and retry if the sequence number changed in the meantime. Thus, neither
+ *        side ever blocks the other one. Readers copy the matrix into a buffer first and only hand it out once the
+ *        sequence check has passed, so they never return a torn matrix.
+ *
+ *        The segment grows when larger matrices are written; readers remap it when they notice this. Every writer
+ *        stamps its segment with a random generation number. When a writer is destroyed, it marks its segment as
+ *        inactive and removes the segment's name, unless a newer writer has taken it over already. Readers look for a
+ *        segment of a newer generation under the same name when their writer has become inactive or has not published
+ *        anything for a while, so they follow restarted writers.
+ */
+class cedar::aux::SharedMemoryChannel
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Whether a channel writes to or reads from the segment.
+  enum Role
+  {
+    ROLE_WRITER,
+    ROLE_READER
+  };
+
+  //! The maximum number of dimensions of transported matrices.
+  static const unsigned int MAX_DIMENSIONALITY = 16;
+
+  //! The header at the beginning of each segment.
+  struct Header
+  {
+    //! Identifies the segment as a cedar channel, always "CEDARSHM".
+    char mMagic[8];
+    //! Sequence lock; odd while the writer is changing the segment, increased by two with every matrix written.
+    std::atomic<uint64_t> mSequence;
+    //! Random number identifying the writer that created the segment.
+    std::atomic<uint64_t> mGeneration;
+    //! One while the writer exists, zero after it has been destroyed.
+    std::atomic<uint32_t> mWriterActive;
+    //! Number of bytes available for matrix data behind the header.
+    uint64_t mCapacity;
+    //! Number of bytes of the current matrix.
+    uint64_t mDataSize;
+    //! OpenCV type of the current matrix.
+    int32_t mMatrixType;
+    //! Number of dimensions of the current matrix.
+    uint32_t mDimensionality;
+    //! Sizes of the current matrix along each dimension.
+    int32_t mSizes[MAX_DIMENSIONALITY];
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Creates a channel with the given name.
+   *
+   *        Writers create the segment, replacing any existing segment of the same name; a warning is logged if that
+   *        segment's writer still seems to be active. Readers attach to the segment lazily, i.e., the writer does not
+   *        have to exist yet.
+   *
+   * @throws cedar::aux::InitializationException if a writer cannot create the segment.
+   */
+  SharedMemoryChannel(const std::string& name, Role role);
+
+  //!@brief Destructor
+  ~SharedMemoryChannel();
+
+private:
+  SharedMemoryChannel(const SharedMemoryChannel&);
+  SharedMemoryChannel& operator=(const SharedMemoryChannel&);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Returns the name of the channel.
+  const std::string& getName() const;
+
+  //! Returns the role of the channel.
+  Role getRole() const;
+
+  //! Returns true if the channel is attached to a segment. Readers try to attach on every call to read.
+  bool isOpen() const;
+
+  /*!@brief Publishes the given matrix to all readers.
+   *
+   * @throws cedar::aux::InvalidValueException if the channel is not a writer or the matrix has too many dimensions.
+   */
+  void write(const cv::Mat& matrix);
+
+  /*!@brief Copies the last matrix published by the writer into target.
+   *
+   *        The matrix is read into an internal buffer, which is then swapped with target; thus, it is copied only once.
+   *        The previous memory of target becomes the buffer for the next call, so no memory is allocated as long as the
+   *        size and type of the published matrix stay the same. Shallow copies of target must therefore not be kept
+   *        across calls.
+   *
+   * @returns True, if a matrix has been copied; false, if there is no writer yet or no new matrix has been published
+   *          since the last call.
+   */
+  bool read(cv::Mat& target);
+
+  //! Returns the number of matrices written to the segment so far (as far as this channel knows).
+  uint64_t getWriteCount() const;
+
+  //! Returns the name of the shared memory segment used for a channel of the given name.
+  static std::string toSegmentName(const std::string& name);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Tries to open the segment as a reader.
+  bool open();
+
+  //! Reopens the segment if its writer has stopped or stalled and a writer of another generation has taken over.
+  void followNewWriter();
+
+  /*!@brief Reads the generation and activity of the segment currently registered under the given name.
+   *
+   * @returns False, if there is no completely initialized segment of that name.
+   */
+  static bool getSegmentState(const std::string& segmentName, uint64_t& generation, bool& writerActive);
+
+  //! Maps the whole segment into memory, e.g., after it has grown.
+  void map();
+
+  //! Returns the header of the mapped segment.
+  Header* getHeader() const;
+
+  //! Returns the start of the matrix data in the mapped segment.
+  char* getDataStart() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Name of the channel.
+  std::string mName;
+
+  //! Name of the shared memory segment.
+  std::string mSegmentName;
+
+  //! Whether this channel writes or reads.
+  Role mRole;
+
+  //! The shared memory segment.
+  boost::scoped_ptr<boost::interprocess::shared_memory_object> mpSegment;
+
+  //! The mapping of the segment into this process.
+  boost::scoped_ptr<boost::interprocess::mapped_region> mpRegion;
+
+  //! The last sequence number written (writers) or read (readers).
+  uint64_t mLastSequence;
+
+  //! Generation of the segment this channel created (writers) or is attached to (readers).
+  uint64_t mGeneration;
+
+  //! Readers only: when a new matrix was last read.
+  std::chrono::steady_clock::time_point mLastNewData;
+
+  //! Readers only: when the name was last checked for a new writer.
+  std::chrono::steady_clock::time_point mLastWriterCheck;
+
+  //! Readers only: the matrix being read; it is swapped with the target once it has been read consistently.
+  cv::Mat mReadBuffer;
+
+}; // class cedar::aux::SharedMemoryChannel
+
+#endif // CEDAR_AUX_SHARED_MEMORY_CHANNEL_H
@@ -38,6 +38,7 @@
 #define CEDAR_AUX_SINGLETON_H
 
 // CEDAR INCLUDES
+#include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/ExceptionBase.h"
 #include "cedar/auxiliaries/exceptions.h"
 
@@ -57,6 +58,10 @@
  *
  * This specific implementation is thread-safe and returns a boost shared pointer to the Singleton instance.
  *
+ * Code that needs an isolated copy of otherwise shared state (e.g., several simulations running side by side in one
+ * process) can create further instances with createIsolatedInstance and make getInstance return them in the current
+ * thread by means of a ThreadScope.
+ *
  * \todo Separate into policies according to Alexandrescu (2001) [threading model, lifetime policy].
  */
 template<class InstanceType>
@@ -70,6 +75,42 @@ public:
   //! Pointer to the instance type.
   typedef typename boost::shared_ptr<InstanceType> InstanceTypePtr;
 
+  /*!@brief Makes getInstance return a different instance in the calling thread for as long as the scope exists.
+   *
+   *        Scopes can be nested; destroying a scope reinstates the instance that was returned before it was created.
+   *        Other threads are not affected, so work handed to them has to open its own scope for the same instance.
+   */
+  class ThreadScope
+  {
+  public:
+    //! Makes getInstance return @em instance in the calling thread.
+    explicit ThreadScope(InstanceTypePtr instance)
+    :
+    mInstance(instance),
+    mpPrevious(scopedInstance())
+    {
+      CEDAR_ASSERT(this->mInstance);
+      scopedInstance() = &this->mInstance;
+    }
+
+    //! Reinstates the instance that was current when this scope was created.
+    ~ThreadScope()
+    {
+      scopedInstance() = this->mpPrevious;
+    }
+
+  private:
+    //! Scopes must be destroyed in the thread and order they were created in, so they cannot be copied.
+    ThreadScope(const ThreadScope&);
+    ThreadScope& operator=(const ThreadScope&);
+
+    //! The instance returned by getInstance while this scope exists.
+    InstanceTypePtr mInstance;
+
+    //! Instance of the enclosing scope, or null if there is none.
+    InstanceTypePtr* mpPrevious;
+  };
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
@@ -83,6 +124,12 @@ public:
    */
   static InstanceTypePtr getInstance()
   {
+    // an instance made current by a ThreadScope takes precedence over the shared one
+    if (InstanceTypePtr* p_scoped = scopedInstance())
+    {
+      return *p_scoped;
+    }
+
     static InstanceTypePtr instance;
 
     // this implements the double-checked locking pattern, an efficient way
@@ -108,6 +155,15 @@ public:
     return instance;
   }
 
+  /*!@brief Creates a new instance that is independent of the one returned by getInstance.
+   *
+   *        Open a ThreadScope for it to have code that accesses the singleton through getInstance use this instance.
+   */
+  static InstanceTypePtr createIsolatedInstance()
+  {
+    return InstanceTypePtr(new InstanceType);
+  }
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -125,6 +181,13 @@ private:
     mDestroyed = true;
   }
 
+  //! The instance made current in the calling thread by the innermost ThreadScope, or null if there is none.
+  static InstanceTypePtr*& scopedInstance()
+  {
+    thread_local InstanceTypePtr* p_instance = nullptr;
+    return p_instance;
+  }
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
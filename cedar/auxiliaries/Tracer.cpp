@@ -0,0 +1,346 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Tracer.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Source file for the class cedar::aux::Tracer.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/auxiliaries/Tracer.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::Tracer::Tracer()
+:
+mEnabled(false),
+mBufferSize(1 << 16)
+{
+  this->mTimer.start();
+}
+
+cedar::aux::Tracer::~Tracer()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+std::string cedar::aux::Tracer::categoryToString(Category category)
+{
+  switch (category)
+  {
+    case CATEGORY_TRIGGER:
+      return "trigger";
+    case CATEGORY_LOCK:
+      return "lock";
+    case CATEGORY_COMPUTE:
+      return "compute";
+    case CATEGORY_CONVOLUTION:
+      return "convolution";
+    case CATEGORY_USER:
+    default:
+      return "user";
+  }
+}
+
+void cedar::aux::Tracer::setEnabled(bool enabled)
+{
+  this->mEnabled.store(enabled);
+}
+
+void cedar::aux::Tracer::setBufferSize(size_t events)
+{
+  if (events == 0)
+  {
+    CEDAR_THROW(cedar::aux::RangeException, "The trace buffers must be able to hold at least one event.");
+  }
+  QMutexLocker locker(&this->mLock);
+  this->mBufferSize = events;
+}
+
+size_t cedar::aux::Tracer::getBufferSize() const
+{
+  QMutexLocker locker(&this->mLock);
+  return this->mBufferSize;
+}
+
+void cedar::aux::Tracer::clear()
+{
+  QMutexLocker locker(&this->mLock);
+  for (auto buffer : this->mBuffers)
+  {
+    QMutexLocker buffer_locker(&buffer->mLock);
+    buffer->mEvents.resize(this->mBufferSize);
+    buffer->mNext = 0;
+    buffer->mWrapped = false;
+  }
+}
+
+cedar::aux::Tracer::ThreadBuffer& cedar::aux::Tracer::getThreadBuffer()
+{
+  if (!this->mThreadBuffer.hasLocalData())
+  {
+    ThreadBufferPtr buffer(new ThreadBuffer());
+    buffer->mNext = 0;
+    buffer->mWrapped = false;
+
+    QMutexLocker locker(&this->mLock);
+    buffer->mThreadId = static_cast<unsigned int>(this->mBuffers.size());
+    buffer->mEvents.resize(this->mBufferSize);
+    this->mBuffers.push_back(buffer);
+    locker.unlock();
+
+    // the storage deletes this pointer when the thread ends; the buffer itself is kept in mBuffers
+    this->mThreadBuffer.setLocalData(new ThreadBufferPtr(buffer));
+  }
+  return **this->mThreadBuffer.localData();
+}
+
+unsigned int cedar::aux::Tracer::getNameId(const std::string& name)
+{
+  QMutexLocker locker(&this->mLock);
+  auto iter = this->mNameIds.find(name);
+  if (iter != this->mNameIds.end())
+  {
+    return iter->second;
+  }
+  unsigned int id = static_cast<unsigned int>(this->mNames.size());
+  this->mNames.push_back(name);
+  this->mNameIds[name] = id;
+  return id;
+}
+
+void cedar::aux::Tracer::record(const std::string& name, Category category, int64_t begin, int64_t end)
+{
+  ThreadBuffer& buffer = this->getThreadBuffer();
+
+  // names are looked up in the thread's own cache first, so the global lock is only needed for new names
+  unsigned int name_id;
+  auto iter = buffer.mNameIds.find(name);
+  if (iter != buffer.mNameIds.end())
+  {
+    name_id = iter->second;
+  }
+  else
+  {
+    name_id = this->getNameId(name);
+    buffer.mNameIds[name] = name_id;
+  }
+
+  QMutexLocker locker(&buffer.mLock);
+  Event& event = buffer.mEvents[buffer.mNext];
+  event.mNameId = name_id;
+  event.mCategory = category;
+  event.mBegin = begin;
+  event.mEnd = end;
+
+  if (++buffer.mNext == buffer.mEvents.size())
+  {
+    buffer.mNext = 0;
+    buffer.mWrapped = true;
+  }
+}
+
+std::vector<std::pair<unsigned int, std::vector<cedar::aux::Tracer::Event> > >
+  cedar::aux::Tracer::collectEvents() const
+{
+  std::vector<ThreadBufferPtr> buffers;
+  {
+    QMutexLocker locker(&this->mLock);
+    buffers = this->mBuffers;
+  }
+
+  std::vector<std::pair<unsigned int, std::vector<Event> > > events;
+  for (auto buffer : buffers)
+  {
+    QMutexLocker locker(&buffer->mLock);
+    std::vector<Event> thread_events;
+    if (buffer->mWrapped)
+    {
+      thread_events.insert(thread_events.end(), buffer->mEvents.begin() + buffer->mNext, buffer->mEvents.end());
+    }
+    thread_events.insert(thread_events.end(), buffer->mEvents.begin(), buffer->mEvents.begin() + buffer->mNext);
+    events.push_back(std::make_pair(buffer->mThreadId, thread_events));
+  }
+  return events;
+}
+
+void cedar::aux::Tracer::writeChromeTrace(std::ostream& stream) const
+{
+  auto events = this->collectEvents();
+  std::vector<std::string> names;
+  {
+    QMutexLocker locker(&this->mLock);
+    names = this->mNames;
+  }
+
+  // names are escaped for json; step names can contain any character
+  auto escape = [](const std::string& value) -> std::string
+  {
+    std::string escaped;
+    for (char c : value)
+    {
+      if (c == '"' || c == '\\')
+      {
+        escaped += '\\';
+        escaped += c;
+      }
+      else if (static_cast<unsigned char>(c) < 0x20)
+      {
+        escaped += ' ';
+      }
+      else
+      {
+        escaped += c;
+      }
+    }
+    return escaped;
+  };
+
+  stream << std::fixed << std::setprecision(3);
+  stream << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [" << std::endl;
+  bool first = true;
+  for (const auto& thread_events : events)
+  {
+    if (!first)
+    {
+      stream << "," << std::endl;
+    }
+    first = false;
+    stream << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread_events.first
+           << ", \"args\": {\"name\": \"thread " << thread_events.first << "\"}}";
+
+    for (const auto& event : thread_events.second)
+    {
+      // chrome traces use microseconds
+      stream << "," << std::endl
+             << "{\"name\": \"" << escape(names.at(event.mNameId)) << "\", "
+             << "\"cat\": \"" << categoryToString(event.mCategory) << "\", "
+             << "\"ph\": \"X\", "
+             << "\"ts\": " << static_cast<double>(event.mBegin) / 1000.0 << ", "
+             << "\"dur\": " << static_cast<double>(event.mEnd - event.mBegin) / 1000.0 << ", "
+             << "\"pid\": 1, \"tid\": " << thread_events.first << "}";
+    }
+  }
+  stream << std::endl << "]}" << std::endl;
+}
+
+void cedar::aux::Tracer::writeChromeTrace(const std::string& fileName) const
+{
+  std::ofstream stream(fileName);
+  if (!stream.is_open())
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + fileName + "\" for writing.");
+  }
+  this->writeChromeTrace(stream);
+}
+
+std::vector<cedar::aux::Tracer::Statistics> cedar::aux::Tracer::getStatistics() const
+{
+  auto events = this->collectEvents();
+  std::vector<std::string> names;
+  {
+    QMutexLocker locker(&this->mLock);
+    names = this->mNames;
+  }
+
+  std::map<std::pair<unsigned int, Category>, std::vector<double> > durations;
+  for (const auto& thread_events : events)
+  {
+    for (const auto& event : thread_events.second)
+    {
+      durations[std::make_pair(event.mNameId, event.mCategory)].push_back
+      (
+        static_cast<double>(event.mEnd - event.mBegin) / 1e9
+      );
+    }
+  }
+
+  std::vector<Statistics> statistics;
+  for (auto& key_durations : durations)
+  {
+    std::vector<double>& values = key_durations.second;
+    std::sort(values.begin(), values.end());
+
+    Statistics entry;
+    entry.mName = names.at(key_durations.first.first);
+    entry.mCategory = key_durations.first.second;
+    entry.mCount = values.size();
+    double sum = 0.0;
+    for (double value : values)
+    {
+      sum += value;
+    }
+    entry.mMean = sum / static_cast<double>(values.size());
+    entry.mP50 = values.at(static_cast<size_t>(0.50 * static_cast<double>(values.size() - 1) + 0.5));
+    entry.mP99 = values.at(static_cast<size_t>(0.99 * static_cast<double>(values.size() - 1) + 0.5));
+    entry.mMax = values.back();
+    statistics.push_back(entry);
+  }
+  return statistics;
+}
+
+void cedar::aux::Tracer::writeStatistics(std::ostream& stream) const
+{
+  auto statistics = this->getStatistics();
+
+  stream << std::left << std::setw(40) << "name" << std::setw(13) << "category" << std::right
+         << std::setw(10) << "count" << std::setw(12) << "mean [ms]" << std::setw(12) << "p50 [ms]"
+         << std::setw(12) << "p99 [ms]" << std::setw(12) << "max [ms]" << std::endl;
+
+  stream << std::fixed << std::setprecision(3);
+  for (const auto& entry : statistics)
+  {
+    stream << std::left << std::setw(40) << entry.mName.substr(0, 39)
+           << std::setw(13) << categoryToString(entry.mCategory) << std::right
+           << std::setw(10) << entry.mCount
+           << std::setw(12) << entry.mMean * 1000.0
+           << std::setw(12) << entry.mP50 * 1000.0
+           << std::setw(12) << entry.mP99 * 1000.0
+           << std::setw(12) << entry.mMax * 1000.0 << std::endl;
+  }
+}
@@ -0,0 +1,241 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Tracer.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Header file for the class cedar::aux::Tracer.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+#ifndef CEDAR_AUX_TRACER_H
+#define CEDAR_AUX_TRACER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Singleton.fwd.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/Tracer.fwd.h"
+
+// SYSTEM INCLUDES
+#ifndef Q_MOC_RUN
+  #include <boost/shared_ptr.hpp>
+#endif
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThreadStorage>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/*!@brief Records timed events of the processing hot path, e.g., trigger dispatch, locking, compute and convolution calls.
+ *
+ *        Every thread writes into its own ring buffer of events; when it is full, the oldest events are overwritten.
+ *        While tracing is disabled, a scoped trace only checks a flag. The recorded events can be exported
+ *        in the chrome trace format (which can be read by chrome://tracing and Perfetto), and summarized as percentiles
+ *        of their durations.
+ *
+ *        Events are usually recorded via cedar::aux::ScopedTrace or the CEDAR_TRACE_SCOPE macro.
+ */
+class cedar::aux::Tracer
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // friends
+  //--------------------------------------------------------------------------------------------------------------------
+
+  // uses singleton template.
+  friend class cedar::aux::Singleton<Tracer>;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! What kind of work an event represents.
+  enum Category
+  {
+    CATEGORY_TRIGGER,
+    CATEGORY_LOCK,
+    CATEGORY_COMPUTE,
+    CATEGORY_CONVOLUTION,
+    CATEGORY_USER
+  };
+
+  //! Summary of the durations of all recorded events with the same name and category. All times are in seconds.
+  struct Statistics
+  {
+    std::string mName;
+    Category mCategory;
+    size_t mCount;
+    double mMean;
+    double mP50;
+    double mP99;
+    double mMax;
+  };
+
+private:
+  //! A single event, times are in nanoseconds since the tracer was created.
+  struct Event
+  {
+    unsigned int mNameId;
+    Category mCategory;
+    int64_t mBegin;
+    int64_t mEnd;
+  };
+
+  //! The events of a single thread.
+  struct ThreadBuffer
+  {
+    unsigned int mThreadId;
+    //! Locked by the thread when recording and by readers; the former is practically never contended.
+    QMutex mLock;
+    std::vector<Event> mEvents;
+    //! Position at which the next event is written.
+    size_t mNext;
+    //! Whether the buffer has been filled completely at least once.
+    bool mWrapped;
+    //! Cache of the ids of names used by this thread.
+    std::map<std::string, unsigned int> mNameIds;
+  };
+  typedef boost::shared_ptr<ThreadBuffer> ThreadBufferPtr;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //!@brief The private constructor for singleton usage.
+  Tracer();
+
+public:
+  //!@brief Destructor
+  ~Tracer();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Returns true if events are currently recorded.
+  inline bool isEnabled() const
+  {
+    return this->mEnabled.load(std::memory_order_relaxed);
+  }
+
+  //! Starts or stops recording events.
+  void setEnabled(bool enabled);
+
+  //! Discards all recorded events.
+  void clear();
+
+  //! Sets the number of events each thread can hold; applied to new threads and when clearing.
+  void setBufferSize(size_t events);
+
+  //! Returns the number of events each thread can hold.
+  size_t getBufferSize() const;
+
+  //! Returns the current time of the tracer's clock in nanoseconds.
+  inline int64_t now() const
+  {
+    return this->mTimer.nsecsElapsed();
+  }
+
+  //! Records an event for the calling thread; begin and end are taken from now().
+  void record(const std::string& name, Category category, int64_t begin, int64_t end);
+
+  //! Writes all recorded events in the chrome trace (json) format.
+  void writeChromeTrace(std::ostream& stream) const;
+
+  //! Writes all recorded events in the chrome trace (json) format to the given file.
+  void writeChromeTrace(const std::string& fileName) const;
+
+  //! Returns duration statistics of all recorded events, grouped by name and category.
+  std::vector<Statistics> getStatistics() const;
+
+  //! Writes the statistics as a human-readable table.
+  void writeStatistics(std::ostream& stream) const;
+
+  //! Returns a readable name of the given category.
+  static std::string categoryToString(Category category);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Returns the buffer of the calling thread, creating it if necessary.
+  ThreadBuffer& getThreadBuffer();
+
+  //! Returns the global id of the given name.
+  unsigned int getNameId(const std::string& name);
+
+  //! Returns copies of the events of all threads, in the order in which they were recorded.
+  std::vector<std::pair<unsigned int, std::vector<Event> > > collectEvents() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  std::atomic<bool> mEnabled;
+
+  QElapsedTimer mTimer;
+
+  size_t mBufferSize;
+
+  //! Pointers to the buffers of the threads; the buffers outlive their threads so they can still be exported.
+  QThreadStorage<ThreadBufferPtr*> mThreadBuffer;
+
+  //! Locks mBuffers, mNames and mNameIds.
+  mutable QMutex mLock;
+
+  std::vector<ThreadBufferPtr> mBuffers;
+
+  std::vector<std::string> mNames;
+
+  std::map<std::string, unsigned int> mNameIds;
+
+}; // class cedar::aux::Tracer
+
+#include "cedar/auxiliaries/Singleton.h"
+
+namespace cedar
+{
+  namespace aux
+  {
+    CEDAR_INSTANTIATE_AUX_TEMPLATE(cedar::aux::Singleton<cedar::aux::Tracer>);
+    //! a singleton for the tracer
+    typedef cedar::aux::Singleton<cedar::aux::Tracer> TracerSingleton;
+  }
+}
+
+#endif // CEDAR_AUX_TRACER_H
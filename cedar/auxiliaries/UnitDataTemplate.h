@@ -122,6 +122,7 @@ public:
   void setData(const Quantity& data)
   {
     this->mData = data;
+    this->markChanged();
   }
 
   //! Copies the quantity from another data object.
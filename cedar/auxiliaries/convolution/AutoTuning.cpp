@@ -0,0 +1,546 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        AutoTuning.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description:
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/convolution/AutoTuning.h"
+#include "cedar/auxiliaries/convolution/EngineManager.h"
+#include "cedar/auxiliaries/convolution/OpenCV.h"
+#include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/kernel/Kernel.h"
+#include "cedar/auxiliaries/systemFunctions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/utilities.h"
+#include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/Path.h"
+#include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/internals.h"
+
+// SYSTEM INCLUDES
+#include <QMutexLocker>
+#include <QReadLocker>
+#include <opencv2/core/core.hpp>
+#include <chrono>
+#include <fstream>
+#include <limits>
+
+//----------------------------------------------------------------------------------------------------------------------
+// register type with the factory
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  bool registered
+    = cedar::aux::conv::EngineManagerSingleton::getInstance()->registerType<cedar::aux::conv::AutoTuningPtr>();
+
+  //! Each engine is timed for at least this many convolutions ...
+  const unsigned int MINIMUM_TUNING_REPETITIONS = 3;
+
+  //! ... and, if they are fast, until this much time has passed.
+  const double MINIMUM_TUNING_SECONDS = 0.05;
+
+  //! An upper bound on the repetitions, so that tuning very fast convolutions does not take long either.
+  const unsigned int MAXIMUM_TUNING_REPETITIONS = 100;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+std::map<std::string, std::string> cedar::aux::conv::AutoTuning::mTuningResults;
+QMutex cedar::aux::conv::AutoTuning::mTuningResultsLock;
+bool cedar::aux::conv::AutoTuning::mTuningResultsLoaded = false;
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::conv::AutoTuning::AutoTuning()
+{
+  this->mEngines.push_back(cedar::aux::conv::EnginePtr(new cedar::aux::conv::OpenCV()));
+#ifdef CEDAR_USE_FFTW
+  this->mEngines.push_back(cedar::aux::conv::EnginePtr(new cedar::aux::conv::FFTW()));
+#endif // CEDAR_USE_FFTW
+}
+
+cedar::aux::conv::AutoTuning::~AutoTuning()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::conv::AutoTuning::setKernelList(cedar::aux::conv::KernelListPtr kernelList)
+{
+  this->Engine::setKernelList(kernelList);
+  for (auto engine : this->mEngines)
+  {
+    engine->setKernelList(kernelList);
+  }
+
+  QMutexLocker locker(&this->mSelectionLock);
+  this->mSignatureSizes.clear();
+  this->mSelectedEngine.reset();
+}
+
+std::string cedar::aux::conv::AutoTuning::getSelectedEngineName() const
+{
+  QMutexLocker locker(&this->mSelectionLock);
+  if (!this->mSelectedEngine)
+  {
+    return std::string();
+  }
+  return getEngineName(this->mSelectedEngine);
+}
+
+std::string cedar::aux::conv::AutoTuning::getEngineName(cedar::aux::conv::ConstEnginePtr engine)
+{
+  return cedar::aux::objectTypeToString(engine);
+}
+
+std::string cedar::aux::conv::AutoTuning::getCachePath()
+{
+  return cedar::aux::getUserApplicationDataDirectory()
+           + "/.cedar/fftw/autotuning."
+           + CEDAR_BUILT_ON_MACHINE + "."
+           + "results";
+}
+
+void cedar::aux::conv::AutoTuning::loadCache()
+{
+  // the caller holds mTuningResultsLock
+  if (mTuningResultsLoaded)
+  {
+    return;
+  }
+  mTuningResultsLoaded = true;
+
+  std::ifstream file(getCachePath().c_str());
+  std::string line;
+  while (std::getline(file, line))
+  {
+    size_t separator = line.rfind(' ');
+    if (separator != std::string::npos)
+    {
+      mTuningResults[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+  }
+}
+
+void cedar::aux::conv::AutoTuning::saveCache()
+{
+  // the caller holds mTuningResultsLock
+  cedar::aux::Path path = getCachePath();
+  path.createDirectories();
+
+  std::ofstream file(path.toString().c_str());
+  for (const auto& result : mTuningResults)
+  {
+    file << result.first << " " << result.second << std::endl;
+  }
+}
+
+size_t cedar::aux::conv::AutoTuning::findEngine(const std::string& name) const
+{
+  for (size_t i = 0; i < this->mEngines.size(); ++i)
+  {
+    if (getEngineName(this->mEngines.at(i)) == name)
+    {
+      return i;
+    }
+  }
+  return this->mEngines.size();
+}
+
+bool cedar::aux::conv::AutoTuning::updateSignature
+     (
+       const cv::Mat& matrix,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  // the caller holds mSelectionLock
+  thread_local std::vector<int> sizes;
+  sizes.clear();
+
+  sizes.push_back(matrix.type());
+  sizes.push_back(matrix.dims);
+  for (int d = 0; d < matrix.dims; ++d)
+  {
+    sizes.push_back(matrix.size[d]);
+  }
+  sizes.push_back(static_cast<int>(borderType));
+  sizes.push_back(static_cast<int>(mode));
+  sizes.push_back(cv::getNumThreads());
+  sizes.push_back(static_cast<int>(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()));
+
+  cedar::aux::conv::ConstKernelListPtr kernel_list = this->getKernelList();
+  for (size_t i = 0; i < kernel_list->size(); ++i)
+  {
+    cedar::aux::kernel::ConstKernelPtr kernel = kernel_list->getKernel(i);
+    QReadLocker locker(kernel->getReadWriteLock());
+    unsigned int dimensionality = kernel->getDimensionality();
+    sizes.push_back(static_cast<int>(dimensionality));
+    for (unsigned int d = 0; d < dimensionality; ++d)
+    {
+      sizes.push_back(static_cast<int>(kernel->getSize(d)));
+    }
+  }
+
+  if (sizes == this->mSignatureSizes)
+  {
+    return false;
+  }
+  this->mSignatureSizes = sizes;
+
+  // type.dims.sizes.border.mode.threads.fftw-threads, followed by the sizes of each kernel
+  size_t index = 0;
+  this->mSignature = cedar::aux::toString(sizes.at(index++));
+  this->mSignature += "." + cedar::aux::toString(sizes.at(index++));
+  for (int d = 0; d < matrix.dims; ++d)
+  {
+    this->mSignature += (d == 0 ? "." : "x") + cedar::aux::toString(sizes.at(index++));
+  }
+  this->mSignature += ".b" + cedar::aux::toString(sizes.at(index++));
+  this->mSignature += ".m" + cedar::aux::toString(sizes.at(index++));
+  this->mSignature += ".t" + cedar::aux::toString(sizes.at(index++));
+  this->mSignature += ".f" + cedar::aux::toString(sizes.at(index++));
+  while (index < sizes.size())
+  {
+    int dimensionality = sizes.at(index++);
+    this->mSignature += ".k" + cedar::aux::toString(dimensionality);
+    for (int d = 0; d < dimensionality; ++d)
+    {
+      this->mSignature += (d == 0 ? ":" : "x") + cedar::aux::toString(sizes.at(index++));
+    }
+  }
+  return true;
+}
+
+cedar::aux::conv::ConstEnginePtr cedar::aux::conv::AutoTuning::getFirstCapableEngine
+                                 (
+                                   cedar::aux::conv::BorderType::Id borderType,
+                                   cedar::aux::conv::Mode::Id mode
+                                 ) const
+{
+  for (auto engine : this->mEngines)
+  {
+    if (engine->checkBorderTypeCapability(borderType) && engine->checkModeCapability(mode))
+    {
+      return engine;
+    }
+  }
+  return this->mEngines.front();
+}
+
+size_t cedar::aux::conv::AutoTuning::tune
+       (
+         const cv::Mat& matrix,
+         cedar::aux::conv::BorderType::Id borderType,
+         cedar::aux::conv::Mode::Id mode,
+         bool alternateEvenCenter
+       ) const
+{
+  size_t fastest = this->mEngines.size();
+  double fastest_time = std::numeric_limits<double>::max();
+  cv::Mat result;
+
+  for (size_t i = 0; i < this->mEngines.size(); ++i)
+  {
+    cedar::aux::conv::ConstEnginePtr engine = this->mEngines.at(i);
+    if (!engine->checkBorderTypeCapability(borderType) || !engine->checkModeCapability(mode))
+    {
+      continue;
+    }
+
+    try
+    {
+      // the first call sets up plans, caches and result memory, so it is not timed
+      engine->convolveInto(matrix, result, borderType, mode, alternateEvenCenter);
+
+      unsigned int repetitions = 0;
+      double elapsed = 0.0;
+      auto start = std::chrono::steady_clock::now();
+      while
+      (
+        repetitions < MINIMUM_TUNING_REPETITIONS
+        || (elapsed < MINIMUM_TUNING_SECONDS && repetitions < MAXIMUM_TUNING_REPETITIONS)
+      )
+      {
+        engine->convolveInto(matrix, result, borderType, mode, alternateEvenCenter);
+        ++repetitions;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      }
+
+      double time = elapsed / static_cast<double>(repetitions);
+      if (time < fastest_time)
+      {
+        fastest = i;
+        fastest_time = time;
+      }
+    }
+    catch (const cedar::aux::ExceptionBase&)
+    {
+      // the engine cannot do this convolution after all
+    }
+    catch (const cv::Exception&)
+    {
+      // the engine cannot do this convolution after all
+    }
+  }
+
+  return fastest;
+}
+
+cedar::aux::conv::ConstEnginePtr cedar::aux::conv::AutoTuning::selectEngine
+                                 (
+                                   const cv::Mat& matrix,
+                                   cedar::aux::conv::BorderType::Id borderType,
+                                   cedar::aux::conv::Mode::Id mode,
+                                   bool alternateEvenCenter
+                                 ) const
+{
+  QMutexLocker locker(&this->mSelectionLock);
+  if (!this->updateSignature(matrix, borderType, mode) && this->mSelectedEngine)
+  {
+    return this->mSelectedEngine;
+  }
+
+  size_t selected = this->mEngines.size();
+  QMutexLocker results_locker(&mTuningResultsLock);
+  loadCache();
+  auto stored = mTuningResults.find(this->mSignature);
+  if (stored != mTuningResults.end())
+  {
+    selected = this->findEngine(stored->second);
+  }
+  results_locker.unlock();
+
+  if (selected < this->mEngines.size())
+  {
+    cedar::aux::LogSingleton::getInstance()->message
+    (
+      "Using engine " + getEngineName(this->mEngines.at(selected)) + " for convolution " + this->mSignature
+        + " (stored tuning result).",
+      "cedar::aux::conv::AutoTuning::selectEngine"
+    );
+  }
+  else
+  {
+    selected = this->tune(matrix, borderType, mode, alternateEvenCenter);
+    if (selected < this->mEngines.size())
+    {
+      std::string name = getEngineName(this->mEngines.at(selected));
+      results_locker.relock();
+      mTuningResults[this->mSignature] = name;
+      saveCache();
+      results_locker.unlock();
+
+      cedar::aux::LogSingleton::getInstance()->message
+      (
+        "Selected engine " + name + " for convolution " + this->mSignature + ".",
+        "cedar::aux::conv::AutoTuning::selectEngine"
+      );
+    }
+  }
+
+  if (selected < this->mEngines.size())
+  {
+    this->mSelectedEngine = this->mEngines.at(selected);
+  }
+  else
+  {
+    // none of the engines managed; let the first one that claims to be capable produce a proper error
+    this->mSelectedEngine = this->getFirstCapableEngine(borderType, mode);
+  }
+  return this->mSelectedEngine;
+}
+
+cv::Mat cedar::aux::conv::AutoTuning::convolve
+        (
+          const cv::Mat& matrix,
+          cedar::aux::conv::BorderType::Id borderType,
+          cedar::aux::conv::Mode::Id mode,
+          bool alternateEvenCenter
+        ) const
+{
+  return this->selectEngine(matrix, borderType, mode, alternateEvenCenter)->convolve
+         (
+           matrix,
+           borderType,
+           mode,
+           alternateEvenCenter
+         );
+}
+
+void cedar::aux::conv::AutoTuning::convolveInto
+     (
+       const cv::Mat& matrix,
+       cv::Mat& result,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode,
+       bool alternateEvenCenter
+     ) const
+{
+  this->selectEngine(matrix, borderType, mode, alternateEvenCenter)->convolveInto
+  (
+    matrix,
+    result,
+    borderType,
+    mode,
+    alternateEvenCenter
+  );
+}
+
+cv::Mat cedar::aux::conv::AutoTuning::convolve
+        (
+          const cv::Mat& matrix,
+          const cv::Mat& kernel,
+          cedar::aux::conv::BorderType::Id borderType,
+          cedar::aux::conv::Mode::Id mode,
+          const std::vector<int>& anchor,
+          bool alternateEvenCenter
+        ) const
+{
+  for (auto engine : this->mEngines)
+  {
+    if (engine->checkCapability(matrix, kernel, borderType, mode))
+    {
+      return engine->convolve(matrix, kernel, borderType, mode, anchor, alternateEvenCenter);
+    }
+  }
+  return this->mEngines.front()->convolve(matrix, kernel, borderType, mode, anchor, alternateEvenCenter);
+}
+
+cv::Mat cedar::aux::conv::AutoTuning::convolve
+        (
+          const cv::Mat& matrix,
+          cedar::aux::kernel::ConstKernelPtr kernel,
+          cedar::aux::conv::BorderType::Id borderType,
+          cedar::aux::conv::Mode::Id mode,
+          bool alternateEvenCenter
+        ) const
+{
+  return this->getFirstCapableEngine(borderType, mode)->convolve(matrix, kernel, borderType, mode, alternateEvenCenter);
+}
+
+cv::Mat cedar::aux::conv::AutoTuning::convolve
+        (
+          const cv::Mat& matrix,
+          cedar::aux::conv::ConstKernelListPtr kernelList,
+          cedar::aux::conv::BorderType::Id borderType,
+          cedar::aux::conv::Mode::Id mode,
+          bool alternateEvenCenter
+        ) const
+{
+  return this->getFirstCapableEngine(borderType, mode)->convolve
+         (
+           matrix,
+           kernelList,
+           borderType,
+           mode,
+           alternateEvenCenter
+         );
+}
+
+bool cedar::aux::conv::AutoTuning::checkCapability
+     (
+       size_t matrixDim,
+       size_t kernelDim,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  for (auto engine : this->mEngines)
+  {
+    if (engine->checkCapability(matrixDim, kernelDim, borderType, mode))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool cedar::aux::conv::AutoTuning::checkCapability
+     (
+       cv::Mat matrix,
+       cv::Mat kernel,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  for (auto engine : this->mEngines)
+  {
+    if (engine->checkCapability(matrix, kernel, borderType, mode))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool cedar::aux::conv::AutoTuning::checkBorderTypeCapability
+     (
+       cedar::aux::conv::BorderType::Id borderType
+     ) const
+{
+  for (auto engine : this->mEngines)
+  {
+    if (engine->checkBorderTypeCapability(borderType))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool cedar::aux::conv::AutoTuning::checkModeCapability
+     (
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  for (auto engine : this->mEngines)
+  {
+    if (engine->checkModeCapability(mode))
+    {
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,266 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        AutoTuning.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Convolution engine that chooses the fastest of the other engines.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_CONV_AUTO_TUNING_H
+#define CEDAR_AUX_CONV_AUTO_TUNING_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/convolution/Engine.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/convolution/AutoTuning.fwd.h"
+
+// SYSTEM INCLUDES
+#include <QMutex>
+#include <map>
+#include <string>
+#include <vector>
+
+
+/*!@brief A convolution engine that benchmarks the other engines and dispatches to the fastest one.
+ *
+ *        Convolutions with the engine's kernel list are tuned per signature, i.e., per combination of matrix size and
+ *        type, kernel sizes, border type, mode and number of threads. The first time a signature is encountered, each
+ *        engine that is capable of the convolution is timed on the actual matrix and kernels; the fastest one is then
+ *        used for all following calls with this signature. Because the kernel sizes are part of the signature, changing
+ *        a kernel's size leads to a new tuning run.
+ *
+ *        Results are shared between all instances and stored in a file in the same directory as the FFTW wisdom, so
+ *        each signature is only tuned once per machine.
+ *
+ *        Convolutions with explicitly passed kernels are not tuned; they go to the first engine that is capable of
+ *        them.
+ */
+class cedar::aux::conv::AutoTuning : public cedar::aux::conv::Engine
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  AutoTuning();
+
+  //!@brief Destructor
+  ~AutoTuning();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  cv::Mat convolve
+  (
+    const cv::Mat& matrix,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  void convolveInto
+  (
+    const cv::Mat& matrix,
+    cv::Mat& result,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  cv::Mat convolve
+  (
+    const cv::Mat& matrix,
+    const cv::Mat& kernel,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    const std::vector<int>& anchor = std::vector<int>(),
+    bool alternateEvenCenter = false
+  ) const;
+
+  cv::Mat convolve
+  (
+    const cv::Mat& matrix,
+    cedar::aux::kernel::ConstKernelPtr kernel,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  cv::Mat convolve
+  (
+    const cv::Mat& matrix,
+    cedar::aux::conv::ConstKernelListPtr kernelList,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  //! Capable of everything at least one of the engines is capable of.
+  bool checkCapability
+  (
+    size_t matrixDim,
+    size_t kernelDim,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  //! Capable of everything at least one of the engines is capable of.
+  bool checkCapability
+  (
+    cv::Mat matrix,
+    cv::Mat kernel,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  bool checkBorderTypeCapability
+  (
+    cedar::aux::conv::BorderType::Id borderType
+  ) const;
+
+  bool checkModeCapability
+  (
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  //! Sets the kernel list of this engine and of all engines it chooses from.
+  void setKernelList(cedar::aux::conv::KernelListPtr kernelList);
+
+  //! Returns the name of the engine that was selected for the last convolution with the kernel list.
+  std::string getSelectedEngineName() const;
+
+  //! Returns the path of the file in which the tuning results are stored.
+  static std::string getCachePath();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  /*!@brief Returns the engine to use for convolving the matrix with the kernel list, tuning it if the signature of the
+   *        call differs from that of the last call.
+   */
+  cedar::aux::conv::ConstEnginePtr selectEngine
+  (
+    const cv::Mat& matrix,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode,
+    bool alternateEvenCenter
+  ) const;
+
+  //! Writes the current signature of a convolution with the kernel list into mSignature; returns true if it changed.
+  bool updateSignature
+  (
+    const cv::Mat& matrix,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  //! Times all capable engines and returns the index of the fastest one.
+  size_t tune
+  (
+    const cv::Mat& matrix,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode,
+    bool alternateEvenCenter
+  ) const;
+
+  //! Returns the first engine that supports the border type and mode.
+  cedar::aux::conv::ConstEnginePtr getFirstCapableEngine
+  (
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  //! Returns the index of the engine with the given name, or the number of engines if there is none.
+  size_t findEngine(const std::string& name) const;
+
+  //! Name under which the engine is stored in the tuning results.
+  static std::string getEngineName(cedar::aux::conv::ConstEnginePtr engine);
+
+  //! Loads the stored tuning results, unless this has already happened.
+  static void loadCache();
+
+  //! Writes all tuning results to the file.
+  static void saveCache();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! The engines to choose from.
+  std::vector<cedar::aux::conv::EnginePtr> mEngines;
+
+  //! Protects the signature and selection below.
+  mutable QMutex mSelectionLock;
+
+  //! Signature of the last convolution with the kernel list.
+  mutable std::string mSignature;
+
+  //! Sizes that make up the signature; compared on every call so that the string only has to be rebuilt on changes.
+  mutable std::vector<int> mSignatureSizes;
+
+  //! Engine selected for mSignature.
+  mutable cedar::aux::conv::ConstEnginePtr mSelectedEngine;
+
+  //! Tuning results of all instances, indexed by signature.
+  static std::map<std::string, std::string> mTuningResults;
+
+  //! Protects mTuningResults and the file they are stored in.
+  static QMutex mTuningResultsLock;
+
+  //! Whether the tuning results have been read from the file.
+  static bool mTuningResultsLoaded;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // parameters
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  // none yet
+
+}; // class cedar::aux::conv::AutoTuning
+
+#endif // CEDAR_AUX_CONV_AUTO_TUNING_H
@@ -41,9 +41,16 @@
 #include "cedar/auxiliaries/convolution/OpenCV.h"
 #include "cedar/auxiliaries/kernel/Kernel.h"
 #include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/ScopedTrace.h"
 
 // SYSTEM INCLUDES
 
+namespace
+{
+  //! Name under which convolution calls show up in traces.
+  const std::string trace_name = "convolution";
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -203,9 +210,23 @@ void cedar::aux::conv::Convolution::updateEngineCapabilities()
 
 cv::Mat cedar::aux::conv::Convolution::convolve(const cv::Mat& matrix) const
 {
+  cedar::aux::ScopedTrace trace(trace_name, cedar::aux::Tracer::CATEGORY_CONVOLUTION);
   return this->getEngine()->convolve(matrix, this->getBorderType(), this->getMode(), this->getAlternateEvenKernelCenter());
 }
 
+void cedar::aux::conv::Convolution::convolveInto(const cv::Mat& matrix, cv::Mat& result) const
+{
+  cedar::aux::ScopedTrace trace(trace_name, cedar::aux::Tracer::CATEGORY_CONVOLUTION);
+  this->getEngine()->convolveInto
+  (
+    matrix,
+    result,
+    this->getBorderType(),
+    this->getMode(),
+    this->getAlternateEvenKernelCenter()
+  );
+}
+
 cv::Mat cedar::aux::conv::Convolution::convolve
 (
   const cv::Mat& matrix,
@@ -213,6 +234,7 @@ cv::Mat cedar::aux::conv::Convolution::convolve
   const std::vector<int>& anchor
 ) const
 {
+  cedar::aux::ScopedTrace trace(trace_name, cedar::aux::Tracer::CATEGORY_CONVOLUTION);
   return this->getEngine()->convolve(matrix, kernel, this->getBorderType(), this->getMode(), anchor, this->getAlternateEvenKernelCenter());
 }
 
@@ -222,6 +244,7 @@ cv::Mat cedar::aux::conv::Convolution::convolve
   cedar::aux::kernel::ConstKernelPtr kernel
 ) const
 {
+  cedar::aux::ScopedTrace trace(trace_name, cedar::aux::Tracer::CATEGORY_CONVOLUTION);
   return this->getEngine()->convolve(matrix, kernel, this->getBorderType(), this->getMode(), this->getAlternateEvenKernelCenter());
 }
 
@@ -231,6 +254,7 @@ cv::Mat cedar::aux::conv::Convolution::convolveSeparable
   cedar::aux::kernel::ConstSeparablePtr kernel
 ) const
 {
+  cedar::aux::ScopedTrace trace(trace_name, cedar::aux::Tracer::CATEGORY_CONVOLUTION);
   return this->getEngine()->convolveSeparable(matrix, kernel, this->getBorderType(), this->getMode(), this->getAlternateEvenKernelCenter());
 }
 
@@ -240,5 +264,6 @@ cv::Mat cedar::aux::conv::Convolution::convolve
   cedar::aux::conv::ConstKernelListPtr kernelList
 ) const
 {
+  cedar::aux::ScopedTrace trace(trace_name, cedar::aux::Tracer::CATEGORY_CONVOLUTION);
   return this->getEngine()->convolve(matrix, kernelList, this->getBorderType(), this->getMode(), this->getAlternateEvenKernelCenter());
 }
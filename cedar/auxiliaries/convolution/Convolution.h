@@ -106,6 +106,16 @@ public:
    */
   cv::Mat convolve(const cv::Mat& matrix) const;
 
+  /*!@brief Same as convolve(const cv::Mat&), but writes the result into the given matrix.
+   *
+   *        Depending on the engine, the memory of @em result is reused if it already has the right size and type. This
+   *        is the preferred method when the same convolution is computed over and over, e.g., in a dynamical system.
+   *
+   * @param matrix The matrix to be convolved with the kernels.
+   * @param result The matrix into which the result is written.
+   */
+  void convolveInto(const cv::Mat& matrix, cv::Mat& result) const;
+
   //! Checks whether the convolution engine can convolve the given matrices with the parameters set in this convolution.
   bool canConvolve(const cv::Mat& matrix, const cv::Mat& kernel) const;
 
@@ -62,6 +62,20 @@ cv::Mat cedar::aux::conv::Engine::convolveSeparable
   return this->convolve(matrix, cedar::aux::kernel::ConstKernelPtr(kernel), borderType, mode, alternateEvenCenter);
 }
 
+void cedar::aux::conv::Engine::convolveInto
+     (
+       const cv::Mat& matrix,
+       cv::Mat& result,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode,
+       bool alternateEvenCenter
+     )
+     const
+{
+  // default implementation: call the normal convolve method
+  result = this->convolve(matrix, borderType, mode, alternateEvenCenter);
+}
+
 void cedar::aux::conv::Engine::setKernelList(cedar::aux::conv::KernelListPtr kernelList)
 {
   CEDAR_DEBUG_ASSERT(kernelList.get() != nullptr);
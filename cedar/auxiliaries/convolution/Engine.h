@@ -90,6 +90,23 @@ public:
     bool alternateEvenCenter = false
   ) const = 0;
 
+  /*!@brief   Convolves the matrix with the kernel list stored in this object and writes the result into @em result.
+   *
+   *            If @em result already has the size and type of the output, implementations should write into its
+   *            existing memory rather than allocating a new matrix.
+   *
+   * @remarks   As a default, this method just assigns the result of the normal convolve function. Override this in
+   *            order to avoid allocating the result on every call.
+   */
+  virtual void convolveInto
+  (
+    const cv::Mat& matrix,
+    cv::Mat& result,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
   /*!@brief   Convolves two matrices with each other.
    */
   virtual cv::Mat convolve
@@ -64,6 +64,10 @@ bool cedar::aux::conv::FFTW::mMultiThreadActivated = false;
 std::set<std::string> cedar::aux::conv::FFTW::mLoadedWisdoms;
 std::map<std::string, fftw_plan> cedar::aux::conv::FFTW::mForwardPlans;
 std::map<std::string, fftw_plan> cedar::aux::conv::FFTW::mBackwardPlans;
+#ifdef CEDAR_USE_FFTW_FLOAT
+std::map<std::string, fftwf_plan> cedar::aux::conv::FFTW::mForwardPlansFloat;
+std::map<std::string, fftwf_plan> cedar::aux::conv::FFTW::mBackwardPlansFloat;
+#endif // CEDAR_USE_FFTW_FLOAT
 
 //----------------------------------------------------------------------------------------------------------------------
 // register type with the factory
@@ -83,11 +87,49 @@ mAllocatedSize(0),
 mMatrixBuffer(nullptr),
 mKernelBuffer(nullptr),
 mResultBuffer(nullptr),
-mRetransformKernel(true)
+mRetransformKernel(true),
+#ifdef CEDAR_USE_FFTW_FLOAT
+mAllocatedSizeFloat(0),
+mMatrixBufferFloat(nullptr),
+mKernelBufferFloat(nullptr),
+mResultBufferFloat(nullptr),
+#endif // CEDAR_USE_FFTW_FLOAT
+mRetransformKernelFloat(true),
+mFetchCombinedKernel(true)
 {
  this->connect(this, SIGNAL(kernelListChanged()), SLOT(kernelListChanged()));
 }
 
+cedar::aux::conv::FFTW::~FFTW()
+{
+  if (mMatrixBuffer)
+  {
+    fftw_free(mMatrixBuffer);
+  }
+  if (mKernelBuffer)
+  {
+    fftw_free(mKernelBuffer);
+  }
+  if (mResultBuffer)
+  {
+    fftw_free(mResultBuffer);
+  }
+#ifdef CEDAR_USE_FFTW_FLOAT
+  if (mMatrixBufferFloat)
+  {
+    fftwf_free(mMatrixBufferFloat);
+  }
+  if (mKernelBufferFloat)
+  {
+    fftwf_free(mKernelBufferFloat);
+  }
+  if (mResultBufferFloat)
+  {
+    fftwf_free(mResultBufferFloat);
+  }
+#endif // CEDAR_USE_FFTW_FLOAT
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // methods
 //----------------------------------------------------------------------------------------------------------------------
@@ -95,17 +137,39 @@ cv::Mat cedar::aux::conv::FFTW::convolve
 (
   const cv::Mat& matrix,
   cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode,
+  bool alternateEvenCenter
+) const
+{
+  cv::Mat output;
+  this->convolveInto(matrix, output, borderType, mode, alternateEvenCenter);
+  return output;
+}
+
+void cedar::aux::conv::FFTW::convolveInto
+(
+  const cv::Mat& matrix,
+  cv::Mat& output,
+  cedar::aux::conv::BorderType::Id borderType,
   cedar::aux::conv::Mode::Id /* mode */,
   bool alternateEvenCenter
 ) const
 {
   if (this->getKernelList()->size() > 0)
   {
-    return this->convolveInternal(matrix, this->getKernelList()->getCombinedKernel(), borderType, alternateEvenCenter);
+    this->convolveInternal
+    (
+      matrix,
+      this->getCachedCombinedKernel(this->getKernelList()),
+      output,
+      borderType,
+      alternateEvenCenter
+    );
   }
   else
   {
-    return cv::Mat(matrix.dims, matrix.size, matrix.type(), cv::Scalar(0.0));
+    this->prepareOutput(matrix, output, matrix.type());
+    output = 0.0;
   }
 }
 
@@ -147,8 +211,9 @@ cv::Mat cedar::aux::conv::FFTW::convolve
 {
   if (kernelList->size() > 0)
   {
-    this->kernelChanged();
-    return this->convolveInternal(matrix, kernelList->getCombinedKernel(), borderType, alternateEvenCenter);
+    // all kernels are summed up in the combined kernel, so the whole list is applied with a single transform; as long
+    // as the same list is passed, its transform is reused
+    return this->convolveInternal(matrix, this->getCachedCombinedKernel(kernelList), borderType, alternateEvenCenter);
   }
   else
   {
@@ -156,13 +221,104 @@ cv::Mat cedar::aux::conv::FFTW::convolve
   }
 }
 
+/*! Convolving with the sum of the kernels is the same as summing the convolutions with each kernel. Thus, the combined
+ *  kernel of a list is transformed once and all kernels are applied by a single pointwise product in the Fourier domain.
+ */
+const cv::Mat& cedar::aux::conv::FFTW::getCachedCombinedKernel(cedar::aux::conv::ConstKernelListPtr kernelList) const
+{
+  QWriteLocker write_lock(&this->mKernelTransformLock);
+  cedar::aux::conv::ConstKernelListPtr previous_list = this->mCombinedKernelSource.lock();
+  if (previous_list != kernelList)
+  {
+    // changes to the own kernel list are already tracked via kernelListChanged; other lists are tracked while in use
+    if (previous_list && previous_list != this->getKernelList())
+    {
+      QObject::disconnect(previous_list.get(), SIGNAL(combinedKernelUpdated()), this, SLOT(kernelChanged()));
+    }
+    if (kernelList != this->getKernelList())
+    {
+      QObject::connect(kernelList.get(), SIGNAL(combinedKernelUpdated()), this, SLOT(kernelChanged()));
+    }
+    this->mCombinedKernelSource = kernelList;
+    this->mFetchCombinedKernel = true;
+    this->mRetransformKernel = true;
+    this->mRetransformKernelFloat = true;
+  }
+
+  // getCombinedKernel returns a copy, so only fetch it if it has actually changed
+  if (this->mFetchCombinedKernel)
+  {
+    this->mCombinedKernel = kernelList->getCombinedKernel();
+    this->mFetchCombinedKernel = false;
+    // the cached spectra may belong to a kernel passed explicitly in the meantime, which already consumed the flags
+    this->mRetransformKernel = true;
+    this->mRetransformKernelFloat = true;
+  }
+  return this->mCombinedKernel;
+}
+
+void cedar::aux::conv::FFTW::prepareOutput(const cv::Mat& matrix, cv::Mat& output, int type) const
+{
+  // fftw writes the result directly into the output, so it has to be continuous and aligned like the planning buffers
+  if
+  (
+    output.dims != matrix.dims
+    || output.size != matrix.size
+    || output.type() != type
+    || !output.isContinuous()
+    || reinterpret_cast<size_t>(output.data) % 16 != 0
+  )
+  {
+    output = cv::Mat(matrix.dims, matrix.size, type);
+  }
+}
+
+unsigned int cedar::aux::conv::FFTW::getTransformedSize
+             (
+               const cv::Mat& matrix,
+               std::vector<unsigned int>& sizes,
+               double& numberOfElements
+             )
+{
+  unsigned int dimensionality = cedar::aux::math::getDimensionalityOf(matrix);
+  sizes.resize(dimensionality);
+  unsigned int transformed_elements = 1;
+  numberOfElements = 1.0;
+  for (unsigned int dim = 0 ; dim < dimensionality; ++dim)
+  {
+    sizes.at(dim) = static_cast<unsigned int>(matrix.size[dim]);
+    if (dim < dimensionality - 1)
+    {
+      transformed_elements *= matrix.size[dim];
+    }
+    numberOfElements *= matrix.size[dim];
+  }
+  // the last dimension only stores the non-redundant half of the spectrum
+  transformed_elements *= matrix.size[dimensionality - 1] / 2 + 1;
+  return transformed_elements;
+}
+
 cv::Mat cedar::aux::conv::FFTW::convolveInternal
         (
-          const cv::Mat& matrixIn,
-          const cv::Mat& kernelIn,
-          cedar::aux::conv::BorderType::Id /* borderType */,
+          const cv::Mat& matrix,
+          const cv::Mat& kernel,
+          cedar::aux::conv::BorderType::Id borderType,
           bool alternateEvenCenter
         ) const
+{
+  cv::Mat output;
+  this->convolveInternal(matrix, kernel, output, borderType, alternateEvenCenter);
+  return output;
+}
+
+void cedar::aux::conv::FFTW::convolveInternal
+     (
+       const cv::Mat& matrixIn,
+       const cv::Mat& kernelIn,
+       cv::Mat& output,
+       cedar::aux::conv::BorderType::Id /* borderType */,
+       bool alternateEvenCenter
+     ) const
 {
   cv::Mat matrix, kernel;
   if (alternateEvenCenter)
@@ -171,13 +327,15 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     std::vector<bool> flipped;
     flipped.assign(cedar::aux::math::getDimensionalityOf(matrixIn), true);
 
-    // preallocate the flipped matrices (cedar::aux::math::flip expects this)
-    matrix = 0.0 * matrixIn.clone();
-    kernel = 0.0 * kernelIn.clone();
+    // preallocate the flipped matrices (cedar::aux::math::flip expects this); their memory is kept between calls
+    this->mFlippedMatrix.create(matrixIn.dims, matrixIn.size, matrixIn.type());
+    this->mFlippedKernel.create(kernelIn.dims, kernelIn.size, kernelIn.type());
 
     // flip the matrices
-    cedar::aux::math::flip(matrixIn, matrix, flipped);
-    cedar::aux::math::flip(kernelIn, kernel, flipped);
+    cedar::aux::math::flip(matrixIn, this->mFlippedMatrix, flipped);
+    cedar::aux::math::flip(kernelIn, this->mFlippedKernel, flipped);
+    matrix = this->mFlippedMatrix;
+    kernel = this->mFlippedKernel;
   }
   else
   {
@@ -187,11 +345,13 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
 
   if (cedar::aux::math::getDimensionalityOf(kernel) == 0)
   {
-    return matrix * cedar::aux::math::getMatrixEntry<double>(kernel, 0, 0);
+    output = matrix * cedar::aux::math::getMatrixEntry<double>(kernel, 0, 0);
+    return;
   }
   else if (cedar::aux::math::getDimensionalityOf(matrix) == 0)
   {
-    return cv::Mat(1, 1, kernel.type(), cv::sum(kernel * cedar::aux::math::getMatrixEntry<double>(matrix, 0, 0)));
+    output = cv::Mat(1, 1, kernel.type(), cv::sum(kernel * cedar::aux::math::getMatrixEntry<double>(matrix, 0, 0)));
+    return;
   }
   //!@todo Why the - 1?
   for (unsigned int dim = 0 ; dim < cedar::aux::math::getDimensionalityOf(matrix) - 1; ++dim)
@@ -208,43 +368,46 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     }
   }
 
-  cv::Mat matrix_64;
-  cv::Mat kernel_64;
-  if (matrix.type() != CV_64F)
+  // when alternating the kernel center, the result is flipped back into the output
+  cv::Mat& result = alternateEvenCenter ? this->mUnflippedOutput : output;
+
+#ifdef CEDAR_USE_FFTW_FLOAT
+  if (matrix.type() == CV_32F)
   {
-    matrix.convertTo(matrix_64, CV_64F);
+    this->convolveFloat(matrix, kernel, result);
   }
   else
+#endif // CEDAR_USE_FFTW_FLOAT
   {
-    CEDAR_ASSERT(matrix.type() == CV_64F);
-    matrix_64 = matrix;
+    this->convolveDouble(matrix, kernel, result);
   }
 
-  if (kernel.type() != CV_64F)
-  {
-    kernel.convertTo(kernel_64, CV_64F);
-  }
-  else
+  if (alternateEvenCenter)
   {
-    CEDAR_ASSERT(kernel.type() == CV_64F);
-    kernel_64 = kernel;
+    // to alternate the kernel center, we flip all inputs and then flip the result back
+    std::vector<bool> flipped;
+    flipped.assign(cedar::aux::math::getDimensionalityOf(matrixIn), true);
+    output.create(result.dims, result.size, result.type());
+    cedar::aux::math::flip(result, output, flipped);
   }
+}
 
-  cv::Mat output = matrix_64.clone();
-  output = 0.0;
-  cv::Mat padded_kernel = this->padKernel(matrix_64, kernel_64);
-
-  unsigned int transformed_elements = 1;
-  double number_of_elements = 1.0;
-  for (unsigned int dim = 0 ; dim < cedar::aux::math::getDimensionalityOf(matrix_64) - 1; ++dim)
+void cedar::aux::conv::FFTW::convolveDouble(const cv::Mat& matrix, const cv::Mat& kernel, cv::Mat& output) const
+{
+  const cv::Mat* p_matrix_64 = &matrix;
+  if (matrix.type() != CV_64F || !matrix.isContinuous())
   {
-    transformed_elements *= matrix_64.size[dim];
-    number_of_elements *= matrix_64.size[dim];
+    matrix.convertTo(this->mConvertedMatrix, CV_64F);
+    p_matrix_64 = &this->mConvertedMatrix;
   }
-  transformed_elements *= matrix_64.size[cedar::aux::math::getDimensionalityOf(matrix_64) -1] / 2 + 1;
-  number_of_elements *= matrix_64.size[cedar::aux::math::getDimensionalityOf(matrix_64) -1];
+  const cv::Mat& matrix_64 = *p_matrix_64;
 
-  if (transformed_elements != mAllocatedSize)
+  std::vector<unsigned int> mat_sizes;
+  double number_of_elements;
+  unsigned int transformed_elements = cedar::aux::conv::FFTW::getTransformedSize(matrix_64, mat_sizes, number_of_elements);
+  unsigned int dimensionality = static_cast<unsigned int>(mat_sizes.size());
+
+  if (transformed_elements != mAllocatedSize || mat_sizes != mTransformedSizes)
   {
     if (mMatrixBuffer)
     {
@@ -265,31 +428,29 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     mResultBuffer = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
     mKernelBuffer = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
     mAllocatedSize = transformed_elements;
+    mTransformedSizes = mat_sizes;
     QWriteLocker write_lock(&this->mKernelTransformLock);
     this->mRetransformKernel = true;
   }
 
-//  fftw_execute(matrix_plan_forward);
-  std::vector<unsigned int> mat_sizes(cedar::aux::math::getDimensionalityOf(matrix_64));
-  for (unsigned int dim = 0; dim < mat_sizes.size(); ++dim)
-  {
-   mat_sizes.at(dim) = static_cast<unsigned int>(matrix.size[dim]);
-  }
-
   fftw_execute_dft_r2c
   (
-    cedar::aux::conv::FFTW::getForwardPlan(cedar::aux::math::getDimensionalityOf(matrix_64), mat_sizes),
+    cedar::aux::conv::FFTW::getForwardPlan(dimensionality, mat_sizes),
     const_cast<double*>(matrix_64.ptr<double>()),
     mMatrixBuffer
   );
 
+  // the padded kernel and its transform are kept until the kernel changes
   QWriteLocker write_lock(&this->mKernelTransformLock);
   if (this->mRetransformKernel)
   {
+    cv::Mat kernel_64;
+    kernel.convertTo(kernel_64, CV_64F);
+    this->mPaddedKernel = this->padKernel(matrix_64, kernel_64);
     fftw_execute_dft_r2c
     (
-      cedar::aux::conv::FFTW::getForwardPlan(cedar::aux::math::getDimensionalityOf(padded_kernel), mat_sizes),
-      const_cast<double*>(padded_kernel.ptr<double>()),
+      cedar::aux::conv::FFTW::getForwardPlan(dimensionality, mat_sizes),
+      this->mPaddedKernel.ptr<double>(),
       mKernelBuffer
     );
     this->mRetransformKernel = false;
@@ -304,36 +465,121 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     mResultBuffer[xyz][1] = (mKernelBuffer[xyz][1] * mMatrixBuffer[xyz][0] + mKernelBuffer[xyz][0] * mMatrixBuffer[xyz][1]) / number_of_elements;
   }
 
-  // transform interaction back to time domain (ifft)
-  fftw_execute_dft_c2r
-  (
-    cedar::aux::conv::FFTW::getBackwardPlan(cedar::aux::math::getDimensionalityOf(output), mat_sizes),
-    mResultBuffer,
-    const_cast<double*>(output.ptr<double>())
-  );
-
-  cv::Mat returned;
-  if (matrix.type() != CV_64F)
+  // transform interaction back to time domain (ifft); if possible, directly into the output
+  if (matrix.type() == CV_64F)
   {
-    output.convertTo(returned, matrix.type());
+    this->prepareOutput(matrix_64, output, CV_64F);
+    fftw_execute_dft_c2r
+    (
+      cedar::aux::conv::FFTW::getBackwardPlan(dimensionality, mat_sizes),
+      mResultBuffer,
+      output.ptr<double>()
+    );
   }
   else
   {
-    returned = output;
+    this->prepareOutput(matrix_64, this->mOutputBuffer, CV_64F);
+    fftw_execute_dft_c2r
+    (
+      cedar::aux::conv::FFTW::getBackwardPlan(dimensionality, mat_sizes),
+      mResultBuffer,
+      this->mOutputBuffer.ptr<double>()
+    );
+    // convertTo reuses the memory of the output if it already has the right size and type
+    this->mOutputBuffer.convertTo(output, matrix.type());
   }
+}
 
-  if (alternateEvenCenter)
+#ifdef CEDAR_USE_FFTW_FLOAT
+void cedar::aux::conv::FFTW::convolveFloat(const cv::Mat& matrixIn, const cv::Mat& kernel, cv::Mat& output) const
+{
+  CEDAR_DEBUG_ASSERT(matrixIn.type() == CV_32F);
+
+  const cv::Mat* p_matrix = &matrixIn;
+  if (!matrixIn.isContinuous())
   {
-    // to alternate the kernel center, we flip all inputs and then flip the result back
-    std::vector<bool> flipped;
-    flipped.assign(cedar::aux::math::getDimensionalityOf(matrixIn), true);
-    cv::Mat tmp_returned = returned.clone() * 0.0;
-    cedar::aux::math::flip(returned, tmp_returned, flipped);
-    returned = tmp_returned;
+    this->mConvertedMatrixFloat = matrixIn.clone();
+    p_matrix = &this->mConvertedMatrixFloat;
+  }
+  const cv::Mat& matrix = *p_matrix;
+
+  std::vector<unsigned int> mat_sizes;
+  double number_of_elements;
+  unsigned int transformed_elements = cedar::aux::conv::FFTW::getTransformedSize(matrix, mat_sizes, number_of_elements);
+  unsigned int dimensionality = static_cast<unsigned int>(mat_sizes.size());
+
+  if (transformed_elements != mAllocatedSizeFloat || mat_sizes != mTransformedSizesFloat)
+  {
+    if (mMatrixBufferFloat)
+    {
+      fftwf_free(mMatrixBufferFloat);
+    }
+
+    if (mResultBufferFloat)
+    {
+      fftwf_free(mResultBufferFloat);
+    }
+
+    if (mKernelBufferFloat)
+    {
+      fftwf_free(mKernelBufferFloat);
+    }
+
+    mMatrixBufferFloat = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+    mResultBufferFloat = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+    mKernelBufferFloat = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+    mAllocatedSizeFloat = transformed_elements;
+    mTransformedSizesFloat = mat_sizes;
+    QWriteLocker write_lock(&this->mKernelTransformLock);
+    this->mRetransformKernelFloat = true;
+  }
+
+  fftwf_execute_dft_r2c
+  (
+    cedar::aux::conv::FFTW::getForwardPlanFloat(dimensionality, mat_sizes),
+    const_cast<float*>(matrix.ptr<float>()),
+    mMatrixBufferFloat
+  );
+
+  // the padded kernel and its transform are kept until the kernel changes
+  QWriteLocker write_lock(&this->mKernelTransformLock);
+  if (this->mRetransformKernelFloat)
+  {
+    cv::Mat kernel_32;
+    kernel.convertTo(kernel_32, CV_32F);
+    this->mPaddedKernelFloat = this->padKernel(matrix, kernel_32);
+    fftwf_execute_dft_r2c
+    (
+      cedar::aux::conv::FFTW::getForwardPlanFloat(dimensionality, mat_sizes),
+      this->mPaddedKernelFloat.ptr<float>(),
+      mKernelBufferFloat
+    );
+    this->mRetransformKernelFloat = false;
+  }
+  write_lock.unlock();
+
+  const float normalization = static_cast<float>(1.0 / number_of_elements);
+  for (unsigned int xyz = 0; xyz < transformed_elements; ++xyz)
+  {
+    // complex multiplication (lateral)
+    mResultBufferFloat[xyz][0]
+      = (mKernelBufferFloat[xyz][0] * mMatrixBufferFloat[xyz][0] - mKernelBufferFloat[xyz][1] * mMatrixBufferFloat[xyz][1])
+        * normalization;
+    mResultBufferFloat[xyz][1]
+      = (mKernelBufferFloat[xyz][1] * mMatrixBufferFloat[xyz][0] + mKernelBufferFloat[xyz][0] * mMatrixBufferFloat[xyz][1])
+        * normalization;
   }
 
-  return returned;
+  // transform interaction back to time domain (ifft), directly into the output
+  this->prepareOutput(matrix, output, CV_32F);
+  fftwf_execute_dft_c2r
+  (
+    cedar::aux::conv::FFTW::getBackwardPlanFloat(dimensionality, mat_sizes),
+    mResultBufferFloat,
+    output.ptr<float>()
+  );
 }
+#endif // CEDAR_USE_FFTW_FLOAT
 
 cv::Mat cedar::aux::conv::FFTW::padKernel(const cv::Mat& matrix, const cv::Mat& kernel) const
 {
@@ -498,17 +744,32 @@ bool cedar::aux::conv::FFTW::checkModeCapability
   return mode == cedar::aux::conv::Mode::Same;
 }
 
+std::string cedar::aux::conv::FFTW::getWisdomPath(const std::string& uniqueIdentifier)
+{
+  return cedar::aux::getUserApplicationDataDirectory()
+           + "/.cedar/fftw/fftw."
+           + CEDAR_BUILT_ON_MACHINE + "."
+           + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
+           + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
+           + uniqueIdentifier + "."
+           + "wisdom";
+}
+
+std::string cedar::aux::conv::FFTW::getPlanIdentifier(const std::vector<unsigned int>& sizes)
+{
+  std::string unique_identifier = cedar::aux::toString(sizes.at(0));
+  for (unsigned int i = 1; i < sizes.size(); ++i)
+  {
+    unique_identifier += "." + cedar::aux::toString(sizes.at(i));
+  }
+  return unique_identifier;
+}
+
 void cedar::aux::conv::FFTW::loadWisdom(const std::string& uniqueIdentifier)
 {
   if (cedar::aux::conv::FFTW::mLoadedWisdoms.find(uniqueIdentifier) == cedar::aux::conv::FFTW::mLoadedWisdoms.end())
   {
-    std::string path = cedar::aux::getUserApplicationDataDirectory()
-                         + "/.cedar/fftw/fftw."
-                         + CEDAR_BUILT_ON_MACHINE + "."
-                         + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
-                         + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
-                         + uniqueIdentifier + "."
-                         + "wisdom";
+    std::string path = cedar::aux::conv::FFTW::getWisdomPath(uniqueIdentifier);
     fftw_import_wisdom_from_filename(path.c_str());
     cedar::aux::conv::FFTW::mLoadedWisdoms.insert(uniqueIdentifier);
   }
@@ -516,26 +777,16 @@ void cedar::aux::conv::FFTW::loadWisdom(const std::string& uniqueIdentifier)
 
 void cedar::aux::conv::FFTW::saveWisdom(const std::string& uniqueIdentifier)
 {
-  cedar::aux::Path path = cedar::aux::getUserApplicationDataDirectory()
-                          + "/.cedar/fftw/fftw."
-                          + CEDAR_BUILT_ON_MACHINE + "."
-                          + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
-                          + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
-                          + uniqueIdentifier + "."
-                          + "wisdom";
+  cedar::aux::Path path = cedar::aux::conv::FFTW::getWisdomPath(uniqueIdentifier);
   path.createDirectories();
-                       
+
   fftw_export_wisdom_to_filename(path.toString().c_str());
 }
 
 fftw_plan cedar::aux::conv::FFTW::getForwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes)
 {
   CEDAR_ASSERT(sizes.size() == dimensionality);
-  std::string unique_identifier = cedar::aux::toString(sizes.at(0));
-  for (unsigned int i = 1; i < sizes.size(); ++i)
-  {
-    unique_identifier += "." + cedar::aux::toString(sizes.at(i));
-  }
+  std::string unique_identifier = cedar::aux::conv::FFTW::getPlanIdentifier(sizes);
   auto entry = cedar::aux::conv::FFTW::mForwardPlans.find(unique_identifier);
   if (entry != cedar::aux::conv::FFTW::mForwardPlans.end())
   {
@@ -600,11 +851,7 @@ fftw_plan cedar::aux::conv::FFTW::getForwardPlan(unsigned int dimensionality, st
 fftw_plan cedar::aux::conv::FFTW::getBackwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes)
 {
   CEDAR_ASSERT(sizes.size() == dimensionality);
-  std::string unique_identifier = cedar::aux::toString(sizes.at(0));
-  for (unsigned int i = 1; i < sizes.size(); ++i)
-  {
-    unique_identifier += "." + cedar::aux::toString(sizes.at(i));
-  }
+  std::string unique_identifier = cedar::aux::conv::FFTW::getPlanIdentifier(sizes);
   auto entry = cedar::aux::conv::FFTW::mBackwardPlans.find(unique_identifier);
   if (entry != cedar::aux::conv::FFTW::mBackwardPlans.end())
   {
@@ -665,6 +912,146 @@ fftw_plan cedar::aux::conv::FFTW::getBackwardPlan(unsigned int dimensionality, s
   }
 }
 
+#ifdef CEDAR_USE_FFTW_FLOAT
+/*! Single-precision plans and wisdom are kept apart from the double ones; the identifiers of float wisdom are prefixed
+ *  so they end up in separate files.
+ */
+void cedar::aux::conv::FFTW::loadWisdomFloat(const std::string& uniqueIdentifier)
+{
+  std::string float_identifier = "float." + uniqueIdentifier;
+  if (cedar::aux::conv::FFTW::mLoadedWisdoms.find(float_identifier) == cedar::aux::conv::FFTW::mLoadedWisdoms.end())
+  {
+    std::string path = cedar::aux::conv::FFTW::getWisdomPath(float_identifier);
+    fftwf_import_wisdom_from_filename(path.c_str());
+    cedar::aux::conv::FFTW::mLoadedWisdoms.insert(float_identifier);
+  }
+}
+
+void cedar::aux::conv::FFTW::saveWisdomFloat(const std::string& uniqueIdentifier)
+{
+  cedar::aux::Path path = cedar::aux::conv::FFTW::getWisdomPath("float." + uniqueIdentifier);
+  path.createDirectories();
+
+  fftwf_export_wisdom_to_filename(path.toString().c_str());
+}
+
+fftwf_plan cedar::aux::conv::FFTW::getForwardPlanFloat(unsigned int dimensionality, const std::vector<unsigned int>& sizes)
+{
+  CEDAR_ASSERT(sizes.size() == dimensionality);
+  std::string unique_identifier = cedar::aux::conv::FFTW::getPlanIdentifier(sizes);
+
+  QReadLocker read_locker(&cedar::aux::conv::FFTW::mPlanLock);
+  auto entry = cedar::aux::conv::FFTW::mForwardPlansFloat.find(unique_identifier);
+  if (entry != cedar::aux::conv::FFTW::mForwardPlansFloat.end())
+  {
+    return entry->second;
+  }
+  read_locker.unlock();
+
+#ifdef CEDAR_USE_FFTW_THREADED
+  cedar::aux::conv::FFTW::initThreads();
+#endif
+  QWriteLocker plan_locker(&cedar::aux::conv::FFTW::mPlanLock);
+  // another thread may have created the plan in the meantime
+  entry = cedar::aux::conv::FFTW::mForwardPlansFloat.find(unique_identifier);
+  if (entry != cedar::aux::conv::FFTW::mForwardPlansFloat.end())
+  {
+    return entry->second;
+  }
+  cedar::aux::conv::FFTW::loadWisdomFloat(unique_identifier);
+  std::vector<int> sizes_signed(sizes.begin(), sizes.end());
+
+  cv::Mat matrix(dimensionality, &(sizes_signed.front()), CV_32F);
+  std::vector<unsigned int> dummy_sizes;
+  double number_of_elements;
+  unsigned int transformed_elements
+    = cedar::aux::conv::FFTW::getTransformedSize(matrix, dummy_sizes, number_of_elements);
+
+  fftwf_complex* matrix_fourier = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+  fftwf_plan matrix_plan_forward
+    = fftwf_plan_dft_r2c
+      (
+        static_cast<int>(dimensionality),
+        &(sizes_signed.front()),
+        matrix.ptr<float>(),
+        matrix_fourier,
+        cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategy()
+      );
+  fftwf_free(matrix_fourier);
+  if (!matrix_plan_forward)
+  {
+    plan_locker.unlock();
+    CEDAR_THROW
+    (
+      cedar::aux::NotFoundException,
+      "FFTW could not find a single-precision forward transformation plan for a matrix with sizes " + unique_identifier
+      + ". You can try to alter the planning strategy."
+    );
+  }
+  cedar::aux::conv::FFTW::mForwardPlansFloat[unique_identifier] = matrix_plan_forward;
+  cedar::aux::conv::FFTW::saveWisdomFloat(unique_identifier);
+  return matrix_plan_forward;
+}
+
+fftwf_plan cedar::aux::conv::FFTW::getBackwardPlanFloat(unsigned int dimensionality, const std::vector<unsigned int>& sizes)
+{
+  CEDAR_ASSERT(sizes.size() == dimensionality);
+  std::string unique_identifier = cedar::aux::conv::FFTW::getPlanIdentifier(sizes);
+
+  QReadLocker read_locker(&cedar::aux::conv::FFTW::mPlanLock);
+  auto entry = cedar::aux::conv::FFTW::mBackwardPlansFloat.find(unique_identifier);
+  if (entry != cedar::aux::conv::FFTW::mBackwardPlansFloat.end())
+  {
+    return entry->second;
+  }
+  read_locker.unlock();
+
+#ifdef CEDAR_USE_FFTW_THREADED
+  cedar::aux::conv::FFTW::initThreads();
+#endif
+  QWriteLocker plan_locker(&cedar::aux::conv::FFTW::mPlanLock);
+  // another thread may have created the plan in the meantime
+  entry = cedar::aux::conv::FFTW::mBackwardPlansFloat.find(unique_identifier);
+  if (entry != cedar::aux::conv::FFTW::mBackwardPlansFloat.end())
+  {
+    return entry->second;
+  }
+  cedar::aux::conv::FFTW::loadWisdomFloat(unique_identifier);
+  std::vector<int> sizes_signed(sizes.begin(), sizes.end());
+
+  cv::Mat matrix(dimensionality, &(sizes_signed.front()), CV_32F);
+  std::vector<unsigned int> dummy_sizes;
+  double number_of_elements;
+  unsigned int transformed_elements
+    = cedar::aux::conv::FFTW::getTransformedSize(matrix, dummy_sizes, number_of_elements);
+
+  fftwf_complex* matrix_fourier = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+  fftwf_plan matrix_plan_backward
+    = fftwf_plan_dft_c2r
+      (
+        static_cast<int>(dimensionality),
+        &(sizes_signed.front()),
+        matrix_fourier,
+        matrix.ptr<float>(),
+        cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategy()
+      );
+  fftwf_free(matrix_fourier);
+  if (!matrix_plan_backward)
+  {
+    plan_locker.unlock();
+    CEDAR_THROW
+    (
+      cedar::aux::NotFoundException,
+      "FFTW could not find a single-precision backward transformation plan for a matrix with sizes " + unique_identifier
+      + ". You can try to alter the planning strategy."
+    );
+  }
+  cedar::aux::conv::FFTW::mBackwardPlansFloat[unique_identifier] = matrix_plan_backward;
+  cedar::aux::conv::FFTW::saveWisdomFloat(unique_identifier);
+  return matrix_plan_backward;
+}
+#endif // CEDAR_USE_FFTW_FLOAT
+
 void cedar::aux::conv::FFTW::initThreads()
 {
 #ifdef CEDAR_USE_FFTW_THREADED
@@ -676,6 +1063,12 @@ void cedar::aux::conv::FFTW::initThreads()
     fftw_set_timelimit(30.0);
     // from now on, all plans are generated for n threads
     fftw_plan_with_nthreads(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads());
+#ifdef CEDAR_USE_FFTW_FLOAT_THREADED
+    // the single-precision library keeps its own thread settings
+    fftwf_init_threads();
+    fftwf_set_timelimit(30.0);
+    fftwf_plan_with_nthreads(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads());
+#endif // CEDAR_USE_FFTW_FLOAT_THREADED
     // make sure that we do not initialize this again
     mMultiThreadActivated = true;
   }
@@ -686,11 +1079,14 @@ void cedar::aux::conv::FFTW::kernelChanged() const
 {
   QWriteLocker write_lock(&this->mKernelTransformLock);
   this->mRetransformKernel = true;
+  this->mRetransformKernelFloat = true;
+  this->mFetchCombinedKernel = true;
 }
 
 void cedar::aux::conv::FFTW::kernelListChanged()
 {
   this->connect(this->getKernelList().get(), SIGNAL(combinedKernelUpdated()), SLOT(kernelChanged()));
+  this->kernelChanged();
 }
 
 #endif // CEDAR_FFTW
@@ -68,6 +68,9 @@ class cedar::aux::conv::FFTW : public cedar::aux::conv::Engine
   //--------------------------------------------------------------------------------------------------------------------
 public:
   FFTW();
+
+  //!@brief Destructor
+  ~FFTW();
   //--------------------------------------------------------------------------------------------------------------------
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -80,6 +83,21 @@ public:
     bool alternateEvenCenter = false
   ) const;
 
+  /*!@brief Convolves the matrix with the combined kernel of the kernel list, writing into @em output.
+   *
+   *        If @em output already has the size and type of the matrix (and is continuous), the result is transformed
+   *        back directly into its memory. Together with the cached kernel transform, a steady-state call does not
+   *        allocate any memory.
+   */
+  void convolveInto
+  (
+    const cv::Mat& matrix,
+    cv::Mat& output,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
   cv::Mat convolve
   (
     const cv::Mat& matrix,
@@ -147,6 +165,16 @@ protected:
     bool alternateEvenCenter
   ) const;
 
+  //!@brief the internal version of the convolve method that writes its result into the given output
+  void convolveInternal
+  (
+    const cv::Mat& matrix,
+    const cv::Mat& kernel,
+    cv::Mat& output,
+    cedar::aux::conv::BorderType::Id borderType,
+    bool alternateEvenCenter
+  ) const;
+
   //!@brief adjusts the size of the kernel (to matrix size) and flips sectors
   cv::Mat padKernel(const cv::Mat& matrix, const cv::Mat& kernel) const;
 
@@ -154,10 +182,44 @@ protected:
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
+  //!@brief convolution in double precision; inputs of other types are converted
+  void convolveDouble(const cv::Mat& matrix, const cv::Mat& kernel, cv::Mat& output) const;
+
+#ifdef CEDAR_USE_FFTW_FLOAT
+  //!@brief convolution of CV_32F matrices in single precision, without converting them
+  void convolveFloat(const cv::Mat& matrix, const cv::Mat& kernel, cv::Mat& output) const;
+#endif // CEDAR_USE_FFTW_FLOAT
+
+  /*!@brief returns the combined kernel of the given kernel list, fetching a new copy only if it has changed or a
+   *        different list is passed
+   */
+  const cv::Mat& getCachedCombinedKernel(cedar::aux::conv::ConstKernelListPtr kernelList) const;
+
+  //!@brief (re)allocates output, unless it already is a continuous, aligned matrix of the right size and type
+  void prepareOutput(const cv::Mat& matrix, cv::Mat& output, int type) const;
+
+  /*!@brief returns the number of complex elements in the transform of the matrix; also fills in the sizes of the
+   *        matrix and its total number of elements
+   */
+  static unsigned int getTransformedSize
+  (
+    const cv::Mat& matrix,
+    std::vector<unsigned int>& sizes,
+    double& numberOfElements
+  );
+
+  static std::string getPlanIdentifier(const std::vector<unsigned int>& sizes);
+  static std::string getWisdomPath(const std::string& uniqueIdentifier);
   static fftw_plan getForwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes);
   static fftw_plan getBackwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes);
   static void loadWisdom(const std::string& uniqueIdentifier);
   static void saveWisdom(const std::string& uniqueIdentifier);
+#ifdef CEDAR_USE_FFTW_FLOAT
+  static fftwf_plan getForwardPlanFloat(unsigned int dimensionality, const std::vector<unsigned int>& sizes);
+  static fftwf_plan getBackwardPlanFloat(unsigned int dimensionality, const std::vector<unsigned int>& sizes);
+  static void loadWisdomFloat(const std::string& uniqueIdentifier);
+  static void saveWisdomFloat(const std::string& uniqueIdentifier);
+#endif // CEDAR_USE_FFTW_FLOAT
   static void initThreads();
 
 private slots:
@@ -176,12 +238,42 @@ private:
   static std::set<std::string> mLoadedWisdoms;
   static std::map<std::string, fftw_plan> mForwardPlans;
   static std::map<std::string, fftw_plan> mBackwardPlans;
+#ifdef CEDAR_USE_FFTW_FLOAT
+  static std::map<std::string, fftwf_plan> mForwardPlansFloat;
+  static std::map<std::string, fftwf_plan> mBackwardPlansFloat;
+#endif // CEDAR_USE_FFTW_FLOAT
   mutable unsigned int mAllocatedSize;
+  mutable std::vector<unsigned int> mTransformedSizes;
   mutable fftw_complex* mMatrixBuffer;
   mutable fftw_complex* mKernelBuffer;
   mutable fftw_complex* mResultBuffer;
   // dirty flag if kernel has changed since last time
   mutable bool mRetransformKernel;
+#ifdef CEDAR_USE_FFTW_FLOAT
+  mutable unsigned int mAllocatedSizeFloat;
+  mutable std::vector<unsigned int> mTransformedSizesFloat;
+  mutable fftwf_complex* mMatrixBufferFloat;
+  mutable fftwf_complex* mKernelBufferFloat;
+  mutable fftwf_complex* mResultBufferFloat;
+#endif // CEDAR_USE_FFTW_FLOAT
+  // dirty flag if kernel has changed since the last single-precision transform
+  mutable bool mRetransformKernelFloat;
+  // dirty flag if the combined kernel of the kernel list has to be fetched again
+  mutable bool mFetchCombinedKernel;
+  mutable cv::Mat mCombinedKernel;
+  // the kernel list from which the cached combined kernel was taken
+  mutable cedar::aux::conv::ConstKernelListWeakPtr mCombinedKernelSource;
+  // padded kernels are kept until the kernel changes
+  mutable cv::Mat mPaddedKernel;
+  mutable cv::Mat mPaddedKernelFloat;
+  // preallocated intermediate matrices for inputs/outputs that cannot be used by fftw directly
+  mutable cv::Mat mConvertedMatrix;
+  mutable cv::Mat mConvertedMatrixFloat;
+  mutable cv::Mat mOutputBuffer;
+  // flipped inputs and the unflipped result used when alternating the center of even kernels
+  mutable cv::Mat mFlippedMatrix;
+  mutable cv::Mat mFlippedKernel;
+  mutable cv::Mat mUnflippedOutput;
   mutable QReadWriteLock mKernelTransformLock;
 }; // cedar::aux::conv::FFTW
 
@@ -45,6 +45,7 @@
 
 
 // SYSTEM INCLUDES
+#include <algorithm>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register type with the factory
@@ -53,6 +54,175 @@ namespace
 {
   bool registered
     = cedar::aux::conv::EngineManagerSingleton::getInstance()->registerType<cedar::aux::conv::OpenCVPtr>();
+
+  //! Number of columns of a slice that are convolved together when a pass along the first dimension is split up.
+  const int SEPARABLE_CHUNK_SIZE = 256;
+
+  /*!@brief One pass of an n-dimensional separable convolution: convolves all lines along one dimension of the source
+   *        with a one-dimensional (already flipped) kernel and writes them to the target.
+   *
+   *        The matrices are viewed as [outer x size x inner] blocks. For every block, the lines are first copied into
+   *        a padded buffer whose border is filled according to the border type, so that the inner loops run over
+   *        contiguous memory without any index checks. Blocks (or, along the first dimension, chunks of columns) are
+   *        distributed over cv::parallel_for_.
+   */
+  template <typename T>
+  class SeparablePass : public cv::ParallelLoopBody
+  {
+  public:
+    SeparablePass
+    (
+      const cv::Mat& source,
+      cv::Mat& target,
+      int dimension,
+      const std::vector<T>& kernel,
+      int anchor,
+      int cvBorderType
+    )
+    :
+    mpSource(reinterpret_cast<const T*>(source.data)),
+    mpTarget(reinterpret_cast<T*>(target.data)),
+    mSize(source.size[dimension]),
+    mOuter(1),
+    mInner(1),
+    mKernel(kernel)
+    {
+      for (int d = 0; d < dimension; ++d)
+      {
+        mOuter *= source.size[d];
+      }
+      for (int d = dimension + 1; d < source.dims; ++d)
+      {
+        mInner *= source.size[d];
+      }
+
+      mChunks = mOuter > 1 ? 1 : (mInner + SEPARABLE_CHUNK_SIZE - 1) / SEPARABLE_CHUNK_SIZE;
+
+      // position p of the padded line holds the source element p - anchor; -1 stands for zero
+      const int padded_size = mSize + static_cast<int>(mKernel.size()) - 1;
+      mSourceIndices.resize(padded_size);
+      for (int p = 0; p < padded_size; ++p)
+      {
+        mSourceIndices[p] = cv::borderInterpolate(p - anchor, mSize, cvBorderType);
+      }
+    }
+
+    //! Number of independent work items of this pass.
+    int getWorkItemCount() const
+    {
+      return mOuter * mChunks;
+    }
+
+    void operator()(const cv::Range& range) const
+    {
+      const int kernel_size = static_cast<int>(mKernel.size());
+      const int padded_size = static_cast<int>(mSourceIndices.size());
+      std::vector<T> padded;
+
+      for (int item = range.start; item < range.end; ++item)
+      {
+        const int outer = item / mChunks;
+        const int begin = (item % mChunks) * SEPARABLE_CHUNK_SIZE;
+        const int width = mChunks == 1 ? mInner : std::min(SEPARABLE_CHUNK_SIZE, mInner - begin);
+        const size_t block_offset = static_cast<size_t>(outer) * mSize * mInner + begin;
+        const T* p_source = mpSource + block_offset;
+        T* p_target = mpTarget + block_offset;
+
+        padded.resize(static_cast<size_t>(padded_size) * width);
+        for (int p = 0; p < padded_size; ++p)
+        {
+          T* p_padded = &padded[static_cast<size_t>(p) * width];
+          if (mSourceIndices[p] < 0)
+          {
+            std::fill(p_padded, p_padded + width, static_cast<T>(0));
+          }
+          else
+          {
+            const T* p_line = p_source + static_cast<size_t>(mSourceIndices[p]) * mInner;
+            std::copy(p_line, p_line + width, p_padded);
+          }
+        }
+
+        if (width == mInner)
+        {
+          // the block is contiguous, so each kernel entry is one long multiply-add over the whole block
+          const size_t count = static_cast<size_t>(mSize) * width;
+          const T first = mKernel[0];
+          for (size_t q = 0; q < count; ++q)
+          {
+            p_target[q] = first * padded[q];
+          }
+          for (int j = 1; j < kernel_size; ++j)
+          {
+            const T weight = mKernel[j];
+            const T* p_shifted = &padded[static_cast<size_t>(j) * width];
+            for (size_t q = 0; q < count; ++q)
+            {
+              p_target[q] += weight * p_shifted[q];
+            }
+          }
+        }
+        else
+        {
+          for (int x = 0; x < mSize; ++x)
+          {
+            T* p_out = p_target + static_cast<size_t>(x) * mInner;
+            const T* p_in = &padded[static_cast<size_t>(x) * width];
+            const T first = mKernel[0];
+            for (int i = 0; i < width; ++i)
+            {
+              p_out[i] = first * p_in[i];
+            }
+            for (int j = 1; j < kernel_size; ++j)
+            {
+              const T weight = mKernel[j];
+              const T* p_shifted = p_in + static_cast<size_t>(j) * width;
+              for (int i = 0; i < width; ++i)
+              {
+                p_out[i] += weight * p_shifted[i];
+              }
+            }
+          }
+        }
+      }
+    }
+
+  private:
+    const T* mpSource;
+    T* mpTarget;
+    int mSize;
+    int mOuter;
+    int mInner;
+    int mChunks;
+    const std::vector<T>& mKernel;
+    std::vector<int> mSourceIndices;
+  };
+
+  //! Applies one flipped kernel part per dimension, alternating between two buffers.
+  template <typename T>
+  cv::Mat convolveSeparableND
+  (
+    const cv::Mat& matrix,
+    const std::vector<std::vector<T> >& flippedParts,
+    const std::vector<int>& anchors,
+    int cvBorderType
+  )
+  {
+    cv::Mat source = matrix.isContinuous() ? matrix : matrix.clone();
+    cv::Mat buffers[2];
+    buffers[0].create(matrix.dims, matrix.size, matrix.type());
+    buffers[1].create(matrix.dims, matrix.size, matrix.type());
+
+    for (int d = 0; d < matrix.dims; ++d)
+    {
+      cv::Mat& target = buffers[d % 2];
+      SeparablePass<T> pass(source, target, d, flippedParts.at(d), anchors.at(d), cvBorderType);
+      cv::parallel_for_(cv::Range(0, pass.getWorkItemCount()), pass);
+      source = target;
+    }
+
+    return source;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -232,6 +402,15 @@ cv::Mat cedar::aux::conv::OpenCV::createFullMatrix
           cedar::aux::conv::BorderType::Id borderType
         ) const
 {
+  if (cedar::aux::math::getDimensionalityOf(matrix) > 2)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::UnhandledValueException,
+      "Modes other than same are only supported for matrices of up to two dimensions."
+    );
+  }
+
   // In the 0D and 1D case there is kernelRows and/or kernelCols 0 in some cases.
   // This means that nothing has to be done, but for computational reasons kernel_SIZE_ has to be set to 1 to do so.
   if (kernelRows == 0)
@@ -350,6 +529,15 @@ cv::Mat cedar::aux::conv::OpenCV::cutOutResult(
                                               unsigned int kernelCols
                                               ) const
 {
+  if (cedar::aux::math::getDimensionalityOf(result) > 2)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::UnhandledValueException,
+      "Modes other than same are only supported for matrices of up to two dimensions."
+    );
+  }
+
   // In the 0D and 1D case there is kernelRows and/or kernelCols 0 in some cases.
   // This means that nothing has to be done, but for computational reasons kernel_SIZE_ has to be set to 1 to do so.
   if (kernelRows == 0)
@@ -413,6 +601,15 @@ cv::Mat cedar::aux::conv::OpenCV::cutOutResult(
                                               unsigned int kernelCols
                                               ) const
 {
+  if (cedar::aux::math::getDimensionalityOf(result) > 2)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::UnhandledValueException,
+      "Modes other than same are only supported for matrices of up to two dimensions."
+    );
+  }
+
   // In the 0D and 1D case there is kernelRows and/or kernelCols 0 in some cases.
   // This means that nothing has to be done, but for computational reasons kernel_SIZE_ has to be set to 1 to do so.
   if (kernelRows == 0)
@@ -550,7 +747,7 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
         cv::Point anchor = cv::Point(-1, -1);
         this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
         int border_type = cedar::aux::conv::BorderType::toCvConstant(borderType);
-        result = this->cvConvolve(matrix, kernel, border_type, anchor);
+        result = this->cvConvolve(matrix, kernel, border_type, anchor, alternateEvenCenter);
       }
       break;
     case cedar::aux::conv::Mode::Full:
@@ -616,7 +813,7 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
         cedar::aux::kernel::ConstKernelPtr kernel = kernelList->getKernel(i);
         cv::Point anchor = cv::Point(-1, -1);
         this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
-        result += this->cvConvolve(matrix, kernel, border_type, anchor);
+        result += this->cvConvolve(matrix, kernel, border_type, anchor, alternateEvenCenter);
       }
 
       return result;
@@ -715,7 +912,7 @@ cv::Mat cedar::aux::conv::OpenCV::convolveSeparable
         int border_type = cedar::aux::conv::BorderType::toCvConstant(borderType);
 
         this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
-        return cvConvolve(matrix, kernel, border_type, anchor);
+        return cvConvolve(matrix, kernel, border_type, anchor, alternateEvenCenter);
       }
       break;
     case cedar::aux::conv::Mode::Full:
@@ -757,7 +954,8 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
   const cv::Mat& matrix,
   const cedar::aux::kernel::ConstKernelPtr kernel,
   int cvBorderType,
-  const cv::Point& anchor
+  const cv::Point& anchor,
+  bool alternateEvenCenter
 ) const
 {
   if
@@ -766,7 +964,7 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
       = boost::dynamic_pointer_cast<const cedar::aux::kernel::Separable>(kernel)
   )
   {
-    return this->cvConvolve(matrix, separable_kernel, cvBorderType, anchor);
+    return this->cvConvolve(matrix, separable_kernel, cvBorderType, anchor, alternateEvenCenter);
   }
   else
   {
@@ -784,7 +982,8 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
           const cv::Mat& matrix,
           const cedar::aux::kernel::ConstSeparablePtr kernel,
           int cvBorderType,
-          cv::Point anchor
+          cv::Point anchor,
+          bool alternateEvenCenter
         ) const
 {
   cv::Mat convolved;
@@ -869,7 +1068,11 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
     }
 
     default:
-      CEDAR_THROW(cedar::aux::UnhandledValueException, "Cannot convolve matrices of the given dimensionality.");
+      if (kernel->getDimensionality() != cedar::aux::math::getDimensionalityOf(matrix))
+      {
+        CEDAR_THROW(cedar::aux::UnhandledValueException, "Cannot convolve matrices of the given dimensionality.");
+      }
+      convolved = this->cvConvolveSeparableND(matrix, kernel, cvBorderType, alternateEvenCenter);
   }
 
   locker.unlock();
@@ -877,6 +1080,67 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
   return convolved;
 }
 
+cv::Mat cedar::aux::conv::OpenCV::cvConvolveSeparableND
+        (
+          const cv::Mat& matrix,
+          const cedar::aux::kernel::ConstSeparablePtr kernel,
+          int cvBorderType,
+          bool alternateEvenCenter
+        ) const
+{
+  const int dimensionality = matrix.dims;
+  CEDAR_DEBUG_ASSERT(kernel->kernelPartCount() == static_cast<size_t>(dimensionality));
+
+  // same anchor rules as translateAnchor, applied to every dimension
+  const std::vector<int>& anchor_vector = kernel->getAnchor();
+  std::vector<int> anchors(dimensionality);
+  std::vector<std::vector<double> > flipped_parts(dimensionality);
+  for (int d = 0; d < dimensionality; ++d)
+  {
+    const cv::Mat& part = kernel->getKernelPart(d);
+    int size = static_cast<int>(cedar::aux::math::get1DMatrixSize(part));
+    for (int i = size - 1; i >= 0; --i)
+    {
+      flipped_parts[d].push_back(cedar::aux::math::getMatrixEntry<double>(part, i));
+    }
+
+    int anchor = size / 2;
+    if (static_cast<size_t>(d) < anchor_vector.size())
+    {
+      anchor = cedar::aux::math::saturate(size / 2 + anchor_vector.at(d), 0, size - 1);
+    }
+    if (alternateEvenCenter && size % 2 == 0 && anchor > 0)
+    {
+      anchor -= 1;
+    }
+    anchors[d] = anchor;
+  }
+
+  switch (matrix.depth())
+  {
+    case CV_64F:
+      return convolveSeparableND<double>(matrix, flipped_parts, anchors, cvBorderType);
+
+    case CV_32F:
+    {
+      std::vector<std::vector<float> > float_parts(dimensionality);
+      for (int d = 0; d < dimensionality; ++d)
+      {
+        float_parts[d].assign(flipped_parts[d].begin(), flipped_parts[d].end());
+      }
+      return convolveSeparableND<float>(matrix, float_parts, anchors, cvBorderType);
+    }
+
+    default:
+    {
+      cv::Mat converted, result;
+      matrix.convertTo(converted, CV_64F);
+      convolveSeparableND<double>(converted, flipped_parts, anchors, cvBorderType).convertTo(result, matrix.type());
+      return result;
+    }
+  }
+}
+
 cv::Mat cedar::aux::conv::OpenCV::convolve
         (
           const cv::Mat& matrix,
@@ -920,7 +1184,7 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
               cv::Point anchor = cv::Point(-1, -1);
               this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
 
-              convolved = this->cvConvolve(matrix, kernel, cv_border_type, anchor);
+              convolved = this->cvConvolve(matrix, kernel, cv_border_type, anchor, alternateEvenCenter);
               break;
             }
 
@@ -256,12 +256,18 @@ private:
     cv::Point anchor
   ) const;
 
+  /*!@brief Convolves the matrix with a separable kernel.
+   *
+   *        Matrices of more than two dimensions are convolved by cvConvolveSeparableND; the anchor is then determined
+   *        from the kernel and alternateEvenCenter instead of from the given point.
+   */
   cv::Mat cvConvolve
   (
     const cv::Mat& matrix,
     const cedar::aux::kernel::ConstSeparablePtr kernel,
     int cvBorderType,
-    cv::Point anchor
+    cv::Point anchor,
+    bool alternateEvenCenter = false
   ) const;
 
   cv::Mat cvConvolve
@@ -269,7 +275,21 @@ private:
     const cv::Mat& matrix,
     const cedar::aux::kernel::ConstKernelPtr kernel,
     int cvBorderType,
-    const cv::Point& anchor
+    const cv::Point& anchor,
+    bool alternateEvenCenter = false
+  ) const;
+
+  /*!@brief Convolves a matrix of three or more dimensions with a separable kernel of the same dimensionality.
+   *
+   *        Each kernel part is applied as a one-dimensional pass along its dimension; the lines of each pass are
+   *        distributed over several threads. The kernel has to be locked by the caller.
+   */
+  cv::Mat cvConvolveSeparableND
+  (
+    const cv::Mat& matrix,
+    const cedar::aux::kernel::ConstSeparablePtr kernel,
+    int cvBorderType,
+    bool alternateEvenCenter
   ) const;
 
   //--------------------------------------------------------------------------------------------------------------------
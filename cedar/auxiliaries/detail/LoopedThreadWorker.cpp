@@ -37,6 +37,8 @@
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/detail/LoopedThreadWorker.h"
 #include "cedar/auxiliaries/LoopedThread.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/CallOnScopeExit.h"
 #include "cedar/auxiliaries/Log.h"
 #include "cedar/auxiliaries/Settings.h"
 #include "cedar/auxiliaries/stringFunctions.h"
@@ -119,6 +121,46 @@ void cedar::aux::detail::LoopedThreadWorker::work()
     // DEPRECATED:
     case cedar::aux::LoopMode::Simulated:
     {
+      auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+      if (clock->isLockstep())
+      {
+        // the global clock decides when to step; steps are run back to back, without sleeping. The thread is usually
+        // registered when it is started already; this covers lockstep mode being enabled in between.
+        clock->registerLockstepThread(mpWrapper);
+        // the other lockstep threads wait for this one, so it has to leave the lockstep even if a step throws
+        cedar::aux::CallOnScopeExit unregister
+        (
+          boost::bind(&cedar::aux::GlobalClock::unregisterLockstepThread, clock, mpWrapper)
+        );
+        while (!safeStopRequested())
+        {
+          QReadLocker locker(this->mTimeFactor.getLockPtr());
+          double time_factor = this->mTimeFactor.member();
+          locker.unlock();
+
+          cedar::unit::Time step_time = mpWrapper->getSimulatedTimeParameter() * time_factor;
+          if
+          (
+            !clock->waitForLockstepTurn
+            (
+              mpWrapper,
+              step_time,
+              boost::bind(&cedar::aux::detail::LoopedThreadWorker::safeStopRequested, this)
+            )
+          )
+          {
+            break;
+          }
+          cedar::aux::CallOnScopeExit finish
+          (
+            boost::bind(&cedar::aux::GlobalClock::finishLockstepStep, clock, mpWrapper)
+          );
+          mpWrapper->step(step_time);
+          updateStatistics(1);
+        }
+        break;
+      }
+
       while (!safeStopRequested())
       {
         QReadLocker locker(this->mTimeFactor.getLockPtr());
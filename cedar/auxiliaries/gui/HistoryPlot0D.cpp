@@ -133,8 +133,15 @@ bool cedar::aux::gui::HistoryPlot0D::canAppend(cedar::aux::ConstDataPtr data) co
     return false;
   }
 
-  QReadLocker locker(&mat_data->getLock());
-  if (mat_data->isEmpty() || mat_data->getDimensionality() != 0)
+  // read a snapshot rather than the data itself so that the step writing the data never waits for the plot
+  auto snapshot = mat_data->getSnapshot();
+  if (!snapshot.isValid())
+  {
+    return false;
+  }
+
+  const cv::Mat& matrix = snapshot.getMatrix();
+  if (matrix.empty() || cedar::aux::math::getDimensionalityOf(matrix) != 0)
   {
     return false;
   }
@@ -172,24 +179,34 @@ void cedar::aux::gui::HistoryPlot0D::init()
 
 void cedar::aux::gui::HistoryPlot0D::advanceHistory()
 {
-  // update the markers for the current value
-#ifdef CEDAR_USE_QWT
+  // read snapshots rather than the data itself so that the steps writing the data never wait for the plot
+  std::vector<cv::Mat> current_values;
+  current_values.reserve(this->mPlotData.size());
   for (auto& plot_data : this->mPlotData)
   {
-    QReadLocker data_locker(&plot_data.mData->getLock());
+    auto snapshot = plot_data.mData->getSnapshot();
+    if (!snapshot.isValid())
+    {
+      // nothing to show yet; try again with the next tick
+      return;
+    }
 
-    if (plot_data.mData->getDimensionality() != 0)
+    if (cedar::aux::math::getDimensionalityOf(snapshot.getMatrix()) != 0)
     {
-      data_locker.unlock();
+      snapshot.release();
       emit dataChanged();
       return;
     }
 
-    cv::Mat now = plot_data.mData->getData().clone();
-    data_locker.unlock();
+    current_values.push_back(snapshot.getMatrix().clone());
+  }
 
-    double value = cedar::aux::math::getMatrixEntry<double>(now, 0);
-    plot_data.mpZeroMarker->setYValue(value);
+  // update the markers for the current value
+#ifdef CEDAR_USE_QWT
+  for (size_t i = 0; i < this->mPlotData.size(); ++i)
+  {
+    double value = cedar::aux::math::getMatrixEntry<double>(current_values.at(i), 0);
+    this->mPlotData.at(i).mpZeroMarker->setYValue(value);
   }
 #endif // CEDAR_USE_QWT
 
@@ -203,19 +220,10 @@ void cedar::aux::gui::HistoryPlot0D::advanceHistory()
   this->mTimeOfLastUpdate = time_now;
 
   // add current value to history
-  for (auto& plot_data : this->mPlotData)
+  for (size_t i = 0; i < this->mPlotData.size(); ++i)
   {
-    QReadLocker data_locker(&plot_data.mData->getLock());
-
-    if (plot_data.mData->getDimensionality() != 0)
-    {
-      data_locker.unlock();
-      emit dataChanged();
-      return;
-    }
-
-    cv::Mat now = plot_data.mData->getData().clone();
-    data_locker.unlock();
+    auto& plot_data = this->mPlotData.at(i);
+    const cv::Mat& now = current_values.at(i);
 
     QWriteLocker hist_locker(&plot_data.mHistory->getLock());
     const cv::Mat& current_hist = plot_data.mHistory->getData();
@@ -207,20 +207,27 @@ void cedar::aux::gui::ImagePlot::plotClicked(QMouseEvent* pEvent, double relativ
 //!@cond SKIPPED_DOCUMENTATION
 bool cedar::aux::gui::ImagePlot::doConversion()
 {
-  QReadLocker read_lock(&this->mData->getLock());
+  cedar::aux::gui::PlotInterface::ConversionTimer conversion_timer(this);
 
   if (this->mDataType == DATA_TYPE_UNKNOWN)
   {
     return false;
   }
 
-  if (this->mData->getDimensionality() > 2)
+  // read a snapshot rather than the data itself so that the step writing the data never waits for the plot
+  auto snapshot = this->mData->getSnapshot();
+  if (!snapshot.isValid())
   {
-    this->setInfo("cannot display matrices of dimensionality > 2");
     return false;
   }
 
-  const cv::Mat& mat = this->mData->getData();
+  const cv::Mat& mat = snapshot.getMatrix();
+
+  if (cedar::aux::math::getDimensionalityOf(mat) > 2)
+  {
+    this->setInfo("cannot display matrices of dimensionality > 2");
+    return false;
+  }
 
   if (mat.empty())
   {
@@ -239,8 +246,8 @@ bool cedar::aux::gui::ImagePlot::doConversion()
     case CV_16UC1:
     case CV_8UC1:
     {
-      cv::Mat copy = this->mData->getData().clone();
-      read_lock.unlock();
+      cv::Mat copy = mat.clone();
+      snapshot.release();
       cv::Mat converted = this->threeChannelGrayscale(copy);
       CEDAR_DEBUG_ASSERT(converted.type() == CV_8UC3);
       this->displayMatrix(converted);
@@ -263,7 +270,7 @@ bool cedar::aux::gui::ImagePlot::doConversion()
         cv::Mat converted;
         cv::cvtColor
         (
-          this->mData->getData(),
+          mat,
           converted,
 #if CEDAR_OPENCV_MAJOR_VERSION >= 3
           cv::COLOR_HSV2BGR
@@ -271,13 +278,13 @@ bool cedar::aux::gui::ImagePlot::doConversion()
           CV_HSV2BGR
 #endif
         );
-				read_lock.unlock();
+        snapshot.release();
         this->displayMatrix(converted);
       }
       else
       {
-        this->displayMatrix(this->mData->getData());
-				read_lock.unlock();
+        this->displayMatrix(mat);
+        snapshot.release();
       }
       break;
     }
@@ -287,7 +294,7 @@ bool cedar::aux::gui::ImagePlot::doConversion()
     {
       // convert grayscale to three-channel matrix
       cv::Mat copy = mat.clone();
-      read_lock.unlock();
+      snapshot.release();
       cv::Mat converted = this->threeChannelGrayscale(copy);
       CEDAR_DEBUG_ASSERT(converted.type() == CV_8UC3);
       this->displayMatrix(converted);
@@ -298,7 +305,7 @@ bool cedar::aux::gui::ImagePlot::doConversion()
     {
       // convert grayscale to three-channel matrix
       cv::Mat copy = mat.clone();
-      read_lock.unlock();
+      snapshot.release();
       cv::Mat channels[3];
       double min_all = std::numeric_limits<double>::max(), max_all = -std::numeric_limits<double>::max();
       cv::split(copy, channels);
@@ -325,8 +332,8 @@ bool cedar::aux::gui::ImagePlot::doConversion()
 
     default:
     {
-      read_lock.unlock();
       std::string matrix_type_name = cedar::aux::math::matrixTypeToString(mat);
+      snapshot.release();
       this->setInfo("Cannot display matrix of type " + matrix_type_name + ".");
       return false;
     }
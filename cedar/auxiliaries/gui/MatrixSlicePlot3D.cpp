@@ -306,21 +306,28 @@ bool cedar::aux::gui::MatrixSlicePlot3D::doConversion()
     return false;
   }
 
-  QReadLocker locker(&this->mData->getLock());
-  if (this->mData->getDimensionality() != 3) // plot is no longer capable of displaying the data
+  // read a snapshot rather than the data itself so that the step writing the data never waits for the plot
+  auto snapshot = this->mData->getSnapshot();
+  if (!snapshot.isValid())
   {
+    return false;
+  }
+
+  const cv::Mat& mat = snapshot.getMatrix();
+  if (cedar::aux::math::getDimensionalityOf(mat) != 3) // plot is no longer capable of displaying the data
+  {
+    snapshot.release();
     emit dataChanged();
     return false;
   }
 
-  const cv::Mat& mat = this->mData->getData();
   if (mat.empty())
   {
     this->setInfo("Matrix is empty.");
     return false;
   }
   cv::Mat cloned_mat = mat.clone();
-  locker.unlock();
+  snapshot.release();
 #ifdef CEDAR_SLICE_PLOT_OPENCV_BACKWARDS_COMPATIBILITY_MODE
   switch(cloned_mat.type())
   {
@@ -382,14 +389,18 @@ void cedar::aux::gui::MatrixSlicePlot3D::plotClicked(QMouseEvent* pEvent, double
 
   cedar::aux::gui::MatrixSlicePlot3D::getSetup(dim_0, dim_1, dim_sliced);
 
-  QReadLocker locker(&this->mData->getLock());
+  auto snapshot = this->mData->getSnapshot();
+  if (!snapshot.isValid())
+  {
+    return;
+  }
 
   int padding = 1;
 
   int idx_row = static_cast<int>(relativeImageY * static_cast<double>(mSliceMatrix.rows));
   int idx_col = static_cast<int>(relativeImageX * static_cast<double>(mSliceMatrix.cols));
 
-  cv::Mat mat = this->mData->getData();
+  const cv::Mat& mat = snapshot.getMatrix();
   auto size = mat.size;
 
   int idx_2_per_row = mSliceMatrix.cols / (size[dim_1] + padding) + 1; // +1 because there is no padding on the right side
@@ -446,8 +457,8 @@ void cedar::aux::gui::MatrixSlicePlot3D::plotClicked(QMouseEvent* pEvent, double
       info_text = info_text.arg("-");
   }
 
+  snapshot.release();
   QToolTip::showText(pEvent->globalPos(), info_text);
-  locker.unlock();
 }
 
 
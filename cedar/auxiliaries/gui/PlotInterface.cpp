@@ -36,8 +36,10 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/gui/PlotInterface.h"
+#include "cedar/units/prefixes.h"
 
 // SYSTEM INCLUDES
+#include <boost/date_time/posix_time/posix_time.hpp>
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -45,7 +47,8 @@
 
 cedar::aux::gui::PlotInterface::PlotInterface(QWidget *pParent)
 :
-QWidget(pParent)
+QWidget(pParent),
+mConversionTimes(cedar::aux::MovingAverage<cedar::unit::Time>(20))
 {
 }
 
@@ -56,3 +59,68 @@ cedar::aux::gui::PlotInterface::~PlotInterface()
 //----------------------------------------------------------------------------------------------------------------------
 // methods
 //----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::gui::PlotInterface::ConversionTimer::ConversionTimer(cedar::aux::gui::PlotInterface* pPlot)
+:
+mpPlot(pPlot),
+mStart(boost::posix_time::microsec_clock::universal_time())
+{
+}
+
+cedar::aux::gui::PlotInterface::ConversionTimer::~ConversionTimer()
+{
+  boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::universal_time() - this->mStart;
+  this->mpPlot->appendConversionTime
+  (
+    cedar::unit::Time(elapsed.total_microseconds() * cedar::unit::micro * cedar::unit::seconds)
+  );
+}
+
+void cedar::aux::gui::PlotInterface::appendConversionTime(const cedar::unit::Time& time)
+{
+  QWriteLocker locker(this->mConversionTimes.getLockPtr());
+  this->mConversionTimes.member().append(time);
+}
+
+bool cedar::aux::gui::PlotInterface::hasConversionTimeMeasurement() const
+{
+  {
+    QReadLocker locker(this->mConversionTimes.getLockPtr());
+    if (this->mConversionTimes.member().size() > 0)
+    {
+      return true;
+    }
+  }
+
+  for (auto p_plot : this->findChildren<cedar::aux::gui::PlotInterface*>())
+  {
+    QReadLocker locker(p_plot->mConversionTimes.getLockPtr());
+    if (p_plot->mConversionTimes.member().size() > 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+cedar::unit::Time cedar::aux::gui::PlotInterface::getConversionTimeAverage() const
+{
+  // findChildren is recursive, so every contained plot only contributes its own measurements
+  std::vector<const cedar::aux::gui::PlotInterface*> plots;
+  plots.push_back(this);
+  for (auto p_plot : this->findChildren<cedar::aux::gui::PlotInterface*>())
+  {
+    plots.push_back(p_plot);
+  }
+
+  cedar::unit::Time sum(0.0 * cedar::unit::seconds);
+  for (auto p_plot : plots)
+  {
+    QReadLocker locker(p_plot->mConversionTimes.getLockPtr());
+    if (p_plot->mConversionTimes.member().size() > 0)
+    {
+      sum += p_plot->mConversionTimes.member().getAverage();
+    }
+  }
+  return sum;
+}
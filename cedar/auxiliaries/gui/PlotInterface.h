@@ -39,6 +39,9 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/Configurable.h"
+#include "cedar/auxiliaries/LockableMember.h"
+#include "cedar/auxiliaries/MovingAverage.h"
+#include "cedar/units/Time.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/Data.fwd.h"
@@ -46,6 +49,7 @@
 
 // SYSTEM INCLUDES
 #include <QWidget>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <map>
 
 /*!@brief A unified interface for widgets that plot instances of cedar::proc::Data.
@@ -56,6 +60,27 @@ class cedar::aux::gui::PlotInterface : public QWidget, public cedar::aux::Config
   // macros
   //--------------------------------------------------------------------------------------------------------------------
   Q_OBJECT
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Measures the time between its construction and its destruction and records it as a conversion time of the
+   *        given plot.
+   */
+  class ConversionTimer
+  {
+  public:
+    //! Starts the measurement.
+    ConversionTimer(cedar::aux::gui::PlotInterface* pPlot);
+
+    //! Records the measurement.
+    ~ConversionTimer();
+
+  private:
+    cedar::aux::gui::PlotInterface* mpPlot;
+    boost::posix_time::ptime mStart;
+  };
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
@@ -80,6 +105,17 @@ public:
    */
   virtual void plot(cedar::aux::ConstDataPtr data, const std::string& title) = 0;
 
+  //! Records how long converting the data for display took once. May be called from any thread.
+  void appendConversionTime(const cedar::unit::Time& time);
+
+  //! Whether the plot, or any plot it contains, has recorded conversion times.
+  bool hasConversionTimeMeasurement() const;
+
+  /*!@brief Returns how long the plot takes on average to convert its data for display, summed over the plot and all
+   *        plots it contains. Must be called in the GUI thread.
+   */
+  cedar::unit::Time getConversionTimeAverage() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -102,7 +138,8 @@ private:
 protected:
   // none yet
 private:
-  // none yet
+  //! The most recent conversion times.
+  cedar::aux::LockableMember<cedar::aux::MovingAverage<cedar::unit::Time> > mConversionTimes;
 
 }; // class cedar::aux::gui::PlotInterface
 
@@ -298,6 +298,7 @@ void cedar::aux::gui::QCLinePlot::timerEvent(QTimerEvent * /* pEvent */)
   {
     return;
   }
+  cedar::aux::gui::PlotInterface::ConversionTimer conversion_timer(this);
   double x_min = std::numeric_limits<double>::max();
   double x_max = -std::numeric_limits<double>::max();
   double y_min = std::numeric_limits<double>::max();
@@ -307,8 +308,14 @@ void cedar::aux::gui::QCLinePlot::timerEvent(QTimerEvent * /* pEvent */)
   {
     if(auto matData = boost::dynamic_pointer_cast<const cedar::aux::MatData>(PlotSeriesDataVector.at(i)))
     {
-      QReadLocker locker2(&matData->getLock());
-      const cv::Mat& plotMat = matData->getData();
+      // read a snapshot rather than the data itself so that the step writing the data never waits for the plot
+      auto snapshot = matData->getSnapshot();
+      if (!snapshot.isValid())
+      {
+        continue;
+      }
+      const cv::Mat& plotMat = snapshot.getMatrix();
+      const cedar::aux::annotation::Annotatable& annotations = snapshot.getAnnotations();
 
       auto dim = cedar::aux::math::getDimensionalityOf(plotMat);
       if (dim != 1) // plot is no longer capable of displaying the data
@@ -316,7 +323,7 @@ void cedar::aux::gui::QCLinePlot::timerEvent(QTimerEvent * /* pEvent */)
         if (dim != 0 || !this->mPlot0D)
         {
           locker.unlock();
-          locker2.unlock();
+          snapshot.release();
           emit dataChanged();
           return;
         }
@@ -332,9 +339,9 @@ void cedar::aux::gui::QCLinePlot::timerEvent(QTimerEvent * /* pEvent */)
       local_min = std::numeric_limits<double>::max();
       local_max = -std::numeric_limits<double>::max();
       cedar::aux::annotation::ConstDimensionsPtr dimensions;
-      if (matData->hasAnnotation<cedar::aux::annotation::Dimensions>())
+      if (annotations.hasAnnotation<cedar::aux::annotation::Dimensions>())
       {
-        dimensions = matData->getAnnotation<cedar::aux::annotation::Dimensions>();
+        dimensions = annotations.getAnnotation<cedar::aux::annotation::Dimensions>();
       }
       QVector<double> xd(plotMat.rows),yd(plotMat.rows);
       for(int ia = 0; ia< plotMat.rows;ia++)
@@ -394,16 +401,15 @@ void cedar::aux::gui::QCLinePlot::timerEvent(QTimerEvent * /* pEvent */)
       x_max = std::max(x_max, local_max);
       this->mpChart->graph((int)i)->setData(xd,yd);
 
-      if (this->mPlot0D && matData->hasAnnotation<cedar::aux::annotation::Dimensions>())
+      if (this->mPlot0D && annotations.hasAnnotation<cedar::aux::annotation::Dimensions>())
       {
-        auto annotation = matData->getAnnotation<cedar::aux::annotation::Dimensions>();
+        auto annotation = annotations.getAnnotation<cedar::aux::annotation::Dimensions>();
         if (annotation->getDimensionality() >= 1)
         {
           //this->mpChart->graph((int)i)->setName(QString::fromStdString(annotation->getLabel(0)));
           this->mpChart->xAxis->setLabel(QString::fromStdString(annotation->getLabel(0)));
         }
       }
-      locker2.unlock();
     }
   }
   locker.unlock();
@@ -478,8 +478,13 @@ void cedar::aux::gui::detail::Qt5LinePlotWorker::convert()
 
   for (size_t i = 0; i < this->mpPlot->mPlotSeriesDataVector.size(); ++i) {
     cedar::aux::gui::Qt5LinePlot::PlotSeriesDataPtr series = this->mpPlot->mPlotSeriesDataVector.at(i);
-    QReadLocker locker(&series->mMatData->getLock());
-    const cv::Mat& mat = series->mMatData->getData();
+    // read a snapshot rather than the data itself so that the step writing the data never waits for the plot
+    auto snapshot = series->mMatData->getSnapshot();
+    if (!snapshot.isValid())
+    {
+      continue;
+    }
+    const cv::Mat& mat = snapshot.getMatrix();
     auto dim = cedar::aux::math::getDimensionalityOf(mat);
     if (dim != 1) // plot is no longer capable of displaying the data
     {
@@ -499,9 +504,9 @@ void cedar::aux::gui::detail::Qt5LinePlotWorker::convert()
     double local_min, local_max;
 
     cedar::aux::annotation::ConstDimensionsPtr dimensions;
-    if (series->mMatData->hasAnnotation<cedar::aux::annotation::Dimensions>())
+    if (snapshot.getAnnotations().hasAnnotation<cedar::aux::annotation::Dimensions>())
     {
-      dimensions = series->mMatData->getAnnotation<cedar::aux::annotation::Dimensions>();
+      dimensions = snapshot.getAnnotations().getAnnotation<cedar::aux::annotation::Dimensions>();
     }
 
     if (!dimensions || !dimensions->hasSamplingPositions(0))
@@ -546,6 +551,7 @@ void cedar::aux::gui::detail::Qt5LinePlotWorker::convert()
 
 void cedar::aux::gui::Qt5LinePlot::conversionDone(double x_min, double x_max)
 {
+  cedar::aux::gui::PlotInterface::ConversionTimer conversion_timer(this);
 
   QReadLocker locker(this->mpLock);
 
@@ -558,8 +564,12 @@ void cedar::aux::gui::Qt5LinePlot::conversionDone(double x_min, double x_max)
     PlotSeriesDataPtr series = this->mPlotSeriesDataVector.at(i);
     if(series->mQLineSeries->isVisible())
     {
-      QReadLocker locker(&series->mMatData->getLock());
-      const cv::Mat& plotMat = series->mMatData->getData();
+      auto snapshot = series->mMatData->getSnapshot();
+      if (!snapshot.isValid())
+      {
+        continue;
+      }
+      const cv::Mat& plotMat = snapshot.getMatrix();
 
       //x_max = std::max(x_max, (double)plotMat.rows);
 
@@ -606,12 +616,16 @@ void cedar::aux::gui::Qt5LinePlot::conversionDone(double x_min, double x_max)
     PlotSeriesDataPtr series = this->mPlotSeriesDataVector.at(i);
     if(series->mQLineSeries->isVisible())
     {
-      QReadLocker locker(&series->mMatData->getLock());
-      const cv::Mat& plotMat = series->mMatData->getData();
+      auto snapshot = series->mMatData->getSnapshot();
+      if (!snapshot.isValid())
+      {
+        continue;
+      }
+      const cv::Mat& plotMat = snapshot.getMatrix();
 
-      if (this->mPlot0D && series->mMatData->hasAnnotation<cedar::aux::annotation::Dimensions>())
+      if (this->mPlot0D && snapshot.getAnnotations().hasAnnotation<cedar::aux::annotation::Dimensions>())
       {
-        auto annotation = series->mMatData->getAnnotation<cedar::aux::annotation::Dimensions>();
+        auto annotation = snapshot.getAnnotations().getAnnotation<cedar::aux::annotation::Dimensions>();
         if (annotation->getDimensionality() >= 1)
         {
           axisX->setTitleText(QString::fromStdString(annotation->getLabel(0)));
@@ -128,10 +128,17 @@ void cedar::aux::gui::Qt5SurfacePlot::deleteArrayData()
 
 void cedar::aux::gui::Qt5SurfacePlot::updateArrayData()
 {
+  cedar::aux::gui::PlotInterface::ConversionTimer conversion_timer(this);
+
   cv::Mat data;
-  this->mMatData->lockForRead();
-  this->mMatData->getData().convertTo(data, CV_64F);
-  this->mMatData->unlock();
+  {
+    auto snapshot = this->mMatData->getSnapshot();
+    if (!snapshot.isValid())
+    {
+      return;
+    }
+    snapshot.getMatrix().convertTo(data, CV_64F);
+  }
   if (cedar::aux::math::getDimensionalityOf(data) != 2) // plot is no longer capable of displaying the data
   {
     emit dataChanged();
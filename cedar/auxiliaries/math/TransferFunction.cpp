@@ -40,6 +40,33 @@
 
 // SYSTEM INCLUDES
 
+//----------------------------------------------------------------------------------------------------------------------
+// local types
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  // calls the (virtual) scalar compute function of a transfer function for each element
+  class ScalarCompute
+  {
+  public:
+    ScalarCompute(const cedar::aux::math::TransferFunction* transferFunction)
+    :
+    mTransferFunction(transferFunction)
+    {
+    }
+
+    template<typename T>
+    T operator()(T value) const
+    {
+      return static_cast<T>(this->mTransferFunction->compute(static_cast<double>(value)));
+    }
+
+  private:
+    const cedar::aux::math::TransferFunction* mTransferFunction;
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -59,35 +86,21 @@ float cedar::aux::math::TransferFunction::compute(float value) const
 
 cv::Mat cedar::aux::math::TransferFunction::compute(const cv::Mat& values) const
 {
-  cv::Mat result = values.clone();
-  if (values.type() == CV_32F)
-  {
-    cv::MatConstIterator_<float> iter_src = values.begin<float>();
-    cv::MatIterator_<float> iter_dest = result.begin<float>();
-    auto end = values.end<float>();
-    for ( ; iter_src != end; ++iter_src, ++iter_dest)
-    {
-      *iter_dest = static_cast<float>(compute(static_cast<double>(*iter_src)));
-    }
-  }
-  else if (values.type() == CV_64F)
-  {
-    cv::MatConstIterator_<double> iter_src = values.begin<double>();
-    cv::MatIterator_<double> iter_dest = result.begin<double>();
-    auto end = values.end<double>();
-    for ( ; iter_src != end; ++iter_src, ++iter_dest)
-    {
-      *iter_dest = compute(*iter_src);
-    }
-  }
-  else
-  {
-    CEDAR_THROW
-    (
-      cedar::aux::NotImplementedException,
-      "This transfer function is not implemented for non-floating data types."
-    );
-  }
+  cv::Mat result;
+  this->compute(values, result);
   return result;
 }
 
+void cedar::aux::math::TransferFunction::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  applyElementwise(values, result, ScalarCompute(this));
+}
+
+void cedar::aux::math::TransferFunction::throwNotImplementedForType()
+{
+  CEDAR_THROW
+  (
+    cedar::aux::NotImplementedException,
+    "This transfer function is not implemented for non-floating data types."
+  );
+}
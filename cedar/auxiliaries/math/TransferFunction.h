@@ -44,6 +44,7 @@
 #include "cedar/auxiliaries/math/TransferFunction.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
 
 /*!@brief Basic interface for all TransferFunction functions.
  */
@@ -99,22 +100,80 @@ public:
 
   /*!@brief Computes the transfer function for each element in the matrix.
    *
-   * @remarks The default implementation iterates over the matrix and calls the other compute function. Override this in
-   *          the child classes to increase performance.
+   * @remarks The default implementation calls compute(const cv::Mat&, cv::Mat&).
    */
   virtual cv::Mat compute(const cv::Mat& values) const;
 
+  /*!@brief Computes the transfer function for each element in the matrix and writes it into result.
+   *
+   *        If result already has the size and type of values, its memory is reused, i.e., no allocation takes place.
+   *        Computing in place, i.e., passing the same matrix as values and result, is allowed.
+   *
+   * @remarks The default implementation iterates over the matrix and calls the virtual compute(double) function for
+   *          each element. Override this in the child classes to increase performance.
+   */
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  // none yet
+  /*!@brief Applies the given function to each element of values and writes the results into result.
+   *
+   *        The function object must provide a templated call operator so that float matrices are processed in single
+   *        precision. As the inner loop runs over contiguous memory without virtual calls, the compiler can vectorize
+   *        it.
+   *
+   * @throws cedar::aux::NotImplementedException if values is not of type CV_32F or CV_64F.
+   */
+  template<typename Function>
+  static void applyElementwise(const cv::Mat& values, cv::Mat& result, const Function& function)
+  {
+    switch (values.type())
+    {
+      case CV_32F:
+        applyElementwiseTyped<float>(values, result, function);
+        break;
+
+      case CV_64F:
+        applyElementwiseTyped<double>(values, result, function);
+        break;
+
+      default:
+        throwNotImplementedForType();
+    }
+  }
+
+  //! Returns true if the matrix is of a floating point type, i.e., if the matrix compute methods can process it.
+  static bool isFloatingPoint(const cv::Mat& values)
+  {
+    return values.type() == CV_32F || values.type() == CV_64F;
+  }
+
+  //! Throws an exception stating that transfer functions are not implemented for non-floating data types.
+  static void throwNotImplementedForType();
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  // none yet
+  template<typename T, typename Function>
+  static void applyElementwiseTyped(const cv::Mat& values, cv::Mat& result, const Function& function)
+  {
+    result.create(values.dims, values.size, values.type());
+    const cv::Mat* arrays[] = {&values, &result, nullptr};
+    cv::Mat planes[2];
+    cv::NAryMatIterator iterator(arrays, planes);
+    for (size_t p = 0; p < iterator.nplanes; ++p, ++iterator)
+    {
+      const T* source = planes[0].ptr<T>();
+      T* destination = planes[1].ptr<T>();
+      for (size_t i = 0; i < iterator.size; ++i)
+      {
+        destination[i] = function(source[i]);
+      }
+    }
+  }
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -0,0 +1,199 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        accumulate.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Sums of many matrices, computed in one blocked pass over the result without allocating memory.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/math/accumulate.h"
+#include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/assert.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+
+namespace
+{
+  //! Number of elements summed at a time; one block of the sum and of one term easily fit into the L1 cache.
+  const size_t BLOCK_SIZE = 1024;
+
+  template <typename T>
+  void accumulateBlocks
+  (
+    cv::Mat& sum,
+    const std::vector<const cv::Mat*>& terms,
+    const double* pWeights,
+    double offset
+  )
+  {
+    const size_t count = sum.total() * static_cast<size_t>(sum.channels());
+    const size_t number_of_terms = terms.size();
+    const T offset_t = static_cast<T>(offset);
+    T* p_sum = reinterpret_cast<T*>(sum.data);
+
+    for (size_t begin = 0; begin < count; begin += BLOCK_SIZE)
+    {
+      const size_t length = std::min(BLOCK_SIZE, count - begin);
+      T* p_out = p_sum + begin;
+
+      if (number_of_terms == 0)
+      {
+        std::fill(p_out, p_out + length, offset_t);
+        continue;
+      }
+
+      // the first term initializes the block, so it does not have to be zeroed first
+      const T* p_first = reinterpret_cast<const T*>(terms[0]->data) + begin;
+      const T first_weight = pWeights != nullptr ? static_cast<T>(pWeights[0]) : static_cast<T>(1);
+      for (size_t i = 0; i < length; ++i)
+      {
+        p_out[i] = first_weight * p_first[i] + offset_t;
+      }
+
+      for (size_t t = 1; t < number_of_terms; ++t)
+      {
+        const T* p_term = reinterpret_cast<const T*>(terms[t]->data) + begin;
+        if (pWeights != nullptr)
+        {
+          const T weight = static_cast<T>(pWeights[t]);
+          for (size_t i = 0; i < length; ++i)
+          {
+            p_out[i] += weight * p_term[i];
+          }
+        }
+        else
+        {
+          for (size_t i = 0; i < length; ++i)
+          {
+            p_out[i] += p_term[i];
+          }
+        }
+      }
+    }
+  }
+
+  void accumulateGeneric
+  (
+    cv::Mat& sum,
+    const std::vector<const cv::Mat*>& terms,
+    const double* pWeights,
+    double offset
+  )
+  {
+    sum.setTo(cv::Scalar::all(offset));
+    for (size_t t = 0; t < terms.size(); ++t)
+    {
+      cv::Mat term = *terms[t];
+      // 1D terms may be transposed with respect to the sum; row vectors are always continuous, so this is just a header
+      if (sum.dims <= 2 && term.dims <= 2 && term.rows != sum.rows)
+      {
+        term = term.reshape(0, sum.rows);
+      }
+
+      if (pWeights != nullptr)
+      {
+        cv::scaleAdd(term, pWeights[t], sum, sum);
+      }
+      else
+      {
+        cv::add(sum, term, sum);
+      }
+    }
+  }
+
+  void accumulateTerms
+  (
+    cv::Mat& sum,
+    const std::vector<const cv::Mat*>& terms,
+    const double* pWeights,
+    double offset
+  )
+  {
+    bool continuous = sum.isContinuous();
+    for (size_t t = 0; t < terms.size(); ++t)
+    {
+      const cv::Mat& term = *terms[t];
+      // the blocks are read with the type and length of sum, so a mismatching term would be read out of bounds; the
+      // only difference in shape allowed is that of 1D terms, which may be row or column vectors
+      if (term.type() != sum.type() || !cedar::aux::math::matrixSizesEqual(term, sum))
+      {
+        cedar::aux::MatrixMismatchException exception(sum, term);
+        CEDAR_THROW_EXCEPTION(exception);
+      }
+      if (!term.empty() && term.data == sum.data)
+      {
+        CEDAR_THROW(cedar::aux::InvalidValueException, "The sum must not be one of the accumulated terms.");
+      }
+      continuous = continuous && term.isContinuous();
+    }
+
+    if (continuous && sum.depth() == CV_32F)
+    {
+      accumulateBlocks<float>(sum, terms, pWeights, offset);
+    }
+    else if (continuous && sum.depth() == CV_64F)
+    {
+      accumulateBlocks<double>(sum, terms, pWeights, offset);
+    }
+    else
+    {
+      accumulateGeneric(sum, terms, pWeights, offset);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// functions
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::math::accumulate(cv::Mat& sum, const std::vector<const cv::Mat*>& terms, double offset)
+{
+  accumulateTerms(sum, terms, nullptr, offset);
+}
+
+void cedar::aux::math::accumulate
+     (
+       cv::Mat& sum,
+       const std::vector<const cv::Mat*>& terms,
+       const std::vector<double>& weights,
+       double offset
+     )
+{
+  CEDAR_ASSERT(weights.size() == terms.size());
+  accumulateTerms(sum, terms, weights.data(), offset);
+}
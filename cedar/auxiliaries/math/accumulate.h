@@ -0,0 +1,86 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        accumulate.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Sums of many matrices, computed in one blocked pass over the result without allocating memory.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_MATH_ACCUMULATE_H
+#define CEDAR_AUX_MATH_ACCUMULATE_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/lib.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/core/core.hpp>
+#include <vector>
+
+namespace cedar
+{
+  namespace aux
+  {
+    namespace math
+    {
+      /*!@brief Writes the sum of the given terms plus a constant offset into sum.
+       *
+       *        All terms must have the type and size of sum, except that 1D terms may be row or column vectors (see
+       *        cedar::aux::math::matrixSizesEqual). sum must already have its final size and type, and it must not be
+       *        one of the terms.
+       *
+       * @throws cedar::aux::MatrixMismatchException if a term does not match sum in type or size.
+       * @throws cedar::aux::InvalidValueException if sum is one of the terms.
+       *
+       *        For continuous float and double matrices, the sum is computed block by block: each block of sum is
+       *        initialized from the first term and then all other terms are added to it while it is in the cache.
+       *        Thus, sum is written to memory only once, no matter how many terms there are. No memory is allocated.
+       */
+      CEDAR_AUX_LIB_EXPORT void accumulate(cv::Mat& sum, const std::vector<const cv::Mat*>& terms, double offset = 0.0);
+
+      /*!@brief Writes the weighted sum of the given terms plus a constant offset into sum.
+       *
+       *        Term i is multiplied by weights[i]; otherwise, this is the same as accumulate without weights.
+       */
+      CEDAR_AUX_LIB_EXPORT void accumulate
+                                (
+                                  cv::Mat& sum,
+                                  const std::vector<const cv::Mat*>& terms,
+                                  const std::vector<double>& weights,
+                                  double offset = 0.0
+                                );
+    }
+  }
+}
+
+#endif // CEDAR_AUX_MATH_ACCUMULATE_H
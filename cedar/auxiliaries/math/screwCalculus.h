@@ -754,6 +754,168 @@ namespace cedar
             CEDAR_THROW(cedar::aux::UnhandledTypeException, "This function can only be called with CV_32F or CV_64F matrices.");
         }
       }
+
+      //----------------------------------------------------------------------------------------------------------------
+      // fixed-size variants
+      //----------------------------------------------------------------------------------------------------------------
+
+      /* The following overloads implement the functions above for cv::Matx and cv::Vec, whose dimensions are known at
+       * compile time. They live on the stack, so none of them allocates memory or has to dispatch on the matrix type,
+       * which makes them the better choice for code that runs in every step of a control loop.
+       */
+
+      /*!@brief fixed-size version of wedgeAxis: the skew-symmetric matrix of a \f$3 \times 1\f$ axis
+       */
+      template<typename T>
+      inline cv::Matx<T, 3, 3> wedgeAxis(const cv::Vec<T, 3>& rAxis)
+      {
+        return cv::Matx<T, 3, 3>
+               (
+                 0, -rAxis[2], rAxis[1],
+                 rAxis[2], 0, -rAxis[0],
+                 -rAxis[1], rAxis[0], 0
+               );
+      }
+
+      /*!@brief fixed-size version of veeAxis: the axis of a \f$3 \times 3\f$ skew-symmetric matrix
+       */
+      template<typename T>
+      inline cv::Vec<T, 3> veeAxis(const cv::Matx<T, 3, 3>& rMatrix)
+      {
+        return cv::Vec<T, 3>(rMatrix(2, 1), rMatrix(0, 2), rMatrix(1, 0));
+      }
+
+      /*!@brief fixed-size version of wedgeTwist: the \f$4 \times 4\f$ matrix form of twist coordinates (v, omega)
+       */
+      template<typename T>
+      inline cv::Matx<T, 4, 4> wedgeTwist(const cv::Vec<T, 6>& rTwist)
+      {
+        return cv::Matx<T, 4, 4>
+               (
+                 0, -rTwist[5], rTwist[4], rTwist[0],
+                 rTwist[5], 0, -rTwist[3], rTwist[1],
+                 -rTwist[4], rTwist[3], 0, rTwist[2],
+                 0, 0, 0, 0
+               );
+      }
+
+      /*!@brief fixed-size version of veeTwist: the twist coordinates (v, omega) of a \f$4 \times 4\f$ twist matrix
+       */
+      template<typename T>
+      inline cv::Vec<T, 6> veeTwist(const cv::Matx<T, 4, 4>& rMatrix)
+      {
+        return cv::Vec<T, 6>(rMatrix(0, 3), rMatrix(1, 3), rMatrix(2, 3), rMatrix(2, 1), rMatrix(0, 2), rMatrix(1, 0));
+      }
+
+      /*!@brief fixed-size version of expAxis: the rotation by theta around a \f$3 \times 1\f$ axis (Rodrigues)
+       */
+      template<typename T>
+      inline cv::Matx<T, 3, 3> expAxis(const cv::Vec<T, 3>& rAxis, double theta)
+      {
+        cv::Matx<T, 3, 3> omega_wedge = wedgeAxis(rAxis);
+        return cv::Matx<T, 3, 3>::eye()
+               + omega_wedge * static_cast<T>(sin(theta))
+               + omega_wedge * omega_wedge * static_cast<T>(1 - cos(theta));
+      }
+
+      /*!@brief fixed-size version of expTwist: the rigid transformation generated by a twist and a joint angle
+       */
+      template<typename T>
+      inline cv::Matx<T, 4, 4> expTwist(const cv::Vec<T, 6>& rXi, double theta)
+      {
+        cv::Vec<T, 3> v(rXi[0], rXi[1], rXi[2]);
+        cv::Vec<T, 3> omega(rXi[3], rXi[4], rXi[5]);
+
+        // rotation
+        cv::Matx<T, 3, 3> R = expAxis(omega, theta);
+
+        // translation
+        cv::Vec<T, 3> p;
+        if (omega[0] == 0 && omega[1] == 0 && omega[2] == 0) // pure translation
+        {
+          p = v * static_cast<T>(theta);
+        }
+        else // translation and rotation
+        {
+          // p = (eye(3,3) - r)*(cross(w,v)) + w*w'*v*theta (Matlab notation)
+          p = (cv::Matx<T, 3, 3>::eye() - R) * omega.cross(v) + omega * static_cast<T>(omega.dot(v) * theta);
+        }
+
+        return cv::Matx<T, 4, 4>
+               (
+                 R(0, 0), R(0, 1), R(0, 2), p[0],
+                 R(1, 0), R(1, 1), R(1, 2), p[1],
+                 R(2, 0), R(2, 1), R(2, 2), p[2],
+                 0, 0, 0, 1
+               );
+      }
+
+      /*!@brief fixed-size version of rigidToAdjointTransformation
+       */
+      template<typename T>
+      inline cv::Matx<T, 6, 6> rigidToAdjointTransformation(const cv::Matx<T, 4, 4>& rRigidTransformation)
+      {
+        cv::Matx<T, 3, 3> rot = rRigidTransformation.template get_minor<3, 3>(0, 0);
+        cv::Vec<T, 3> pos(rRigidTransformation(0, 3), rRigidTransformation(1, 3), rRigidTransformation(2, 3));
+        cv::Matx<T, 3, 3> pos_wedge_times_rot = wedgeAxis(pos) * rot;
+
+        cv::Matx<T, 6, 6> adjoint = cv::Matx<T, 6, 6>::zeros();
+        for (int row = 0; row < 3; ++row)
+        {
+          for (int col = 0; col < 3; ++col)
+          {
+            adjoint(row, col) = rot(row, col);
+            adjoint(row, col + 3) = pos_wedge_times_rot(row, col);
+            adjoint(row + 3, col + 3) = rot(row, col);
+          }
+        }
+        return adjoint;
+      }
+
+      /*!@brief applies the adjoint of a rigid transformation to a twist, without forming the \f$6 \times 6\f$ adjoint
+       *
+       * This is equal to rigidToAdjointTransformation(rRigidTransformation) * rTwist.
+       */
+      template<typename T>
+      inline cv::Vec<T, 6> adjointTransformTwist
+                           (
+                             const cv::Matx<T, 4, 4>& rRigidTransformation,
+                             const cv::Vec<T, 6>& rTwist
+                           )
+      {
+        cv::Matx<T, 3, 3> rot = rRigidTransformation.template get_minor<3, 3>(0, 0);
+        cv::Vec<T, 3> pos(rRigidTransformation(0, 3), rRigidTransformation(1, 3), rRigidTransformation(2, 3));
+        cv::Vec<T, 3> omega = rot * cv::Vec<T, 3>(rTwist[3], rTwist[4], rTwist[5]);
+        cv::Vec<T, 3> v = rot * cv::Vec<T, 3>(rTwist[0], rTwist[1], rTwist[2]) + pos.cross(omega);
+        return cv::Vec<T, 6>(v[0], v[1], v[2], omega[0], omega[1], omega[2]);
+      }
+
+      /*!@brief inverts a rigid transformation in closed form, i.e., without a general matrix inversion
+       */
+      template<typename T>
+      inline cv::Matx<T, 4, 4> invertRigidTransformation(const cv::Matx<T, 4, 4>& rRigidTransformation)
+      {
+        cv::Matx<T, 3, 3> rot_transpose = rRigidTransformation.template get_minor<3, 3>(0, 0).t();
+        cv::Vec<T, 3> pos(rRigidTransformation(0, 3), rRigidTransformation(1, 3), rRigidTransformation(2, 3));
+        cv::Vec<T, 3> inverse_pos = -(rot_transpose * pos);
+        return cv::Matx<T, 4, 4>
+               (
+                 rot_transpose(0, 0), rot_transpose(0, 1), rot_transpose(0, 2), inverse_pos[0],
+                 rot_transpose(1, 0), rot_transpose(1, 1), rot_transpose(1, 2), inverse_pos[1],
+                 rot_transpose(2, 0), rot_transpose(2, 1), rot_transpose(2, 2), inverse_pos[2],
+                 0, 0, 0, 1
+               );
+      }
+
+      /*!@brief fixed-size version of twistCoordinates
+       */
+      template<typename T>
+      inline cv::Vec<T, 6> twistCoordinates(const cv::Vec<T, 3>& rSupportPoint, const cv::Vec<T, 3>& rAxis)
+      {
+        cv::Vec<T, 3> omega = rAxis * static_cast<T>(1 / cv::norm(rAxis));
+        cv::Vec<T, 3> cross = rSupportPoint.cross(omega);
+        return cv::Vec<T, 6>(cross[0], cross[1], cross[2], omega[0], omega[1], omega[2]);
+      }
     }
   }
 }
@@ -41,6 +41,7 @@
 #include "cedar/auxiliaries/Singleton.h"
 
 // SYSTEM INCLUDES
+#include <cmath>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register class with the sigmoid factory manager
@@ -52,6 +53,37 @@ namespace
     = cedar::aux::math::TransferFunctionManagerSingleton::getInstance()->registerType<cedar::aux::math::AbsSigmoidPtr>();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// local types
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  class AbsSigmoidFunction
+  {
+  public:
+    AbsSigmoidFunction(double beta, double threshold)
+    :
+    mBeta(beta),
+    mThreshold(threshold)
+    {
+    }
+
+    template<typename T>
+    T operator()(T value) const
+    {
+      const T one = static_cast<T>(1);
+      const T beta = static_cast<T>(this->mBeta);
+      const T difference = value - static_cast<T>(this->mThreshold);
+      return static_cast<T>(0.5) * (one + beta * difference / (one + beta * std::abs(difference)));
+    }
+
+  private:
+    double mBeta;
+    double mThreshold;
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -73,7 +105,7 @@ double cedar::aux::math::AbsSigmoid::compute(double value) const
   return cedar::aux::math::sigmoidAbs(value, _mBeta->getValue(), this->mThreshold->getValue());
 }
 
-cv::Mat cedar::aux::math::AbsSigmoid::compute(const cv::Mat& values) const
+void cedar::aux::math::AbsSigmoid::compute(const cv::Mat& values, cv::Mat& result) const
 {
-  return sigmoidAbs(values, this->_mBeta->getValue(), this->mThreshold->getValue());
+  applyElementwise(values, result, AbsSigmoidFunction(this->getBeta(), this->getThreshold()));
 }
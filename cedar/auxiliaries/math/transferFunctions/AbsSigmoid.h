@@ -80,8 +80,8 @@ public:
    */
   virtual double compute(double value) const;
 
-  //! Overriden for efficiency.
-  virtual cv::Mat compute(const cv::Mat& values) const;
+  //! Computes the function for all elements of the matrix at once; see TransferFunction::compute.
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
 
   //! Returns the beta (slope) of the sigmoid.
   inline double getBeta() const
@@ -70,3 +70,18 @@ double cedar::aux::math::ExpSigmoid::compute(double value) const
 {
   return cedar::aux::math::sigmoidExp(value, _mBeta->getValue(), this->getThreshold());
 }
+
+void cedar::aux::math::ExpSigmoid::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  if (!isFloatingPoint(values))
+  {
+    throwNotImplementedForType();
+  }
+
+  // 1 / (1 + exp(-beta * (x - threshold))), computed in place with OpenCV's vectorized operations
+  const double beta = this->_mBeta->getValue();
+  values.convertTo(result, -1, -beta, beta * this->getThreshold());
+  cv::exp(result, result);
+  result += 1.0;
+  cv::divide(1.0, result, result);
+}
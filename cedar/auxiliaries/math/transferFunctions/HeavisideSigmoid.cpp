@@ -51,6 +51,33 @@ namespace
     = cedar::aux::math::TransferFunctionManagerSingleton::getInstance()->registerType<cedar::aux::math::HeavisideSigmoidPtr>();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// local types
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  class HeavisideFunction
+  {
+  public:
+    HeavisideFunction(double threshold)
+    :
+    mThreshold(threshold)
+    {
+    }
+
+    template<typename T>
+    T operator()(T value) const
+    {
+      // same as sigmoidHeaviside: zero up to and including the threshold
+      return (value <= static_cast<T>(this->mThreshold)) ? static_cast<T>(0) : static_cast<T>(1);
+    }
+
+  private:
+    double mThreshold;
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -63,3 +90,8 @@ double cedar::aux::math::HeavisideSigmoid::compute(double value) const
 {
   return cedar::aux::math::sigmoidHeaviside(value, this->getThreshold());
 }
+
+void cedar::aux::math::HeavisideSigmoid::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  applyElementwise(values, result, HeavisideFunction(this->getThreshold()));
+}
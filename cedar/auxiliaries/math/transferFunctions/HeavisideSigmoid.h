@@ -89,6 +89,9 @@ public:
    */
   virtual double compute(double value) const;
 
+  //! Computes the function for all elements of the matrix at once; see TransferFunction::compute.
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -81,3 +81,13 @@ double cedar::aux::math::LinearTransferFunction::compute(double value) const
 {
   return this->getFactor() * value + this->getOffset();
 }
+
+void cedar::aux::math::LinearTransferFunction::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  if (!isFloatingPoint(values))
+  {
+    throwNotImplementedForType();
+  }
+
+  values.convertTo(result, -1, this->getFactor(), this->getOffset());
+}
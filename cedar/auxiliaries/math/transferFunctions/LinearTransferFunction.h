@@ -75,6 +75,9 @@ public:
    */
   virtual double compute(double value) const;
 
+  //! Computes the function for all elements of the matrix at once; see TransferFunction::compute.
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
+
   //! Returns the offset of the linear function, i.e., \f$ m \f$ in \f$ f(x) = m \cdot x + b \f$.
   inline double getFactor() const
   {
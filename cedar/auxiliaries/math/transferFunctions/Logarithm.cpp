@@ -43,6 +43,7 @@
 #include "cedar/auxiliaries/Singleton.h"
 
 // SYSTEM INCLUDES
+#include <cmath>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register class with the sigmoid factory manager
@@ -59,6 +60,23 @@ namespace
   bool registered = register_function();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// local types
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  class LogarithmFunction
+  {
+  public:
+    template<typename T>
+    T operator()(T value) const
+    {
+      return std::log(value);
+    }
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -75,3 +93,9 @@ double cedar::aux::math::Logarithm::compute(double value) const
 {
   return std::log(value);
 }
+
+void cedar::aux::math::Logarithm::compute(const cv::Mat& values, cv::Mat& result) const
+{
+  // cv::log is not used here because its result for values <= 0 is undefined
+  applyElementwise(values, result, LogarithmFunction());
+}
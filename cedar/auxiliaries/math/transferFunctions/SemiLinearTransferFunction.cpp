@@ -59,6 +59,35 @@ namespace
   bool registered = register_function();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// local types
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  class SemiLinearFunction
+  {
+  public:
+    SemiLinearFunction(double threshold, double beta)
+    :
+    mThreshold(threshold),
+    mBeta(beta)
+    {
+    }
+
+    template<typename T>
+    T operator()(T value) const
+    {
+      const T threshold = static_cast<T>(this->mThreshold);
+      return (value > threshold) ? threshold + static_cast<T>(this->mBeta) * (value - threshold) : threshold;
+    }
+
+  private:
+    double mThreshold;
+    double mBeta;
+  };
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -79,11 +108,7 @@ double cedar::aux::math::SemiLinearTransferFunction::compute(double value) const
   return cedar::aux::math::sigmoidSemiLinear(value, this->getThreshold(), this->getBeta());
 }
 
-cv::Mat cedar::aux::math::SemiLinearTransferFunction::compute(const cv::Mat& values) const
+void cedar::aux::math::SemiLinearTransferFunction::compute(const cv::Mat& values, cv::Mat& result) const
 {
-  double beta = this->getBeta();
-  double threshold = this->getThreshold();
-  cv::Mat result = threshold + beta * values;
-  result.setTo(threshold, values < threshold);
-  return result;
+  applyElementwise(values, result, SemiLinearFunction(this->getThreshold(), this->getBeta()));
 }
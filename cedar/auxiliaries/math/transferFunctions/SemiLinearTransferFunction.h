@@ -81,7 +81,8 @@ public:
    */
   virtual double compute(double value) const;
 
-  cv::Mat compute(const cv::Mat& values) const;
+  //! Computes the function for all elements of the matrix at once; see TransferFunction::compute.
+  virtual void compute(const cv::Mat& values, cv::Mat& result) const;
 
   /*!@brief Returns the current beta value.
    */
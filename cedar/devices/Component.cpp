@@ -62,6 +62,9 @@
 
 class cedar::dev::Component::DataCollection
 {
+  protected:
+    typedef std::map<ComponentDataType, std::unique_ptr<cedar::dev::SampleExchange> > ExchangeMapType;
+
   public:
     DataCollection():
     mCommunicationErrorCount(20)
@@ -157,7 +160,7 @@ class cedar::dev::Component::DataCollection
       this->resetBufferUnlocked(mPreviousDeviceSideBuffer, type, matrixType);
     }
 
-    void setUserSideBuffer(ComponentDataType type, cv::Mat data)
+    bool setUserSideBuffer(ComponentDataType type, cv::Mat data)
     {
       // reference to the old buffer matrix
       cv::Mat &buffer = mUserSideBuffer.member()[type]->getData();
@@ -169,12 +172,14 @@ class cedar::dev::Component::DataCollection
       if(data.size == buff_size && data.type() == buff_type)
       {
         this->setData(mUserSideBuffer, type, data);
+        return true;
       }
       else
       {
         cedar::aux::LogSingleton::getInstance()->warning(
           "New buffer object has wrong size or type. Old Buffer Size: "+boost::lexical_cast<std::string>(buffer.rows)+","+boost::lexical_cast<std::string>(buffer.cols)+" New Size: "+boost::lexical_cast<std::string>(data.rows)+","+boost::lexical_cast<std::string>(data.cols)+". Old Buffer Type: "+boost::lexical_cast<std::string>(buff_type)+ " New Type: "+ boost::lexical_cast<std::string>(data.type()),
           CEDAR_CURRENT_FUNCTION_NAME);
+        return false;
       }
     }
 
@@ -243,6 +248,16 @@ class cedar::dev::Component::DataCollection
       return this->getBufferIndexUnlocked(mPreviousDeviceSideBuffer, type, index);
     }
 
+    cedar::dev::SampleExchange& getUserSideExchange(ComponentDataType type) const
+    {
+      return this->getExchange(mUserSideExchanges, type);
+    }
+
+    cedar::dev::SampleExchange& getPreviousDeviceSideExchange(ComponentDataType type) const
+    {
+      return this->getExchange(mPreviousDeviceSideExchanges, type);
+    }
+
     void registerTransformationHook(ComponentDataType from, ComponentDataType to, TransformationFunctionType fun)
     {
       QWriteLocker locker(this->mTransformationHooks.getLockPtr());
@@ -415,6 +430,10 @@ class cedar::dev::Component::DataCollection
       this->lazyInitializeUnlocked(mUserSideBuffer, type);
       this->lazyInitializeUnlocked(mPreviousDeviceSideBuffer, type);
       this->lazyInitializeUnlocked(mInitialUserSideSubmittedData, type);
+
+      // types are installed while the component is configured, so the exchange maps do not change during communication
+      mUserSideExchanges[type].reset(new cedar::dev::SampleExchange());
+      mPreviousDeviceSideExchanges[type].reset(new cedar::dev::SampleExchange());
     }
 
     virtual void resetBuffers(cedar::dev::Component::ComponentDataType type, int matrixType)
@@ -429,6 +448,9 @@ class cedar::dev::Component::DataCollection
         this->resetBufferUnlocked(mUserSideBuffer, type, matrixType);
         this->resetBufferUnlocked(mPreviousDeviceSideBuffer, type, matrixType);
         this->resetBufferUnlocked(mInitialUserSideSubmittedData, type, matrixType);
+
+        this->getUserSideExchange(type).reset(this->getBufferUnlocked(mUserSideBuffer, type));
+        this->getPreviousDeviceSideExchange(type).reset(this->getBufferUnlocked(mPreviousDeviceSideBuffer, type));
       }
     }
 
@@ -529,6 +551,17 @@ class cedar::dev::Component::DataCollection
       bufferData.member()[type]->getData().at<float>(index, 0) = value;
     }
 
+    cedar::dev::SampleExchange& getExchange(const ExchangeMapType& exchanges, ComponentDataType type) const
+    {
+      // no lock needed: the map only changes when types are installed (see lazyInitializeMembers)
+      auto found = exchanges.find(type);
+      if (found == exchanges.end())
+      {
+        CEDAR_THROW(TypeNotFoundException, "This type is not installed.");
+      }
+      return *found->second;
+    }
+
     void lazyInitializeUnlocked(cedar::aux::LockableMember<BufferDataType>& bufferData, ComponentDataType type)
     {
       auto found = bufferData.member().find(type);
@@ -573,6 +606,12 @@ class cedar::dev::Component::DataCollection
     cedar::aux::LockableMember<BufferDataType> mPreviousDeviceSideBuffer; // was: mPreviousDeviceSideMeasurementsBuffer
 
   private:
+    //! Newest user-side samples; the communication thread and the user side exchange data through these without locks.
+    ExchangeMapType mUserSideExchanges;
+
+    //! User-side measurement samples of the previous communication step.
+    ExchangeMapType mPreviousDeviceSideExchanges;
+
     std::map<ComponentDataType, cedar::dev::Component::DimensionalityType> mInstalledDimensions;
 
     cedar::aux::LockableMember<TransformationHookContainerType> mTransformationHooks;
@@ -723,6 +762,7 @@ void cedar::dev::Component::init()
   mNotReadyForCommandsCounter.member() = 0;
   mWatchDogCounter.member() = 0;
   mSuppressUserSideInteraction = false;
+  mUserSideCommandTypeInUse.store(-1);
 }
 
 // constructor
@@ -1021,6 +1061,15 @@ void cedar::dev::Component::resetComponent()
       this->mMeasurementData->resetUserSideBufferUnlocked(type, matrixType);
       this->mMeasurementData->resetPreviousDeviceSideBufferUnlocked(type, matrixType);
       this->mMeasurementData->resetDeviceSideRetrievedBufferUnlocked(type, matrixType);
+
+      this->mMeasurementData->getUserSideExchange(type).publish
+      (
+        this->mMeasurementData->getUserSideBufferUnlocked(type)
+      );
+      this->mMeasurementData->getPreviousDeviceSideExchange(type).publish
+      (
+        this->mMeasurementData->getPreviousDeviceSideBufferUnlocked(type)
+      );
     }
   }
 
@@ -1034,6 +1083,8 @@ void cedar::dev::Component::resetComponent()
     {
       this->mCommandData->resetUserSideBufferUnlocked(type,matrixType);
       this->mCommandData->resetDeviceSideSubmittedBufferUnlocked(type,matrixType);
+
+      this->mCommandData->getUserSideExchange(type).publish(this->mCommandData->getUserSideBufferUnlocked(type));
     }
   }
 }
@@ -1049,11 +1100,28 @@ void cedar::dev::Component::applyDeviceSideCommandsAs(ComponentDataType type)
 
 void cedar::dev::Component::setUserSideCommandBuffer(ComponentDataType type, cv::Mat data)
 {
-  this->checkExclusivenessOfCommand(type);
-  QWriteLocker locker(this->mUserSideCommandUsed.getLockPtr());    
+  if (this->mUserSideCommandTypeInUse.load() != static_cast<int>(type))
+  {
+    this->checkExclusivenessOfCommand(type);
+  }
+
+  // the communication thread takes the command from the exchange; the buffer is kept up to date for other readers
+  if (this->mCommandData->setUserSideBuffer(type, data))
+  {
+    this->mCommandData->getUserSideExchange(type).publish(data);
+    this->markUserSideCommandUsed(type);
+  }
+}
 
-  this->mCommandData->setUserSideBuffer(type, data);
-  this->mUserSideCommandUsed.member().insert(type);
+void cedar::dev::Component::markUserSideCommandUsed(ComponentDataType type)
+{
+  // only the first command of a type has to lock; afterwards, commands go through the exchange alone
+  if (this->mUserSideCommandTypeInUse.load() != static_cast<int>(type))
+  {
+    QWriteLocker locker(this->mUserSideCommandUsed.getLockPtr());
+    this->mUserSideCommandUsed.member().insert(type);
+    this->mUserSideCommandTypeInUse.store(static_cast<int>(type));
+  }
 }
 
 void cedar::dev::Component::setInitialUserSideCommandBuffer(ComponentDataType type, cv::Mat data)
@@ -1075,30 +1143,51 @@ void cedar::dev::Component::setInitialUserSideCommandBuffer(ComponentDataType ty
 
 void cedar::dev::Component::setUserSideCommandBufferIndex(ComponentDataType type, int index, float value)
 {
-  this->checkExclusivenessOfCommand(type);
-  QWriteLocker locker(this->mUserSideCommandUsed.getLockPtr());
+  if (this->mUserSideCommandTypeInUse.load() != static_cast<int>(type))
+  {
+    this->checkExclusivenessOfCommand(type);
+  }
   this->mCommandData->setUserSideBufferIndex(type, index, value);
-  this->mUserSideCommandUsed.member().insert(type);
+  this->mCommandData->getUserSideExchange(type).publishElement(index, value);
+  this->markUserSideCommandUsed(type);
+}
+
+void cedar::dev::Component::readUserSideCommandSample
+     (
+       ComponentDataType type,
+       cedar::dev::SampleExchange::Sample& sample
+     ) const
+{
+  this->mCommandData->getUserSideExchange(type).read(sample);
+}
+
+void cedar::dev::Component::readUserSideMeasurementSample
+     (
+       ComponentDataType type,
+       cedar::dev::SampleExchange::Sample& sample
+     ) const
+{
+  this->mMeasurementData->getUserSideExchange(type).read(sample);
 }
 
 cv::Mat cedar::dev::Component::getUserSideMeasurementBuffer(ComponentDataType type) const
 {
-  return this->mMeasurementData->getUserSideBuffer(type);
+  return this->mMeasurementData->getUserSideExchange(type).read().mData;
 }
 
 float cedar::dev::Component::getUserSideMeasurementBufferIndex(ComponentDataType type, int index) const
 {
-  return this->mMeasurementData->getUserSideBufferIndex(type, index);
+  return this->mMeasurementData->getUserSideExchange(type).readElement(index);
 }
 
 cv::Mat cedar::dev::Component::getPreviousDeviceSideMeasurementBuffer(ComponentDataType type) const
 {
-  return this->mMeasurementData->getPreviousDeviceSideBuffer(type);
+  return this->mMeasurementData->getPreviousDeviceSideExchange(type).read().mData;
 }
 
 float cedar::dev::Component::getPreviousDeviceSideMeasurementBufferIndex(ComponentDataType type, int index) const
 {
-  return this->mMeasurementData->getPreviousDeviceSideBufferIndex(type, index);
+  return this->mMeasurementData->getPreviousDeviceSideExchange(type).readElement(index);
 }
 
 void cedar::dev::Component::registerCommandHook(ComponentDataType type, CommandFunctionType fun)
@@ -1475,8 +1564,9 @@ void cedar::dev::Component::stepCommandCommunication(cedar::unit::Time dt)
     // we know the map has exactly one entry
     type_from_user = *(this->mUserSideCommandUsed.member().begin());
 
-    QReadLocker lock(this->mCommandData->mUserSideBuffer.getLockPtr());
-    userData = this->mCommandData->getUserSideBufferUnlocked(type_from_user).clone();
+    // does not lock, so commands set by the user side never hold up communication (and vice versa)
+    this->mCommandData->getUserSideExchange(type_from_user).read(this->mCommandSample);
+    userData = this->mCommandSample.mData;
   }
 
   locker.unlock();
@@ -1652,6 +1742,15 @@ void cedar::dev::Component::updateUserSideMeasurements()
     this->mMeasurementData->mPreviousDeviceSideBuffer.member()[type]->getData() = this->mMeasurementData->mUserSideBuffer.member()[type]->getData().clone();
     this->mMeasurementData->mUserSideBuffer.member()[type]->getData() = this->mMeasurementData->mDeviceSideRetrievedData.member()[type]->getData().clone();
     this->mMeasurementData->mDeviceSideRetrievedData.member()[type]->getData() = 0.0; // Warum 0.0 ? Warum ist das keine Matrix?
+
+    this->mMeasurementData->getPreviousDeviceSideExchange(type).publish
+    (
+      this->mMeasurementData->mPreviousDeviceSideBuffer.member()[type]->getData()
+    );
+    this->mMeasurementData->getUserSideExchange(type).publish
+    (
+      this->mMeasurementData->mUserSideBuffer.member()[type]->getData()
+    );
   }
 
   locker.unlock();
@@ -1977,6 +2076,13 @@ void cedar::dev::Component::processStart()
      QWriteLocker lock1(this->mCommandData->mUserSideBuffer.getLockPtr());
      
      this->mCommandData->mUserSideBuffer.member() = this->mCommandData->mInitialUserSideSubmittedData.member();
+     for (const auto& type_data_pair : this->mCommandData->mUserSideBuffer.member())
+     {
+       if (!type_data_pair.second->getData().empty())
+       {
+         this->mCommandData->getUserSideExchange(type_data_pair.first).publish(type_data_pair.second->getData());
+       }
+     }
      //for(int i=0; i < this->mCommandData->mUserSideBuffer.member().size(); ++i)
      //{
      //  std::cout << this->mCommandData->mUserSideBuffer.member()[i] << "\n";
@@ -1995,12 +2101,14 @@ void cedar::dev::Component::clearUserSideCommand()
 {
   QWriteLocker user_command_locker(this->mUserSideCommandUsed.getLockPtr());
   this->mUserSideCommandUsed.member().clear();
+  this->mUserSideCommandTypeInUse.store(-1);
 }
 
 void cedar::dev::Component::clearAllCommands()
 {
   QWriteLocker user_command_locker(this->mUserSideCommandUsed.getLockPtr());
   this->mUserSideCommandUsed.member().clear();
+  this->mUserSideCommandTypeInUse.store(-1);
   // TODO TODO
 //  QWriteLocker dev_command_locker(this->mDeviceSideCommandUsed.getLockPtr());
 //  this->mDeviceSideCommandUsed.member().clear();
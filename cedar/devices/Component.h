@@ -46,6 +46,7 @@
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/StringParameter.h"
 #include "cedar/devices/Channel.h"
+#include "cedar/devices/SampleExchange.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/devices/Component.fwd.h"
@@ -68,6 +69,7 @@
 
 #include <vector>
 #include <map>
+#include <atomic>
 
 /*!@brief Base class for components of robots.
  */
@@ -249,6 +251,18 @@ public:
   cedar::aux::ConstDataPtr getUserSideCommandData(const ComponentDataType &type) const;
   void setUserSideCommandBuffer(ComponentDataType type, cv::Mat);
 
+  /*!@brief Copies the newest user-side command of the given type, along with its time stamp and sequence number.
+   *
+   *        Does not lock; reading commands this way never holds up the communication with the device.
+   */
+  void readUserSideCommandSample(ComponentDataType type, cedar::dev::SampleExchange::Sample& sample) const;
+
+  /*!@brief Copies the newest user-side measurement of the given type, along with its time stamp and sequence number.
+   *
+   *        Does not lock; reading measurements this way never holds up the communication with the device.
+   */
+  void readUserSideMeasurementSample(ComponentDataType type, cedar::dev::SampleExchange::Sample& sample) const;
+
   void applyDeviceSideCommandsAs(ComponentDataType type);
 
   //! Returns the dimensionality (size) of the given command type.
@@ -401,6 +415,9 @@ private:
   //!@brief checks whether a given command type conflicts with already set commands and throws an exception if this happens
   void checkExclusivenessOfCommand(ComponentDataType type);
 
+  //!@brief Registers the type as the one used by the user side, unless it already is.
+  void markUserSideCommandUsed(ComponentDataType type);
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -443,6 +460,12 @@ private:
 
   cedar::aux::LockableMember<std::set<ComponentDataType>> mUserSideCommandUsed;
 
+  //! The command type last added to mUserSideCommandUsed, -1 if it is empty. Lets repeated commands skip its lock.
+  std::atomic<int> mUserSideCommandTypeInUse;
+
+  //! Buffer into which the communication thread reads user-side commands.
+  cedar::dev::SampleExchange::Sample mCommandSample;
+
   cedar::aux::LockableMember<boost::optional<cedar::unit::Time> > mLastStepMeasurementsTime;
   cedar::aux::LockableMember<boost::optional<cedar::unit::Time> > mLastStepCommandsTime;
 
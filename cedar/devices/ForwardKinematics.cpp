@@ -44,6 +44,8 @@
 #include "cedar/auxiliaries/math/tools.h"
 
 // SYSTEM INCLUDES
+#include <QReadLocker>
+#include <QWriteLocker>
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -67,109 +69,118 @@ cedar::dev::ForwardKinematics::~ForwardKinematics()
 
 void cedar::dev::ForwardKinematics::initializeFromJointList()
 {
+  QWriteLocker locker(&mTransformationsLock);
+
   // clear variables
   mReferenceJointTwists.clear();
+  mReferenceJointTwistWedges.clear();
   mReferenceJointTransformations.clear();
   mTwistExponentials.clear();
+  mInverseTwistExponentials.clear();
   mProductsOfExponentials.clear();
   mJointTransformations.clear();
   mJointTwists.clear();
 
   // transform joint geometry into twist coordinates
-  cv::Mat xi;
-  cv::Mat T;
-  cv::Mat p;
-  cv::Mat omega = cv::Mat::zeros(3, 1, CV_32FC1);
   for (unsigned int j=0; j < mpKinematicChain->getNumberOfJoints(); j++)
   {
     // create and store twist
     cedar::dev::KinematicChain::JointPtr joint = mpKinematicChain->getJoint(j);
-    p = cv::Mat::zeros(3, 1, CV_32FC1);
-    p.at<float>(0, 0) = joint->_mpPosition->at(0);
-    p.at<float>(1, 0) = joint->_mpPosition->at(1);
-    p.at<float>(2, 0) = joint->_mpPosition->at(2);
-    omega = cv::Mat::zeros(3, 1, CV_32FC1);
-    omega.at<float>(0, 0) = joint->_mpAxis->at(0);
-    omega.at<float>(1, 0) = joint->_mpAxis->at(1);
-    omega.at<float>(2, 0) = joint->_mpAxis->at(2);
-    xi = cedar::aux::math::twistCoordinates<float>(p, omega);
-    mReferenceJointTwists.push_back(xi.clone());
+    cv::Vec<float, 3> p(joint->_mpPosition->at(0), joint->_mpPosition->at(1), joint->_mpPosition->at(2));
+    cv::Vec<float, 3> omega(joint->_mpAxis->at(0), joint->_mpAxis->at(1), joint->_mpAxis->at(2));
+    mReferenceJointTwists.push_back(cedar::aux::math::twistCoordinates(p, omega));
+    mReferenceJointTwistWedges.push_back(cedar::aux::math::wedgeTwist(mReferenceJointTwists.back()));
 
     // create and store transformation matrix to joint coordinate frame
-    T = cv::Mat::eye(4, 4, CV_32FC1);
-    T.at<float>(0, 3) = joint->_mpPosition->at(0);
-    T.at<float>(1, 3) = joint->_mpPosition->at(1);
-    T.at<float>(2, 3) = joint->_mpPosition->at(2);
-    mReferenceJointTransformations.push_back(T.clone());
+    Transformation T = Transformation::eye();
+    T(0, 3) = p[0];
+    T(1, 3) = p[1];
+    T(2, 3) = p[2];
+    mReferenceJointTransformations.push_back(T);
 
     // create storage variables for intermediate results
-    mTwistExponentials.push_back(cv::Mat::eye(4, 4, CV_32FC1));
-    mProductsOfExponentials.push_back(cv::Mat::eye(4, 4, CV_32FC1));
-    mJointTransformations.push_back(cv::Mat::eye(4, 4, CV_32FC1));
-    mJointTwists.push_back(cv::Mat::eye(6, 1, CV_32FC1));
+    mTwistExponentials.push_back(Transformation::eye());
+    mInverseTwistExponentials.push_back(Transformation::eye());
+    mProductsOfExponentials.push_back(Transformation::eye());
+    mJointTransformations.push_back(Transformation::eye());
+    mJointTwists.push_back(Twist());
   }
 
   // end-effector
-  mReferenceEndEffectorTransformation = getEndEffectorCoordinateFrame()->getTransformation();
+  getEndEffectorCoordinateFrame()->getTransformation(mReferenceEndEffectorTransformation);
 }
 
-cv::Mat cedar::dev::ForwardKinematics::getJointTransformation(unsigned int index)
+cedar::dev::ForwardKinematics::Transformation cedar::dev::ForwardKinematics::getRootTransformationFixed() const
 {
-  cv::Mat T;
-  mTransformationsLock.lockForRead();
-  T = mpRootCoordinateFrame->getTransformation() * mJointTransformations[index];
-  mTransformationsLock.unlock();
-  return T;
+  Transformation root;
+  mpRootCoordinateFrame->getTransformation(root);
+  return root;
 }
 
-void cedar::dev::ForwardKinematics::calculateCartesianJacobian
+cedar::dev::ForwardKinematics::Point cedar::dev::ForwardKinematics::toWorldCoordinates
 (
   const cv::Mat& point,
   unsigned int jointIndex,
-  cv::Mat& result,
-  unsigned int coordinateFrame
-)
+  unsigned int coordinateFrame,
+  const Transformation& root
+) const
 {
-  // transform to local coordinates if necessary
-  cv::Mat point_local;
-  mTransformationsLock.lockForRead();
+  Point point_fixed(point.at<float>(0, 0), point.at<float>(1, 0), point.at<float>(2, 0), point.at<float>(3, 0));
   switch (coordinateFrame)
   {
-    case cedar::dev::KinematicChain::WORLD_COORDINATES :
-    {
-      point_local = (mpRootCoordinateFrame->getTransformation() * mJointTransformations[jointIndex]).inv() * point;
-      break;
-    }
     case cedar::dev::KinematicChain::BASE_COORDINATES :
     {
-      point_local = mJointTransformations[jointIndex].inv() * point;
-      break;
+      return root * point_fixed;
     }
     case cedar::dev::KinematicChain::LOCAL_COORDINATES :
     {
-      point_local = point;
-      break;
+      return root * mJointTransformations[jointIndex] * point_fixed;
+    }
+    case cedar::dev::KinematicChain::WORLD_COORDINATES :
+    default:
+    {
+      return point_fixed;
     }
   }
+}
+
+cedar::dev::ForwardKinematics::Twist cedar::dev::ForwardKinematics::getSpatialJointTwist
+(
+  unsigned int jointIndex,
+  const Transformation& root
+) const
+{
+  return cedar::aux::math::adjointTransformTwist(root, mJointTwists[jointIndex]);
+}
+
+cv::Mat cedar::dev::ForwardKinematics::getJointTransformation(unsigned int index)
+{
+  Transformation root = getRootTransformationFixed();
+  QReadLocker locker(&mTransformationsLock);
+  return toMat(root * mJointTransformations[index]);
+}
+
+void cedar::dev::ForwardKinematics::calculateCartesianJacobian
+(
+  const cv::Mat& point,
+  unsigned int jointIndex,
+  cv::Mat& result,
+  unsigned int coordinateFrame
+)
+{
+  Transformation root = getRootTransformationFixed();
+  QReadLocker locker(&mTransformationsLock);
+  Point point_world = toWorldCoordinates(point, jointIndex, coordinateFrame, root);
 
   // calculate Jacobian column by column
-  cv::Mat column;
   for (unsigned int j = 0; j <=  jointIndex; j++)
   {
-    column = cedar::aux::math::wedgeTwist<float>
-             (
-               cedar::aux::math::rigidToAdjointTransformation<float>(mpRootCoordinateFrame->getTransformation())
-               * mJointTwists[j]
-             )
-             * mpRootCoordinateFrame->getTransformation() // change point to world coordinates
-             * mJointTransformations[jointIndex] // change point to root coordinates
-             * point_local;
+    Point column = cedar::aux::math::wedgeTwist(getSpatialJointTwist(j, root)) * point_world;
     // export
-    result.at<float>(0, j) = column.at<float>(0, 0);
-    result.at<float>(1, j) = column.at<float>(1, 0);
-    result.at<float>(2, j) = column.at<float>(2, 0);
+    result.at<float>(0, j) = column[0];
+    result.at<float>(1, j) = column[1];
+    result.at<float>(2, j) = column[2];
   }
-  mTransformationsLock.unlock();
 }
 
 cv::Mat cedar::dev::ForwardKinematics::calculateCartesianJacobian
@@ -184,6 +195,18 @@ cv::Mat cedar::dev::ForwardKinematics::calculateCartesianJacobian
   return J;
 }
 
+cedar::dev::ForwardKinematics::Point cedar::dev::ForwardKinematics::calculateCartesianJacobianTemporalDerivativeColumn
+(
+  const Point& pointWorld,
+  const Point& velocityWorld,
+  unsigned int column,
+  const Transformation& root
+) const
+{
+  return cedar::aux::math::wedgeTwist(calculateTwistTemporalDerivativeFixed(column)) * pointWorld
+         + cedar::aux::math::wedgeTwist(getSpatialJointTwist(column, root)) * velocityWorld;
+}
+
 void cedar::dev::ForwardKinematics::calculateCartesianJacobianTemporalDerivative
      (
        const cv::Mat& point,
@@ -192,49 +215,20 @@ void cedar::dev::ForwardKinematics::calculateCartesianJacobianTemporalDerivative
        unsigned int coordinateFrame
      )
 {
-  cv::Mat point_world;
-  switch (coordinateFrame)
-  {
-    case cedar::dev::KinematicChain::WORLD_COORDINATES :
-    {
-      point_world = point;
-      break;
-    }
-    case cedar::dev::KinematicChain::BASE_COORDINATES :
-    {
-      //!@todo add base coordinate treatment
-//      point_local = mJointTransformations[jointIndex].inv() * point; ...
-      break;
-    }
-    case cedar::dev::KinematicChain::LOCAL_COORDINATES :
-    {
-      point_world = mpRootCoordinateFrame->getTransformation() * mJointTransformations[jointIndex] * point; //... check this
-      break;
-    }
-  }
+  Transformation root = getRootTransformationFixed();
+  QReadLocker locker(&mTransformationsLock);
+  Point point_world = toWorldCoordinates(point, jointIndex, coordinateFrame, root);
+  Point velocity_world = calculateVelocityFixed(point_world, jointIndex, root);
 
   // calculate Jacobian temporal derivative column by column
-  cv::Mat column;
-  cv::Mat S1;
-  cv::Mat S2;
-  mTransformationsLock.lockForRead();
   for (unsigned int j = 0; j <= jointIndex; j++)
   {
-    S1 = cedar::aux::math::wedgeTwist<float>(calculateTwistTemporalDerivative(j)) * point_world;
-    S2 = cedar::aux::math::wedgeTwist<float>
-         (
-           cedar::aux::math::rigidToAdjointTransformation<float>(mpRootCoordinateFrame->getTransformation())
-           *mJointTwists[j]
-         )
-         * calculateVelocity(point_world, jointIndex, cedar::dev::KinematicChain::WORLD_COORDINATES);
-
-    column = S1 + S2;
+    Point column = calculateCartesianJacobianTemporalDerivativeColumn(point_world, velocity_world, j, root);
     // export
-    result.at<float>(0, j) = column.at<float>(0, 0);
-    result.at<float>(1, j) = column.at<float>(1, 0);
-    result.at<float>(2, j) = column.at<float>(2, 0);
+    result.at<float>(0, j) = column[0];
+    result.at<float>(1, j) = column[1];
+    result.at<float>(2, j) = column[2];
   }
-  mTransformationsLock.unlock();
 }
 
 cv::Mat cedar::dev::ForwardKinematics::calculateCartesianJacobianTemporalDerivative
@@ -249,6 +243,22 @@ cv::Mat cedar::dev::ForwardKinematics::calculateCartesianJacobianTemporalDerivat
   return J;
 }
 
+cedar::dev::ForwardKinematics::Point cedar::dev::ForwardKinematics::calculateVelocityFixed
+(
+  const Point& pointWorld,
+  unsigned int jointIndex,
+  const Transformation& root
+) const
+{
+  // spatial Jacobian times joint velocities
+  Twist spatial_velocity;
+  for (unsigned int j = 0; j <= jointIndex; j++)
+  {
+    spatial_velocity += getSpatialJointTwist(j, root) * mpKinematicChain->getJointVelocity(j);
+  }
+  return cedar::aux::math::wedgeTwist(spatial_velocity) * pointWorld;
+}
+
 cv::Mat cedar::dev::ForwardKinematics::calculateVelocity
         (
           const cv::Mat& point,
@@ -256,31 +266,10 @@ cv::Mat cedar::dev::ForwardKinematics::calculateVelocity
           unsigned int coordinateFrame
         )
 {
-  cv::Mat point_world;
-  switch (coordinateFrame)
-  {
-    case cedar::dev::KinematicChain::WORLD_COORDINATES :
-    {
-      point_world = point;
-      break;
-    }
-    case cedar::dev::KinematicChain::BASE_COORDINATES :
-    {
-      //!@todo add base coordinate treatment
-//      point_local = mJointTransformations[jointIndex].inv() * point; ...
-      break;
-    }
-    case cedar::dev::KinematicChain::LOCAL_COORDINATES :
-    {
-      point_world = mpRootCoordinateFrame->getTransformation() * mJointTransformations[jointIndex] * point; //... check this
-      break;
-    }
-  }
-  return cedar::aux::math::wedgeTwist<float>
-         (
-           calculateSpatialJacobian(jointIndex) * mpKinematicChain->getJointVelocities()
-         )
-         * point_world;
+  Transformation root = getRootTransformationFixed();
+  QReadLocker locker(&mTransformationsLock);
+  Point point_world = toWorldCoordinates(point, jointIndex, coordinateFrame, root);
+  return toMat(calculateVelocityFixed(point_world, jointIndex, root));
 }
 
 cv::Mat cedar::dev::ForwardKinematics::calculateAcceleration
@@ -290,184 +279,117 @@ cv::Mat cedar::dev::ForwardKinematics::calculateAcceleration
           unsigned int coordinateFrame
         )
 {
-  cv::Mat point_world;
-  switch (coordinateFrame)
+  Transformation root = getRootTransformationFixed();
+  QReadLocker locker(&mTransformationsLock);
+  Point point_world = toWorldCoordinates(point, jointIndex, coordinateFrame, root);
+
+  // J_dot * theta_dot + J * theta_dot_dot, and the spatial velocity J * theta_dot
+  Twist T1;
+  Twist T2;
+  Twist spatial_velocity;
+  for (unsigned int j = 0; j <= jointIndex; j++)
   {
-    case cedar::dev::KinematicChain::WORLD_COORDINATES :
-    {
-      point_world = point;
-      break;
-    }
-    case cedar::dev::KinematicChain::BASE_COORDINATES :
-    {
-      //!@todo: add base coordinate treatment
-//      point_local = mJointTransformations[jointIndex].inv() * point; ...
-      break;
-    }
-    case cedar::dev::KinematicChain::LOCAL_COORDINATES :
-    {
-      point_world = mpRootCoordinateFrame->getTransformation() * mJointTransformations[jointIndex] * point; //... check this
-      break;
-    }
+    Twist spatial_twist = getSpatialJointTwist(j, root);
+    T1 += calculateTwistTemporalDerivativeFixed(j) * mpKinematicChain->getJointVelocity(j);
+    T2 += spatial_twist * mpKinematicChain->getJointAcceleration(j);
+    spatial_velocity += spatial_twist * mpKinematicChain->getJointVelocity(j);
   }
-  cv::Mat J = calculateSpatialJacobian(jointIndex);
-  cv::Mat J_dot = calculateSpatialJacobianTemporalDerivative(jointIndex);
-  cv::Mat T1 = J_dot * mpKinematicChain->getJointVelocities();
-  cv::Mat T2 = J * mpKinematicChain->getJointAccelerations();
-  cv::Mat S1 = cedar::aux::math::wedgeTwist<float>(T1 + T2) * point_world;
-  cv::Mat S2 = cedar::aux::math::wedgeTwist<float>(calculateSpatialJacobian(jointIndex)
-               * mpKinematicChain->getJointVelocities())
-           * calculateVelocity(point_world, jointIndex, cedar::dev::KinematicChain::WORLD_COORDINATES);
-  return S1 + S2;
+  Transformation spatial_velocity_wedge = cedar::aux::math::wedgeTwist(spatial_velocity);
+  Point S1 = cedar::aux::math::wedgeTwist(Twist(T1 + T2)) * point_world;
+  Point S2 = spatial_velocity_wedge * (spatial_velocity_wedge * point_world);
+  return toMat(Point(S1 + S2));
 }
 
 cv::Mat cedar::dev::ForwardKinematics::calculateSpatialJacobian(unsigned int index)
 {
   cv::Mat jacobian = cv::Mat::zeros(6, mpKinematicChain->getNumberOfJoints(), CV_32FC1);
-  mTransformationsLock.lockForRead();
+  Transformation root = getRootTransformationFixed();
+  QReadLocker locker(&mTransformationsLock);
   for (unsigned int j = 0; j <= index; j++)
   {
+    Twist column = getSpatialJointTwist(j, root);
     for (int i = 0; i < 6; i++)
     {
-      jacobian.at<float>(i, j) = mJointTwists[j].at<float>(i, 0);
+      jacobian.at<float>(i, j) = column[i];
     }
   }
-  mTransformationsLock.unlock();
-  return cedar::aux::math::rigidToAdjointTransformation<float>(mpRootCoordinateFrame->getTransformation())*jacobian;
+  return jacobian;
 }
 
 cv::Mat cedar::dev::ForwardKinematics::calculateSpatialJacobianTemporalDerivative(unsigned int index)
 {
-  // create k-th column
   cv::Mat J = cv::Mat::zeros(6, mpKinematicChain->getNumberOfJoints(), CV_32FC1);
+  QReadLocker locker(&mTransformationsLock);
   for (unsigned int i=0; i<=index; i++)
   {
-    mTransformationsLock.lockForRead();
     // create i-th column
-    cv::Mat column = cv::Mat::zeros(6, 1, CV_32FC1);
-    column = calculateTwistTemporalDerivative(i);
+    Twist column = calculateTwistTemporalDerivativeFixed(i);
     // export to matrix
     for (unsigned int j=0; j<6; j++)
     {
-      J.at<float>(j, i) = column.at<float>(j, 0);
+      J.at<float>(j, i) = column[j];
     }
-    mTransformationsLock.unlock();
   }
   return J;
 }
 
 cv::Mat cedar::dev::ForwardKinematics::calculateTwistTemporalDerivative(unsigned int jointIndex)
+{
+  QReadLocker locker(&mTransformationsLock);
+  return toMat(calculateTwistTemporalDerivativeFixed(jointIndex));
+}
+
+cedar::dev::ForwardKinematics::Twist cedar::dev::ForwardKinematics::calculateTwistTemporalDerivativeFixed
+(
+  unsigned int jointIndex
+) const
 {
   // calculate transformation to (j-1)-th joint frame
-  cv::Mat g = cv::Mat::zeros(4, 4, CV_32FC1);
+  Transformation g = Transformation::zeros();
   // g is a product of j-1 exponentials, so the temporal derivative is a sum with j-1 summands
   for (unsigned int k = 0; k < jointIndex; k++)
   {
     /*******************************************************************************************************************
      * the k-th summand, deriving the factor with positive sign theta_k
      ******************************************************************************************************************/
-    cv::Mat s_k = cv::Mat::eye(4, 4, CV_32FC1); // summand where the factor with the positive sign theta_k is derived
-    // factors before the k-th
-    for (unsigned int j = 0; j < k; j++)
-    {
-      // j-th factor stays the same for j < k
-      s_k = s_k * mTwistExponentials[j];
-//      if((jointIndex == 2) && (k == 1))
-//      {
-//        std::cout << "joint index = " << jointIndex << ", k = " << k << std::endl;
-//        std::cout << "j = " << j << std::endl;
-//        std::cout << "s_k:" << std::endl;
-//        cedar::aux::math::write(s_k);
-//      }
-
-    }
+    // factors before the k-th stay the same
+    Transformation s_k = (k > 0) ? mProductsOfExponentials[k - 1] : Transformation::eye();
     // k-th factor is derived by time
-    s_k = s_k * cedar::aux::math::wedgeTwist<float>(mReferenceJointTwists[k]) * mTwistExponentials[k];
-
-//    if((jointIndex == 2) && (k == 1))
-//    {
-//      std::cout << "j = " << k << std::endl;
-//
-//      std::cout << "s_k:" << std::endl;
-//      cedar::aux::math::write(s_k);
-//      std::cout << "cedar::aux::math::wedgeTwist<float>(mReferenceJointTwists[k]):" << std::endl;
-//      cedar::aux::math::write(cedar::aux::math::wedgeTwist<float>(mReferenceJointTwists[k]));
-//      std::cout << "mTwistExponentials[k]:" << std::endl;
-//      cedar::aux::math::write(mTwistExponentials[k]);
-//    }
+    s_k = s_k * mReferenceJointTwistWedges[k] * mTwistExponentials[k];
     // factors after the k-th
     for (unsigned int j = k+1; j < jointIndex; j++)
     {
       // j-th factor stays the same for j > k
       s_k = s_k * mTwistExponentials[j];
-//      if((jointIndex == 2) && (k == 1))
-//      {
-//        std::cout << "j = " << j << std::endl;
-//        std::cout << "s_k:" << std::endl;
-//        cedar::aux::math::write(s_k);
-//      }
     }
-    s_k = s_k * cedar::aux::math::wedgeTwist<float>(mReferenceJointTwists[jointIndex])
-              * mProductsOfExponentials[jointIndex-1].inv();
-//    if((jointIndex == 2) && (k == 1))
-//    {
-//      std::cout << "final s_k:" << std::endl;
-//      cedar::aux::math::write(s_k);
-//    }
+    s_k = s_k * mReferenceJointTwistWedges[jointIndex]
+              * cedar::aux::math::invertRigidTransformation(mProductsOfExponentials[jointIndex-1]);
     /*******************************************************************************************************************
      * the (2*(j-1)-k)-th summand, deriving the factor with negative sign theta_k
      ******************************************************************************************************************/
-    cv::Mat t_k; // summand where the factor with the negative sign theta_k is derived
-    t_k = mProductsOfExponentials[jointIndex-1]
-            * cedar::aux::math::wedgeTwist<float>(mReferenceJointTwists[jointIndex]);
+    Transformation t_k = mProductsOfExponentials[jointIndex-1] * mReferenceJointTwistWedges[jointIndex];
     // factors before the k-th
     for (unsigned int j = jointIndex-1; j > k; j--)
     {
       // j-th factor stays the same for j > k
-      t_k = t_k * mTwistExponentials[j].inv();
+      t_k = t_k * mInverseTwistExponentials[j];
     }
     // k-th factor is derived by time
-    t_k = t_k * cedar::aux::math::wedgeTwist<float>(mReferenceJointTwists[k]) * mTwistExponentials[k].inv();
+    t_k = t_k * mReferenceJointTwistWedges[k] * mInverseTwistExponentials[k];
     // factors after the k-th
     for (int j = k-1; j >= 0; j--)
     {
       // j-th factor stays the same for j < k
-      t_k = t_k * mTwistExponentials[j].inv();
+      t_k = t_k * mInverseTwistExponentials[j];
     }
 
-//    if((jointIndex == 2) && (k == 1))
-//    {
-//      std::cout << "final s_k:" << std::endl;
-//      cedar::aux::math::write(s_k);
-//      std::cout << "final t_k:" << std::endl;
-//      cedar::aux::math::write(t_k);
-//      std::cout << "g:" << std::endl;
-//      cedar::aux::math::write(g);
-//    }
     // add this summand to the sum
-    g = g + mpKinematicChain->getJointVelocity(k)*(s_k - t_k);
-
-//    std::cout << "joint index = " << jointIndex << ", summand " << k << std::endl;
-//    std::cout << "final s_k:" << std::endl;
-//    cedar::aux::math::write(s_k);
-//    std::cout << "final t_k:" << std::endl;
-//    cedar::aux::math::write(t_k);
-//    std::cout << "g:" << std::endl;
-//    cedar::aux::math::write(g);
+    g = g + (s_k - t_k) * mpKinematicChain->getJointVelocity(k);
   }
 
-//  std::cout << "twist exponentials:" << std::endl;
-//  for (unsigned int l = 0; l <= jointIndex; l++)
-//  {
-//    cedar::aux::math::write(mTwistExponentials[l]);
-//  }
-//  std::cout << "cedar::aux::math::veeTwist<float>(g):" << std::endl;
-//  cedar::aux::math::write(cedar::aux::math::veeTwist<float>(g));
-//  std::cout << "------------------------------------------------------" << std::endl;
-
   // adjoint of the calculated sum times the j-th twist is the derivative
-  return cedar::aux::math::veeTwist<float>(g);
- }
+  return cedar::aux::math::veeTwist(g);
+}
 
 cv::Mat cedar::dev::ForwardKinematics::calculateEndEffectorPosition()
 {
@@ -496,7 +418,8 @@ void cedar::dev::ForwardKinematics::setEndEffector(cedar::aux::LocalCoordinateFr
 
 cv::Mat cedar::dev::ForwardKinematics::getProductOfExponentials(unsigned int jointIndex)
 {
-  return mProductsOfExponentials[jointIndex];
+  QReadLocker locker(&mTransformationsLock);
+  return toMat(mProductsOfExponentials[jointIndex]);
 }
 
 cv::Mat cedar::dev::ForwardKinematics::getEndEffectorTransformation()
@@ -524,42 +447,31 @@ cv::Mat cedar::dev::ForwardKinematics::calculateEndEffectorAcceleration()
 
 void cedar::dev::ForwardKinematics::calculateTransformations()
 {
-  mTransformationsLock.lockForWrite();
-  // first joint
-  cedar::aux::math::expTwist<float>
-  (
-    mReferenceJointTwists[0],
-    mpKinematicChain->getJointAngle(0),
-    mTwistExponentials[0]
-  );
-  mProductsOfExponentials[0] = mTwistExponentials[0].clone();
-  mJointTransformations[0] = mProductsOfExponentials[0] * mReferenceJointTransformations[0];
-  mJointTwists[0] = mReferenceJointTwists[0];
-  // other joints
-  for (unsigned int i = 1; i < mpKinematicChain->getNumberOfJoints(); i++)
+  Transformation root = getRootTransformationFixed();
+  unsigned int number_of_joints = mpKinematicChain->getNumberOfJoints();
+
+  QWriteLocker locker(&mTransformationsLock);
+  for (unsigned int i = 0; i < number_of_joints; i++)
   {
-    cedar::aux::math::expTwist<float>
-    (
-      mReferenceJointTwists[i],
-      mpKinematicChain->getJointAngle(i),
-      mTwistExponentials[i]
-    );
-    mProductsOfExponentials[i] = mProductsOfExponentials[i - 1] * mTwistExponentials[i];
+    mTwistExponentials[i] = cedar::aux::math::expTwist(mReferenceJointTwists[i], mpKinematicChain->getJointAngle(i));
+    mInverseTwistExponentials[i] = cedar::aux::math::invertRigidTransformation(mTwistExponentials[i]);
+    if (i == 0)
+    {
+      // first joint
+      mProductsOfExponentials[0] = mTwistExponentials[0];
+      mJointTwists[0] = mReferenceJointTwists[0];
+    }
+    else
+    {
+      // other joints
+      mProductsOfExponentials[i] = mProductsOfExponentials[i - 1] * mTwistExponentials[i];
+      mJointTwists[i] = cedar::aux::math::adjointTransformTwist(mProductsOfExponentials[i], mReferenceJointTwists[i]);
+    }
     mJointTransformations[i] = mProductsOfExponentials[i] * mReferenceJointTransformations[i];
-    mJointTwists[i] = cedar::aux::math::rigidToAdjointTransformation<float>
-                      (
-                        mProductsOfExponentials[i]
-                      )
-                      * mReferenceJointTwists[i];
   }
-// end-effector
+  // end-effector
   mpEndEffectorCoordinateFrame->setTransformation
   (
-    mpRootCoordinateFrame->getTransformation()
-    * mProductsOfExponentials[mpKinematicChain->getNumberOfJoints()-1]
-    * mReferenceEndEffectorTransformation
+    Transformation(root * mProductsOfExponentials[number_of_joints - 1] * mReferenceEndEffectorTransformation)
   );
-  mTransformationsLock.unlock();
 }
-
-
@@ -51,9 +51,10 @@
 #include <opencv2/opencv.hpp>
 
 
-/*!@todo describe.
+/*!@brief Forward kinematics of a kinematic chain, computed with the product of exponentials formula.
  *
- * @todo describe more.
+ * All transformations and twists are kept in fixed-size matrices (cv::Matx), so updating the chain and computing
+ * Jacobians, velocities and accelerations does not allocate memory; cv::Mat only appears at the interface.
  */
 class cedar::dev::ForwardKinematics
 {
@@ -61,6 +62,15 @@ class cedar::dev::ForwardKinematics
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! A rigid transformation in homogeneous coordinates.
+  typedef cv::Matx<float, 4, 4> Transformation;
+
+  //! Twist coordinates (v, omega).
+  typedef cv::Vec<float, 6> Twist;
+
+  //! A point in homogeneous coordinates.
+  typedef cv::Vec<float, 4> Point;
 
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
@@ -119,7 +129,42 @@ protected:
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  // none yet
+  //! Transformation of the root coordinate frame.
+  Transformation getRootTransformationFixed() const;
+
+  //! Converts a point given in the specified coordinate frame to world coordinates. Requires the read lock.
+  Point toWorldCoordinates
+  (
+    const cv::Mat& point,
+    unsigned int jointIndex,
+    unsigned int coordinateFrame,
+    const Transformation& root
+  ) const;
+
+  //! Twist of the given joint in world coordinates. Requires the read lock.
+  Twist getSpatialJointTwist(unsigned int jointIndex, const Transformation& root) const;
+
+  //! Velocity of a point rigidly attached to the given joint, both in world coordinates. Requires the read lock.
+  Point calculateVelocityFixed(const Point& pointWorld, unsigned int jointIndex, const Transformation& root) const;
+
+  //! Fixed-size version of calculateTwistTemporalDerivative. Requires the read lock.
+  Twist calculateTwistTemporalDerivativeFixed(unsigned int jointIndex) const;
+
+  //! Fixed-size version of calculateCartesianJacobianTemporalDerivative for a column. Requires the read lock.
+  Point calculateCartesianJacobianTemporalDerivativeColumn
+  (
+    const Point& pointWorld,
+    const Point& velocityWorld,
+    unsigned int column,
+    const Transformation& root
+  ) const;
+
+  //! Copies a fixed-size matrix into a newly allocated cv::Mat.
+  template<int rows, int cols>
+  static cv::Mat toMat(const cv::Matx<float, rows, cols>& matrix)
+  {
+    return cv::Mat(matrix, true);
+  }
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -137,19 +182,23 @@ private:
   QReadWriteLock mTransformationsLock;
 
   //! twist coordinates for the transformations induced by rotating the joints (assuming reference configurations)
-  std::vector<cv::Mat> mReferenceJointTwists;
+  std::vector<Twist> mReferenceJointTwists;
+  //! wedge of the reference joint twists, needed for the temporal derivatives
+  std::vector<Transformation> mReferenceJointTwistWedges;
   //! transformations to the joint frames (assuming reference configurations)
-  std::vector<cv::Mat> mReferenceJointTransformations;
+  std::vector<Transformation> mReferenceJointTransformations;
   //! transformations to the end-effector frame (assuming reference configurations)
-  cv::Mat mReferenceEndEffectorTransformation;
-    //! exponentials of joint twists with specified joint angle
-  std::vector<cv::Mat> mTwistExponentials;
+  Transformation mReferenceEndEffectorTransformation;
+  //! exponentials of joint twists with specified joint angle
+  std::vector<Transformation> mTwistExponentials;
+  //! inverses of mTwistExponentials
+  std::vector<Transformation> mInverseTwistExponentials;
   //! transformation matrices between joints, generated by exponential map of joint twists
-  std::vector<cv::Mat> mProductsOfExponentials;
+  std::vector<Transformation> mProductsOfExponentials;
   //! transformation matrices to the joint frames in the current configuration
-  std::vector<cv::Mat> mJointTransformations;
+  std::vector<Transformation> mJointTransformations;
   //! twist coordinates for the transformations induced by rotating the joints in the curent configuration
-  std::vector<cv::Mat> mJointTwists;
+  std::vector<Twist> mJointTwists;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
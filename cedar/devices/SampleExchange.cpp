@@ -0,0 +1,172 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        SampleExchange.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Source file for the class cedar::dev::SampleExchange.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/devices/SampleExchange.h"
+#include "cedar/auxiliaries/assert.h"
+
+// SYSTEM INCLUDES
+#include <QMutexLocker>
+#include <chrono>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dev::SampleExchange::SampleExchange(unsigned int numberOfSlots)
+:
+mSlots(numberOfSlots),
+mLastSequenceNumber(0)
+{
+  // there always is a newest sample, initially an empty one
+  this->mSlots.makeNewest(0);
+}
+
+cedar::dev::SampleExchange::~SampleExchange()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+int64_t cedar::dev::SampleExchange::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>
+         (
+           std::chrono::steady_clock::now().time_since_epoch()
+         ).count();
+}
+
+void cedar::dev::SampleExchange::reset(const cv::Mat& initialValue)
+{
+  QMutexLocker locker(&this->mWriterLock);
+
+  int64_t time_stamp = now();
+  for (unsigned int i = 0; i < this->mSlots.getNumberOfSlots(); ++i)
+  {
+    Sample& sample = this->mSlots.at(static_cast<int>(i));
+    initialValue.copyTo(sample.mData);
+    sample.mTimeStamp = time_stamp;
+    sample.mSequenceNumber = 0;
+  }
+  this->mSlots.makeNewest(0);
+}
+
+unsigned long long cedar::dev::SampleExchange::commit(int slotIndex)
+{
+  Sample& sample = this->mSlots.at(slotIndex);
+  sample.mTimeStamp = now();
+  sample.mSequenceNumber = ++this->mLastSequenceNumber;
+  this->mSlots.makeNewest(slotIndex);
+  return sample.mSequenceNumber;
+}
+
+unsigned long long cedar::dev::SampleExchange::publish(const cv::Mat& data)
+{
+  QMutexLocker locker(&this->mWriterLock);
+
+  int slot = this->mSlots.waitForFreeSlot();
+  // reuses the memory of the slot if the data has the same size and type as the last sample written into it
+  data.copyTo(this->mSlots.at(slot).mData);
+  return this->commit(slot);
+}
+
+unsigned long long cedar::dev::SampleExchange::publishElement(int index, float value)
+{
+  QMutexLocker locker(&this->mWriterLock);
+
+  // only writers change the newest slot, so it can be read here without pinning it
+  const cv::Mat& newest = this->mSlots.at(this->mSlots.getNewest()).mData;
+  CEDAR_ASSERT(index >= 0 && index < newest.rows);
+
+  int slot = this->mSlots.waitForFreeSlot();
+  cv::Mat& data = this->mSlots.at(slot).mData;
+  newest.copyTo(data);
+  data.at<float>(index, 0) = value;
+  return this->commit(slot);
+}
+
+void cedar::dev::SampleExchange::read(Sample& sample) const
+{
+  this->mSlots.readNewest
+  (
+    [&sample](const Sample& newest)
+    {
+      newest.mData.copyTo(sample.mData);
+      sample.mTimeStamp = newest.mTimeStamp;
+      sample.mSequenceNumber = newest.mSequenceNumber;
+    }
+  );
+}
+
+cedar::dev::SampleExchange::Sample cedar::dev::SampleExchange::read() const
+{
+  Sample sample;
+  this->read(sample);
+  return sample;
+}
+
+float cedar::dev::SampleExchange::readElement(int index) const
+{
+  float value = 0.0f;
+  this->mSlots.readNewest
+  (
+    [&value, index](const Sample& newest)
+    {
+      CEDAR_DEBUG_ASSERT(index >= 0 && index < newest.mData.rows);
+      value = newest.mData.at<float>(index, 0);
+    }
+  );
+  return value;
+}
+
+unsigned long long cedar::dev::SampleExchange::getSequenceNumber() const
+{
+  unsigned long long sequence_number = 0;
+  this->mSlots.readNewest
+  (
+    [&sequence_number](const Sample& newest)
+    {
+      sequence_number = newest.mSequenceNumber;
+    }
+  );
+  return sequence_number;
+}
@@ -0,0 +1,171 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        SampleExchange.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Header file for the class cedar::dev::SampleExchange.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DEV_SAMPLE_EXCHANGE_H
+#define CEDAR_DEV_SAMPLE_EXCHANGE_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/NewestSlotPool.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/devices/SampleExchange.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/core/core.hpp>
+#include <QMutex>
+#include <cstdint>
+
+
+/*!@brief Hands the newest sample of one kind of data from the threads that write it to the threads that read it.
+ *
+ *        The exchange keeps its samples in a cedar::aux::NewestSlotPool with a small number of slots (three by
+ *        default, i.e., a triple buffer). A writer copies each sample into a slot that is neither the newest one nor
+ *        pinned by a reader and then makes it the newest one. Readers pin the newest slot while they copy it out.
+ *
+ *        Reading is lock-free, but not wait-free (see cedar::aux::NewestSlotPool). Writers are serialized among
+ *        themselves by a mutex. A writer does not wait for readers as long as a slot is free; if all slots but the
+ *        newest one are pinned, e.g., because more readers than there are spare slots are still copying older samples,
+ *        it waits until one of them is done copying.
+ *
+ *        Every sample carries the time at which it was published and a sequence number, so readers can tell how old
+ *        a sample is and whether they have seen it before.
+ */
+class cedar::dev::SampleExchange
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! A sample along with the time it was published and its number.
+  struct Sample
+  {
+    Sample()
+    :
+    mTimeStamp(0),
+    mSequenceNumber(0)
+    {
+    }
+
+    //! The data of the sample.
+    cv::Mat mData;
+
+    //! Time at which the sample was published, in nanoseconds (see SampleExchange::now).
+    int64_t mTimeStamp;
+
+    //! Number of the sample, counting from one; zero for the initial value set by reset.
+    unsigned long long mSequenceNumber;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  SampleExchange(unsigned int numberOfSlots = 3);
+
+  //!@brief Destructor
+  ~SampleExchange();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Returns the current time of the steady clock used for the time stamps of samples, in nanoseconds.
+  static int64_t now();
+
+  /*!@brief Sets every slot to a copy of the given value and makes it the newest sample, with sequence number zero.
+   *
+   *        This changes slots that readers may be copying and must therefore not be called while other threads use
+   *        the exchange, e.g., only while a component is being configured.
+   */
+  void reset(const cv::Mat& initialValue);
+
+  /*!@brief Copies the data into a free slot and makes it the newest sample.
+   *
+   *        Once the slots have the size and type of the data, this does not allocate memory.
+   *
+   * @returns The sequence number of the published sample.
+   */
+  unsigned long long publish(const cv::Mat& data);
+
+  /*!@brief Publishes a copy of the newest sample in which the element at (index, 0) is set to the given value.
+   *
+   * @returns The sequence number of the published sample.
+   */
+  unsigned long long publishElement(int index, float value);
+
+  /*!@brief Copies the newest sample into the given one. Does not take a lock.
+   *
+   *        If sample.mData already has the size and type of the data, its memory is reused.
+   */
+  void read(Sample& sample) const;
+
+  //! Returns a copy of the newest sample. Does not take a lock.
+  Sample read() const;
+
+  //! Returns the element at (index, 0) of the newest sample. Does not take a lock.
+  float readElement(int index) const;
+
+  //! Returns the sequence number of the newest sample. Does not take a lock.
+  unsigned long long getSequenceNumber() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Stamps the sample in the given slot and makes it the newest one. The writer lock must be held.
+  unsigned long long commit(int slotIndex);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! The slots holding the samples.
+  cedar::aux::NewestSlotPool<Sample> mSlots;
+
+  //! Sequence number of the last published sample. Only accessed while holding the writer lock.
+  unsigned long long mLastSequenceNumber;
+
+  //! Serializes writers. Readers never take this lock.
+  QMutex mWriterLock;
+
+}; // class cedar::dev::SampleExchange
+
+#endif // CEDAR_DEV_SAMPLE_EXCHANGE_H
+
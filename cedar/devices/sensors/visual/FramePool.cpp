@@ -0,0 +1,161 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        FramePool.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Source file for the class cedar::dev::sensors::visual::FramePool.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/devices/sensors/visual/FramePool.h"
+#include "cedar/auxiliaries/opencv_helper.h"
+
+// SYSTEM INCLUDES
+#include <thread>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dev::sensors::visual::FramePool::FramePool(unsigned int numberOfBuffers)
+:
+mBuffers(numberOfBuffers),
+mPublishedCount(0),
+mDetachedCount(0)
+{
+}
+
+cedar::dev::sensors::visual::FramePool::~FramePool()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cedar::dev::sensors::visual::FramePool::isShared(const cv::Mat& matrix)
+{
+#if CEDAR_OPENCV_MAJOR_VERSION >= 3
+  return matrix.u != nullptr && CV_XADD(&matrix.u->refcount, 0) > 1;
+#else
+  return matrix.refcount != nullptr && CV_XADD(matrix.refcount, 0) > 1;
+#endif
+}
+
+unsigned long long cedar::dev::sensors::visual::FramePool::getPublishedCount() const
+{
+  return this->mPublishedCount.load();
+}
+
+unsigned long long cedar::dev::sensors::visual::FramePool::getDetachedCount() const
+{
+  return this->mDetachedCount.load();
+}
+
+void cedar::dev::sensors::visual::FramePool::clear()
+{
+  this->mBuffers.makeNewest(-1);
+}
+
+int cedar::dev::sensors::visual::FramePool::findBuffer() const
+{
+  int detachable = -1;
+  for (unsigned int i = 0; i < this->mBuffers.getNumberOfSlots(); ++i)
+  {
+    int index = static_cast<int>(i);
+    if (!this->mBuffers.isFree(index))
+    {
+      continue;
+    }
+
+    if (!isShared(this->mBuffers.at(index).mFrame))
+    {
+      return index;
+    }
+    else if (detachable < 0)
+    {
+      detachable = index;
+    }
+  }
+  return detachable;
+}
+
+unsigned long long cedar::dev::sensors::visual::FramePool::publish(const cv::Mat& frame)
+{
+  int buffer_index = this->findBuffer();
+  while (buffer_index < 0)
+  {
+    // consumers are copying the headers of all other buffers right now; this only takes a moment
+    std::this_thread::yield();
+    buffer_index = this->findBuffer();
+  }
+
+  Buffer& buffer = this->mBuffers.at(buffer_index);
+  if (isShared(buffer.mFrame))
+  {
+    // every free buffer is still referenced by a consumer; leave the memory to them
+    buffer.mFrame.release();
+    this->mDetachedCount.fetch_add(1);
+  }
+
+  // reuses the memory of the buffer if the frame has the same size and type as the last one written into it
+  frame.copyTo(buffer.mFrame);
+  buffer.mFrameNumber = this->mPublishedCount.load() + 1;
+  this->mBuffers.makeNewest(buffer_index);
+  this->mPublishedCount.fetch_add(1);
+
+  return buffer.mFrameNumber;
+}
+
+cv::Mat cedar::dev::sensors::visual::FramePool::getNewest(unsigned long long* pFrameNumber) const
+{
+  cv::Mat frame;
+  unsigned long long frame_number = 0;
+  this->mBuffers.readNewest
+  (
+    [&frame, &frame_number](const Buffer& buffer)
+    {
+      // the shallow copy keeps the writer from reusing the memory once the buffer is unpinned
+      frame = buffer.mFrame;
+      frame_number = buffer.mFrameNumber;
+    }
+  );
+
+  if (pFrameNumber != nullptr)
+  {
+    *pFrameNumber = frame_number;
+  }
+  return frame;
+}
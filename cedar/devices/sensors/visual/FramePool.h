@@ -0,0 +1,152 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        FramePool.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Header file for the class cedar::dev::sensors::visual::FramePool.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+#ifndef CEDAR_DEV_SENSORS_VISUAL_FRAME_POOL_H
+#define CEDAR_DEV_SENSORS_VISUAL_FRAME_POOL_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/devices/sensors/visual/namespace.h"
+#include "cedar/auxiliaries/NewestSlotPool.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/core/core.hpp>
+#include <atomic>
+
+
+/*!@brief A pool of frame buffers through which a capture thread hands the newest frame of a channel to its consumers.
+ *
+ *        The buffers are kept in a cedar::aux::NewestSlotPool. The writer copies each frame into a buffer that is
+ *        neither the newest one nor referenced by anybody else and then makes it the newest one. Consumers get shallow
+ *        copies of the newest buffer; as long as they hold on to such a copy, the writer does not touch its memory. If
+ *        all free buffers are referenced by consumers, the writer detaches one of them, i.e., it leaves the old memory
+ *        to its consumers and allocates new memory for the frame.
+ *
+ *        Consumers never wait for the writer. Buffers are only pinned while a consumer copies the header of the newest
+ *        one, so the writer can only find no free buffer at all while several consumers are doing so at the same time;
+ *        it then yields until one of them is done (see publish).
+ *
+ *        There must only be one writer at a time.
+ */
+class cedar::dev::sensors::visual::FramePool
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! A buffer of the pool.
+  struct Buffer
+  {
+    Buffer()
+    :
+    mFrameNumber(0)
+    {
+    }
+
+    cv::Mat mFrame;
+    unsigned long long mFrameNumber;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  FramePool(unsigned int numberOfBuffers = 4);
+
+  //!@brief Destructor
+  ~FramePool();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Copies the frame into a free buffer and makes it the newest frame. Never takes a lock.
+   *
+   *        If consumers are copying the headers of all buffers but the newest one right now, this yields until one of
+   *        them is done, which only takes a moment.
+   *
+   * @returns The number of the published frame, counting from one.
+   */
+  unsigned long long publish(const cv::Mat& frame);
+
+  /*!@brief Returns a shallow copy of the newest frame. Never blocks.
+   *
+   *        The memory of the returned matrix is not overwritten by later frames. The matrix is empty if no frame has
+   *        been published since the pool was created or cleared.
+   *
+   * @param pFrameNumber If given, receives the number of the returned frame (zero for an empty matrix).
+   */
+  cv::Mat getNewest(unsigned long long* pFrameNumber = nullptr) const;
+
+  //! Forgets the newest frame; until the next call of publish, getNewest returns an empty matrix.
+  void clear();
+
+  //! Returns the number of frames that have been published.
+  unsigned long long getPublishedCount() const;
+
+  //! Returns how often all buffers were in use, so that publish had to allocate new memory.
+  unsigned long long getDetachedCount() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! True if somebody besides the pool holds a reference to the memory of the matrix.
+  static bool isShared(const cv::Mat& matrix);
+
+  //! Returns a free buffer, preferring ones whose memory no consumer references; -1 if no buffer is free right now.
+  int findBuffer() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! The buffers of the pool.
+  cedar::aux::NewestSlotPool<Buffer> mBuffers;
+
+  //! Number of frames that have been published.
+  std::atomic<unsigned long long> mPublishedCount;
+
+  //! Number of times a buffer had to be detached.
+  std::atomic<unsigned long long> mDetachedCount;
+
+}; // class cedar::dev::sensors::visual::FramePool
+
+#endif // CEDAR_DEV_SENSORS_VISUAL_FRAME_POOL_H
@@ -141,6 +141,12 @@ void cedar::dev::sensors::visual::GLGrabber::onCleanUp()
 }
 
 
+bool cedar::dev::sensors::visual::GLGrabber::canGrabChannelsConcurrently() const
+{
+  return false;
+}
+
+
 std::string cedar::dev::sensors::visual::GLGrabber::onGetSourceInfo(unsigned int channel)
 {
   // value of channel is already checked by GraberInterface::getSourceInfo()
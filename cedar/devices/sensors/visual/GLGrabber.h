@@ -129,6 +129,9 @@ protected:
   void onCloseGrabber();
   std::string onGetSourceInfo(unsigned int channel);
 
+  //! The widgets can only be grabbed from the thread that paints them, so the channels aren't grabbed concurrently.
+  bool canGrabChannelsConcurrently() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -43,6 +43,9 @@
 #include "cedar/auxiliaries/sleepFunctions.h"
 
 // SYSTEM INCLUDES
+#include <QThread>
+#include <QWaitCondition>
+#include <QMutexLocker>
 #include <signal.h>
 #include <exception>
 #include <sstream>
@@ -73,6 +76,241 @@ namespace
 }
 
 
+//----------------------------------------------------------------------------------------------------------------------
+// capture and encoder threads
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace cedar
+{
+  namespace dev
+  {
+    namespace sensors
+    {
+      namespace visual
+      {
+        namespace GrabberScope
+        {
+          //! Grabs one channel of a grabber whenever it is asked to and publishes the frame.
+          class CaptureThread : public QThread
+          {
+          public:
+            CaptureThread(cedar::dev::sensors::visual::Grabber* pGrabber, unsigned int channel)
+            :
+            mpGrabber(pGrabber),
+            mChannel(channel),
+            mRequested(false),
+            mFinished(true),
+            mQuit(false),
+            mFailed(false)
+            {
+            }
+
+            //! Starts grabbing a frame.
+            void requestFrame()
+            {
+              QMutexLocker locker(&this->mMutex);
+              this->mRequested = true;
+              this->mFinished = false;
+              this->mWakeUp.wakeOne();
+            }
+
+            //! Waits until the requested frame is grabbed. Returns false and the reason if grabbing failed.
+            bool waitForFrame(std::string& error)
+            {
+              QMutexLocker locker(&this->mMutex);
+              while (!this->mFinished)
+              {
+                this->mFrameDone.wait(&this->mMutex);
+              }
+              error = this->mError;
+              return !this->mFailed;
+            }
+
+            //! Lets the thread end and waits for it.
+            void finish()
+            {
+              {
+                QMutexLocker locker(&this->mMutex);
+                this->mQuit = true;
+                this->mWakeUp.wakeOne();
+              }
+              this->wait();
+            }
+
+          protected:
+            void run()
+            {
+              while (true)
+              {
+                {
+                  QMutexLocker locker(&this->mMutex);
+                  while (!this->mRequested && !this->mQuit)
+                  {
+                    this->mWakeUp.wait(&this->mMutex);
+                  }
+                  if (this->mQuit)
+                  {
+                    return;
+                  }
+                  this->mRequested = false;
+                }
+
+                bool failed = false;
+                std::string error;
+                try
+                {
+                  this->mpGrabber->onGrab(this->mChannel);
+                  this->mpGrabber->publishFrame(this->mChannel);
+                }
+                catch (cedar::dev::sensors::visual::GrabberGrabException&)
+                {
+                  error = "Channel " + cedar::aux::toString(this->mChannel) + ": cvCapture.read() error!";
+                  failed = true;
+                }
+                catch (std::exception& e)
+                {
+                  error = e.what();
+                  failed = true;
+                }
+
+                QMutexLocker locker(&this->mMutex);
+                this->mFailed = failed;
+                this->mError = error;
+                this->mFinished = true;
+                this->mFrameDone.wakeAll();
+              }
+            }
+
+          private:
+            cedar::dev::sensors::visual::Grabber* mpGrabber;
+            unsigned int mChannel;
+
+            QMutex mMutex;
+            QWaitCondition mWakeUp;
+            QWaitCondition mFrameDone;
+            bool mRequested;
+            bool mFinished;
+            bool mQuit;
+            bool mFailed;
+            std::string mError;
+          };
+
+          //! Writes the frames of all channels to the video writers of a grabber, in a bounded queue.
+          class EncoderThread : public QThread
+          {
+          public:
+            EncoderThread(cedar::dev::sensors::visual::Grabber* pGrabber, unsigned int queueLength)
+            :
+            mpGrabber(pGrabber),
+            mQueue(queueLength),
+            mHead(0),
+            mSize(0),
+            mQuit(false),
+            mFailed(false)
+            {
+            }
+
+            /*! Adds the frames of all channels to the queue. Never waits for the encoder: if the queue is full, the
+             *  frames are dropped and false is returned.
+             */
+            bool enqueue(const std::vector<cv::Mat>& frames)
+            {
+              QMutexLocker locker(&this->mMutex);
+              if (this->mSize == this->mQueue.size())
+              {
+                this->mpGrabber->mDroppedRecordingFrames.fetch_add(1);
+                return false;
+              }
+
+              // assigning to the existing vector reuses its memory; the frames themselves are not copied
+              this->mQueue[(this->mHead + this->mSize) % this->mQueue.size()] = frames;
+              ++this->mSize;
+              this->mFramesQueued.wakeOne();
+              return true;
+            }
+
+            //! Returns true and the reason if writing a frame failed.
+            bool hasFailed(std::string& error)
+            {
+              QMutexLocker locker(&this->mMutex);
+              error = this->mError;
+              return this->mFailed;
+            }
+
+            //! Writes the remaining frames, then lets the thread end and waits for it.
+            void finish()
+            {
+              {
+                QMutexLocker locker(&this->mMutex);
+                this->mQuit = true;
+                this->mFramesQueued.wakeOne();
+              }
+              this->wait();
+            }
+
+          protected:
+            void run()
+            {
+              std::vector<cv::Mat> frames;
+              while (true)
+              {
+                {
+                  QMutexLocker locker(&this->mMutex);
+                  while (this->mSize == 0 && !this->mQuit)
+                  {
+                    this->mFramesQueued.wait(&this->mMutex);
+                  }
+                  if (this->mSize == 0 || this->mFailed)
+                  {
+                    return;
+                  }
+                  frames.swap(this->mQueue[this->mHead]);
+                  this->mHead = (this->mHead + 1) % this->mQueue.size();
+                  --this->mSize;
+                }
+
+                try
+                {
+                  for (unsigned int channel = 0; channel < frames.size(); ++channel)
+                  {
+                    this->mpGrabber->getGrabberChannel(channel)->mVideoWriter << frames.at(channel);
+                  }
+                  this->mpGrabber->mRecordedFrames.fetch_add(1);
+                }
+                catch (std::exception& e)
+                {
+                  QMutexLocker locker(&this->mMutex);
+                  this->mError = e.what();
+                  this->mFailed = true;
+                }
+
+                // let go of the frames so that the grabber can reuse their memory
+                for (auto& frame : frames)
+                {
+                  frame.release();
+                }
+              }
+            }
+
+          private:
+            cedar::dev::sensors::visual::Grabber* mpGrabber;
+
+            QMutex mMutex;
+            QWaitCondition mFramesQueued;
+            //! Ring buffer of the queued frames, one vector with a frame per channel for each entry.
+            std::vector<std::vector<cv::Mat> > mQueue;
+            unsigned int mHead;
+            unsigned int mSize;
+            bool mQuit;
+            bool mFailed;
+            std::string mError;
+          };
+        }
+      }
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -118,6 +356,10 @@ cedar::aux::LoopedThread()
 
 cedar::dev::sensors::visual::Grabber::~Grabber()
 {
+  // normally done in doCleanUp already
+  this->stopRecording();
+  this->stopCaptureThreads();
+
   // freeing the readwrite-locks
   if (mpReadWriteLock)
   {
@@ -231,6 +473,8 @@ void cedar::dev::sensors::visual::Grabber::doCleanUp()
     // stop Recording
     stopRecording();
 
+    this->stopCaptureThreads();
+
     // do the cleanup in derived class
     onCleanUp();
 
@@ -262,6 +506,8 @@ void cedar::dev::sensors::visual::Grabber::init
   mCaptureDeviceCreated = false;
   mpLockCaptureDeviceCreated = new QReadWriteLock();
   mpLockIsCreating = new QReadWriteLock();
+  mRecordedFrames = 0;
+  mDroppedRecordingFrames = 0;
 
   // insert this instance to our instance-vector (used for emergency-cleanup)
   mInstances.push_back(this);
@@ -303,6 +549,12 @@ bool cedar::dev::sensors::visual::Grabber::applyParameter()
   {
     this->onCreateGrabber();
     grabber_created = true;
+
+    // make the first frames available
+    for (unsigned int channel = 0; channel < getNumChannels(); ++channel)
+    {
+      this->publishFrame(channel);
+    }
   }
   catch(cedar::dev::sensors::visual::CreateGrabberException& e)
   {
@@ -363,6 +615,8 @@ void cedar::dev::sensors::visual::Grabber::closeGrabber()
     this->stop();
   }
 
+  this->stopCaptureThreads();
+
   // close the grabber-things in the derived class
   this->onCloseGrabber();
 
@@ -372,6 +626,7 @@ void cedar::dev::sensors::visual::Grabber::closeGrabber()
   {
     this->getGrabberChannel(channel)->mChannelInfo="";
     this->getGrabberChannel(channel)->mImageMat = cv::Mat();
+    this->getGrabberChannel(channel)->mFramePool.clear();
   }
 
   cedar::aux::LogSingleton::getInstance()->debugMessage
@@ -492,25 +747,33 @@ void cedar::dev::sensors::visual::Grabber::grab()
   //lock grabber to block recreation due to parameter changes
   mpLockIsCreating->lockForRead();
 
-  // lock channel image matrix
+  // lock channel image matrix; this only blocks changes to the capture buffers, not the readers of getImage()
   mpReadWriteLock->lockForWrite();
   try
   {
     unsigned int num_channels = getNumChannels();
-    for(unsigned int channel = 0; channel < num_channels; ++channel)
+    if (num_channels > 1 && this->canGrabChannelsConcurrently())
     {
-      try
-      {
-        this->onGrab(channel);
-      }
-      catch(cedar::dev::sensors::visual::GrabberGrabException)
+      result = this->grabConcurrently(error_info);
+    }
+    else
+    {
+      for(unsigned int channel = 0; channel < num_channels; ++channel)
       {
-        if (error_info != "")
+        try
+        {
+          this->onGrab(channel);
+          this->publishFrame(channel);
+        }
+        catch(cedar::dev::sensors::visual::GrabberGrabException)
         {
-          error_info = error_info + "\n";
+          if (error_info != "")
+          {
+            error_info = error_info + "\n";
+          }
+          error_info = error_info + "Channel " + cedar::aux::toString(channel) + ": cvCapture.read() error!";
+          result = false;
         }
-        error_info = error_info + "Channel " + cedar::aux::toString(channel) + ": cvCapture.read() error!";
-        result = false;
       }
     }
   }
@@ -553,30 +816,108 @@ void cedar::dev::sensors::visual::Grabber::grab()
     mFpsMeasureStart = boost::posix_time::microsec_clock::local_time();
   }
 
-  // check if recording is on
-  if (mRecording)
+  // check if recording is on; the frames are handed to the encoder, which writes them in its own thread
+  std::string recording_error;
+  bool recording_failed = false;
   {
-    unsigned int num_channels = getNumChannels();
-    for(unsigned int channel = 0; channel < num_channels; ++channel)
+    QMutexLocker locker(&mRecordingLock);
+    if (mRecording && mpEncoder)
     {
-      try
+      std::vector<cv::Mat> frames(getNumChannels());
+      for (unsigned int channel = 0; channel < frames.size(); ++channel)
       {
-        getGrabberChannel(channel)->mVideoWriter << getGrabberChannel(channel)->mImageMat;
+        frames.at(channel) = this->getImage(channel);
       }
-      catch (std::exception& e)
+      mpEncoder->enqueue(frames);
+      recording_failed = mpEncoder->hasFailed(recording_error);
+    }
+  }
+
+  if (recording_failed)
+  {
+    std::string info = "[Grabber::grab] Error recording: " + recording_error;
+    cedar::aux::LogSingleton::getInstance()->error
+                                             (
+                                               this->getName() + ": " + info,
+                                               "cedar::dev::sensors::visual::Grabber::grab()"
+                                             );
+    this->stopRecording();
+    this->closeGrabber();
+    CEDAR_THROW(cedar::dev::sensors::visual::GrabberRecordingException, info);
+  }
+}
+
+bool cedar::dev::sensors::visual::Grabber::grabConcurrently(std::string& errorInfo)
+{
+  unsigned int num_channels = getNumChannels();
+  if (mCaptureThreads.size() != num_channels)
+  {
+    this->stopCaptureThreads();
+    for (unsigned int channel = 0; channel < num_channels; ++channel)
+    {
+      mCaptureThreads.push_back
+      (
+        std::unique_ptr<cedar::dev::sensors::visual::GrabberScope::CaptureThread>
+        (
+          new cedar::dev::sensors::visual::GrabberScope::CaptureThread(this, channel)
+        )
+      );
+      mCaptureThreads.back()->start();
+    }
+  }
+
+  for (auto& capture_thread : mCaptureThreads)
+  {
+    capture_thread->requestFrame();
+  }
+
+  bool result = true;
+  for (auto& capture_thread : mCaptureThreads)
+  {
+    std::string error;
+    if (!capture_thread->waitForFrame(error))
+    {
+      if (errorInfo != "")
       {
-        std::stringstream info;
-        info << "[Grabber::grab] Error recording channel" << channel << ": " << e.what();
-        cedar::aux::LogSingleton::getInstance()->error
-                                                 (
-                                                   this->getName() + ": info ",
-                                                   "cedar::dev::sensors::visual::Grabber::grab()"
-                                                 );
-        this->closeGrabber();
-        CEDAR_THROW(cedar::dev::sensors::visual::GrabberRecordingException,info.str());
+        errorInfo = errorInfo + "\n";
       }
+      errorInfo = errorInfo + error;
+      result = false;
     }
   }
+  return result;
+}
+
+void cedar::dev::sensors::visual::Grabber::stopCaptureThreads()
+{
+  for (auto& capture_thread : mCaptureThreads)
+  {
+    capture_thread->finish();
+  }
+  mCaptureThreads.clear();
+}
+
+bool cedar::dev::sensors::visual::Grabber::canGrabChannelsConcurrently() const
+{
+  return true;
+}
+
+void cedar::dev::sensors::visual::Grabber::publishFrame(unsigned int channel)
+{
+  if (channel >= getNumChannels())
+  {
+    CEDAR_THROW(cedar::aux::IndexOutOfRangeException,buildChannelErrorMessage(channel));
+  }
+
+  GrabberChannelPtr p_channel = getGrabberChannel(channel);
+  if (p_channel->mImageMat.empty())
+  {
+    p_channel->mFramePool.clear();
+  }
+  else
+  {
+    p_channel->mFramePool.publish(p_channel->mImageMat);
+  }
 }
 
 cv::Mat cedar::dev::sensors::visual::Grabber::getImage(unsigned int channel) const
@@ -585,7 +926,18 @@ cv::Mat cedar::dev::sensors::visual::Grabber::getImage(unsigned int channel) con
   {
     CEDAR_THROW(cedar::aux::IndexOutOfRangeException,buildChannelErrorMessage(channel));
   }
-  return getGrabberChannel(channel)->mImageMat;
+  return getGrabberChannel(channel)->mFramePool.getNewest();
+}
+
+unsigned long long cedar::dev::sensors::visual::Grabber::getFrameNumber(unsigned int channel) const
+{
+  if (channel >= getNumChannels())
+  {
+    CEDAR_THROW(cedar::aux::IndexOutOfRangeException,buildChannelErrorMessage(channel));
+  }
+  unsigned long long frame_number = 0;
+  getGrabberChannel(channel)->mFramePool.getNewest(&frame_number);
+  return frame_number;
 }
 
 QReadWriteLock* cedar::dev::sensors::visual::Grabber::getReadWriteLockPointer() const
@@ -686,15 +1038,11 @@ void cedar::dev::sensors::visual::Grabber::saveSnapshot(unsigned int channel) co
     CEDAR_THROW(cedar::aux::IndexOutOfRangeException,buildChannelErrorMessage(channel));
   }
 
-  // copy image to local buffer for slow imwrite-function and for error-checking
-  cv::Mat imgBuffer;
+  // the newest frame isn't overwritten while we hold it, so there is no need to copy it for the slow imwrite-function
+  cv::Mat imgBuffer = this->getImage(channel);
 
-  if (!getGrabberChannel(channel)->mImageMat.empty())
+  if (!imgBuffer.empty())
   {
-    mpReadWriteLock->lockForRead();
-    getGrabberChannel(channel)->mImageMat.copyTo(imgBuffer);
-    mpReadWriteLock->unlock();
-
     try
     {
       cv::imwrite(getGrabberChannel(channel)->_mSnapshotName->getPath(true), imgBuffer);
@@ -730,7 +1078,7 @@ cv::Size cedar::dev::sensors::visual::Grabber::getSize(unsigned int channel) con
   {
     CEDAR_THROW(cedar::aux::IndexOutOfRangeException,buildChannelErrorMessage(channel));
   }
-  return getGrabberChannel(channel)->mImageMat.size();
+  return this->getImage(channel).size();
 }
 
 void cedar::dev::sensors::visual::Grabber::setRecordName(const std::string& recordName)
@@ -824,8 +1172,6 @@ void cedar::dev::sensors::visual::Grabber::startRecording
     return;
   }
 
-  // set the record-flag
-  mRecording = true;
   unsigned int recording_channels = 0;
 
   // write the video-file with the actual grabbing-speed
@@ -841,7 +1187,7 @@ void cedar::dev::sensors::visual::Grabber::startRecording
                       record_name,
                       static_cast<unsigned int>(recFormat),
                       fps,
-                      getGrabberChannel(channel)->mImageMat.size(),
+                      this->getImage(channel).size(),
                       color
                     );
 
@@ -861,6 +1207,16 @@ void cedar::dev::sensors::visual::Grabber::startRecording
     }
   }
 
+  // start the encoder and set the record-flag
+  mRecordedFrames = 0;
+  mDroppedRecordingFrames = 0;
+  {
+    QMutexLocker locker(&mRecordingLock);
+    mpEncoder.reset(new cedar::dev::sensors::visual::GrabberScope::EncoderThread(this, RECORDING_QUEUE_LENGTH));
+    mpEncoder->start();
+    mRecording = true;
+  }
+
   if (recording_channels != num_channels)
   {
     std::string msg = "Start recording: only " + cedar::aux::toString(recording_channels)
@@ -886,9 +1242,17 @@ void cedar::dev::sensors::visual::Grabber::startRecording
 
 void cedar::dev::sensors::visual::Grabber::stopRecording()
 {
-  if (mRecording)
+  std::unique_ptr<cedar::dev::sensors::visual::GrabberScope::EncoderThread> p_encoder;
+  bool was_recording;
   {
+    QMutexLocker locker(&mRecordingLock);
+    was_recording = mRecording;
     mRecording = false;
+    p_encoder = std::move(mpEncoder);
+  }
+
+  if (was_recording)
+  {
     if (mGrabberThreadStartedOnRecording)
     {
       this->stop();
@@ -900,6 +1264,25 @@ void cedar::dev::sensors::visual::Grabber::stopRecording()
                                                );
     }
 
+    // write the frames still in the queue
+    if (p_encoder)
+    {
+      p_encoder->finish();
+      p_encoder.reset();
+    }
+
+    if (mDroppedRecordingFrames > 0)
+    {
+      cedar::aux::LogSingleton::getInstance()->warning
+                                               (
+                                                 this->getName() + ": Recording dropped "
+                                                   + cedar::aux::toString(mDroppedRecordingFrames.load()) + " of "
+                                                   + cedar::aux::toString(mDroppedRecordingFrames + mRecordedFrames)
+                                                   + " frames because encoding was too slow",
+                                                 "cedar::dev::sensors::visual::Grabber::stopRecording()"
+                                               );
+    }
+
     // delete the videowriter
     unsigned int num_channels = getNumChannels();
     for(unsigned int channel = 0; channel < num_channels; ++channel)
@@ -914,6 +1297,16 @@ bool cedar::dev::sensors::visual::Grabber::isRecording() const
   return mRecording;
 }
 
+unsigned long long cedar::dev::sensors::visual::Grabber::getRecordedFrameCount() const
+{
+  return mRecordedFrames.load();
+}
+
+unsigned long long cedar::dev::sensors::visual::Grabber::getDroppedRecordingFrameCount() const
+{
+  return mDroppedRecordingFrames.load();
+}
+
 void cedar::dev::sensors::visual::Grabber::step(cedar::unit::Time)
 {
   // if something went wrong on grabbing,
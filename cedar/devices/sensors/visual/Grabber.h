@@ -56,9 +56,32 @@
 // SYSTEM INCLUDES
 #include <opencv2/opencv.hpp>
 #include <QReadWriteLock>
+#include <QMutex>
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <string>
 
+//!@cond SKIPPED_DOCUMENTATION
+namespace cedar
+{
+  namespace dev
+  {
+    namespace sensors
+    {
+      namespace visual
+      {
+        namespace GrabberScope
+        {
+          class CaptureThread;
+          class EncoderThread;
+        }
+      }
+    }
+  }
+}
+//!@endcond
+
 /*! @class cedar::dev::sensors::visual::Grabber
  *  @brief This is the base class for all grabber.
  *
@@ -75,7 +98,7 @@
  *     - grabbing: <br>
  *             => grab manually a new image: grab()  <br>
  *             => get the image from the internal buffer: getImage() <br>
- *     - recording: startRecording(), stopRecording()  <br>
+ *     - recording: startRecording(), stopRecording(), getRecordedFrameCount(), getDroppedRecordingFrameCount() <br>
  *     - snapshots: saveSnapshot(), saveSnapshotAllCams(), getSnapshotName()<br>
  *
  *    @remarks For grabber developers <br>
@@ -85,6 +108,11 @@
  *      At the beginning of the destructor, call doCleanUp() and do the cleanup in this function.
  *      To get an example, have a look at the VideoGrabber or the TestGrabber-class. <br><br>
  *
+ *    @remarks Capture pipeline <br>
+ *      If there is more than one channel, every channel is grabbed by its own capture thread, so that the channels
+ *      of a stereo rig are captured at the same time. Each channel hands its frames to the consumers through a
+ *      FramePool, i.e., getImage() never waits for a capture in progress. Recordings are encoded by a separate thread;
+ *      if it cannot keep up with the grabbing, frames are dropped and counted rather than delaying the grabbing.
  *
  */
 class cedar::dev::sensors::visual::Grabber
@@ -92,6 +120,11 @@ class cedar::dev::sensors::visual::Grabber
 virtual public cedar::aux::NamedConfigurable,
 public cedar::aux::LoopedThread
 {
+  //!@cond SKIPPED_DOCUMENTATION
+  friend class cedar::dev::sensors::visual::GrabberScope::CaptureThread;
+  friend class cedar::dev::sensors::visual::GrabberScope::EncoderThread;
+  //!@endcond
+
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
@@ -265,7 +298,8 @@ public:
 
   /*! @brief Get an Image in a cv::Mat structure
 
-   *      With this method you can get the grabbed image.
+   *      With this method you can get the grabbed image. This never waits for the grabbing; the returned matrix is
+   *      the newest frame of the channel and is not overwritten by later frames.
    *  @param channel
    *      This is the index of the source you want the picture from.<br>
    *      In the mono case you do not need to supply this value. Default is 0.<br>
@@ -276,6 +310,14 @@ public:
    */
   cv::Mat getImage(unsigned int channel=0) const;
 
+  /*! @brief Get the number of the newest frame of a channel, i.e., the one returned by getImage()
+   *
+   *      Frames are counted from one since the grabber was created; zero means that there is no frame.
+   *  @param channel The channel
+   *  @throw cedar::aux::IndexOutOfRangeException Thrown, if channel doesn't fit to number of channels
+   */
+  unsigned long long getFrameNumber(unsigned int channel=0) const;
+
 
   /*! @brief Grab a new image (or images in stereo case) from the source (channel, picture, avi...).
    *
@@ -293,7 +335,8 @@ public:
 
   /*! @brief Get a pointer to the QReadWriteLock.
    *
-   *      Used for concurrent reading/writing to the image matrices
+   *      Used for concurrent reading/writing to the image matrices the grabber captures into. getImage() doesn't need
+   *      this lock.
    */
   QReadWriteLock* getReadWriteLockPointer() const;
 
@@ -448,7 +491,9 @@ public:
    *      Always all cameras recording. To set the filename use setRecordName()<br>
    *      By default record.avi is used as filename (in the mono case) <br><br>
    *      The transcoding is entirely done via the opencv-API.<br>
-   *      Look at the OPENCV manual to determine the usable FOURCC's
+   *      Look at the OPENCV manual to determine the usable FOURCC's<br>
+   *      The frames are encoded in a separate thread. If it falls behind by more than RECORDING_QUEUE_LENGTH frames,
+   *      further frames are dropped, see getDroppedRecordingFrameCount()
    *
    *  @throw GrabberRecordingException Thrown, if not all channels could be recorded
    *
@@ -467,6 +512,7 @@ public:
 
   /*! @brief Stop all recordings
    *  @remarks
+   *    The frames still waiting for the encoder are written first.<br>
    *    All VideoWriter structures are released. There is no possibiltiy to append another recording.<br>
    *    If recording will be restarted without changing the recording filenames, the old files will be
    *    overwritten
@@ -476,6 +522,12 @@ public:
   /*! @brief Get the state of the recording-flag */
   bool isRecording() const;
 
+  /*! @brief Get the number of frames written to the files of the current (or last) recording */
+  unsigned long long getRecordedFrameCount() const;
+
+  /*! @brief Get the number of frames the current (or last) recording skipped because the encoder fell behind */
+  unsigned long long getDroppedRecordingFrameCount() const;
+
   /*! @brief Defines the additions to the filename.
    *
    *   This method will be used in a stereo-grabber if you use setSnapshotName("SnapshotFilename")
@@ -568,6 +620,22 @@ protected:
   virtual void onGrab(unsigned int channel) = 0;
 
 
+  /*! @brief Whether onGrab may be invoked for different channels at the same time.
+   *
+   *      If so (the default), every channel is grabbed in its own capture thread. Override this to return false if
+   *      the channels of the derived grabber share state or have to be grabbed from a specific thread.
+   */
+  virtual bool canGrabChannelsConcurrently() const;
+
+  /*! @brief Hands the content of the image buffer of a channel to the consumers, i.e., to getImage().
+   *
+   *      grab() and applyParameter() do this after onGrab() and onCreateGrabber(), respectively. Derived grabbers
+   *      only have to call it when they change the image buffer anywhere else.
+   *  @param channel The channel
+   *  @throw cedar::aux::IndexOutOfRangeException Thrown, if channel doesn't fit to number of channels
+   */
+  void publishFrame(unsigned int channel);
+
   /*! @brief Get the channel informations from the derived grabber-classes
    *
    *    This method is used internally to update the channel info string. It will be called after the onCreate()-method
@@ -579,7 +647,8 @@ protected:
 
   /*!@brief Get the Image buffer
    *
-   *    Before this buffer can be read out or written in, it have to be locked with the mpReadWriteLock() lock!
+   *    This is the buffer the grabber captures into; consumers get copies of it via getImage(). Outside of onGrab(),
+   *    it has to be locked with the mpReadWriteLock() lock before it can be read out or written in!
    *
    *  @param channel This is the index of the source you want to print the properties.
    *  @throw cedar::aux::IndexOutOfRangeException Thrown, if channel doesn't fit to number of channels
@@ -670,12 +739,22 @@ private:
    */
   void processQuit();
 
+  /*! @brief Grabs all channels, each one in its own capture thread.
+   *
+   *  @param errorInfo Receives the errors of all failed channels
+   *  @returns False if any channel failed
+   */
+  bool grabConcurrently(std::string& errorInfo);
+
+  //! @brief Stops the capture threads; they are started again by the next grab()
+  void stopCaptureThreads();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
 protected:
 
-    //! @brief Read/write lock used for concurrent access to the mImageMatVector - matrices
+    //! @brief Read/write lock used for concurrent access to the image matrices the grabber captures into
     QReadWriteLock* mpReadWriteLock;
     
     //! @brief The actual measured fps of grabbing
@@ -726,6 +805,21 @@ private:
     //! @brief Flag, if this is the first instance of a grabber (used for the ctrl-c handler)
     bool mFirstGrabberInstance;
 
+    //! @brief One capture thread per channel; only used if there is more than one channel
+    std::vector<std::unique_ptr<cedar::dev::sensors::visual::GrabberScope::CaptureThread> > mCaptureThreads;
+
+    //! @brief Writes the recorded frames while recording
+    std::unique_ptr<cedar::dev::sensors::visual::GrabberScope::EncoderThread> mpEncoder;
+
+    //! @brief Used for concurrent access to the encoder and the mRecording flag
+    QMutex mRecordingLock;
+
+    //! @brief Number of frames written in the current (or last) recording
+    std::atomic<unsigned long long> mRecordedFrames;
+
+    //! @brief Number of frames dropped in the current (or last) recording
+    std::atomic<unsigned long long> mDroppedRecordingFrames;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -734,6 +828,9 @@ protected:
   //! @brief Constant which defines how often getMeasuredFramerate() will be updated (in frames).
   static const int UPDATE_FPS_MEASURE_FRAME_COUNT = 5;
 
+  //! @brief Constant which defines how many frames may wait for the encoder before further frames are dropped.
+  static const unsigned int RECORDING_QUEUE_LENGTH = 4;
+
   //! @brief A vector which contains for every grabbing-channel one channel structure
   ChannelParameterPtr _mChannels;
 
@@ -42,6 +42,7 @@
 
 // CEDAR INCLUDES
 #include "cedar/devices/sensors/visual/namespace.h"
+#include "cedar/devices/sensors/visual/FramePool.h"
 #include "cedar/auxiliaries/Configurable.h"
 #include "cedar/auxiliaries/FileParameter.h"
 
@@ -102,9 +103,12 @@ private:
   // members
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  //! @brief The picture frame
+  //! @brief The picture frame the grabber captures into
   cv::Mat mImageMat;
 
+  //! @brief The frames handed to the consumers, see Grabber::getImage
+  cedar::dev::sensors::visual::FramePool mFramePool;
+
   //! @brief Needed to to the recordings
   cv::VideoWriter mVideoWriter;
 
@@ -189,6 +189,7 @@ void cedar::dev::sensors::visual::PictureGrabber::fileNameChanged()
     }
     else
     {
+      this->publishFrame(channel);
       setIsCreated(true);
       onGetSourceInfo(channel);
       emit pictureChanged();
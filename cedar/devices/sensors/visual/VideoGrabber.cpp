@@ -279,32 +279,34 @@ void cedar::dev::sensors::visual::VideoGrabber::onCloseGrabber()
 
 void cedar::dev::sensors::visual::VideoGrabber::onGrab(unsigned int channel)
 {
+  cv::VideoCapture& capture = getVideoChannel(channel)->mVideoCapture;
+
+  // all channels end with the shortest file. As the channels are grabbed in lockstep, every channel rewinds itself in
+  // the same grab, so the channels never touch each other's capture and can be grabbed concurrently
+  if (_mLooped->getValue() && capture.get(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES)) >= mFramesCount)
+  {
+    capture.set(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES), 0);
+  }
+
   // read next frame from file for this channel
   cv::Mat frame;
-  getVideoChannel(channel)->mVideoCapture >> frame;
+  capture >> frame;
   // check if the grabbed frame is empty
   if (frame.empty())
   {
     // this is fine, skip frame
-    unsigned int frame_no = getVideoChannel(channel)->mVideoCapture.get(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES));
+    unsigned int frame_no = capture.get(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES));
     // only increase the frame number if we are not already at the last frame
     if (frame_no < mFramesCount-1)
     {
-      getVideoChannel(channel)->mVideoCapture.set(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES), ++frame_no);
+      capture.set(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES), ++frame_no);
       return;
     }
     // end of file. Rewind if looped is on
     if (_mLooped->getValue())
     {
-      // rewind all channels and grab first frame for all channels up to this channel
-      for (unsigned int i = 0; i < this->getNumChannels(); ++i)
-      {
-        getVideoChannel(i)->mVideoCapture.set(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES), 0);
-        if (i <= channel)
-        {
-          getVideoChannel(i)->mVideoCapture >> getImageMat(i);
-        }
-      }
+      capture.set(CEDAR_OPENCV_CONSTANT(CAP_PROP_POS_FRAMES), 0);
+      capture >> getImageMat(channel);
     }
   }
   else
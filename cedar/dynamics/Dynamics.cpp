@@ -42,6 +42,8 @@
 #include "cedar/dynamics/Dynamics.h"
 #include "cedar/processing/StepTime.h"
 #include "cedar/processing/exceptions.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/assert.h"
 
 // SYSTEM INCLUDES
 
@@ -50,7 +52,10 @@
 //----------------------------------------------------------------------------------------------------------------------
 cedar::dyn::Dynamics::Dynamics()
 :
-cedar::proc::Step(true)
+cedar::proc::Step(true),
+mIntegrationStepMeasurementId(0),
+mIntegrationStepSize(0.0 * cedar::unit::seconds),
+mIntegrator(new cedar::dyn::Integrator())
 {
   this->mTimestepMeasurementId = this->registerTimeMeasurement("time step");
 }
@@ -66,10 +71,89 @@ void cedar::dyn::Dynamics::compute(const cedar::proc::Arguments& arguments)
 
     this->setTimeMeasurement(this->mTimestepMeasurementId, step_time.getStepTime());
 
+    if (this->isIntegratorEnabled())
+    {
+      this->mIntegrator->setMethod(this->_mIntegrationMethod->getValue());
+      this->mIntegrator->setTolerance(this->_mIntegrationTolerance->getValue());
+    }
+
     this->eulerStep(step_time.getStepTime());
+
+    if (this->isIntegratorEnabled())
+    {
+      // only the adaptive method takes steps that differ from the time step; the others may not even have used the
+      // integrator (e.g., fast paths for the Euler method)
+      this->mIntegrationStepSize = step_time.getStepTime();
+      if (this->mIntegrator->getMethod() == cedar::dyn::IntegrationMethod::AdaptiveHeun)
+      {
+        this->mIntegrationStepSize
+          = this->mIntegrator->getLastStepSize() * cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds);
+      }
+      this->setTimeMeasurement(this->mIntegrationStepMeasurementId, this->mIntegrationStepSize);
+    }
   }
   catch (const std::bad_cast& e)
   {
     CEDAR_THROW(cedar::proc::InvalidArgumentsException, "Bad arguments passed to dynamics. Expected StepTime.");
   }
 }
+
+void cedar::dyn::Dynamics::enableIntegrator()
+{
+  CEDAR_ASSERT(!this->isIntegratorEnabled());
+
+  this->_mIntegrationMethod = new cedar::aux::EnumParameter
+                              (
+                                this,
+                                "integration method",
+                                cedar::dyn::IntegrationMethod::typePtr(),
+                                cedar::dyn::IntegrationMethod::ExplicitEuler
+                              );
+  this->_mIntegrationTolerance = new cedar::aux::DoubleParameter
+                                 (
+                                   this,
+                                   "integration tolerance",
+                                   1e-3,
+                                   cedar::aux::DoubleParameter::LimitType::positive()
+                                 );
+  this->_mIntegrationTolerance->markAdvanced();
+
+  this->mIntegrationStepMeasurementId = this->registerTimeMeasurement("integration step");
+}
+
+bool cedar::dyn::Dynamics::isIntegratorEnabled() const
+{
+  return static_cast<bool>(this->_mIntegrationMethod);
+}
+
+cedar::dyn::Integrator& cedar::dyn::Dynamics::getIntegrator()
+{
+  return *this->mIntegrator;
+}
+
+cedar::dyn::IntegrationMethod::Id cedar::dyn::Dynamics::getIntegrationMethod() const
+{
+  if (!this->isIntegratorEnabled())
+  {
+    return cedar::dyn::IntegrationMethod::ExplicitEuler;
+  }
+  return this->_mIntegrationMethod->getValue();
+}
+
+void cedar::dyn::Dynamics::setIntegrationMethod(cedar::dyn::IntegrationMethod::Id method)
+{
+  if (!this->isIntegratorEnabled())
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::NotImplementedException,
+      "Step \"" + this->getName() + "\" only supports the explicit Euler method."
+    );
+  }
+  this->_mIntegrationMethod->setValue(method);
+}
+
+cedar::unit::Time cedar::dyn::Dynamics::getIntegrationStepSize() const
+{
+  return this->mIntegrationStepSize;
+}
@@ -43,6 +43,10 @@
 
 // CEDAR INCLUDES
 #include "cedar/processing/Step.h"
+#include "cedar/dynamics/IntegrationMethod.h"
+#include "cedar/dynamics/Integrator.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/EnumParameter.h"
 #include "cedar/units/Time.h"
 
 // FORWARD DECLARATIONS
@@ -70,13 +74,33 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  // none yet
+  //! Returns the method with which this step integrates its equations.
+  cedar::dyn::IntegrationMethod::Id getIntegrationMethod() const;
+
+  /*!@brief Sets the method with which this step integrates its equations.
+   *
+   *        Only steps that call enableIntegrator support methods other than the explicit Euler method.
+   */
+  void setIntegrationMethod(cedar::dyn::IntegrationMethod::Id method);
+
+  //! Returns the mean length of the (sub) steps taken by the integrator during the last time step.
+  cedar::unit::Time getIntegrationStepSize() const;
 
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  // none yet
+  /*!@brief Adds parameters for the integration method and the tolerance of the adaptive method to this step.
+   *
+   *        Steps that integrate their equations with getIntegrator() call this in their constructor.
+   */
+  void enableIntegrator();
+
+  //! Whether the integrator was enabled for this step.
+  bool isIntegratorEnabled() const;
+
+  //! Returns the integrator, set up with the current values of the integration parameters.
+  cedar::dyn::Integrator& getIntegrator();
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
@@ -98,6 +122,28 @@ protected:
 private:
   unsigned int mTimestepMeasurementId;
 
+  //! Id of the time measurement of the length of the steps taken by the integrator.
+  unsigned int mIntegrationStepMeasurementId;
+
+  //! Mean length of the steps taken by the integrator during the last time step.
+  cedar::unit::Time mIntegrationStepSize;
+
+  //! Integrates the equations of steps that enabled it.
+  cedar::dyn::IntegratorPtr mIntegrator;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // parameters
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  //! The integration method; only present when enableIntegrator was called.
+  cedar::aux::EnumParameterPtr _mIntegrationMethod;
+
+  //! Error per time step accepted by the adaptive integration method.
+  cedar::aux::DoubleParameterPtr _mIntegrationTolerance;
+
 }; // class cedar::dyn::Dynamics
 
 #endif // CEDAR_DYN_DYNAMICS_H
@@ -0,0 +1,86 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        IntegrationMethod.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description:
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/IntegrationMethod.h"
+#include "cedar/auxiliaries/EnumBase.h"
+#include "cedar/auxiliaries/EnumType.h"
+
+// SYSTEM INCLUDES
+
+
+//----------------------------------------------------------------------------------------------------------------------
+// Static members
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::EnumType<cedar::dyn::IntegrationMethod> cedar::dyn::IntegrationMethod::mType("cedar::dyn::IntegrationMethod::");
+
+#ifndef CEDAR_COMPILER_MSVC
+const cedar::dyn::IntegrationMethod::Id cedar::dyn::IntegrationMethod::ExplicitEuler;
+const cedar::dyn::IntegrationMethod::Id cedar::dyn::IntegrationMethod::ExponentialEuler;
+const cedar::dyn::IntegrationMethod::Id cedar::dyn::IntegrationMethod::Heun;
+const cedar::dyn::IntegrationMethod::Id cedar::dyn::IntegrationMethod::RungeKutta4;
+const cedar::dyn::IntegrationMethod::Id cedar::dyn::IntegrationMethod::AdaptiveHeun;
+#endif
+
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::IntegrationMethod::construct()
+{
+  using cedar::dyn::IntegrationMethod;
+  mType.type()->def(cedar::aux::Enum(IntegrationMethod::ExplicitEuler, "ExplicitEuler", "explicit Euler"));
+  mType.type()->def(cedar::aux::Enum(IntegrationMethod::ExponentialEuler, "ExponentialEuler", "exponential Euler"));
+  mType.type()->def(cedar::aux::Enum(IntegrationMethod::Heun, "Heun", "Heun (2nd order)"));
+  mType.type()->def(cedar::aux::Enum(IntegrationMethod::RungeKutta4, "RungeKutta4", "Runge-Kutta (4th order)"));
+  mType.type()->def(cedar::aux::Enum(IntegrationMethod::AdaptiveHeun, "AdaptiveHeun", "adaptive Heun"));
+}
+
+const cedar::aux::EnumBase& cedar::dyn::IntegrationMethod::type()
+{
+  return *cedar::dyn::IntegrationMethod::typePtr();
+}
+
+const cedar::dyn::IntegrationMethod::TypePtr& cedar::dyn::IntegrationMethod::typePtr()
+{
+  return cedar::dyn::IntegrationMethod::mType.type();
+}
@@ -0,0 +1,127 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        IntegrationMethod.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Methods with which dynamics steps integrate their equations.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATION_METHOD_H
+#define CEDAR_DYN_INTEGRATION_METHOD_H
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/EnumType.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/IntegrationMethod.fwd.h"
+
+// SYSTEM INCLUDES
+
+
+/*!@brief An enum class for the methods with which cedar::dyn::Dynamics steps integrate their equations.
+ *
+ * @see   cedar::dyn::Integrator
+ */
+class cedar::dyn::IntegrationMethod
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! The type of the enum values.
+  typedef cedar::aux::EnumId Id;
+
+  //! The pointer type of the enum base object.
+  typedef boost::shared_ptr<cedar::aux::EnumBase> TypePtr;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  // none
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Initializes the enum values.
+   */
+  static void construct();
+
+  /*!@brief Returns a reference to the enum base object.
+   */
+  static const cedar::aux::EnumBase& type();
+
+  /*!@brief Returns a pointer to the enum base object.
+   */
+  static const cedar::dyn::IntegrationMethod::TypePtr& typePtr();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! One forward Euler step per time step.
+  static const Id ExplicitEuler = 0;
+
+  //! Integrates the linear decay exactly and holds the rest of the equation constant during the time step.
+  static const Id ExponentialEuler = 1;
+
+  //! Second order method of Heun (explicit trapezoidal rule).
+  static const Id Heun = 2;
+
+  //! Classical fourth order Runge-Kutta method.
+  static const Id RungeKutta4 = 3;
+
+  //! Heun's method with an embedded Euler step for error control; splits time steps until the error is small enough.
+  static const Id AdaptiveHeun = 4;
+
+protected:
+  // none yet
+
+private:
+  //! The enum object.
+  static cedar::aux::EnumType<cedar::dyn::IntegrationMethod> mType;
+
+}; // class cedar::dyn::IntegrationMethod
+
+#endif // CEDAR_DYN_INTEGRATION_METHOD_H
@@ -0,0 +1,315 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Integrator.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description:
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Integrator.h"
+#include "cedar/auxiliaries/assert.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::Integrator::Integrator(cedar::dyn::IntegrationMethod::Id method)
+:
+mMethod(method),
+mTolerance(1e-3),
+mAdaptiveStepSize(0.0),
+mLastStepSize(0.0),
+mLastStepCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::Integrator::setMethod(cedar::dyn::IntegrationMethod::Id method)
+{
+  this->mMethod = method;
+}
+
+cedar::dyn::IntegrationMethod::Id cedar::dyn::Integrator::getMethod() const
+{
+  return this->mMethod;
+}
+
+void cedar::dyn::Integrator::setTolerance(double tolerance)
+{
+  CEDAR_ASSERT(tolerance > 0.0);
+  this->mTolerance = tolerance;
+}
+
+double cedar::dyn::Integrator::getTolerance() const
+{
+  return this->mTolerance;
+}
+
+double cedar::dyn::Integrator::getLastStepSize() const
+{
+  return this->mLastStepSize;
+}
+
+unsigned int cedar::dyn::Integrator::getLastStepCount() const
+{
+  return this->mLastStepCount;
+}
+
+void cedar::dyn::Integrator::computeIncrement
+(
+  const cv::Mat& state,
+  double rate,
+  const ForcingFunction& forcing,
+  double time,
+  cv::Mat& increment
+)
+{
+  this->integrate(state, rate, nullptr, forcing, time, increment);
+}
+
+void cedar::dyn::Integrator::computeIncrement
+(
+  const cv::Mat& state,
+  const cv::Mat& rate,
+  const ForcingFunction& forcing,
+  double time,
+  cv::Mat& increment
+)
+{
+  CEDAR_ASSERT(rate.size == state.size);
+  CEDAR_ASSERT(rate.type() == state.type());
+  this->integrate(state, 0.0, &rate, forcing, time, increment);
+}
+
+void cedar::dyn::Integrator::derivative
+(
+  const cv::Mat& state,
+  double scalarRate,
+  const cv::Mat* rateMatrix,
+  const ForcingFunction& forcing,
+  cv::Mat& derivative
+)
+{
+  derivative.create(state.dims, state.size, state.type());
+  forcing(state, derivative);
+  CEDAR_DEBUG_ASSERT(derivative.size == state.size);
+
+  if (rateMatrix != nullptr)
+  {
+    cv::multiply(*rateMatrix, state, this->mDecay);
+    cv::subtract(derivative, this->mDecay, derivative);
+  }
+  else if (scalarRate != 0.0)
+  {
+    cv::addWeighted(derivative, 1.0, state, -scalarRate, 0.0, derivative);
+  }
+}
+
+void cedar::dyn::Integrator::integrate
+(
+  const cv::Mat& state,
+  double scalarRate,
+  const cv::Mat* rateMatrix,
+  const ForcingFunction& forcing,
+  double time,
+  cv::Mat& increment
+)
+{
+  this->mLastStepSize = time;
+  this->mLastStepCount = 1;
+
+  if (time <= 0.0)
+  {
+    increment = cv::Mat::zeros(state.dims, state.size, state.type());
+    return;
+  }
+
+  cv::Mat& k1 = this->mStageDerivatives[0];
+  cv::Mat& k2 = this->mStageDerivatives[1];
+  cv::Mat& k3 = this->mStageDerivatives[2];
+  cv::Mat& k4 = this->mStageDerivatives[3];
+
+  switch (this->mMethod)
+  {
+    case cedar::dyn::IntegrationMethod::ExplicitEuler:
+      this->derivative(state, scalarRate, rateMatrix, forcing, k1);
+      k1.convertTo(increment, -1, time);
+      break;
+
+    case cedar::dyn::IntegrationMethod::ExponentialEuler:
+      this->derivative(state, scalarRate, rateMatrix, forcing, increment);
+      this->exponentialIncrement(scalarRate, rateMatrix, time, increment);
+      break;
+
+    case cedar::dyn::IntegrationMethod::Heun:
+      this->derivative(state, scalarRate, rateMatrix, forcing, k1);
+      cv::addWeighted(state, 1.0, k1, time, 0.0, this->mStageState);
+      this->derivative(this->mStageState, scalarRate, rateMatrix, forcing, k2);
+      cv::addWeighted(k1, 0.5 * time, k2, 0.5 * time, 0.0, increment);
+      break;
+
+    case cedar::dyn::IntegrationMethod::RungeKutta4:
+      this->derivative(state, scalarRate, rateMatrix, forcing, k1);
+      cv::addWeighted(state, 1.0, k1, 0.5 * time, 0.0, this->mStageState);
+      this->derivative(this->mStageState, scalarRate, rateMatrix, forcing, k2);
+      cv::addWeighted(state, 1.0, k2, 0.5 * time, 0.0, this->mStageState);
+      this->derivative(this->mStageState, scalarRate, rateMatrix, forcing, k3);
+      cv::addWeighted(state, 1.0, k3, time, 0.0, this->mStageState);
+      this->derivative(this->mStageState, scalarRate, rateMatrix, forcing, k4);
+
+      cv::addWeighted(k1, time / 6.0, k4, time / 6.0, 0.0, increment);
+      cv::addWeighted(k2, time / 3.0, increment, 1.0, 0.0, increment);
+      cv::addWeighted(k3, time / 3.0, increment, 1.0, 0.0, increment);
+      break;
+
+    case cedar::dyn::IntegrationMethod::AdaptiveHeun:
+      this->adaptiveIncrement(state, scalarRate, rateMatrix, forcing, time, increment);
+      break;
+
+    default:
+      CEDAR_THROW(cedar::aux::UnhandledValueException, "Unhandled integration method.");
+  }
+}
+
+void cedar::dyn::Integrator::exponentialIncrement
+(
+  double scalarRate,
+  const cv::Mat* rateMatrix,
+  double time,
+  cv::Mat& increment
+)
+{
+  // the solution of du/dt = -r * u + f for constant f is u + (1 - exp(-r * dt)) / r * (f - r * u)
+  if (rateMatrix == nullptr)
+  {
+    double factor = time;
+    if (std::abs(scalarRate * time) > 1e-12)
+    {
+      factor = -std::expm1(-scalarRate * time) / scalarRate;
+    }
+    increment.convertTo(increment, -1, factor);
+    return;
+  }
+
+  cv::Mat& factors = this->mExponentialFactors;
+  rateMatrix->convertTo(factors, -1, -time);
+  cv::exp(factors, factors);
+  cv::subtract(cv::Scalar(1.0), factors, factors);
+  // division by zero yields zero; these elements do not decay and are integrated with the plain time step
+  cv::divide(factors, *rateMatrix, factors);
+  cv::compare(*rateMatrix, cv::Scalar(0.0), this->mZeroRates, cv::CMP_EQ);
+  factors.setTo(cv::Scalar(time), this->mZeroRates);
+
+  cv::multiply(increment, factors, increment);
+}
+
+void cedar::dyn::Integrator::adaptiveIncrement
+(
+  const cv::Mat& state,
+  double scalarRate,
+  const cv::Mat* rateMatrix,
+  const ForcingFunction& forcing,
+  double time,
+  cv::Mat& increment
+)
+{
+  // bounds for the change of the step size from one sub step to the next
+  const double min_factor = 0.2;
+  const double max_factor = 2.0;
+  const double safety = 0.9;
+  // do not split a time step into more than this many sub steps
+  const double min_step = time / 1000.0;
+
+  cv::Mat& k1 = this->mStageDerivatives[0];
+  cv::Mat& k2 = this->mStageDerivatives[1];
+  cv::Mat& y = this->mAdaptiveState;
+  state.copyTo(y);
+
+  double step = this->mAdaptiveStepSize;
+  if (step <= 0.0 || step > time)
+  {
+    step = time;
+  }
+
+  double remaining = time;
+  unsigned int steps = 0;
+  while (remaining > 1e-9 * time)
+  {
+    // the last sub step must end exactly at the end of the time step
+    double h = std::min(step, remaining);
+
+    this->derivative(y, scalarRate, rateMatrix, forcing, k1);
+    cv::addWeighted(y, 1.0, k1, h, 0.0, this->mStageState);
+    this->derivative(this->mStageState, scalarRate, rateMatrix, forcing, k2);
+
+    // difference between the Euler and the Heun step
+    double error = 0.5 * h * cv::norm(k2, k1, cv::NORM_INF);
+
+    double factor = max_factor;
+    if (error > 0.0)
+    {
+      factor = std::min(max_factor, std::max(min_factor, safety * std::sqrt(this->mTolerance / error)));
+    }
+
+    if (error <= this->mTolerance || h <= min_step)
+    {
+      cv::addWeighted(k1, 0.5 * h, k2, 0.5 * h, 0.0, this->mStageState);
+      cv::add(y, this->mStageState, y);
+      remaining -= h;
+      ++steps;
+
+      // only steps that were limited by the error determine the step size of the next call
+      if (h == step)
+      {
+        step = h * factor;
+      }
+    }
+    else
+    {
+      step = std::max(min_step, h * factor);
+    }
+  }
+
+  this->mAdaptiveStepSize = step;
+  this->mLastStepCount = steps;
+  this->mLastStepSize = time / static_cast<double>(steps);
+
+  cv::subtract(y, state, increment);
+}
@@ -0,0 +1,227 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Integrator.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Numerical integration of the equations of dynamics steps.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATOR_H
+#define CEDAR_DYN_INTEGRATOR_H
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/IntegrationMethod.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/Integrator.fwd.h"
+
+// SYSTEM INCLUDES
+#ifndef Q_MOC_RUN
+  #include <boost/function.hpp>
+#endif // Q_MOC_RUN
+#include <opencv2/opencv.hpp>
+
+
+/*!@brief Integrates equations of the form du/dt = -rate * u + forcing(u) over one time step.
+ *
+ *        The rate is either a scalar or a matrix holding one rate per element of the state; it is treated as constant
+ *        during a time step. All other terms of the equation are computed by the forcing function, which is called
+ *        once per stage of the chosen method. Rates and times are given in the same unit, e.g., 1/ms and ms.
+ *
+ *        The integrator does not change the state, it only computes the increment that moves the state over the time
+ *        step. This leaves locking and any noise terms to the caller. All intermediate matrices are kept as members
+ *        and reused as long as the size of the state does not change.
+ *
+ * @see   cedar::dyn::IntegrationMethod
+ */
+class cedar::dyn::Integrator
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Function that writes the forcing term for the given state into its second argument.
+   *
+   *        The output matrix may be reused from an earlier call; functions should write into it rather than assign a
+   *        new matrix to it.
+   */
+  typedef boost::function<void (const cv::Mat& state, cv::Mat& forcing)> ForcingFunction;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  Integrator(cedar::dyn::IntegrationMethod::Id method = cedar::dyn::IntegrationMethod::ExplicitEuler);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Sets the integration method.
+  void setMethod(cedar::dyn::IntegrationMethod::Id method);
+
+  //! Returns the integration method.
+  cedar::dyn::IntegrationMethod::Id getMethod() const;
+
+  /*!@brief Sets the largest error per time step accepted by the adaptive method, in units of the state.
+   */
+  void setTolerance(double tolerance);
+
+  //! Returns the largest error per time step accepted by the adaptive method.
+  double getTolerance() const;
+
+  /*!@brief Computes the increment of the state over the given time for a scalar rate.
+   *
+   * @param state     The state at the beginning of the time step.
+   * @param rate      Rate of the linear decay of the state.
+   * @param forcing   Computes the remaining terms of the equation.
+   * @param time      Length of the time step.
+   * @param increment Output; the state at the end of the time step is state + increment.
+   */
+  void computeIncrement
+  (
+    const cv::Mat& state,
+    double rate,
+    const ForcingFunction& forcing,
+    double time,
+    cv::Mat& increment
+  );
+
+  /*!@brief Computes the increment of the state over the given time for a rate given for each element of the state.
+   *
+   *        The rate matrix must have the same size and type as the state.
+   */
+  void computeIncrement
+  (
+    const cv::Mat& state,
+    const cv::Mat& rate,
+    const ForcingFunction& forcing,
+    double time,
+    cv::Mat& increment
+  );
+
+  /*!@brief Returns the mean length of the steps taken during the last call to computeIncrement.
+   *
+   *        This is the length of the time step for all but the adaptive method.
+   */
+  double getLastStepSize() const;
+
+  //! Returns the number of steps taken during the last call to computeIncrement.
+  unsigned int getLastStepCount() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Computes the increment; exactly one of scalarRate and rateMatrix is used, depending on whether the latter is set.
+  void integrate
+  (
+    const cv::Mat& state,
+    double scalarRate,
+    const cv::Mat* rateMatrix,
+    const ForcingFunction& forcing,
+    double time,
+    cv::Mat& increment
+  );
+
+  //! Writes the right hand side of the equation for the given state into derivative.
+  void derivative
+  (
+    const cv::Mat& state,
+    double scalarRate,
+    const cv::Mat* rateMatrix,
+    const ForcingFunction& forcing,
+    cv::Mat& derivative
+  );
+
+  //! Scales the derivative by the integral of the exponential decay over the time step.
+  void exponentialIncrement(double scalarRate, const cv::Mat* rateMatrix, double time, cv::Mat& increment);
+
+  //! Integrates with Heun's method, splitting the time step until the error estimate is below the tolerance.
+  void adaptiveIncrement
+  (
+    const cv::Mat& state,
+    double scalarRate,
+    const cv::Mat* rateMatrix,
+    const ForcingFunction& forcing,
+    double time,
+    cv::Mat& increment
+  );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! The integration method.
+  cedar::dyn::IntegrationMethod::Id mMethod;
+
+  //! Error accepted per time step by the adaptive method.
+  double mTolerance;
+
+  //! Step length the adaptive method starts with; carried over from the last call.
+  double mAdaptiveStepSize;
+
+  //! Mean step length of the last call.
+  double mLastStepSize;
+
+  //! Number of steps taken in the last call.
+  unsigned int mLastStepCount;
+
+  //! Derivatives of the stages of the current method.
+  cv::Mat mStageDerivatives[4];
+
+  //! State at which the current stage is evaluated.
+  cv::Mat mStageState;
+
+  //! Product of the rate matrix and the state.
+  cv::Mat mDecay;
+
+  //! Factors of the exponential Euler step.
+  cv::Mat mExponentialFactors;
+
+  //! Marks the elements of the rate matrix that are zero.
+  cv::Mat mZeroRates;
+
+  //! State of the adaptive method between its sub steps.
+  cv::Mat mAdaptiveState;
+
+}; // class cedar::dyn::Integrator
+
+#endif // CEDAR_DYN_INTEGRATOR_H
@@ -49,7 +49,7 @@
 #include "cedar/auxiliaries/annotation/DiscreteMetric.h"
 #include "cedar/auxiliaries/annotation/ValueRangeHint.h"
 #include "cedar/auxiliaries/convolution/Convolution.h"
-#include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/convolution/AutoTuning.h"
 #include "cedar/auxiliaries/convolution/OpenCV.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/math/Sigmoid.h"
@@ -66,6 +66,7 @@
 // SYSTEM INCLUDES
 #include <iostream>
 #include <boost/lexical_cast.hpp>
+#include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/units/cmath.hpp>
 #include <boost/signals2/connection.hpp>
@@ -136,6 +137,77 @@ namespace
   bool declared = declare();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// local functions
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  //! Which matrix, if any, the input noise is multiplied with.
+  enum class NoiseModulation
+  {
+    None,
+    Input,
+    Activation
+  };
+
+  /* Performs the Euler step of the field equation in a single sweep over the field: computes du/dt, modulates the noise
+   * (the modulated noise is written back, as it is a buffer of the field) and updates u in place. The modulation is a
+   * template parameter so that the inner loop is free of branches and can be vectorized.
+   */
+  template<NoiseModulation modulation>
+  void integrate_fused
+  (
+    cv::Mat& u,
+    const cv::Mat& lateralInteraction,
+    const cv::Mat& inputSum,
+    cv::Mat& inputNoise,
+    double constantInput,
+    double timeFactor,
+    double noiseFactor
+  )
+  {
+    CEDAR_ASSERT(u.type() == CV_32F);
+    CEDAR_ASSERT(lateralInteraction.type() == CV_32F);
+    CEDAR_ASSERT(inputSum.type() == CV_32F);
+    CEDAR_ASSERT(inputNoise.type() == CV_32F);
+
+    const float constant_input = static_cast<float>(constantInput);
+    const float time_factor = static_cast<float>(timeFactor);
+    const float noise_factor = static_cast<float>(noiseFactor);
+
+    const cv::Mat* arrays[] = {&u, &lateralInteraction, &inputSum, &inputNoise, nullptr};
+    cv::Mat planes[4];
+    cv::NAryMatIterator iterator(arrays, planes);
+    for (size_t p = 0; p < iterator.nplanes; ++p, ++iterator)
+    {
+      float* activation = planes[0].ptr<float>();
+      const float* lateral = planes[1].ptr<float>();
+      const float* input = planes[2].ptr<float>();
+      float* noise = planes[3].ptr<float>();
+
+      for (size_t i = 0; i < iterator.size; ++i)
+      {
+        const float u_i = activation[i];
+        const float d_u = -u_i + constant_input + lateral[i] + input[i];
+
+        float noise_i = noise[i];
+        if (modulation == NoiseModulation::Input)
+        {
+          noise_i *= input[i];
+          noise[i] = noise_i;
+        }
+        else if (modulation == NoiseModulation::Activation)
+        {
+          noise_i *= u_i;
+          noise[i] = noise_i;
+        }
+
+        activation[i] = u_i + time_factor * d_u + noise_factor * noise_i;
+      }
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -151,6 +223,7 @@ mMaximumLocation(new cedar::aux::MatData(cv::Mat::zeros(2, 1, CV_32F))),
 mCurrentDeltaT(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F))),
 mLateralKernelEducational(new cedar::aux::MatData(cv::Mat::zeros(50,50,CV_32F))),
 mIsActive(false),
+mUseReferenceIntegration(false),
 // parameters
 _mOutputActivation(new cedar::aux::BoolParameter(this, "activation as output", false)),
 _mDiscreteMetric(new cedar::aux::BoolParameter(this, "discrete metric (workaround)", false)),
@@ -255,6 +328,8 @@ _mNoiseCorrelationKernelConvolution(new cedar::aux::conv::Convolution())
   this->declareBuffer("current delta time", this->mCurrentDeltaT);
   this->declareBuffer("full lateral kernel", this->mLateralKernelEducational);
 
+  this->enableIntegrator();
+
     _mMultiplicativeNoiseInput->markAdvanced(true);
     _mMultiplicativeNoiseActivation->markAdvanced(true);
 
@@ -571,16 +646,17 @@ void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
     neural_noise = this->_mNoiseCorrelationKernelConvolution->convolve(neural_noise);
 
     //!@todo document why this has to use sqrt(time) for noise
-    sigmoid_u = _mSigmoid->getValue()->compute
-                (
-                  u
-                  + sqrt(time / (1.0 * cedar::unit::second)) * neural_noise
-                );
+    _mSigmoid->getValue()->compute
+    (
+      u
+      + sqrt(time / (1.0 * cedar::unit::second)) * neural_noise,
+      sigmoid_u
+    );
   }
   else
   {
     // calculate output
-    sigmoid_u = _mSigmoid->getValue()->compute(u);
+    _mSigmoid->getValue()->compute(u, sigmoid_u);
   }
 //  //Experimental Part to Update the GUI
   if(_mUpdateStepGui->getValue() && cedar::proc::gui::SettingsSingleton::getInstance()->getUseDynamicFieldIcons() )
@@ -650,7 +726,7 @@ void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
   sigmoid_u_lock.unlock();
 
   QReadLocker sigmoid_u_readlock(&this->mSigmoidalActivation->getLock());
-  lateral_interaction = this->_mLateralKernelConvolution->convolve(sigmoid_u);
+  this->_mLateralKernelConvolution->convolveInto(sigmoid_u, lateral_interaction);
 
   this->updateInputSum();
 
@@ -658,17 +734,62 @@ void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
   CEDAR_ASSERT(u.size == lateral_interaction.size);
   CEDAR_ASSERT(u.size == input_sum.size);
 
-  // the field equation
-  cv::Mat d_u = -u + h + lateral_interaction + global_inhibition * cv::sum(sigmoid_u)[0] + input_sum;
-
-  boost::shared_ptr<QWriteLocker> activation_write_locker;
-  if (this->activationIsOutput())
+  if (this->getIntegrator().getMethod() != cedar::dyn::IntegrationMethod::ExplicitEuler)
   {
-    activation_read_locker->unlock();
-    activation_write_locker = boost::shared_ptr<QWriteLocker>(new QWriteLocker(&this->mActivation->getLock()));
+    // the input sum and the noise are held constant during the time step; the integrator re-evaluates output and
+    // lateral interaction at each of its stages
+    double neural_noise_factor = 0.0;
+    if (mNoiseCorrelationKernel->getAmplitude() != 0.0)
+    {
+      neural_noise_factor = sqrt(time / (1.0 * cedar::unit::second));
+    }
+
+    this->getIntegrator().computeIncrement
+    (
+      u,
+      1.0 / tau,
+      boost::bind(&cedar::dyn::NeuralField::computeForcing, this, _1, _2, neural_noise_factor),
+      time / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds),
+      this->mIncrement
+    );
+
+    boost::shared_ptr<QWriteLocker> activation_write_locker;
+    if (this->activationIsOutput())
+    {
+      activation_read_locker->unlock();
+      activation_write_locker = boost::shared_ptr<QWriteLocker>(new QWriteLocker(&this->mActivation->getLock()));
+    }
+
+    cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+
+    if (_mMultiplicativeNoiseInput->getValue())
+    {
+      cv::multiply(input_noise, input_sum, input_noise);
+    }
+    else if (_mMultiplicativeNoiseActivation->getValue())
+    {
+      cv::multiply(input_noise, u, input_noise);
+    }
+
+    double noise_factor = (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
+                          * _mInputNoiseGain->getValue();
+
+    cv::add(u, this->mIncrement, u);
+    cv::addWeighted(u, 1.0, input_noise, noise_factor, 0.0, u);
   }
+  else if (this->mUseReferenceIntegration)
+  {
+    // the field equation
+    cv::Mat d_u = -u + h + lateral_interaction + global_inhibition * cv::sum(sigmoid_u)[0] + input_sum;
+
+    boost::shared_ptr<QWriteLocker> activation_write_locker;
+    if (this->activationIsOutput())
+    {
+      activation_read_locker->unlock();
+      activation_write_locker = boost::shared_ptr<QWriteLocker>(new QWriteLocker(&this->mActivation->getLock()));
+    }
 
-  cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+    cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
 
     if(_mMultiplicativeNoiseInput->getValue() != 0)
     {
@@ -683,6 +804,51 @@ void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
     u += time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds) * d_u
          + (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
            * _mInputNoiseGain->getValue() * input_noise;
+  }
+  else
+  {
+    // the sum of the output is needed for every element, so it cannot be part of the sweep below
+    double global_input = 0.0;
+    if (global_inhibition != 0.0)
+    {
+      global_input = global_inhibition * cv::sum(sigmoid_u)[0];
+    }
+
+    boost::shared_ptr<QWriteLocker> activation_write_locker;
+    if (this->activationIsOutput())
+    {
+      activation_read_locker->unlock();
+      activation_write_locker = boost::shared_ptr<QWriteLocker>(new QWriteLocker(&this->mActivation->getLock()));
+    }
+
+    cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+
+    double time_factor = time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds);
+    double noise_factor = (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
+                          * _mInputNoiseGain->getValue();
+
+    if (_mMultiplicativeNoiseInput->getValue())
+    {
+      integrate_fused<NoiseModulation::Input>
+      (
+        u, lateral_interaction, input_sum, input_noise, h + global_input, time_factor, noise_factor
+      );
+    }
+    else if (_mMultiplicativeNoiseActivation->getValue())
+    {
+      integrate_fused<NoiseModulation::Activation>
+      (
+        u, lateral_interaction, input_sum, input_noise, h + global_input, time_factor, noise_factor
+      );
+    }
+    else
+    {
+      integrate_fused<NoiseModulation::None>
+      (
+        u, lateral_interaction, input_sum, input_noise, h + global_input, time_factor, noise_factor
+      );
+    }
+  }
 
   mCurrentDeltaT->getData().at<float>(0,0)= time / cedar::unit::seconds;
 }
@@ -692,6 +858,48 @@ void cedar::dyn::NeuralField::updateInputSum()
   cedar::proc::steps::Sum::sumSlot(this->getInputSlot("input"), this->mInputSum->getData(), true);
 }
 
+void cedar::dyn::NeuralField::computeForcing(const cv::Mat& state, cv::Mat& forcing, double neuralNoiseFactor)
+{
+  const cv::Mat* sigmoid_state = &this->mSigmoidalActivation->getData();
+  const cv::Mat* lateral_interaction = &this->mLateralInteraction->getData();
+
+  // at the current activation, output and lateral interaction have already been computed in eulerStep
+  if (state.data != this->mActivation->getData().data)
+  {
+    if (neuralNoiseFactor != 0.0)
+    {
+      cv::addWeighted(state, 1.0, this->mNeuralNoise->getData(), neuralNoiseFactor, 0.0, this->mStageInput);
+      this->_mSigmoid->getValue()->compute(this->mStageInput, this->mStageSigmoid);
+    }
+    else
+    {
+      this->_mSigmoid->getValue()->compute(state, this->mStageSigmoid);
+    }
+    this->_mLateralKernelConvolution->convolveInto(this->mStageSigmoid, this->mStageLateral);
+
+    sigmoid_state = &this->mStageSigmoid;
+    lateral_interaction = &this->mStageLateral;
+  }
+
+  const double tau = this->mTau->getValue();
+  const double global_inhibition = this->mGlobalInhibition->getValue();
+  double constant_input = this->mRestingLevel->getValue();
+  if (global_inhibition != 0.0)
+  {
+    constant_input += global_inhibition * cv::sum(*sigmoid_state)[0];
+  }
+
+  cv::addWeighted
+  (
+    *lateral_interaction,
+    1.0 / tau,
+    this->mInputSum->getData(),
+    1.0 / tau,
+    constant_input / tau,
+    forcing
+  );
+}
+
 bool cedar::dyn::NeuralField::isMatrixCompatibleInput(const cv::Mat& matrix) const
 {
   if (matrix.type() != CV_32F)
@@ -714,8 +922,14 @@ void cedar::dyn::NeuralField::dimensionalityChanged()
 #ifdef CEDAR_USE_FFTW
   if (this->getDimensionality() >= 3)
   {
-    this->_mLateralKernelConvolution->setEngine(cedar::aux::conv::FFTWPtr(new cedar::aux::conv::FFTW()));
-    this->_mNoiseCorrelationKernelConvolution->setEngine(cedar::aux::conv::FFTWPtr(new cedar::aux::conv::FFTW()));
+    this->_mLateralKernelConvolution->setEngine
+    (
+      cedar::aux::conv::AutoTuningPtr(new cedar::aux::conv::AutoTuning())
+    );
+    this->_mNoiseCorrelationKernelConvolution->setEngine
+    (
+      cedar::aux::conv::AutoTuningPtr(new cedar::aux::conv::AutoTuning())
+    );
   }
 #endif // CEDAR_USE_FFTW
   this->updateMatrices();
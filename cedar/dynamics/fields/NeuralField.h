@@ -179,6 +179,23 @@ public:
     return this->mRestingLevel->setValue(restingLevel, true);
   }
 
+  /*!@brief Selects the reference integration of the field equation.
+   *
+   *        By default, the Euler step is computed in a single, fused sweep over the field. The reference integration
+   *        evaluates the field equation with separate matrix operations, exactly as earlier versions did, and thus
+   *        reproduces their results bit by bit. It is slower and meant for regression tests.
+   */
+  inline void setReferenceIntegration(bool useReference)
+  {
+    this->mUseReferenceIntegration = useReference;
+  }
+
+  //! Returns whether the reference integration of the field equation is used.
+  inline bool isReferenceIntegrationEnabled() const
+  {
+    return this->mUseReferenceIntegration;
+  }
+
 public slots:
   //!@brief handle a change in dimensionality, which leads to creating new matrices
   void dimensionalityChanged();
@@ -238,6 +255,15 @@ private:
    */
   void updateInputSum();
 
+  /*!@brief Computes the terms of the field equation other than the decay of the activation, divided by the time scale.
+   *
+   *        Used by integration methods other than the explicit Euler method, which evaluate the equation at
+   *        intermediate states of the time step. The input sum is kept constant during the time step.
+   *
+   * @remarks This method assumes that all data is locked.
+   */
+  void computeForcing(const cv::Mat& state, cv::Mat& forcing, double neuralNoiseFactor);
+
 
 private slots:
   void activationAsOutputChanged();
@@ -281,6 +307,19 @@ private:
   boost::signals2::connection mKernelAddedConnection;
   boost::signals2::connection mKernelRemovedConnection;
   bool mIsActive;
+  bool mUseReferenceIntegration;
+
+  //! Increment of the activation computed by the integrator.
+  cv::Mat mIncrement;
+
+  //! Input of the sigmoid at an intermediate state of the integrator.
+  cv::Mat mStageInput;
+
+  //! Output of the sigmoid at an intermediate state of the integrator.
+  cv::Mat mStageSigmoid;
+
+  //! Lateral interaction at an intermediate state of the integrator.
+  cv::Mat mStageLateral;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
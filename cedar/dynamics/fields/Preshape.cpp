@@ -120,6 +120,8 @@ _mSigmoid
   this->updateMatrices();
 
   this->registerFunction("reset memory", boost::bind(&cedar::dyn::Preshape::resetMemory, this));
+
+  this->enableIntegrator();
 }
 //----------------------------------------------------------------------------------------------------------------------
 // methods
@@ -139,6 +141,30 @@ void cedar::dyn::Preshape::eulerStep(const cedar::unit::Time& time)
     peak = cedar::aux::math::getMatrixEntry<double>(peak_detector->getData(), 0, 0);
   }
 
+  if (this->getIntegrator().getMethod() != cedar::dyn::IntegrationMethod::ExplicitEuler)
+  {
+    // the dynamics are linear in the preshape: d/dt u = -rate * u + forcing with
+    // rate = peak * (s / tau_build_up + (1 - s) / tau_decay) and forcing = peak * s * input / tau_build_up, both of
+    // which are constant during the time step (the exponential Euler method is exact here)
+    sigmoided_input.convertTo(this->mRate, -1, peak * (1.0 / tau_build_up - 1.0 / tau_decay), peak / tau_decay);
+    cv::multiply(sigmoided_input, input_mat, this->mForcing, peak / tau_build_up);
+
+    const cv::Mat& forcing = this->mForcing;
+    this->getIntegrator().computeIncrement
+    (
+      preshape,
+      this->mRate,
+      [&forcing](const cv::Mat&, cv::Mat& result)
+      {
+        forcing.copyTo(result);
+      },
+      time / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds),
+      this->mIncrement
+    );
+    preshape += this->mIncrement;
+    return;
+  }
+
   // one possible preshape dynamic
   preshape +=
   (
@@ -131,7 +131,14 @@ protected:
   cedar::aux::MatDataPtr mActivation;
 
 private:
-  // none yet
+  //! Rate of the decay of each element of the preshape, used by integration methods other than the Euler method.
+  cv::Mat mRate;
+
+  //! Part of the equation that does not depend on the preshape, used by integration methods other than Euler.
+  cv::Mat mForcing;
+
+  //! Increment of the preshape computed by the integrator.
+  cv::Mat mIncrement;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
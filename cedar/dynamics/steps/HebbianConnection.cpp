@@ -44,6 +44,7 @@
 #include "cedar/processing/DataSlot.h"
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/processing/DeclarationRegistry.h"
+#include "cedar/processing/Checkpoint.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/exceptions.h"
 #include "cedar/units/Time.h"
@@ -56,8 +57,6 @@
 // SYSTEM INCLUDES
 #include <iostream>
 #include <vector>
-#include <cstdlib>
-#include <ctime>
 
 
 //Declaration
@@ -225,15 +224,14 @@ cv::Mat cedar::dyn::steps::HebbianConnection::initializeWeightMatrix()
   cv::Mat myWeightMat = cv::Mat::zeros(mWeightSizeX, mWeightSizeY, CV_32F);
   if (!mSetWeights->getValue())
   {
-    srand(static_cast<unsigned>(time(0)));
+    // drawn from the generator of the current thread, so that seeded runs (e.g., trials) are reproducible
     float HIGH = mWeightInitNoiseRange->getValue();
     float LOW = mWeightInitBase->getValue();
     for (unsigned int x = 0; x < mWeightSizeX; x++)
     {
       for (unsigned int y = 0; y < mWeightSizeY; y++)
       {
-        float random = LOW + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (HIGH - LOW)));
-        myWeightMat.at<float>(x, y) = random;
+        myWeightMat.at<float>(x, y) = cv::theRNG().uniform(LOW, HIGH);
       }
     }
   }
@@ -393,6 +391,34 @@ void cedar::dyn::steps::HebbianConnection::reset()
 {
 }
 
+void cedar::dyn::steps::HebbianConnection::writeCheckpoint
+(
+  cedar::proc::Checkpoint& checkpoint,
+  const std::string& path
+) const
+{
+  this->cedar::dyn::Dynamics::writeCheckpoint(checkpoint, path);
+
+  cv::Mat reward_state = (cv::Mat_<int>(1, 2) << (mIsRewarded ? 1 : 0), mElapsedTime);
+  checkpoint.store(path + "/reward state", reward_state);
+}
+
+void cedar::dyn::steps::HebbianConnection::readCheckpoint
+(
+  const cedar::proc::Checkpoint& checkpoint,
+  const std::string& path
+)
+{
+  this->cedar::dyn::Dynamics::readCheckpoint(checkpoint, path);
+
+  cv::Mat reward_state;
+  if (checkpoint.restore(path + "/reward state", reward_state))
+  {
+    mIsRewarded = reward_state.at<int>(0, 0) != 0;
+    mElapsedTime = reward_state.at<int>(0, 1);
+  }
+}
+
 void cedar::dyn::steps::HebbianConnection::resetWeights()
 {
   if(mInputDimension->getValue() + mAssociationDimension->getValue() > 2)
@@ -99,6 +99,12 @@ public:
   void setSize(unsigned int dim, unsigned int size);
   void setWeights(cv::Mat newWeights);
 
+  //! Also stores the progress of the current reward phase.
+  void writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path) const;
+
+  //! Also restores the progress of the reward phase.
+  void readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path);
+
 public slots:
   //!@brief This slot is connected to the valueChanged() event of the gain value parameter.
  void updateAssociationDimension();
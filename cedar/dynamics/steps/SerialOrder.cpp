@@ -51,6 +51,7 @@
 // SYSTEM INCLUDES
 #include <iostream>
 #ifndef Q_MOC_RUN
+  #include <boost/bind.hpp>
   #include <boost/make_shared.hpp>
 #endif
 #include <string>
@@ -238,6 +239,8 @@ _mIsCyclic(new cedar::aux::BoolParameter(this, "cyclic", false))
 
   // connect the parameter's change signal
   QObject::connect(_mNumberOfOrdinalPositions.get(), SIGNAL(valueChanged()), this, SLOT(numberOfOrdinalPositionsChanged()));
+
+  this->enableIntegrator();
 }
 
 void cedar::dyn::SerialOrder::numberOfOrdinalPositionsChanged()
@@ -306,6 +309,50 @@ void cedar::dyn::SerialOrder::eulerStep(const cedar::unit::Time& time)
   CEDAR_ASSERT(mOrdinalNodes.size() == mMemoryNodes.size());
   CEDAR_ASSERT(mOrdinalNodes.size() == mOrdinalNodeOutputs.size());
 
+  if (this->getIntegrator().getMethod() != cedar::dyn::IntegrationMethod::ExplicitEuler)
+  {
+    const unsigned int number_of_nodes = this->mOrdinalNodes.size();
+
+    this->mState.create(2 * number_of_nodes, 1, CV_32F);
+    for (unsigned int i = 0; i < number_of_nodes; ++i)
+    {
+      this->mState.at<float>(i, 0) = this->mOrdinalNodes.at(i)->getData().at<float>(0, 0);
+      this->mState.at<float>(number_of_nodes + i, 0) = this->mMemoryNodes.at(i)->getData().at<float>(0, 0);
+    }
+
+    this->getIntegrator().computeIncrement
+    (
+      this->mState,
+      1.0 / this->_mTau->getValue(),
+      boost::bind(&cedar::dyn::SerialOrder::computeForcing, this, _1, _2),
+      time / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds),
+      this->mIncrement
+    );
+
+    // as in the Euler step, the outputs are those of the activation at the beginning of the time step
+    this->_mSigmoid->getValue()->compute(this->mState, this->mStateOutput);
+    this->mState += this->mIncrement;
+
+    for (unsigned int i = 0; i < number_of_nodes; ++i)
+    {
+      const float d = this->mState.at<float>(i, 0);
+      const float dm = this->mState.at<float>(number_of_nodes + i, 0);
+      const float f_d = this->mStateOutput.at<float>(i, 0);
+      const float f_dm = this->mStateOutput.at<float>(number_of_nodes + i, 0);
+
+      this->mOrdinalNodes.at(i)->getData().at<float>(0, 0) = d;
+      this->mMemoryNodes.at(i)->getData().at<float>(0, 0) = dm;
+      this->mOrdinalNodeOutputs.at(i)->getData() = cv::Mat(1, 1, CV_32F, cv::Scalar(f_d));
+      this->mMemoryNodeOutputs.at(i)->getData() = cv::Mat(1, 1, CV_32F, cv::Scalar(f_dm));
+
+      mOrdinalNodeActivationBuffer->getData().at<float>(i, 0) = d;
+      mOrdinalNodeOutputBuffer->getData().at<float>(i, 0) = f_d;
+      mMemoryNodeActivationBuffer->getData().at<float>(i, 0) = dm;
+      mMemoryNodeOutputBuffer->getData().at<float>(i, 0) = f_dm;
+    }
+    return;
+  }
+
   // to implement the global inhibition between the ordinal and memory nodes, we need to sum up
   // all outputs of the ordinal layer
   cv::Mat sum_of_ordinal_outputs = cv::Mat::zeros(1, 1, CV_32F);
@@ -406,6 +453,68 @@ void cedar::dyn::SerialOrder::eulerStep(const cedar::unit::Time& time)
   }
 }
 
+void cedar::dyn::SerialOrder::computeForcing(const cv::Mat& state, cv::Mat& forcing)
+{
+  // same equations as in eulerStep, without the decay term -d
+  const unsigned int number_of_nodes = this->mOrdinalNodes.size();
+  const double tau = this->_mTau->getValue();
+  const double h = this->_mOrdinalNodeRestingLevel->getValue();
+  const double c0 = this->_mOrdinalNodeSelfExcitationWeight->getValue();
+  const double c1 = this->_mOrdinalNodeGlobalInhibitionWeight->getValue();
+  const double c2 = this->_mMemoryNodeToNextOrdinalNodeWeight->getValue();
+  const double c3 = this->_mMemoryNodeToSameOrdinalNodeWeight->getValue();
+  const double hm = this->_mMemoryNodeRestingLevel->getValue();
+  const double c4 = this->_mMemoryNodeSelfExcitationWeight->getValue();
+  const double c5 = this->_mMemoryNodeGlobalInhibitionWeight->getValue();
+  const double c6 = this->_mOrdinalNodeToSameMemoryNodeWeight->getValue();
+  const double c7 = this->_mOrdinalNodeToPreviousMemoryNodeWeight->getValue();
+  const bool is_cyclic = this->_mIsCyclic->getValue();
+
+  double cos_signal = 0.0;
+  if (this->mCosSignalInput)
+  {
+    cos_signal = this->mCosSignalInput->getData().at<float>(0, 0);
+  }
+
+  this->_mSigmoid->getValue()->compute(state, this->mStateOutput);
+  const cv::Mat& output = this->mStateOutput;
+
+  double sum_of_ordinal_outputs = 0.0;
+  for (unsigned int i = 0; i < number_of_nodes; ++i)
+  {
+    sum_of_ordinal_outputs += output.at<float>(i, 0);
+  }
+
+  for (unsigned int i = 0; i < number_of_nodes; ++i)
+  {
+    const double f_d = output.at<float>(i, 0);
+    const double f_dm = output.at<float>(number_of_nodes + i, 0);
+
+    double d_dot = h + c0 * f_d + c1 * (sum_of_ordinal_outputs - f_d) + c3 * f_dm - cos_signal;
+    if (i > 0)
+    {
+      d_dot += c2 * output.at<float>(number_of_nodes + i - 1, 0);
+    }
+    else if (is_cyclic)
+    {
+      d_dot += c2 * output.at<float>(2 * number_of_nodes - 1, 0);
+    }
+    else
+    {
+      d_dot += c2;
+    }
+
+    double dm_dot = hm + c4 * f_dm + c5 * (sum_of_ordinal_outputs - f_dm) + c6 * f_d;
+    if (is_cyclic)
+    {
+      dm_dot += c7 * output.at<float>((i + 1) % number_of_nodes, 0);
+    }
+
+    forcing.at<float>(i, 0) = static_cast<float>(d_dot / tau);
+    forcing.at<float>(number_of_nodes + i, 0) = static_cast<float>(dm_dot / tau);
+  }
+}
+
 void cedar::dyn::SerialOrder::reset()
 {
   for (unsigned int i = 0; i < mOrdinalNodes.size(); ++i)
@@ -112,6 +112,13 @@ private:
   //!@brief Resets the step.
   void reset();
 
+  /*!@brief Computes the terms of the node equations other than the decay of the activation, divided by the time scale.
+   *
+   *        The state holds the activation of all ordinal nodes followed by that of all memory nodes. Used by
+   *        integration methods other than the explicit Euler method.
+   */
+  void computeForcing(const cv::Mat& state, cv::Mat& forcing);
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -141,6 +148,13 @@ private:
   //!@brief buffer for the output of all memory nodes
   cedar::aux::MatDataPtr mMemoryNodeOutputBuffer;
 
+  //! Activation of all ordinal nodes followed by that of all memory nodes, as integrated by the integrator.
+  cv::Mat mState;
+  //! Output of the nodes in mState.
+  cv::Mat mStateOutput;
+  //! Increment of mState computed by the integrator.
+  cv::Mat mIncrement;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
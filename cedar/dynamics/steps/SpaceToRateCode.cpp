@@ -118,6 +118,8 @@ mMakeCyclic(new cedar::aux::BoolParameter(this, "use cyclic mean", false))
   // connect the parameter's change signal
   QObject::connect(_mLowerLimit.get(), SIGNAL(valueChanged()), this, SLOT(limitsChanged()));
   QObject::connect(_mUpperLimit.get(), SIGNAL(valueChanged()), this, SLOT(limitsChanged()));
+
+  this->enableIntegrator();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -253,6 +255,27 @@ void cedar::dyn::SpaceToRateCode::eulerStep(const cedar::unit::Time& time)
   //!@todo use the time unit throughout the computation
   double tau = this->getTau() / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second);
 
+  if (this->getIntegrator().getMethod() != cedar::dyn::IntegrationMethod::ExplicitEuler)
+  {
+    // d/dt x = -s / tau * x + o / tau; the exponential Euler method solves this exactly
+    const double forcing_value = o / tau;
+    this->getIntegrator().computeIncrement
+    (
+      this->mOutput->getData(),
+      s / tau,
+      [forcing_value](const cv::Mat&, cv::Mat& forcing)
+      {
+        forcing.setTo(cv::Scalar(forcing_value));
+      },
+      dt,
+      this->mIncrement
+    );
+    this->mOutput->getData() += this->mIncrement;
+
+    this->mFixPoint->getData().at<float>(0,0) = o / s;
+    return;
+  }
+
   // the result is simply input * gain; see explanation above for variable names
   double h = dt;
   if (h / tau * s >= 2) // stability criterion
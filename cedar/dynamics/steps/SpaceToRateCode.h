@@ -147,6 +147,9 @@ protected:
 private:
   cv::Mat mRamp;
 
+  //! Increment of the output computed by the integrator.
+  cv::Mat mIncrement;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
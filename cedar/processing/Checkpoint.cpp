@@ -0,0 +1,373 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Checkpoint.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description:
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/Checkpoint.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// SYSTEM INCLUDES
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+
+//----------------------------------------------------------------------------------------------------------------------
+// private helpers
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  // identifies checkpoint files and the version of their format
+  const char CHECKPOINT_MAGIC[8] = {'C', 'E', 'D', 'A', 'R', 'C', 'K', '1'};
+
+  // matrix data is aligned to this many bytes within the checkpoint
+  const size_t CHECKPOINT_ALIGNMENT = 16;
+
+  size_t aligned_offset(size_t offset)
+  {
+    return (offset + CHECKPOINT_ALIGNMENT - 1) / CHECKPOINT_ALIGNMENT * CHECKPOINT_ALIGNMENT;
+  }
+
+  template <typename T>
+  void write_value(std::ostream& stream, const T& value)
+  {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  T read_value(std::istream& stream)
+  {
+    T value;
+    if (!stream.read(reinterpret_cast<char*>(&value), sizeof(T)))
+    {
+      CEDAR_THROW(cedar::aux::ParseException, "Unexpected end of checkpoint data.");
+    }
+    return value;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::proc::Checkpoint::Checkpoint()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+cv::Mat cedar::proc::Checkpoint::getStoredMatrix(const Entry& entry) const
+{
+  if (entry.sizes.empty())
+  {
+    return cv::Mat();
+  }
+
+  // the header does not write to the data; it is only used as the source or target of copies
+  unsigned char* data = const_cast<unsigned char*>(this->mData.data()) + entry.offset;
+  return cv::Mat(static_cast<int>(entry.sizes.size()), entry.sizes.data(), entry.type, data);
+}
+
+void cedar::proc::Checkpoint::store(const std::string& key, const cv::Mat& matrix)
+{
+  std::vector<int> sizes;
+  if (!matrix.empty())
+  {
+    sizes.assign(matrix.size.p, matrix.size.p + matrix.dims);
+  }
+  size_t bytes = matrix.total() * matrix.elemSize();
+
+  auto iter = this->mEntries.find(key);
+  if (iter == this->mEntries.end() || iter->second.bytes != bytes)
+  {
+    if (iter != this->mEntries.end())
+    {
+      // the old memory of the entry cannot be reused; give it back before appending the new one
+      this->mEntries.erase(iter);
+      this->compact();
+    }
+
+    // append the data at the end of the memory block
+    size_t offset = aligned_offset(this->mData.size());
+    this->mData.resize(offset + bytes);
+
+    Entry& entry = this->mEntries[key];
+    entry.offset = offset;
+    entry.bytes = bytes;
+  }
+
+  Entry& entry = this->mEntries[key];
+  entry.type = matrix.type();
+  entry.sizes = sizes;
+
+  if (bytes == 0)
+  {
+    return;
+  }
+
+  if (matrix.isContinuous())
+  {
+    std::memcpy(this->mData.data() + entry.offset, matrix.data, bytes);
+  }
+  else
+  {
+    cv::Mat stored = this->getStoredMatrix(entry);
+    matrix.copyTo(stored);
+  }
+}
+
+bool cedar::proc::Checkpoint::restore(const std::string& key, cv::Mat& matrix) const
+{
+  auto iter = this->mEntries.find(key);
+  if (iter == this->mEntries.end())
+  {
+    return false;
+  }
+
+  const Entry& entry = iter->second;
+  checkEntry(key, entry, this->mData.size());
+  if (entry.sizes.empty())
+  {
+    matrix = cv::Mat();
+    return true;
+  }
+
+  // allocates only if size or type differ
+  matrix.create(static_cast<int>(entry.sizes.size()), entry.sizes.data(), entry.type);
+
+  if (matrix.isContinuous())
+  {
+    std::memcpy(matrix.data, this->mData.data() + entry.offset, entry.bytes);
+  }
+  else
+  {
+    this->getStoredMatrix(entry).copyTo(matrix);
+  }
+  return true;
+}
+
+void cedar::proc::Checkpoint::checkEntry(const std::string& key, const Entry& entry, size_t dataSize)
+{
+  if (entry.sizes.empty())
+  {
+    if (entry.bytes != 0)
+    {
+      CEDAR_THROW(cedar::aux::ParseException, "Empty checkpoint entry \"" + key + "\" has data.");
+    }
+    return;
+  }
+
+  if
+  (
+    CV_MAT_DEPTH(entry.type) > CV_64F
+    || (entry.type & ~CV_MAT_TYPE_MASK) != 0
+    || entry.sizes.size() < 2
+    || entry.sizes.size() > CV_MAX_DIM
+  )
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "Checkpoint entry \"" + key + "\" has an invalid type or dimensionality.");
+  }
+
+  // the expected number of bytes; checked for overflow along the way
+  size_t bytes = CV_ELEM_SIZE(entry.type);
+  for (int size : entry.sizes)
+  {
+    if (size <= 0 || bytes > std::numeric_limits<size_t>::max() / static_cast<size_t>(size))
+    {
+      CEDAR_THROW(cedar::aux::ParseException, "Checkpoint entry \"" + key + "\" has invalid sizes.");
+    }
+    bytes *= static_cast<size_t>(size);
+  }
+
+  if (entry.bytes != bytes)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::ParseException,
+      "Checkpoint entry \"" + key + "\" has " + cedar::aux::toString(entry.bytes) + " bytes of data instead of "
+        + cedar::aux::toString(bytes) + "."
+    );
+  }
+
+  if (entry.bytes > dataSize || entry.offset > dataSize - entry.bytes)
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "Checkpoint entry \"" + key + "\" exceeds the data.");
+  }
+}
+
+void cedar::proc::Checkpoint::compact()
+{
+  std::vector<unsigned char> data;
+  data.reserve(this->mData.size());
+  for (auto& key_entry_pair : this->mEntries)
+  {
+    Entry& entry = key_entry_pair.second;
+    size_t offset = aligned_offset(data.size());
+    data.resize(offset + entry.bytes);
+    if (entry.bytes > 0)
+    {
+      std::memcpy(data.data() + offset, this->mData.data() + entry.offset, entry.bytes);
+    }
+    entry.offset = offset;
+  }
+  this->mData.swap(data);
+}
+
+bool cedar::proc::Checkpoint::contains(const std::string& key) const
+{
+  return this->mEntries.find(key) != this->mEntries.end();
+}
+
+std::vector<std::string> cedar::proc::Checkpoint::listKeys() const
+{
+  std::vector<std::string> keys;
+  keys.reserve(this->mEntries.size());
+  for (const auto& key_entry_pair : this->mEntries)
+  {
+    keys.push_back(key_entry_pair.first);
+  }
+  return keys;
+}
+
+size_t cedar::proc::Checkpoint::getNumberOfEntries() const
+{
+  return this->mEntries.size();
+}
+
+size_t cedar::proc::Checkpoint::getDataSize() const
+{
+  return this->mData.size();
+}
+
+void cedar::proc::Checkpoint::clear()
+{
+  this->mEntries.clear();
+  this->mData.clear();
+}
+
+void cedar::proc::Checkpoint::serialize(std::ostream& stream) const
+{
+  stream.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+
+  write_value<uint64_t>(stream, this->mEntries.size());
+  for (const auto& key_entry_pair : this->mEntries)
+  {
+    const std::string& key = key_entry_pair.first;
+    const Entry& entry = key_entry_pair.second;
+
+    write_value<uint64_t>(stream, key.size());
+    stream.write(key.data(), key.size());
+    write_value<int32_t>(stream, entry.type);
+    write_value<uint32_t>(stream, entry.sizes.size());
+    for (int size : entry.sizes)
+    {
+      write_value<int32_t>(stream, size);
+    }
+    write_value<uint64_t>(stream, entry.offset);
+    write_value<uint64_t>(stream, entry.bytes);
+  }
+
+  write_value<uint64_t>(stream, this->mData.size());
+  stream.write(reinterpret_cast<const char*>(this->mData.data()), this->mData.size());
+}
+
+void cedar::proc::Checkpoint::deserialize(std::istream& stream)
+{
+  char magic[sizeof(CHECKPOINT_MAGIC)];
+  if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0)
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "The data is not a checkpoint or was written by an incompatible version.");
+  }
+
+  std::map<std::string, Entry> entries;
+  uint64_t number_of_entries = read_value<uint64_t>(stream);
+  for (uint64_t i = 0; i < number_of_entries; ++i)
+  {
+    std::string key(read_value<uint64_t>(stream), '\0');
+    if (!stream.read(&key[0], key.size()))
+    {
+      CEDAR_THROW(cedar::aux::ParseException, "Unexpected end of checkpoint data.");
+    }
+
+    Entry entry;
+    entry.type = read_value<int32_t>(stream);
+    entry.sizes.resize(read_value<uint32_t>(stream));
+    for (auto& size : entry.sizes)
+    {
+      size = read_value<int32_t>(stream);
+    }
+    entry.offset = read_value<uint64_t>(stream);
+    entry.bytes = read_value<uint64_t>(stream);
+    entries[key] = entry;
+  }
+
+  std::vector<unsigned char> data(read_value<uint64_t>(stream));
+  if (!stream.read(reinterpret_cast<char*>(data.data()), data.size()))
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "Unexpected end of checkpoint data.");
+  }
+
+  for (const auto& key_entry_pair : entries)
+  {
+    checkEntry(key_entry_pair.first, key_entry_pair.second, data.size());
+  }
+
+  this->mEntries.swap(entries);
+  this->mData.swap(data);
+}
+
+void cedar::proc::Checkpoint::writeFile(const cedar::aux::Path& file) const
+{
+  std::ofstream stream(file.absolute().toString(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!stream.is_open())
+  {
+    CEDAR_THROW(cedar::aux::InvalidPathException, "Could not open checkpoint file \"" + file.toString() + "\".");
+  }
+  this->serialize(stream);
+}
+
+void cedar::proc::Checkpoint::readFile(const cedar::aux::Path& file)
+{
+  std::ifstream stream(file.absolute().toString(), std::ios::in | std::ios::binary);
+  if (!stream.is_open())
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open checkpoint file \"" + file.toString() + "\".");
+  }
+  this->deserialize(stream);
+}
@@ -0,0 +1,174 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Checkpoint.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Binary snapshots of the matrices held by processing elements.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_PROC_CHECKPOINT_H
+#define CEDAR_PROC_CHECKPOINT_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Path.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/processing/Checkpoint.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/core/core.hpp>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+
+/*!@brief A binary snapshot of matrices, e.g., the activations, weights and buffers of all steps in a group.
+ *
+ *        Matrices are stored under a key in one contiguous block of memory; storing and restoring them is a plain copy
+ *        of their memory. Storing a matrix again under the same key reuses its memory if its size in bytes has not
+ *        changed, so a checkpoint that is written repeatedly does not allocate memory; otherwise, the old memory is
+ *        released.
+ *
+ *        Checkpoints can be written to and read from files. The file format is a raw image of the memory; it is
+ *        meant for resuming and forking runs on the same machine and is not portable between platforms of different
+ *        endianness.
+ *
+ * @see   cedar::proc::Connectable::writeCheckpoint, cedar::proc::Connectable::readCheckpoint
+ */
+class cedar::proc::Checkpoint
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Describes where and how a matrix is stored.
+  struct Entry
+  {
+    //! OpenCV type of the matrix.
+    int type;
+    //! Sizes of the matrix along each dimension; empty for empty matrices.
+    std::vector<int> sizes;
+    //! Position of the matrix data in the memory block.
+    size_t offset;
+    //! Number of bytes of the matrix data.
+    size_t bytes;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  Checkpoint();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Copies the matrix into the checkpoint, replacing the matrix stored under the same key (if any).
+  void store(const std::string& key, const cv::Mat& matrix);
+
+  /*!@brief Copies the matrix stored under the given key into the given matrix.
+   *
+   *        The memory of the matrix is reused if its size and type match those of the stored matrix.
+   *
+   * @returns False, if there is no matrix stored under the key; the matrix is left untouched in that case.
+   */
+  bool restore(const std::string& key, cv::Mat& matrix) const;
+
+  //! Checks whether a matrix is stored under the given key.
+  bool contains(const std::string& key) const;
+
+  //! Returns the keys of all stored matrices.
+  std::vector<std::string> listKeys() const;
+
+  //! Returns the number of stored matrices.
+  size_t getNumberOfEntries() const;
+
+  //! Returns the number of bytes used for the matrix data.
+  size_t getDataSize() const;
+
+  //! Removes all matrices from the checkpoint.
+  void clear();
+
+  //! Writes the checkpoint to the given stream, which should be opened in binary mode.
+  void serialize(std::ostream& stream) const;
+
+  /*!@brief Replaces the contents of this checkpoint with one read from the given stream.
+   *
+   * @throws cedar::aux::ParseException if the data is not a valid checkpoint; the checkpoint is left untouched then.
+   */
+  void deserialize(std::istream& stream);
+
+  //! Writes the checkpoint to the given file.
+  void writeFile(const cedar::aux::Path& file) const;
+
+  //! Replaces the contents of this checkpoint with the one stored in the given file.
+  void readFile(const cedar::aux::Path& file);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Returns a header for the stored data of the entry.
+  cv::Mat getStoredMatrix(const Entry& entry) const;
+
+  //! Throws a parse exception if the entry does not describe a valid matrix within data of the given size.
+  static void checkEntry(const std::string& key, const Entry& entry, size_t dataSize);
+
+  //! Moves the data of all entries together, releasing memory no entry uses anymore.
+  void compact();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! Where the matrices are stored, by key.
+  std::map<std::string, Entry> mEntries;
+
+  //! The data of all matrices.
+  std::vector<unsigned char> mData;
+
+}; // class cedar::proc::Checkpoint
+
+#endif // CEDAR_PROC_CHECKPOINT_H
@@ -42,6 +42,7 @@
 #include "cedar/processing/ExternalData.h"
 #include "cedar/processing/OwnedData.h"
 #include "cedar/processing/Group.h"
+#include "cedar/processing/Checkpoint.h"
 #include "cedar/auxiliaries/Data.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/Path.h"
@@ -183,6 +184,72 @@ void cedar::proc::Connectable::readData(const cedar::aux::ConfigurationNode& sto
   }
 }
 
+void cedar::proc::Connectable::writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path) const
+{
+  // inputs are owned (and thus stored) by the connectables they come from
+  for (auto role : {cedar::proc::DataRole::BUFFER, cedar::proc::DataRole::OUTPUT})
+  {
+    if (!this->hasSlotForRole(role))
+    {
+      continue;
+    }
+
+    const std::string& role_name = cedar::proc::DataRole::type().get(role).name();
+    for (auto slot : this->getOrderedDataSlots(role))
+    {
+      if (auto mat_data = boost::dynamic_pointer_cast<const cedar::aux::MatData>(slot->getData()))
+      {
+        QReadLocker locker(&mat_data->getLock());
+        checkpoint.store(path + "/" + role_name + "/" + slot->getName(), mat_data->getData());
+      }
+    }
+  }
+}
+
+void cedar::proc::Connectable::readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path)
+{
+  for (auto role : {cedar::proc::DataRole::BUFFER, cedar::proc::DataRole::OUTPUT})
+  {
+    if (!this->hasSlotForRole(role))
+    {
+      continue;
+    }
+
+    const std::string& role_name = cedar::proc::DataRole::type().get(role).name();
+    for (auto slot : this->getOrderedDataSlots(role))
+    {
+      auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(slot->getData());
+      if (!mat_data)
+      {
+        continue;
+      }
+
+      bool properties_changed;
+      {
+        QWriteLocker locker(&mat_data->getLock());
+        cv::Mat& matrix = mat_data->getData();
+        // shallow copy; keeps the old header for comparison if the matrix is reallocated
+        cv::Mat old_matrix = matrix;
+
+        if (!checkpoint.restore(path + "/" + role_name + "/" + slot->getName(), matrix))
+        {
+          continue;
+        }
+        properties_changed = old_matrix.type() != matrix.type() || old_matrix.size != matrix.size;
+
+        // the matrix was written directly, so readers relying on versions and snapshots have to be told
+        mat_data->markChanged();
+        mat_data->publishSnapshot();
+      }
+
+      if (properties_changed && role == cedar::proc::DataRole::OUTPUT)
+      {
+        this->emitOutputPropertiesChangedSignal(slot->getName());
+      }
+    }
+  }
+}
+
 void cedar::proc::Connectable::redetermineInputValidity(const std::string& slot)
 {
   this->getInputSlot(slot)->setValidity(cedar::proc::DataSlot::VALIDITY_UNKNOWN);
@@ -51,6 +51,7 @@
 // FORWARD DECLARATIONS
 #include "cedar/processing/Group.fwd.h"
 #include "cedar/processing/Connectable.fwd.h"
+#include "cedar/processing/Checkpoint.fwd.h"
 #include "cedar/processing/Step.fwd.h"
 #include "cedar/processing/sources/GroupSource.fwd.h"
 #include "cedar/processing/InputSlotHelper.fwd.h"
@@ -203,6 +204,19 @@ public:
   //! Writes data marked as serializable to the configuration node.
   virtual void readData(const cedar::aux::ConfigurationNode& root);
 
+  /*!@brief Stores the matrices of all buffers and outputs in the checkpoint.
+   *
+   *        Entries are stored under keys that start with the given path. Override this (and readCheckpoint) to add
+   *        state that is not held in a buffer or output.
+   */
+  virtual void writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path) const;
+
+  /*!@brief Restores the matrices of all buffers and outputs from the checkpoint.
+   *
+   *        Slots that have no entry in the checkpoint are left untouched.
+   */
+  virtual void readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path);
+
   //!@brief Parses a data and Connectable name without specifying a role.
   static void parseDataNameNoRole
               (
@@ -60,6 +60,7 @@
 #include "cedar/processing/sources/GroupSource.h"
 #include "cedar/auxiliaries/StringVectorParameter.h"
 #include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/CallOnScopeExit.h"
 #include "cedar/auxiliaries/PluginProxy.h"
 #include "cedar/auxiliaries/Parameter.h"
 #include "cedar/auxiliaries/ParameterDeclaration.h"
@@ -773,6 +774,11 @@ void cedar::proc::Group::startTriggers(bool wait)
 {
   std::vector<cedar::proc::LoopedTriggerPtr> triggers = this->listLoopedTriggers();
 
+  // in lockstep mode, no trigger may take its first step before all of them (including those in subgroups) are started
+  auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+  clock->holdLockstep();
+  cedar::aux::CallOnScopeExit release_lockstep(boost::bind(&cedar::aux::GlobalClock::releaseLockstep, clock));
+
   for (auto trigger : triggers)
   {
     if (!trigger->isRunning() && trigger->startWithAll())
@@ -2092,6 +2098,30 @@ void cedar::proc::Group::readData(const cedar::aux::ConfigurationNode& root)
   }
 }
 
+void cedar::proc::Group::writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path) const
+{
+  for (auto name_element_pair : this->getElements())
+  {
+    if (auto connectable = boost::dynamic_pointer_cast<cedar::proc::Connectable>(name_element_pair.second))
+    {
+      std::string element_path = path.empty() ? name_element_pair.first : path + "." + name_element_pair.first;
+      connectable->writeCheckpoint(checkpoint, element_path);
+    }
+  }
+}
+
+void cedar::proc::Group::readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path)
+{
+  for (auto name_element_pair : this->getElements())
+  {
+    if (auto connectable = boost::dynamic_pointer_cast<cedar::proc::Connectable>(name_element_pair.second))
+    {
+      std::string element_path = path.empty() ? name_element_pair.first : path + "." + name_element_pair.first;
+      connectable->readCheckpoint(checkpoint, element_path);
+    }
+  }
+}
+
 std::set<std::string> cedar::proc::Group::getRequiredPlugins(const std::string& architectureFile)
 {
   std::set<std::string> plugins;
@@ -216,6 +216,19 @@ public:
    */
   void writeData(cedar::aux::ConfigurationNode& root) const;
 
+  /*!@brief Stores the matrices of all elements of this group and its subgroups in the checkpoint.
+   *
+   *        The keys of the entries start with the path of the elements relative to this group.
+   */
+  void writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path = std::string()) const;
+
+  /*!@brief Restores the matrices of all elements of this group and its subgroups from the checkpoint.
+   *
+   *        Elements that are not part of the checkpoint are left untouched, so checkpoints stay usable after elements
+   *        were added to or removed from the group.
+   */
+  void readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path = std::string());
+
   /*!@brief Removes an element from the group.
    *
    * @remark Before calling this function, you should remove all connections to the element.
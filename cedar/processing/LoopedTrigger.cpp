@@ -42,9 +42,11 @@
 // CEDAR INCLUDES
 #include "cedar/processing/LoopedTrigger.h"
 #include "cedar/processing/StepTime.h"
+#include "cedar/processing/Step.h"
 #include "cedar/processing/Group.h"
 #include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/processing/ElementDeclaration.h"
+#include "cedar/auxiliaries/ScopedTrace.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
@@ -53,6 +55,11 @@
 
 // SYSTEM INCLUDES
 #include <QApplication>
+#ifdef CEDAR_USE_QT5
+  #include <QtConcurrent/QtConcurrentMap>
+#else
+  #include <QtConcurrentMap>
+#endif
 #include <algorithm>
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -100,7 +107,8 @@ cedar::aux::LoopedThread(cedar::aux::LoopMode::RealDT, stepSize), // changed: ce
 cedar::proc::Trigger(name),
 mStarted(false),
 mStatistics(new TimeAverage(50)),
-_mStartWithAll(new cedar::aux::BoolParameter(this, "start with all", true))
+_mStartWithAll(new cedar::aux::BoolParameter(this, "start with all", true)),
+_mParallelDispatch(new cedar::aux::BoolParameter(this, "parallel dispatch", false))
 {
   // When the name changes, we need to tell the manager about this.
   QObject::connect(this->_mName.get(), SIGNAL(valueChanged()), this, SLOT(onNameChanged()));
@@ -139,6 +147,18 @@ bool cedar::proc::LoopedTrigger::startWithAll() const
   return copy;
 }
 
+bool cedar::proc::LoopedTrigger::isParallelDispatchEnabled() const
+{
+  cedar::aux::Parameter::ReadLocker locker(this->_mParallelDispatch);
+  bool copy = this->_mParallelDispatch->getValue();
+  return copy;
+}
+
+void cedar::proc::LoopedTrigger::setParallelDispatchEnabled(bool enabled)
+{
+  this->_mParallelDispatch->setValue(enabled, true);
+}
+
 /*! This method takes care of changing the step's name in the registry as well.
  *
  * @todo Solve this with boost signals/slots; that way, this can be moved to cedar::proc::Element
@@ -207,13 +227,37 @@ void cedar::proc::LoopedTrigger::processQuit()
 
 void cedar::proc::LoopedTrigger::step(cedar::unit::Time time)
 {
+  cedar::aux::ScopedTrace trace(this->getName(), cedar::aux::Tracer::CATEGORY_TRIGGER);
   cedar::proc::ArgumentsPtr arguments(new cedar::proc::StepTime(time));
+  // in lockstep mode, the step only counts as finished (and the clock may only advance) once its chains are done
+  cedar::proc::Step::SynchronousChainScope chain_scope
+  (
+    cedar::proc::Step::areChainsSynchronous() || this->isInLockstep()
+  );
 
   QReadLocker locker(this->mListeners.getLockPtr());
   auto this_ptr = boost::static_pointer_cast<cedar::proc::LoopedTrigger>(this->shared_from_this());
-  for (const auto& listener : this->mListeners.member())
+  const auto& listeners = this->mListeners.member();
+  if (listeners.size() > 1 && this->isParallelDispatchEnabled())
   {
-    listener->onTrigger(arguments, this_ptr);
+    // listeners of a looped trigger are all looped and thus start their own chains; they are independent of each other
+    bool synchronous = cedar::proc::Step::areChainsSynchronous();
+    QtConcurrent::blockingMap
+    (
+      listeners,
+      [&arguments, &this_ptr, synchronous](const cedar::proc::TriggerablePtr& listener)
+      {
+        cedar::proc::Step::SynchronousChainScope chain_scope(synchronous);
+        listener->onTrigger(arguments, this_ptr);
+      }
+    );
+  }
+  else
+  {
+    for (const auto& listener : listeners)
+    {
+      listener->onTrigger(arguments, this_ptr);
+    }
   }
   this->mStatistics->append(time);
 }
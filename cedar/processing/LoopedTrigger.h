@@ -104,6 +104,14 @@ public:
   //! If false, this trigger should not be started with start all triggers calls.
   bool startWithAll() const;
 
+  /*! If true, the triggerables of each level of the triggering chains started by this trigger are triggered in
+   *  parallel on the global thread pool rather than one after another.
+   */
+  bool isParallelDispatchEnabled() const;
+
+  //! Enables or disables parallel dispatch, see isParallelDispatchEnabled.
+  void setParallelDispatchEnabled(bool enabled);
+
   // override name hiding
   using cedar::proc::Trigger::canTrigger;
 
@@ -180,6 +188,9 @@ protected:
 private:
   cedar::aux::BoolParameterPtr _mStartWithAll;
 
+  //! Whether independent triggerables are triggered in parallel.
+  cedar::aux::BoolParameterPtr _mParallelDispatch;
+
 }; // class cedar::proc::LoopedTrigger
 
 #endif // CEDAR_PROC_LOOPED_TRIGGER_H
@@ -46,11 +46,14 @@
 #include "cedar/processing/Group.h"
 #include "cedar/processing/Trigger.h"
 #include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/ExternalData.h"
 #include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/systemFunctions.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/Tracer.h"
+#include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 #include "cedar/defines.h"
@@ -76,18 +79,51 @@
 // Check for NaNs after every compute call
 //#define CEDAR_ENABLE_NAN_CHECK
 
+//----------------------------------------------------------------------------------------------------------------------
+// helpers
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  //! Triggers the chain with the given clock being current, i.e., with the clock of the thread that started the chain.
+  void triggerWithClock(cedar::proc::TriggerPtr trigger, cedar::aux::GlobalClockPtr clock)
+  {
+    cedar::aux::GlobalClockSingleton::ThreadScope clock_scope(clock);
+    trigger->trigger();
+  }
+
+  //! Whether looped steps run their chains in the current thread, see cedar::proc::Step::SynchronousChainScope.
+  thread_local bool chains_synchronous = false;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
+cedar::proc::Step::SynchronousChainScope::SynchronousChainScope(bool synchronous)
+:
+mPrevious(chains_synchronous)
+{
+  chains_synchronous = synchronous;
+}
+
+cedar::proc::Step::SynchronousChainScope::~SynchronousChainScope()
+{
+  chains_synchronous = this->mPrevious;
+}
+
 cedar::proc::Step::Step(bool isLooped)
 :
 Triggerable(isLooped),
 // initialize parameters
-mAutoLockInputsAndOutputs(true)
+mAutoLockInputsAndOutputs(true),
+mSkipUnchangedComputes(false),
+mSkippedComputes(0),
+mComputeVersionsValid(false),
+mComputeParameterVersion(0)
 {
   this->mComputeTimeId = this->registerTimeMeasurement("compute call");
   this->mLockingTimeId = this->registerTimeMeasurement("locking");
   this->mRoundTimeId = this->registerTimeMeasurement("round time");
+  this->mTriggerChainTimeId = this->registerTimeMeasurement("trigger chain");
 
 
   // create the finished trigger singleton.
@@ -179,6 +215,8 @@ void cedar::proc::Step::callReset()
 
   // reset the step
   this->reset();
+  this->mComputeVersionsValid = false;
+  this->markOutputsChanged();
 
   // unlock everything
   locker.unlock();
@@ -339,7 +377,13 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
   connections_locker.unlock();
 
   // lock the step
+  auto tracer = cedar::aux::TracerSingleton::getInstance();
+  int64_t lock_trace_begin = tracer->isEnabled() ? tracer->now() : -1;
   cedar::proc::Step::ReadLocker step_locker(this);
+  if (lock_trace_begin >= 0)
+  {
+    tracer->record(this->getName(), cedar::aux::Tracer::CATEGORY_LOCK, lock_trace_begin, tracer->now());
+  }
 
   boost::posix_time::ptime lock_end = boost::posix_time::microsec_clock::universal_time();
   boost::posix_time::time_duration lock_elapsed = lock_end - lock_start;
@@ -359,6 +403,33 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
     return;
   } // this->mMandatoryConnectionsAreSet
 
+  // skip the compute call if nothing the step depends on has changed since the last one
+  bool track_versions = this->mSkipUnchangedComputes;
+  size_t input_version_count = 0;
+  unsigned long long parameter_version = 0;
+  if (track_versions)
+  {
+    this->mCurrentComputeVersions.clear();
+    this->appendDataVersions(cedar::proc::DataRole::INPUT, this->mCurrentComputeVersions);
+    input_version_count = this->mCurrentComputeVersions.size();
+    this->appendDataVersions(cedar::proc::DataRole::OUTPUT, this->mCurrentComputeVersions);
+    parameter_version = this->getParameterVersion();
+
+    if
+    (
+      this->mComputeVersionsValid
+      && parameter_version == this->mComputeParameterVersion
+      && this->mCurrentComputeVersions == this->mComputeVersions
+    )
+    {
+      ++this->mSkippedComputes;
+      step_locker.unlock();
+      this->processChangedSlots();
+      this->mBusy.unlock();
+      this->triggerSubsequentSteps(trigger);
+      return;
+    }
+  }
 
   if (this->mPreciseLastComputeCall.is_not_a_date_time()) // was not called before, initialize time
   {
@@ -375,6 +446,7 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
 
   // start measuring the execution time.
   boost::posix_time::ptime run_start = boost::posix_time::microsec_clock::universal_time();
+  int64_t compute_trace_begin = tracer->isEnabled() ? tracer->now() : -1;
 
   try
   {
@@ -401,6 +473,19 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
       mNumberOfStepsMissed= looped_trigger->getNumberOfStepsMissed();
     }
 
+    // let steps that depend on the outputs know that they have changed
+    this->markOutputsChanged();
+
+    if (track_versions)
+    {
+      // the outputs have new versions now; the inputs are locked and thus still the same
+      this->mCurrentComputeVersions.resize(input_version_count);
+      this->appendDataVersions(cedar::proc::DataRole::OUTPUT, this->mCurrentComputeVersions);
+      this->mComputeVersions.swap(this->mCurrentComputeVersions);
+      this->mComputeParameterVersion = parameter_version;
+      this->mComputeVersionsValid = true;
+    }
+
   }
   // catch exceptions and translate them to the given state/message
   catch(const cedar::aux::ExceptionBase& e)
@@ -434,6 +519,10 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
     this->setState(cedar::proc::Triggerable::STATE_EXCEPTION, "An unknown exception type occurred.");
   }
 
+  if (compute_trace_begin >= 0)
+  {
+    tracer->record(this->getName(), cedar::aux::Tracer::CATEGORY_COMPUTE, compute_trace_begin, tracer->now());
+  }
   boost::posix_time::ptime run_end = boost::posix_time::microsec_clock::universal_time();
   boost::posix_time::time_duration run_elapsed = run_end - run_start;
   cedar::unit::Time run_elapsed_s(run_elapsed.total_microseconds() * cedar::unit::micro * cedar::unit::seconds);
@@ -471,6 +560,11 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
   // finally, the step is now no longer busy
   this->mBusy.unlock();
 
+  this->triggerSubsequentSteps(trigger);
+}
+
+void cedar::proc::Step::triggerSubsequentSteps(cedar::proc::TriggerPtr trigger)
+{
   //!@todo This is code that really belongs in Trigger(able). But it can't be moved there as it is, because Trigger(able) doesn't know about loopiness etc.
   // subsequent steps are triggered if one of the following conditions is met:
   // a) This step has not been triggered as part of a trigger chain. This is the case if trigger is NULL.
@@ -492,12 +586,22 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
 #ifdef DEBUG_TRIGGERING
     std::cout << "Step " << this->getName() << " was computed and thus triggers its done trigger." << std::endl;
 #endif // DEBUG_TRIGGERING
-    // trigger subsequent steps in a non-blocking manner
-    if (this->isLooped())
+    // trigger subsequent steps in a non-blocking manner, unless the caller waits for the whole chain
+    if (this->isLooped() && !cedar::proc::Step::areChainsSynchronous())
     {
       if (!this->mFinishedChainResult.isStarted() || this->mFinishedChainResult.isFinished())
       {
-        this->mFinishedChainResult = QtConcurrent::run(boost::bind(&cedar::proc::Trigger::trigger, this->getFinishedTrigger(), cedar::proc::ArgumentsPtr()));
+        // the chain runs in the thread pool, but steps in it have to see the clock of this step, e.g., when it belongs
+        // to an isolated trial
+        this->mFinishedChainResult = QtConcurrent::run
+                                     (
+                                       boost::bind
+                                       (
+                                         &triggerWithClock,
+                                         this->getFinishedTrigger(),
+                                         cedar::aux::GlobalClockSingleton::getInstance()
+                                       )
+                                     );
       }
     }
     else
@@ -513,6 +617,11 @@ void cedar::proc::Step::callComputeWithoutTriggering(cedar::proc::ArgumentsPtr a
   this->onTrigger(args, cedar::proc::TriggerPtr(new cedar::proc::Trigger()));
 }
 
+bool cedar::proc::Step::areChainsSynchronous()
+{
+  return chains_synchronous;
+}
+
 
 void cedar::proc::Step::processChangedSlots()
 {
@@ -582,6 +691,11 @@ void cedar::proc::Step::setRoundTimeMeasurement(const cedar::unit::Time& time)
   this->setTimeMeasurement(this->mRoundTimeId, time);
 }
 
+void cedar::proc::Step::setTriggerChainTimeMeasurement(const cedar::unit::Time& time)
+{
+  this->setTimeMeasurement(this->mTriggerChainTimeId, time);
+}
+
 cedar::unit::Time cedar::proc::Step::getLastTimeMeasurement(unsigned int id) const
 {
   CEDAR_DEBUG_ASSERT(id < this->mTimeMeasurements.size());
@@ -680,5 +794,79 @@ cedar::unit::Time cedar::proc::Step::getRoundTimeAverage() const
 //!@todo This method is probably superfluous
 void cedar::proc::Step::callInputConnectionChanged(const std::string& slot)
 {
+  this->mComputeVersionsValid = false;
   this->cedar::proc::Connectable::callInputConnectionChanged(slot);
 }
+
+void cedar::proc::Step::setSkipUnchangedComputes(bool skip)
+{
+  this->mComputeVersionsValid = false;
+  this->mSkipUnchangedComputes = skip;
+}
+
+bool cedar::proc::Step::getSkipUnchangedComputes() const
+{
+  return this->mSkipUnchangedComputes;
+}
+
+unsigned long long cedar::proc::Step::getSkippedComputeCount() const
+{
+  return this->mSkippedComputes;
+}
+
+void cedar::proc::Step::appendDataVersions
+(
+  cedar::proc::DataRole::Id role,
+  std::vector<std::pair<const cedar::aux::Data*, unsigned long long> >& versions
+) const
+{
+  if (!this->hasSlotForRole(role))
+  {
+    return;
+  }
+
+  for (const auto& slot : this->getOrderedDataSlots(role))
+  {
+    if (auto external = boost::dynamic_pointer_cast<cedar::proc::ExternalData>(slot))
+    {
+      for (unsigned int i = 0; i < external->getDataCount(); ++i)
+      {
+        auto data = external->getData(i);
+        versions.push_back(std::make_pair(data.get(), data ? data->getVersion() : 0));
+      }
+    }
+    else
+    {
+      auto data = slot->getData();
+      versions.push_back(std::make_pair(data.get(), data ? data->getVersion() : 0));
+    }
+  }
+}
+
+void cedar::proc::Step::markOutputsChanged()
+{
+  if (!this->hasSlotForRole(cedar::proc::DataRole::OUTPUT))
+  {
+    return;
+  }
+
+  for (const auto& slot : this->getOrderedDataSlots(cedar::proc::DataRole::OUTPUT))
+  {
+    if (auto data = slot->getData())
+    {
+      data->markChanged();
+      if (this->mAutoLockInputsAndOutputs)
+      {
+        // the outputs are still locked, so this is the cheapest moment for publishing them to plots
+        data->publishSnapshot();
+      }
+      else if (data->getLock().tryLockForRead())
+      {
+        // the step locks its outputs itself, so they are not locked here; if the step is writing them right now, the
+        // snapshot is left to the next reader of the snapshots
+        data->publishSnapshot();
+        data->getLock().unlock();
+      }
+    }
+  }
+}
@@ -51,6 +51,7 @@
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/BoolParameter.fwd.h"
+#include "cedar/auxiliaries/Data.fwd.h"
 #include "cedar/processing/Trigger.fwd.h"
 #include "cedar/processing/Step.fwd.h"
 
@@ -74,6 +75,7 @@
 #include <utility>
 #include <vector>
 #include <deque>
+#include <atomic>
 
 
 /*!@brief This class represents a processing step in the processing framework.
@@ -100,6 +102,7 @@ class cedar::proc::Step : public QObject,
   // friends
   //--------------------------------------------------------------------------------------------------------------------
   friend class cedar::proc::Group;
+  friend class cedar::proc::Trigger;
 
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
@@ -181,6 +184,28 @@ public:
     }
   };
 
+  /*! While an object of this class exists, looped steps triggered in the current thread run their subsequent steps in
+   *  that thread, instead of handing them to the thread pool.
+   *
+   *  This is needed wherever the caller relies on the whole chain being computed once the looped steps return, e.g.,
+   *  when stepping triggers manually in batch runs.
+   */
+  class SynchronousChainScope
+  {
+  public:
+    //! Constructor; passing false restores the default, asynchronous behavior for the lifetime of the object.
+    explicit SynchronousChainScope(bool synchronous = true);
+
+    //! Destructor; restores the previous behavior.
+    ~SynchronousChainScope();
+
+  private:
+    SynchronousChainScope(const SynchronousChainScope&);
+    SynchronousChainScope& operator=(const SynchronousChainScope&);
+
+    bool mPrevious;
+  };
+
   //!@cond SKIPPED_DOCUMENTATION
   CEDAR_GENERATE_POINTER_TYPES(ReadLocker);
   CEDAR_GENERATE_POINTER_TYPES(WriteLocker);
@@ -218,6 +243,9 @@ public:
   //! The same as onTrigger, but does not trigger subsequent steps.
   void callComputeWithoutTriggering(cedar::proc::ArgumentsPtr args = cedar::proc::ArgumentsPtr());
 
+  //! True if a SynchronousChainScope is active in the current thread.
+  static bool areChainsSynchronous();
+
   //!@brief Gets the amount of triggers stored in this step.
   size_t getTriggerCount() const;
 
@@ -296,6 +324,22 @@ public:
   //! Updates the step's trigger chains
   void updateTriggerChains(std::set<cedar::proc::Trigger*>& visited);
 
+  /*!@brief Sets whether compute calls are skipped when nothing the step depends on has changed.
+   *
+   *        When enabled, a trigger only calls compute if the version of an input or output (see
+   *        cedar::aux::Data::getVersion) or of a parameter (see cedar::aux::Configurable::getParameterVersion) differs
+   *        from the one seen by the last compute call. Subsequent steps are triggered either way. Only enable this for
+   *        steps whose outputs depend on nothing else, i.e., not on the time passed to compute, on internal state or
+   *        on external sources.
+   */
+  void setSkipUnchangedComputes(bool skip);
+
+  //! Returns whether compute calls are skipped when nothing the step depends on has changed.
+  bool getSkipUnchangedComputes() const;
+
+  //! Returns how many compute calls have been skipped because nothing the step depends on had changed.
+  unsigned long long getSkippedComputeCount() const;
+
   void emitOutputPropertiesChangedSignal(const std::string& slot);
 
 public slots:
@@ -440,6 +484,10 @@ private:
    */
   void setRoundTimeMeasurement(const cedar::unit::Time& time);
 
+  /*!@brief Sets the time it took to process the trigger chain following this step.
+   */
+  void setTriggerChainTimeMeasurement(const cedar::unit::Time& time);
+
   /*!@brief Locks the data of the step according to the current method.
    *
    * For a description of the method, see setAutoLockInputsAndOutputs(bool).
@@ -460,6 +508,23 @@ private:
   //! Processes all slots that have been changed during the compute call.
   void processChangedSlots();
 
+  //! Appends the versions of all data in slots of the given role to the list.
+  void appendDataVersions
+  (
+    cedar::proc::DataRole::Id role,
+    std::vector<std::pair<const cedar::aux::Data*, unsigned long long> >& versions
+  ) const;
+
+  /*!@brief Increases the versions of all outputs of the step and publishes snapshots of them for plots.
+   *
+   *        If the step does not lock its inputs and outputs automatically, outputs that cannot be locked for reading
+   *        right away are not published.
+   */
+  void markOutputsChanged();
+
+  //! Triggers subsequent steps after a trigger call has been processed, see onTrigger.
+  void triggerSubsequentSteps(cedar::proc::TriggerPtr trigger);
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -491,6 +556,9 @@ private:
   //!@brief Moving average of the time between compute calls.
   unsigned int mRoundTimeId;
 
+  //!@brief Moving average of the time taken by the trigger chain following this step.
+  unsigned int mTriggerChainTimeId;
+
   boost::posix_time::ptime mPreciseLastComputeCall;
 
   //! Whether the step should lock its inputs and outputs automatically.
@@ -504,6 +572,24 @@ private:
 
   double mNumberOfStepsMissed;
 
+  //! Whether compute calls are skipped when nothing the step depends on has changed.
+  std::atomic<bool> mSkipUnchangedComputes;
+
+  //! Number of compute calls skipped because nothing had changed.
+  std::atomic<unsigned long long> mSkippedComputes;
+
+  //! Whether mComputeVersions and mComputeParameterVersion describe the last compute call.
+  std::atomic<bool> mComputeVersionsValid;
+
+  //! Versions of the inputs and outputs after the last compute call, in slot order.
+  std::vector<std::pair<const cedar::aux::Data*, unsigned long long> > mComputeVersions;
+
+  //! Versions of the inputs and outputs at the current trigger call; kept as a member to avoid reallocations.
+  std::vector<std::pair<const cedar::aux::Data*, unsigned long long> > mCurrentComputeVersions;
+
+  //! Parameter version seen by the last compute call.
+  unsigned long long mComputeParameterVersion;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -42,6 +42,7 @@
 // CEDAR INCLUDES
 #include "cedar/processing/Trigger.h"
 #include "cedar/processing/Step.h"
+#include "cedar/processing/LoopedTrigger.h"
 #include "cedar/processing/Element.h"
 #include "cedar/processing/Group.h"
 #include "cedar/processing/ElementDeclaration.h"
@@ -49,13 +50,24 @@
 #include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/processing/sources/GroupSource.h"
 #include "cedar/processing/sinks/GroupSink.h"
+#include "cedar/auxiliaries/ScopedTrace.h"
 #include "cedar/auxiliaries/GraphTemplate.h"
 #include "cedar/auxiliaries/Log.h"
 #include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/MovingAverage.h"
+#include "cedar/units/prefixes.h"
 
 // SYSTEM INCLUDES
 #include <QReadLocker>
 #include <QWriteLocker>
+#ifdef CEDAR_USE_QT5
+  #include <QtConcurrent/QtConcurrentMap>
+#else
+  #include <QtConcurrentMap>
+#endif
+#ifndef Q_MOC_RUN
+  #include <boost/date_time/posix_time/posix_time_types.hpp>
+#endif
 #include <algorithm>
 #include <string>
 #include <iostream>
@@ -774,8 +786,21 @@ void cedar::proc::Trigger::updateTriggeringOrderRecurseUpSource(cedar::proc::sou
 }
 
 
+bool cedar::proc::Trigger::isParallelDispatchEnabled() const
+{
+  // only chains started by looped triggerables can be dispatched in parallel; the looped trigger decides whether to
+  if (this->mpOwner == nullptr || !this->mpOwner->isLooped())
+  {
+    return false;
+  }
+
+  auto looped_trigger = this->mpOwner->getLoopedTrigger();
+  return looped_trigger && looped_trigger->isParallelDispatchEnabled();
+}
+
 void cedar::proc::Trigger::trigger(cedar::proc::ArgumentsPtr arguments)
 {
+  cedar::aux::ScopedTrace trace(this->getName(), cedar::aux::Tracer::CATEGORY_TRIGGER);
   auto this_ptr = boost::static_pointer_cast<cedar::proc::Trigger>(this->shared_from_this());
 
   QReadLocker lock(this->mTriggeringOrder.getLockPtr());
@@ -784,27 +809,101 @@ void cedar::proc::Trigger::trigger(cedar::proc::ArgumentsPtr arguments)
 /* DEBUG_TRIGGERING */  std::cout << "> Triggering " << nameTrigger(this) << std::endl;
 #endif
 
-  for (auto order_triggerables_pair : this->mTriggeringOrder.member())
+  bool parallel = this->isParallelDispatchEnabled();
+  boost::posix_time::ptime chain_start = boost::posix_time::microsec_clock::universal_time();
+
+  for (const auto& order_triggerables_pair : this->mTriggeringOrder.member())
   {
-    auto triggerables = order_triggerables_pair.second;
-    for (cedar::proc::TriggerablePtr triggerable : triggerables)
+    boost::posix_time::ptime level_start = boost::posix_time::microsec_clock::universal_time();
+
+    const auto& triggerables = order_triggerables_pair.second;
+    // all triggerables with the same depth are independent of each other, so they can be fanned out to the thread pool;
+    // blockingMap only returns once all of them are done, which keeps the levels in order.
+    if (parallel && triggerables.size() > 1)
     {
+      std::vector<cedar::proc::TriggerablePtr> level(triggerables.begin(), triggerables.end());
+      // looped steps in the level must start their chains the same way they would in this thread
+      bool synchronous = cedar::proc::Step::areChainsSynchronous();
+      QtConcurrent::blockingMap
+      (
+        level,
+        [&arguments, &this_ptr, synchronous](const cedar::proc::TriggerablePtr& triggerable)
+        {
+          cedar::proc::Step::SynchronousChainScope chain_scope(synchronous);
+          triggerable->onTrigger(arguments, this_ptr);
+        }
+      );
+    }
+    else
+    {
+      for (const cedar::proc::TriggerablePtr& triggerable : triggerables)
+      {
 #ifdef DEBUG_TRIGGERING
 /* DEBUG_TRIGGERING */ std::cout << "  > Triggering chain item " << nameTriggerable(triggerable) << std::endl;
 #endif
 
-      triggerable->onTrigger(arguments, this_ptr);
+        triggerable->onTrigger(arguments, this_ptr);
 
 #ifdef DEBUG_TRIGGERING
 /* DEBUG_TRIGGERING */ std::cout << "  < Done triggering chain item " << nameTriggerable(triggerable) << std::endl;
 #endif
+      }
+    }
+
+    boost::posix_time::time_duration level_elapsed = boost::posix_time::microsec_clock::universal_time() - level_start;
+    this->appendLevelTimeMeasurement
+    (
+      order_triggerables_pair.first,
+      cedar::unit::Time(level_elapsed.total_microseconds() * cedar::unit::micro * cedar::unit::seconds)
+    );
+  }
+
+  if (!this->mTriggeringOrder.member().empty())
+  {
+    if (auto owner_step = dynamic_cast<cedar::proc::Step*>(this->mpOwner))
+    {
+      boost::posix_time::time_duration chain_elapsed = boost::posix_time::microsec_clock::universal_time() - chain_start;
+      owner_step->setTriggerChainTimeMeasurement
+      (
+        cedar::unit::Time(chain_elapsed.total_microseconds() * cedar::unit::micro * cedar::unit::seconds)
+      );
     }
   }
 #ifdef DEBUG_TRIGGERING
-/* DEBUG_TRIGGERING */ std::cout << "< Done triggering " << nameTrigger(this) << std::endl;
+/* DEBUG_TRIGGERING */  std::cout << "< Done triggering " << nameTrigger(this) << std::endl;
 #endif
 }
 
+void cedar::proc::Trigger::appendLevelTimeMeasurement(unsigned int level, const cedar::unit::Time& time)
+{
+  QWriteLocker locker(this->mLevelTimeMeasurements.getLockPtr());
+  auto iter = this->mLevelTimeMeasurements.member().find(level);
+  if (iter == this->mLevelTimeMeasurements.member().end())
+  {
+    // average over the last 100 iterations, same as the step measurements
+    iter = this->mLevelTimeMeasurements.member().insert
+           (
+             std::make_pair(level, cedar::aux::MovingAverage<cedar::unit::Time>(100))
+           ).first;
+  }
+  iter->second.append(time);
+}
+
+std::map<unsigned int, cedar::unit::Time> cedar::proc::Trigger::getLevelTimeMeasurementAverages() const
+{
+  std::map<unsigned int, cedar::unit::Time> averages;
+
+  QReadLocker locker(this->mLevelTimeMeasurements.getLockPtr());
+  for (const auto& level_measurement_pair : this->mLevelTimeMeasurements.member())
+  {
+    if (level_measurement_pair.second.size() > 0)
+    {
+      averages[level_measurement_pair.first] = level_measurement_pair.second.getAverage();
+    }
+  }
+  return averages;
+}
+
 void cedar::proc::Trigger::onTrigger(cedar::proc::ArgumentsPtr, cedar::proc::TriggerPtr)
 {
 }
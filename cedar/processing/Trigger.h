@@ -47,6 +47,8 @@
 #include "cedar/auxiliaries/LockableMember.h"
 #include "cedar/auxiliaries/GraphTemplate.h"
 #include "cedar/auxiliaries/boostSignalsHelper.h"
+#include "cedar/auxiliaries/MovingAverage.h"
+#include "cedar/units/Time.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/processing/sources/GroupSource.fwd.h"
@@ -144,6 +146,12 @@ public:
   //! Returns the number of triggerables directly listening to this trigger.
   size_t getTriggerCount() const;
 
+  /*! Returns the average time it took to process each level of the triggering order, indexed by depth.
+   *
+   *  Levels that have not been triggered yet are not contained in the map.
+   */
+  std::map<unsigned int, cedar::unit::Time> getLevelTimeMeasurementAverages() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -179,6 +187,14 @@ private:
   //! Updates the triggering order of the source recursively, going upwards the triggering chains.
   void updateTriggeringOrderRecurseUpSource(cedar::proc::sources::GroupSource* source, std::set<cedar::proc::Trigger*>& visited);
 
+  /*! Checks whether the triggerables of each level of the triggering order should be triggered in parallel. This is the
+   *  case if the owner of this trigger is attached to a looped trigger that has parallel dispatch enabled.
+   */
+  bool isParallelDispatchEnabled() const;
+
+  //! Appends a time measurement for the given level of the triggering order.
+  void appendLevelTimeMeasurement(unsigned int level, const cedar::unit::Time& time);
+
   void setOwner(cedar::proc::Triggerable* owner)
   {
     this->mpOwner = owner;
@@ -236,7 +252,8 @@ protected:
   cedar::aux::LockableMember< std::map<unsigned int, std::set<cedar::proc::TriggerablePtr> > > mTriggeringOrder;
 
 private:
-  // none yet
+  //! Time measurements for each level of the triggering order.
+  cedar::aux::LockableMember<std::map<unsigned int, cedar::aux::MovingAverage<cedar::unit::Time>>> mLevelTimeMeasurements;
 
   //--------------------------------------------------------------------------------------------------------------------
   // boost signals
@@ -45,6 +45,7 @@
 #include "cedar/processing/Step.h"
 #include "cedar/processing/Trigger.h"
 #include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/Checkpoint.h"
 #include "cedar/auxiliaries/FileLog.h"
 #include "cedar/auxiliaries/ParameterDeclaration.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
@@ -73,6 +74,7 @@ cedar::proc::experiment::Experiment::Experiment(cedar::proc::GroupPtr group)
 :
 mCurrentTrial(0),
 mIsRunning(false),
+mTrialIsRunning(false),
 _mFileName(new cedar::aux::StringParameter(this, "filename", "")),
 _mTrials(new cedar::aux::UIntParameter(this, "repetitions", 1)),
 _mActionSequences
@@ -234,6 +236,14 @@ void cedar::proc::experiment::Experiment::startExperiment()
   this->installLog();
   if (this->_mTrials->getValue() > 0)
   {
+    // trials ending with ResetType::Restore return to this state
+    if (!this->mGroupCheckpoint)
+    {
+      this->mGroupCheckpoint = cedar::proc::CheckpointPtr(new cedar::proc::Checkpoint());
+    }
+    this->mGroupCheckpoint->clear();
+    this->mGroup->writeCheckpoint(*this->mGroupCheckpoint);
+
     this->preExperiment();
 
     std::string time_stamp = cedar::aux::RecorderSingleton::getInstance()->getTimeStamp();
@@ -262,6 +272,12 @@ void cedar::proc::experiment::Experiment::stopExperiment()
 }
 
 void cedar::proc::experiment::Experiment::startTrial()
+{
+  this->prepareTrial();
+  this->mStartGroup->start();
+}
+
+void cedar::proc::experiment::Experiment::prepareTrial()
 {
   cedar::aux::GlobalClockSingleton::getInstance()->reset();
   cedar::aux::GlobalClockSingleton::getInstance()->start();
@@ -279,7 +295,6 @@ void cedar::proc::experiment::Experiment::startTrial()
   std::string trial_number = ss.str();
   cedar::aux::RecorderSingleton::getInstance()->setSubfolder(this->mRecordFolderName + "/" + "Trial_" + trial_number);
   cedar::aux::RecorderSingleton::getInstance()->start();
-  this->mStartGroup->start();
 }
 
 void cedar::proc::experiment::Experiment::startAllTriggers()
@@ -287,6 +302,11 @@ void cedar::proc::experiment::Experiment::startAllTriggers()
   this->mStartGroup->start();
 }
 
+void cedar::proc::experiment::Experiment::writeConfiguration(cedar::aux::ConfigurationNode& root)
+{
+  cedar::aux::NamedConfigurable::writeConfiguration(root);
+}
+
 void cedar::proc::experiment::Experiment::addActionSequence(cedar::proc::experiment::ActionSequencePtr actionSequence)
 {
   this->_mActionSequences->pushBack(actionSequence);
@@ -329,6 +349,14 @@ void cedar::proc::experiment::Experiment::stopTrial(ResetType::Id reset, bool st
       this->resetGroupState();
       break;
     }
+    case ResetType::Restore:
+    {
+      if (this->mGroupCheckpoint)
+      {
+        this->mGroup->readCheckpoint(*this->mGroupCheckpoint);
+      }
+      break;
+    }
     case ResetType::Reset:
     default:
     {
@@ -57,8 +57,10 @@
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/FileLog.fwd.h"
+#include "cedar/processing/Checkpoint.fwd.h"
 #include "cedar/processing/experiment/Experiment.fwd.h"
 #include "cedar/processing/experiment/Supervisor.fwd.h"
+#include "cedar/processing/experiment/TrialRunner.fwd.h"
 
 // SYSTEM INCLUDES
 #include <QObject>
@@ -85,6 +87,7 @@ class cedar::proc::experiment::Experiment : public QObject, public cedar::aux::N
   // freinds
   //--------------------------------------------------------------------------------------------------------------------
   friend class cedar::proc::experiment::Supervisor;
+  friend class cedar::proc::experiment::TrialRunner;
 
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
@@ -107,6 +110,7 @@ public:
         mType.type()->def(cedar::aux::Enum(None, "None", "", "The architecture is left in the state it had at the end of the trial."));
         mType.type()->def(cedar::aux::Enum(Reset, "Reset", "", "The architecture is reset after reaching the end of the trial."));
         mType.type()->def(cedar::aux::Enum(Reload, "Reload", "", "The architecture is reloaded after reaching the end of the trial."));
+        mType.type()->def(cedar::aux::Enum(Restore, "Restore", "", "The activations, weights and buffers of all steps are restored to the ones they had when the experiment was started."));
       }
 
       //! Returns the enumeration type.
@@ -128,6 +132,8 @@ public:
       static const Id Reset = 2;
       //!@brief the architecture is reloaded after reaching the end of the trial
       static const Id Reload = 3;
+      //!@brief the matrices of all steps are restored from a checkpoint taken when the experiment was started
+      static const Id Restore = 4;
 
     private:
       static cedar::aux::EnumType<ResetType> mType;
@@ -320,6 +326,9 @@ private:
   //! Called after an experiment is stopped.
   void postExperiment();
 
+  //! Resets the clock and the action sequences and starts the recorder for the current trial.
+  void prepareTrial();
+
   //!@brief Calls a condition check.
   void step(cedar::unit::Time);
 
@@ -376,6 +385,9 @@ private:
   //!@brief The state of the group before the experiment has been started.
   cedar::aux::ConfigurationNode mGroupState;
 
+  //!@brief The matrices of all steps of the group when the experiment was started.
+  cedar::proc::CheckpointPtr mGroupCheckpoint;
+
   //! Whether or not the experiment is meant to repeat indefinitely.
   cedar::aux::BoolParameterPtr _mRepeat;
 
@@ -0,0 +1,352 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        TrialRunner.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Runs the trials of an experiment concurrently on isolated copies of its group.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/experiment/TrialRunner.h"
+#include "cedar/processing/experiment/Experiment.h"
+#include "cedar/processing/experiment/Supervisor.h"
+#include "cedar/processing/Group.h"
+#include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/Checkpoint.h"
+#include "cedar/processing/Step.h"
+#include "cedar/processing/exceptions.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/Recorder.h"
+#include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// SYSTEM INCLUDES
+#include <QThreadPool>
+#include <QRunnable>
+#include <QMutexLocker>
+#include <opencv2/core/core.hpp>
+#ifndef Q_MOC_RUN
+  #include <boost/bind.hpp>
+  #include <boost/function.hpp>
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// helpers
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  //! Runs a function on a thread pool.
+  class FunctionRunnable : public QRunnable
+  {
+  public:
+    FunctionRunnable(const boost::function<void()>& function)
+    :
+    mFunction(function)
+    {
+    }
+
+    void run()
+    {
+      this->mFunction();
+    }
+
+  private:
+    boost::function<void()> mFunction;
+  };
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::proc::experiment::TrialRunner::TrialRunner(cedar::proc::experiment::ExperimentPtr experiment)
+:
+mExperiment(experiment),
+mNumberOfWorkers(0),
+mStepSize(0.0 * cedar::unit::seconds),
+mMaximumTrialDuration(10.0 * cedar::unit::seconds),
+mSeed(0),
+mKeepFinalStates(false),
+mCancelled(false),
+mRecorderBufferSize(0)
+{
+  CEDAR_ASSERT(this->mExperiment);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::proc::experiment::TrialRunner::setNumberOfWorkers(unsigned int workers)
+{
+  this->mNumberOfWorkers = workers;
+}
+
+unsigned int cedar::proc::experiment::TrialRunner::getNumberOfWorkers() const
+{
+  return this->mNumberOfWorkers;
+}
+
+void cedar::proc::experiment::TrialRunner::setStepSize(const cedar::unit::Time& stepSize)
+{
+  this->mStepSize = stepSize;
+}
+
+cedar::unit::Time cedar::proc::experiment::TrialRunner::getStepSize() const
+{
+  return this->mStepSize;
+}
+
+void cedar::proc::experiment::TrialRunner::setMaximumTrialDuration(const cedar::unit::Time& duration)
+{
+  this->mMaximumTrialDuration = duration;
+}
+
+cedar::unit::Time cedar::proc::experiment::TrialRunner::getMaximumTrialDuration() const
+{
+  return this->mMaximumTrialDuration;
+}
+
+void cedar::proc::experiment::TrialRunner::setSeed(unsigned int seed)
+{
+  this->mSeed = seed;
+}
+
+unsigned int cedar::proc::experiment::TrialRunner::getSeed() const
+{
+  return this->mSeed;
+}
+
+void cedar::proc::experiment::TrialRunner::setKeepsFinalStates(bool keep)
+{
+  this->mKeepFinalStates = keep;
+}
+
+bool cedar::proc::experiment::TrialRunner::getKeepsFinalStates() const
+{
+  return this->mKeepFinalStates;
+}
+
+void cedar::proc::experiment::TrialRunner::cancel()
+{
+  this->mCancelled = true;
+}
+
+std::vector<cedar::proc::experiment::TrialRunner::TrialResult> cedar::proc::experiment::TrialRunner::run()
+{
+  auto group = this->mExperiment->getGroup();
+  CEDAR_ASSERT(group);
+
+  cedar::unit::Time step_size = this->mStepSize;
+  if (step_size <= 0.0 * cedar::unit::seconds)
+  {
+    // the same choice as in cedar::proc::Group::stepTriggers
+    auto triggers = group->listLoopedTriggers();
+    if (triggers.empty())
+    {
+      CEDAR_THROW
+      (
+        cedar::proc::InvalidObjectException,
+        "The group of experiment \"" + this->mExperiment->getName()
+          + "\" has no looped triggers, so a step size has to be set for running its trials."
+      );
+    }
+
+    step_size = triggers.front()->getSimulatedTimeParameter();
+    for (auto trigger : triggers)
+    {
+      if (trigger->getSimulatedTimeParameter() < step_size)
+      {
+        step_size = trigger->getSimulatedTimeParameter();
+      }
+    }
+  }
+
+  // all copies are made from the state the group and experiment have now
+  this->mGroupConfiguration.clear();
+  group->writeConfiguration(this->mGroupConfiguration);
+  this->mExperimentConfiguration.clear();
+  this->mExperiment->writeConfiguration(this->mExperimentConfiguration);
+
+  auto recorder = cedar::aux::RecorderSingleton::getInstance();
+  this->mRecordedProjectName = recorder->getRecorderProjectName();
+  this->mRecorderBufferSize = recorder->getBufferSize();
+  std::string time_stamp = recorder->getTimeStamp();
+  this->mRecordFolderName = this->mExperiment->getName() + "_" + time_stamp;
+
+  std::vector<TrialResult> results(this->mExperiment->getTrialCount());
+  for (unsigned int trial = 0; trial < results.size(); ++trial)
+  {
+    TrialResult& result = results.at(trial);
+    result.mTrial = trial;
+    result.mSeed = this->mSeed + trial;
+    result.mCompleted = false;
+    result.mEndedByAction = false;
+    result.mDuration = 0.0 * cedar::unit::seconds;
+    result.mNumberOfSteps = 0;
+  }
+
+  cedar::aux::LogSingleton::getInstance()->message
+  (
+    "Running " + cedar::aux::toString(results.size()) + " trials of experiment \"" + this->mExperiment->getName()
+      + "\" concurrently. Timestamp: " + time_stamp,
+    CEDAR_CURRENT_FUNCTION_NAME
+  );
+
+  this->mCancelled = false;
+
+  // a pool of its own, so that the trials do not take the threads of the global pool from the steps; by default, it
+  // has one thread per core
+  QThreadPool pool;
+  if (this->mNumberOfWorkers > 0)
+  {
+    pool.setMaxThreadCount(static_cast<int>(this->mNumberOfWorkers));
+  }
+
+  for (auto& result : results)
+  {
+    pool.start
+    (
+      new FunctionRunnable
+      (
+        boost::bind(&cedar::proc::experiment::TrialRunner::runTrial, this, boost::ref(result), step_size)
+      )
+    );
+  }
+  pool.waitForDone();
+
+  return results;
+}
+
+void cedar::proc::experiment::TrialRunner::runTrial(TrialResult& result, const cedar::unit::Time& stepSize)
+{
+  if (this->mCancelled)
+  {
+    return;
+  }
+
+  try
+  {
+    // everything the trial accesses through these singletons belongs to the trial; the clock only advances with the
+    // steps of the trial
+    auto clock = cedar::aux::GlobalClockSingleton::createIsolatedInstance();
+    clock->setLockstep(true);
+    cedar::aux::GlobalClockSingleton::ThreadScope clock_scope(clock);
+
+    auto recorder = cedar::aux::RecorderSingleton::createIsolatedInstance();
+    recorder->setRecordedProjectName(this->mRecordedProjectName);
+    recorder->setBufferSize(this->mRecorderBufferSize);
+    cedar::aux::RecorderSingleton::ThreadScope recorder_scope(recorder);
+
+    cedar::proc::experiment::SupervisorSingleton::ThreadScope supervisor_scope
+    (
+      cedar::proc::experiment::SupervisorSingleton::createIsolatedInstance()
+    );
+
+    // chains must not leave the trial's thread: they would not see the scopes above, and they could still be running
+    // when the actions are evaluated or the copy is destroyed
+    cedar::proc::Step::SynchronousChainScope synchronous_chains;
+
+    // cv::theRNG is local to the thread; steps draw from it rather than from the process-wide rand()
+    cv::theRNG().state = result.mSeed;
+
+    // declared after the scopes, so that the copies are destroyed while they still see the trial's recorder
+    cedar::proc::GroupPtr group;
+    cedar::proc::experiment::ExperimentPtr experiment;
+    {
+      QMutexLocker locker(&this->mCopyLock);
+      group = cedar::proc::GroupPtr(new cedar::proc::Group());
+      group->readConfiguration(this->mGroupConfiguration);
+      experiment = cedar::proc::experiment::ExperimentPtr(new cedar::proc::experiment::Experiment(group));
+      experiment->readConfiguration(this->mExperimentConfiguration);
+      for (auto action_sequence : experiment->getActionSequences())
+      {
+        action_sequence->setExperiment(experiment);
+      }
+    }
+
+    // the trials already keep the cores busy; besides, listeners dispatched to the pool would not see the trial's scopes
+    for (auto trigger : group->listLoopedTriggers(true))
+    {
+      trigger->setParallelDispatchEnabled(false);
+    }
+
+    experiment->mCurrentTrial = result.mTrial;
+    experiment->mRecordFolderName = this->mRecordFolderName;
+    experiment->preExperiment();
+    experiment->prepareTrial();
+
+    while (experiment->trialIsRunning())
+    {
+      if (this->mCancelled || clock->getTime() >= this->mMaximumTrialDuration)
+      {
+        experiment->stopTrial(cedar::proc::experiment::Experiment::ResetType::None, false);
+        break;
+      }
+
+      group->stepTriggers(stepSize);
+      ++result.mNumberOfSteps;
+      experiment->executeActionSequences();
+    }
+
+    result.mDuration = clock->getTime();
+    result.mEndedByAction = !this->mCancelled && result.mDuration < this->mMaximumTrialDuration;
+    result.mCompleted = !this->mCancelled;
+
+    if (recorder->hasDataToRecord())
+    {
+      result.mRecordingDirectory = recorder->getOutputDirectory();
+    }
+
+    if (this->mKeepFinalStates)
+    {
+      result.mFinalState = cedar::proc::CheckpointPtr(new cedar::proc::Checkpoint());
+      group->writeCheckpoint(*result.mFinalState);
+    }
+  }
+  catch (cedar::aux::ExceptionBase& exc)
+  {
+    result.mError = exc.exceptionInfo();
+  }
+  catch (std::exception& exc)
+  {
+    result.mError = exc.what();
+  }
+
+  if (!result.mError.empty())
+  {
+    cedar::aux::LogSingleton::getInstance()->error
+    (
+      "Trial " + cedar::aux::toString(result.mTrial) + " failed: " + result.mError,
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+  }
+}
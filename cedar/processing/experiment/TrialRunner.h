@@ -0,0 +1,217 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        TrialRunner.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Runs the trials of an experiment concurrently on isolated copies of its group.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_PROC_EXPERIMENT_TRIAL_RUNNER_H
+#define CEDAR_PROC_EXPERIMENT_TRIAL_RUNNER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Configurable.h"
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/processing/Checkpoint.fwd.h"
+#include "cedar/processing/experiment/Experiment.fwd.h"
+#include "cedar/processing/experiment/TrialRunner.fwd.h"
+
+// SYSTEM INCLUDES
+#include <QMutex>
+#include <atomic>
+#include <string>
+#include <vector>
+
+
+/*!@brief Runs the trials of an experiment concurrently, each on its own copy of the experiment's group.
+ *
+ *        Every trial gets a copy of the group and of the experiment, its own clock, recorder and supervisor, and its
+ *        own seed for the random number generators. The trials are run on a pool with a bounded number of worker
+ *        threads; at most one copy per worker exists at any time.
+ *
+ *        Instead of starting the looped triggers of its copy, a trial steps them in its worker thread with a fixed
+ *        step size, and evaluates the action sequences of the experiment after every step. The trial's clock only
+ *        advances with these steps, so a trial ends when one of its actions ends it, or when its simulated time
+ *        reaches the maximum trial duration. Recordings of trial n go to the "Trial_n" subfolder of the experiment's
+ *        record folder, as in sequential experiments.
+ *
+ *        The shared singletons are replaced in the trial's thread by means of cedar::aux::Singleton::ThreadScope. All
+ *        steps of a trial, including the chains triggered by its looped steps, are computed in the trial's thread
+ *        (see cedar::proc::Step::SynchronousChainScope), so they all see the trial's singletons and random number
+ *        generators, and the action sequences only ever see fully computed steps.
+ */
+class cedar::proc::experiment::TrialRunner
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Describes the outcome of one trial.
+  struct TrialResult
+  {
+    //! Number of the trial, starting at zero.
+    unsigned int mTrial;
+    //! Seed of the random number generators of the trial.
+    unsigned int mSeed;
+    //! Whether the trial was run until its end; false if it was cancelled or failed.
+    bool mCompleted;
+    //! Whether the trial was ended by an action rather than by reaching the maximum trial duration.
+    bool mEndedByAction;
+    //! Simulated time at the end of the trial.
+    cedar::unit::Time mDuration;
+    //! Number of times the triggers of the group were stepped.
+    unsigned int mNumberOfSteps;
+    //! Directory the recordings of the trial were written to; empty if nothing was recorded.
+    std::string mRecordingDirectory;
+    //! Activations, weights and buffers of all steps at the end of the trial, if final states are kept.
+    cedar::proc::CheckpointPtr mFinalState;
+    //! Description of the error that aborted the trial; empty if there was none.
+    std::string mError;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief Creates a runner for the trials of the given experiment.
+  TrialRunner(cedar::proc::experiment::ExperimentPtr experiment);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Sets the number of trials run at the same time. Zero, the default, uses one worker per core.
+  void setNumberOfWorkers(unsigned int workers);
+
+  //! Returns the number of trials run at the same time; zero means one worker per core.
+  unsigned int getNumberOfWorkers() const;
+
+  //! Sets the time by which the triggers are stepped. Zero, the default, uses the shortest step size of the triggers.
+  void setStepSize(const cedar::unit::Time& stepSize);
+
+  //! Returns the time by which the triggers are stepped; zero means the shortest step size of the triggers.
+  cedar::unit::Time getStepSize() const;
+
+  //! Sets the simulated time after which trials that have not been ended by an action are stopped.
+  void setMaximumTrialDuration(const cedar::unit::Time& duration);
+
+  //! Returns the simulated time after which trials that have not been ended by an action are stopped.
+  cedar::unit::Time getMaximumTrialDuration() const;
+
+  //! Sets the seed of the first trial; each further trial uses the next higher seed.
+  void setSeed(unsigned int seed);
+
+  //! Returns the seed of the first trial.
+  unsigned int getSeed() const;
+
+  //! Sets whether the matrices of all steps are stored in the result of each trial after it has ended.
+  void setKeepsFinalStates(bool keep);
+
+  //! Returns whether the matrices of all steps are stored in the result of each trial after it has ended.
+  bool getKeepsFinalStates() const;
+
+  /*!@brief Runs all trials of the experiment and returns their results, ordered by trial number.
+   *
+   *        Blocks until all trials have ended. Repetition of the experiment is not supported; the experiment's trial
+   *        count determines the number of trials.
+   */
+  std::vector<TrialResult> run();
+
+  /*!@brief Cancels a call to run from another thread.
+   *
+   *        Running trials are stopped after their current step; trials that have not started yet are skipped.
+   */
+  void cancel();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Runs one trial on a new copy of the group; called by the workers.
+  void runTrial(TrialResult& result, const cedar::unit::Time& stepSize);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! The experiment whose trials are run.
+  cedar::proc::experiment::ExperimentPtr mExperiment;
+
+  //! Number of trials run at the same time; zero means one per core.
+  unsigned int mNumberOfWorkers;
+
+  //! Time by which the triggers are stepped; zero means the shortest step size of the triggers.
+  cedar::unit::Time mStepSize;
+
+  //! Simulated time after which trials are stopped.
+  cedar::unit::Time mMaximumTrialDuration;
+
+  //! Seed of the first trial.
+  unsigned int mSeed;
+
+  //! Whether the final states of the trials are kept.
+  bool mKeepFinalStates;
+
+  //! Set to stop the trials of the current run.
+  std::atomic<bool> mCancelled;
+
+  //! Configuration of the group the copies are made from.
+  cedar::aux::ConfigurationNode mGroupConfiguration;
+
+  //! Configuration of the experiment the copies are made from.
+  cedar::aux::ConfigurationNode mExperimentConfiguration;
+
+  //! Settings of the shared recorder that are passed on to the recorders of the trials.
+  std::string mRecordedProjectName;
+  unsigned int mRecorderBufferSize;
+
+  //! Folder the recordings of the current run are written to; the trials write to subfolders of it.
+  std::string mRecordFolderName;
+
+  //! Reading configurations accesses shared registries, so the copies are made one at a time.
+  QMutex mCopyLock;
+
+}; // class cedar::proc::experiment::TrialRunner
+
+#endif // CEDAR_PROC_EXPERIMENT_TRIAL_RUNNER_H
@@ -48,6 +48,7 @@
 #include "cedar/processing/gui/AdvancedParameterLinker.h"
 #include "cedar/processing/gui/ArchitectureConsistencyCheck.h"
 #include "cedar/processing/gui/PerformanceOverview.h"
+#include "cedar/auxiliaries/Tracer.h"
 #include "cedar/processing/gui/BoostControl.h"
 #include "cedar/processing/gui/Scene.h"
 #include "cedar/processing/gui/Settings.h"
@@ -97,6 +98,7 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/algorithm/string.hpp>
+#include <sstream>
 
 #ifndef Q_MOC_RUN
   #if (BOOST_VERSION / 100000 < 2 && BOOST_VERSION / 100 % 1000 < 61) 
@@ -548,6 +550,8 @@ void cedar::proc::gui::Ide::init(bool loadDefaultPlugins, bool redirectLogToGui,
   QObject::connect(mpActionExperiments, SIGNAL(triggered()), this, SLOT(showExperimentDialog()));
 
   QObject::connect(mpActionPerformanceOverview, SIGNAL(triggered()), this->mpPerformanceOverview, SLOT(show()));
+  QObject::connect(mpActionRecordTrace, SIGNAL(toggled(bool)), this, SLOT(toggleTracing(bool)));
+  QObject::connect(mpActionExportTrace, SIGNAL(triggered()), this, SLOT(exportTrace()));
   QObject::connect(mpActionParameterLinker, SIGNAL(triggered()), this, SLOT(openParameterLinker()));
   QObject::connect(mpActionDataSlotPositioning, SIGNAL(triggered()), this, SLOT(toggleDataSlotPositioning()));
 
@@ -1018,6 +1022,60 @@ void cedar::proc::gui::Ide::exportSvg()
   }
 }
 
+void cedar::proc::gui::Ide::toggleTracing(bool enabled)
+{
+  auto tracer = cedar::aux::TracerSingleton::getInstance();
+  if (enabled)
+  {
+    tracer->clear();
+  }
+  tracer->setEnabled(enabled);
+}
+
+void cedar::proc::gui::Ide::exportTrace()
+{
+  cedar::aux::DirectoryParameterPtr last_dir = cedar::proc::gui::SettingsSingleton::getInstance()->lastArchitectureExportDialogDirectory();
+
+  QString file = QFileDialog::getSaveFileName(this, // parent
+                                              "Select where to export the trace", // caption
+                                              last_dir->getValue().absolutePath(), // initial directory;
+                                              "chrome trace (*.json)", // filter(s), separated by ';;'
+                                              0,
+                                              // js: Workaround for freezing file dialogs in QT5 (?)
+                                              QFileDialog::DontUseNativeDialog
+                                              );
+
+  if (!file.isEmpty())
+  {
+    if (!file.endsWith(".json"))
+    {
+      file += ".json";
+    }
+
+    auto tracer = cedar::aux::TracerSingleton::getInstance();
+    try
+    {
+      tracer->writeChromeTrace(file.toStdString());
+    }
+    catch (const cedar::aux::FileNotFoundException& e)
+    {
+      cedar::aux::LogSingleton::getInstance()->error(e.getMessage(), "cedar::proc::gui::Ide::exportTrace()");
+      return;
+    }
+
+    std::stringstream statistics;
+    tracer->writeStatistics(statistics);
+    cedar::aux::LogSingleton::getInstance()->message
+    (
+      "Trace written to " + file.toStdString() + ".\n" + statistics.str(),
+      "cedar::proc::gui::Ide::exportTrace()"
+    );
+
+    QString path = file.remove(file.lastIndexOf(QDir::separator()), file.length());
+    last_dir->setValue(path);
+  }
+}
+
 void cedar::proc::gui::Ide::duplicateSelected()
 {
   //!@todo Doesn't this code belong into scene?
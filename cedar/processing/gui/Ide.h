@@ -230,6 +230,14 @@ public slots:
    */
   void exportSvg();
 
+  //!@brief Starts or stops recording a trace of the processing.
+  void toggleTracing(bool enabled);
+
+  /*!@brief Opens a dialog that lets the user export the recorded trace in the chrome trace format. Statistics of the
+   *        trace are written to the log.
+   */
+  void exportTrace();
+
   /*!@brief Opens a dialog that contains the robot manager widget.
    */
   void showRobotManager();
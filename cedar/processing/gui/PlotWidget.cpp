@@ -42,10 +42,13 @@
 #include "cedar/processing/exceptions.h"
 #include "cedar/processing/Group.h"
 #include "cedar/processing/gui/Settings.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
 
 
 // SYSTEM INCLUDES
 #include <boost/make_shared.hpp>
+#include <QTimer>
 #ifdef CEDAR_USE_QT5
     #include <QSizeGrip>
 #else
@@ -73,6 +76,7 @@ mpData(pData),
 mpPlotData(pPlotData),
 mTitle(pLabel.toStdString()),
 mpLabel(new QLabel(pLabel)),
+mpConversionTimeLabel(new QLabel()),
 mGridMinimumHeight(150),
 mGridMinimumWidth(200)
 {
@@ -106,9 +110,29 @@ mGridMinimumWidth(200)
   this->mpTitleLayout->addWidget(this->mpPlotSelector);
   this->mpTitleLayout->addWidget(this->mpLabel);
 
+  this->mpConversionTimeLabel->setAlignment(Qt::AlignRight | Qt::AlignVCenter);
+  this->mpConversionTimeLabel->setToolTip("Average time the plot takes to convert its data for display.");
+  this->mpTitleLayout->addWidget(this->mpConversionTimeLabel);
+  auto p_timer = new QTimer(this);
+  QObject::connect(p_timer, SIGNAL(timeout()), this, SLOT(updateConversionTime()));
+  p_timer->start(1000);
+
   this->openPlotFromDeclaration(declarationToUse);
 };
 
+void cedar::proc::gui::PlotWidgetPrivate::LabeledPlot::updateConversionTime()
+{
+  if (this->mpPlotter == nullptr || !this->mpPlotter->hasConversionTimeMeasurement())
+  {
+    this->mpConversionTimeLabel->clear();
+    return;
+  }
+
+  double milliseconds
+    = this->mpPlotter->getConversionTimeAverage() / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds);
+  this->mpConversionTimeLabel->setText(QString::number(milliseconds, 'f', 2) + " ms");
+}
+
 void cedar::proc::gui::PlotWidgetPrivate::LabeledPlot::openPlotFromDeclaration(const std::string& declarationToFind)
 {
   // first, check if there are any declarations for the data at all
@@ -157,6 +181,7 @@ void cedar::proc::gui::PlotWidgetPrivate::LabeledPlot::openPlotFromDeclaration(c
 
     this->mpPlotContainer->layout()->removeWidget(this->mpPlotter);
     delete this->mpPlotter;
+    this->mpPlotter = nullptr;
   }
 
   // clear all remaining widgets from the plot container
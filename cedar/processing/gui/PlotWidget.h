@@ -104,6 +104,9 @@ namespace cedar
 
           void openSpecificPlot();
 
+          //! Shows how long the plot takes to convert its data.
+          void updateConversionTime();
+
         public:
           // members
           cedar::aux::gui::ConstPlotDeclarationPtr mpPlotDeclaration;
@@ -118,6 +121,7 @@ namespace cedar
 
           std::map<cedar::aux::ConstDataPtr, const std::string> mMultiPlotData;
           QLabel* mpLabel;
+          QLabel* mpConversionTimeLabel;
 
         private:
           int mGridMinimumHeight;
@@ -49,6 +49,7 @@
 #include "cedar/processing/gui/PropertyPane.h"
 #include "cedar/processing/DataSlot.h"
 #include "cedar/processing/Step.h"
+#include "cedar/processing/Trigger.h"
 #include "cedar/processing/steps/Component.h"
 #include "cedar/processing/steps/ShapeVisualisation.h"
 #include "cedar/devices/KinematicChain.h"
@@ -261,6 +262,15 @@ void cedar::proc::gui::StepItem::updateToolTip()
     tool_tip += "</tr>";
   }
 
+  // the trigger chain measurement broken down by the levels of the chain; only averages are kept for these
+  for (const auto& level_time_pair : step->getFinishedTrigger()->getLevelTimeMeasurementAverages())
+  {
+    QString measurement_str = "<tr><td></td><td>chain level %1</td><td align=\"right\">-</td>"
+                              "<td align=\"right\">%2</td></tr>";
+    double avg_d = level_time_pair.second / (0.001 * cedar::unit::seconds);
+    tool_tip += measurement_str.arg(level_time_pair.first).arg(QString("%1 ms").arg(avg_d, 0, 'f', 1));
+  }
+
   tool_tip += "</table>";
 
   const auto& annotation = this->getStep()->getStateAnnotation();
@@ -45,6 +45,7 @@
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/version.h"
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/SharedMemoryChannel.h"
 
 // SYSTEM INCLUDES
 #include <QReadLocker>
@@ -74,7 +75,8 @@ namespace
     input_declaration->setIconPath(":/steps/local_writer.svg");
     input_declaration->setDescription("Forwards a tensor to a "
                           "'LocalReader' step inside the same local "
-                          "cedar instance. "
+                          "cedar instance, or, via shared memory, to "
+                          "other cedar instances on the same machine. "
                           "See also the LocalReader step.");
 
     input_declaration->declare();
@@ -89,17 +91,14 @@ namespace
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
 
-QReadWriteLock *cedar::proc::sinks::LocalWriter::mpDataLock= NULL;
-
 cedar::proc::sinks::LocalWriter::LocalWriter()
 :
 cedar::proc::Step(true),
 // outputs
 mInput(new cedar::aux::MatData(cv::Mat())),
-_mPort(new cedar::aux::StringParameter(this, "port", "default local port"))
+_mPort(new cedar::aux::StringParameter(this, "port", "default local port")),
+_mSharedMemory(new cedar::aux::BoolParameter(this, "shared memory", false))
 {
-  cedar::proc::sinks::LocalWriter::mpDataLock= new QReadWriteLock();
-
   // declare all data
   this->declareInput("input");
   _mPort->setValidator(boost::bind(&cedar::proc::sinks::LocalWriter::validatePortName, this, _1));
@@ -111,6 +110,7 @@ _mPort(new cedar::aux::StringParameter(this, "port", "default local port"))
 void cedar::proc::sinks::LocalWriter::onStart()
 {
   _mPort->setConstant(true);
+  _mSharedMemory->setConstant(true);
     if("" != oldName && oldName != _mPort->getValue())
     {
         if(getPortCount(oldName) > 0)
@@ -119,7 +119,7 @@ void cedar::proc::sinks::LocalWriter::onStart()
         }
         oldName = "";
     }
-    if("" != _mPort->getValue())
+    if("" != _mPort->getValue() && !_mSharedMemory->getValue())
     {
         this->setMatrix( _mPort->getValue(), this->mInput->getData() );
         oldName = _mPort->getValue();
@@ -130,12 +130,21 @@ void cedar::proc::sinks::LocalWriter::onStart()
 
 void cedar::proc::sinks::LocalWriter::connect()
 {
+  this->mSharedMemoryChannel.reset();
 
+  if (this->_mSharedMemory->getValue() && "" != _mPort->getValue())
+  {
+    this->mSharedMemoryChannel.reset
+    (
+      new cedar::aux::SharedMemoryChannel(_mPort->getValue(), cedar::aux::SharedMemoryChannel::ROLE_WRITER)
+    );
+  }
 }
 
 void cedar::proc::sinks::LocalWriter::onStop()
 {
   _mPort->setConstant(false);
+  _mSharedMemory->setConstant(false);
 }
 
 void cedar::proc::sinks::LocalWriter::reset()
@@ -150,6 +159,14 @@ void cedar::proc::sinks::LocalWriter::compute(const cedar::proc::Arguments&)
         this->setState(cedar::proc::Step::STATE_EXCEPTION, "Local port name is empty!");
         //CEDAR_THROW(cedar::aux::InvalidNameException, "Local port name is empty!");
     }
+    else if (this->_mSharedMemory->getValue())
+    {
+      if (!this->mSharedMemoryChannel || this->mSharedMemoryChannel->getName() != _mPort->getValue())
+      {
+        this->connect();
+      }
+      this->mSharedMemoryChannel->write(this->mInput->getData());
+    }
     else
     {
       this->setMatrix( _mPort->getValue(), this->mInput->getData() );
@@ -206,22 +223,40 @@ void cedar::proc::sinks::LocalWriter::validatePortName(const std::string& portNa
 
 void cedar::proc::sinks::LocalWriter::setMatrix(const std::string &key, const cv::Mat &mat)
 {
-  QWriteLocker lock( mpDataLock );
-  accessData()[ key ]= mat.clone();
+  QWriteLocker lock( &accessDataLock() );
+  // copying reuses the stored matrix' memory if its size and type do not change; readers only get copies of it
+  mat.copyTo(accessData()[ key ]);
 }
 
 cv::Mat cedar::proc::sinks::LocalWriter::getMatrix(const std::string &key)
 {
-  QReadLocker lock( mpDataLock ); // locking for multi-threaded writers/readers
-  auto res= accessData()[ key ];
+  QReadLocker lock( &accessDataLock() ); // locking for multi-threaded writers/readers
+  auto iter = accessData().find( key );
+  if (iter == accessData().end())
+  {
+    return cv::Mat();
+  }
+
+  return iter->second.clone(); // cloning is important since the cv::Mats share
+                               // their memory
+}
+
+bool cedar::proc::sinks::LocalWriter::readMatrix(const std::string &key, cv::Mat &target)
+{
+  QReadLocker lock( &accessDataLock() );
+  auto iter = accessData().find( key );
+  if (iter == accessData().end())
+  {
+    return false;
+  }
 
-  return res.clone(); // cloning is important since the cv::Mats share 
-                      // their memory
+  iter->second.copyTo(target);
+  return true;
 }
 
 unsigned int cedar::proc::sinks::LocalWriter::getPortCount(const std::string &key)
 {
-  QReadLocker lock( mpDataLock );
+  QReadLocker lock( &accessDataLock() );
   return accessData().count( key );
 }
 
@@ -43,14 +43,21 @@
 #include "cedar/processing/Step.h"
 #include "cedar/auxiliaries/StringParameter.h"
 #include "cedar/auxiliaries/NumericParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/MatData.h"
 
 // FORWARD DECLARATIONS
+#include "cedar/auxiliaries/SharedMemoryChannel.fwd.h"
 #include "cedar/processing/sinks/LocalWriter.fwd.h"
 
 // SYSTEM INCLUDES
 
-/*!@brief A step which sends matrices locally  */
+/*!@brief A step which sends matrices locally
+ *
+ *        By default, matrices are sent to LocalReaders in the same process. If the "shared memory" parameter is set,
+ *        they are published through a shared memory segment instead (see cedar::aux::SharedMemoryChannel), so
+ *        LocalReaders in other processes on the same machine can read them.
+ */
 class cedar::proc::sinks::LocalWriter : public cedar::proc::Step
 {
   //--------------------------------------------------------------------------------------------------------------------
@@ -125,19 +132,35 @@ protected:
   cedar::aux::ConstMatDataPtr mInput;
   std::string oldName = "";
 
+  //! Channel used for publishing the input if shared memory is used.
+  cedar::aux::SharedMemoryChannelPtr mSharedMemoryChannel;
+
 public:
   static cv::Mat getMatrix(const std::string &key);
   static void setMatrix(const std::string &key, const cv::Mat &mat);
   static unsigned int getPortCount(const std::string &key);
 
+  /*! Copies the matrix of the given port into target, reallocating target only if its size or type differs.
+   *
+   *  @returns False, if there is no such port.
+   */
+  static bool readMatrix(const std::string &key, cv::Mat &target);
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
 private:
   cedar::aux::StringParameterPtr _mPort;
 
+  //! Whether the matrix is published via shared memory rather than within the process.
+  cedar::aux::BoolParameterPtr _mSharedMemory;
+
   // locking for thread safety
-  static QReadWriteLock *mpDataLock;
+  static QReadWriteLock& accessDataLock()
+  {
+    static QReadWriteLock lock;
+    return lock;
+  }
 
   static std::map<std::string, cv::Mat>& accessData()
   {
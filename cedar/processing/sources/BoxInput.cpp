@@ -96,6 +96,8 @@ _mLeftBounds(new cedar::aux::UIntVectorParameter(this, "left bounds", 2, 0, 0, 1
 _mReferenceLevel(new cedar::aux::DoubleParameter(this, "reference level", 0.0))
 {
   this->declareOutput("box input", mOutput);
+  // the output only depends on the parameters, so there is no need to recompute it while they stay the same
+  this->setSkipUnchangedComputes(true);
   QObject::connect(_mAmplitude.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
   QObject::connect(_mReferenceLevel.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
   QObject::connect(_mWidths.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
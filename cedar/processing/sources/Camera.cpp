@@ -200,7 +200,8 @@ void cedar::proc::sources::Camera::compute(const cedar::proc::Arguments&)
   if (this->getCameraGrabber()->isCreated())
   {
     this->getCameraGrabber()->grab();
-    this->mImage->setData(this->getCameraGrabber()->getImage().clone());
+    // the grabber doesn't overwrite frames that are still referenced, so there is no need to copy it
+    this->mImage->setData(this->getCameraGrabber()->getImage());
   }
 }
 
@@ -91,6 +91,8 @@ _mSizes(new cedar::aux::UIntVectorParameter(this, "sizes", 2, 50, 1, 1000.0)),
 _mConst(new cedar::aux::DoubleParameter(this, "value", 1.0))
 {
   this->declareOutput("matrix", mOutput);
+  // the output only depends on the parameters, so there is no need to recompute it while they stay the same
+  this->setSkipUnchangedComputes(true);
 
   QObject::connect(_mConst.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
   QObject::connect(_mSizes.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrixSize()));
@@ -99,6 +99,8 @@ _mSigmas(new cedar::aux::DoubleVectorParameter(this, "sigma", 2, 3.0, 0.01, 1000
 _mIsCyclic(new cedar::aux::BoolParameter(this, "cyclic", false))
 {
   this->declareOutput("Gauss input", mOutput);
+  // the output only depends on the parameters, so there is no need to recompute it while they stay the same
+  this->setSkipUnchangedComputes(true);
   QObject::connect(_mAmplitude.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
   QObject::connect(_mSigmas.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
   QObject::connect(_mCenters.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrix()));
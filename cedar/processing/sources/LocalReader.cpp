@@ -46,6 +46,7 @@
 #include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/net/exceptions.h"
+#include "cedar/auxiliaries/SharedMemoryChannel.h"
 #include "cedar/version.h"
 
 // SYSTEM INCLUDES
@@ -73,8 +74,9 @@ namespace
     );
     declaration->setIconPath(":/steps/local_reader.svg");
     declaration->setDescription("Reads a tensor that was sent from a "
-                    "'LocalWriter' inside the same local cedar instance. "
-                    "See also the "
+                    "'LocalWriter' inside the same local cedar instance, "
+                    "or, via shared memory, from another cedar instance "
+                    "on the same machine. See also the "
                     "LocalWriter step.");
 
     declaration->declare();
@@ -93,7 +95,8 @@ cedar::proc::sources::LocalReader::LocalReader()
 cedar::proc::Step(true),
 mOutput(new cedar::aux::MatData(cv::Mat())),
 // parameters
-_mPort(new cedar::aux::StringParameter(this, "port", "default local port"))
+_mPort(new cedar::aux::StringParameter(this, "port", "default local port")),
+_mSharedMemory(new cedar::aux::BoolParameter(this, "shared memory", false))
 {
   // declare all data
   this->declareOutput("output", mOutput);
@@ -125,17 +128,28 @@ void cedar::proc::sources::LocalReader::emitOutputPropertiesChangedSignalOnActio
 
 void cedar::proc::sources::LocalReader::connect()
 {
+  this->mSharedMemoryChannel.reset();
+
+  if (this->_mSharedMemory->getValue() && "" != _mPort->getValue())
+  {
+    this->mSharedMemoryChannel.reset
+    (
+      new cedar::aux::SharedMemoryChannel(_mPort->getValue(), cedar::aux::SharedMemoryChannel::ROLE_READER)
+    );
+  }
 }
 
 void cedar::proc::sources::LocalReader::onStart()
 {
   this->_mPort->setConstant(true);
+  this->_mSharedMemory->setConstant(true);
   this->connect();
 }
 
 void cedar::proc::sources::LocalReader::onStop()
 {
   this->_mPort->setConstant(false);
+  this->_mSharedMemory->setConstant(false);
 }
 
 void cedar::proc::sources::LocalReader::compute(const cedar::proc::Arguments&)
@@ -145,22 +159,41 @@ void cedar::proc::sources::LocalReader::compute(const cedar::proc::Arguments&)
         this->setState(cedar::proc::Step::STATE_EXCEPTION, "Local port name is empty!");
         //CEDAR_THROW(cedar::aux::InvalidNameException, "Local port name is empty!");
     }
-  else if(cedar::proc::sinks::LocalWriter::getPortCount( _mPort->getValue() ) > 0)
+  else if (this->_mSharedMemory->getValue())
   {
-    cv::Mat old = this->mOutput->getData();
-
-    cv::Mat read = cedar::proc::sinks::LocalWriter::getMatrix( _mPort->getValue() );
+    if (!this->mSharedMemoryChannel || this->mSharedMemoryChannel->getName() != _mPort->getValue())
+    {
+      this->connect();
+    }
 
-    bool changed = (old.type() != read.type() || old.size != read.size);
-    this->mOutput->setData(read.clone());
-    if (changed)
+    // the matrix is read directly into the output; this keeps the old header around to detect changes in size/type
+    cv::Mat old = this->mOutput->getData();
+    if (this->mSharedMemoryChannel->read(this->mOutput->getData()))
     {
-      this->emitOutputPropertiesChangedSignal("output");
+      const cv::Mat& read = this->mOutput->getData();
+      if (old.type() != read.type() || old.size != read.size)
+      {
+        this->emitOutputPropertiesChangedSignal("output");
+      }
     }
   }
   else
   {
+    cv::Mat old = this->mOutput->getData();
+
+    // copy directly into the output; its memory is reused as long as the size and type do not change
+    if (cedar::proc::sinks::LocalWriter::readMatrix( _mPort->getValue(), this->mOutput->getData() ))
+    {
+      const cv::Mat& read = this->mOutput->getData();
+      if (old.type() != read.type() || old.size != read.size)
+      {
+        this->emitOutputPropertiesChangedSignal("output");
+      }
+    }
+    else
+    {
       this->setState(cedar::proc::Step::STATE_EXCEPTION, "Local port does not exist!");
       //CEDAR_THROW(cedar::aux::InvalidNameException, "Local port does not exist!");
+    }
   }
 }
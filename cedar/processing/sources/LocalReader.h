@@ -43,9 +43,11 @@
 #include "cedar/processing/Step.h"
 #include "cedar/auxiliaries/StringParameter.h"
 #include "cedar/auxiliaries/NumericParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/MatData.h"
 
 // FORWARD DECLARATIONS
+#include "cedar/auxiliaries/SharedMemoryChannel.fwd.h"
 #include "cedar/processing/sources/LocalReader.fwd.h"
 
 // SYSTEM INCLUDES
@@ -117,6 +119,9 @@ private:
 protected:
   //!@brief The data containing the output.
   cedar::aux::MatDataPtr mOutput;
+
+  //! Channel used for reading the matrix if shared memory is used.
+  cedar::aux::SharedMemoryChannelPtr mSharedMemoryChannel;
 private:
 
 
@@ -126,6 +131,9 @@ private:
 private:
   cedar::aux::StringParameterPtr _mPort;
 
+  //! Whether the matrix is read from shared memory rather than from within the process.
+  cedar::aux::BoolParameterPtr _mSharedMemory;
+
 }; // class cedar::proc::sources::LocalReader
 
 #endif // CEDAR_LOCAL_READER_STEP_H
@@ -103,6 +103,8 @@ _mSigmaR(new cedar::aux::DoubleParameter(this, "sigma r", 100.0, cedar::aux::Dou
 {
   // output
   this->declareOutput("spatial pattern", mPattern);
+  // the output only depends on the parameters, so there is no need to recompute it while they stay the same
+  this->setSkipUnchangedComputes(true);
 
   QObject::connect(_mSizeX.get(), SIGNAL(valueChanged()), this, SLOT(recompute()));
   QObject::connect(_mSizeY.get(), SIGNAL(valueChanged()), this, SLOT(recompute()));
@@ -422,24 +422,12 @@ void cedar::proc::steps::Component::compute(const cedar::proc::Arguments&)
   for (const auto& measurement : measurements)
   {
     std::string name = component->getNameForMeasurementType(measurement);
-    if(auto measurementDataOriginal = component->getMeasurementData(measurement))
+    auto output = mOutputs.find(name);
+    if (output != mOutputs.end() && output->second)
     {
-//      auto measurementData = measurementDataOriginal; // There was a clone here that seemed unneccesary and only caused a crash on windows.
-      if (auto measurementData = boost::dynamic_pointer_cast<const cedar::aux::MatData>(measurementDataOriginal))
-      {
-        QReadLocker measurementLocker(&measurementData->getLock());
-
-        if (!measurementData) // test again after the lock
-          continue;
-
-        cv::Mat measurementMat = measurementData->getData().clone();
-        measurementLocker.unlock();
-        std::string name = component->getNameForMeasurementType(measurement);
-        if(auto outPutPtr = mOutputs.at(name))
-        {
-          outPutPtr->setData(measurementMat);
-        }
-      }
+      // reads the newest measurement without locking anything the component's communication thread uses
+      component->readUserSideMeasurementSample(measurement, this->mMeasurementSample);
+      this->mMeasurementSample.mData.copyTo(output->second->getData());
     }
   }
 //
@@ -43,6 +43,7 @@
 // CEDAR INCLUDES
 #include "cedar/processing/Step.h"
 #include "cedar/devices/ComponentParameter.h"
+#include "cedar/devices/SampleExchange.h"
 #include "cedar/auxiliaries/gui/Parameter.h"
 #include "cedar/auxiliaries/ParameterTemplate.h"
 #include "cedar/auxiliaries/MatData.h"
@@ -208,6 +209,9 @@ private:
 
   std::map<std::string, cedar::aux::MatDataPtr>  mOutputs;
 
+  //! Buffer into which measurements are read before they are copied to the outputs.
+  cedar::dev::SampleExchange::Sample mMeasurementSample;
+
   bool mInitConfigHasBeenApplied;
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
@@ -46,7 +46,7 @@
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/convolution/Convolution.h"
-#include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/convolution/AutoTuning.h"
 
 // SYSTEM INCLUDES
 #include <iostream>
@@ -76,7 +76,8 @@ namespace
                         "Convolution can be done with to different engines: OpenCV and FFTW. "
                         "The OpenCV engine provides Convolution with three modes: Full, same, and valid. "
                         "Also the border handling can be set as: Cyclic, zero-filled, mirrowed, and replicate. "
-                        "The FFTW engine only provides cyclic border handling with mode same.\n\n"
+                        "The FFTW engine only provides cyclic border handling with mode same. "
+                        "The AutoTuning engine times the other engines and uses the fastest one.\n\n"
                         "The step can either use an kernel matrix (input) to perform the convolution, or it can use "
                         " a list of kernels set via parameters."
                       );
@@ -300,7 +301,7 @@ void cedar::proc::steps::Convolution::inputDimensionalityChanged()
   #ifdef CEDAR_USE_FFTW
   if (new_dimensionality >= 3)
   {
-    this->mConvolution->setEngine(cedar::aux::conv::FFTWPtr(new cedar::aux::conv::FFTW()));
+    this->mConvolution->setEngine(cedar::aux::conv::AutoTuningPtr(new cedar::aux::conv::AutoTuning()));
   }
 #endif // CEDAR_USE_FFTW
 
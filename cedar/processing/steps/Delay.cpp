@@ -43,10 +43,14 @@
 // CEDAR INCLUDES
 #include "cedar/processing/typecheck/IsMatrix.h"
 #include "cedar/processing/ElementDeclaration.h"
+#include "cedar/processing/Checkpoint.h"
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
 
 // SYSTEM INCLUDES
+#include <algorithm>
+#include <sstream>
 
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -71,7 +75,10 @@ bool declare()
   declaration->setIconPath(":/steps/delay.svg");
   declaration->setDescription
   (
-    "Delays an input for exactly one time-step. Also provides the measured actual time difference between those two last time-steps."
+    "Delays an input by a given time. Past inputs are kept in a ring buffer together with the time at which they "
+    "arrived; the output shows the input that arrived at least the given delay ago (optionally interpolated). With a "
+    "delay of zero, the input is delayed by exactly one time-step. Additional outputs with their own delays (in "
+    "milliseconds) can be added. Also provides the measured actual time difference between the two last time-steps."
   );
 
   declaration->declare();
@@ -91,8 +98,34 @@ cedar::proc::steps::Delay::Delay()
 // outputs
 mOutput(new cedar::aux::MatData(cv::Mat())),
 mOutputTimeStep(new cedar::aux::MatData(cv::Mat::zeros(1,1,CV_32F))),
-mOldInput(new cedar::aux::MatData(cv::Mat())),
-mFirstIteration(true)
+mOldestFrame(0),
+mNumberOfFrames(0),
+// parameters
+_mDelay
+(
+  new cedar::aux::TimeParameter
+  (
+    this,
+    "delay",
+    cedar::unit::Time(0.0 * cedar::unit::seconds),
+    cedar::aux::TimeParameter::LimitType::positiveZero()
+  )
+),
+_mAdditionalDelays
+(
+  new cedar::aux::DoubleVectorParameter
+  (
+    this,
+    "additional delays",
+    std::vector<double>(),
+    cedar::aux::DoubleVectorParameter::LimitType::positiveZero()
+  )
+),
+_mInterpolate(new cedar::aux::BoolParameter(this, "interpolate", false)),
+_mMaximumNumberOfFrames
+(
+  new cedar::aux::UIntParameter(this, "maximum number of frames", 1000, cedar::aux::UIntParameter::LimitType::positive())
+)
 {
   // declare all data
   cedar::proc::DataSlotPtr input = this->declareInput("input");
@@ -101,17 +134,141 @@ mFirstIteration(true)
 
   input->setCheck(cedar::proc::typecheck::IsMatrix());
 
+  _mMaximumNumberOfFrames->markAdvanced(true);
+
   mLastTime= cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+
+  QObject::connect(_mAdditionalDelays.get(), SIGNAL(valueChanged()), this, SLOT(additionalDelaysChanged()));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 // methods
 //----------------------------------------------------------------------------------------------------------------------
 
-void cedar::proc::steps::Delay::inputConnectionChanged(const std::string& inputName)
+void cedar::proc::steps::Delay::setDelay(const cedar::unit::Time& delay)
+{
+  this->_mDelay->setValue(delay);
+}
+
+cedar::unit::Time cedar::proc::steps::Delay::getDelay() const
+{
+  return this->_mDelay->getValue();
+}
+
+unsigned int cedar::proc::steps::Delay::getNumberOfBufferedFrames() const
+{
+  return static_cast<unsigned int>(this->mNumberOfFrames);
+}
+
+void cedar::proc::steps::Delay::writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path) const
+{
+  this->cedar::proc::Step::writeCheckpoint(checkpoint, path);
+
+  // times are stored relative to the current time, so that the buffer still fits when the clock was reset in between
+  cedar::unit::Time now = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+  cv::Mat ages(1, static_cast<int>(this->mNumberOfFrames) + 1, CV_64F);
+  ages.at<double>(0, 0) = (now - this->mLastTime) / cedar::unit::Time(1.0 * cedar::unit::seconds);
+  for (size_t i = 0; i < this->mNumberOfFrames; ++i)
+  {
+    size_t index = this->frameIndex(i);
+    ages.at<double>(0, static_cast<int>(i) + 1)
+      = (now - this->mFrameTimes.at(index)) / cedar::unit::Time(1.0 * cedar::unit::seconds);
+
+    std::stringstream key;
+    key << path << "/frame " << i;
+    checkpoint.store(key.str(), this->mFrames.at(index));
+  }
+  checkpoint.store(path + "/frame ages", ages);
+}
+
+void cedar::proc::steps::Delay::readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path)
+{
+  this->cedar::proc::Step::readCheckpoint(checkpoint, path);
+
+  cv::Mat ages;
+  if (!checkpoint.restore(path + "/frame ages", ages) || ages.total() == 0)
+  {
+    return;
+  }
+
+  cedar::unit::Time now = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+  size_t number_of_frames = ages.total() - 1;
+  if (this->mFrames.size() < number_of_frames)
+  {
+    this->mFrames.resize(number_of_frames);
+    this->mFrameTimes.resize(number_of_frames);
+  }
+
+  // the oldest frame goes first, so that frame i is the i-th oldest one again
+  this->clearFrames();
+  this->mLastTime = now - ages.at<double>(0, 0) * cedar::unit::seconds;
+  for (size_t i = 0; i < number_of_frames; ++i)
+  {
+    std::stringstream key;
+    key << path << "/frame " << i;
+    if (!checkpoint.restore(key.str(), this->mFrames.at(i)))
+    {
+      // an incomplete buffer is of no use; start over
+      this->clearFrames();
+      return;
+    }
+    this->mFrameTimes.at(i) = now - ages.at<double>(0, static_cast<int>(i) + 1) * cedar::unit::seconds;
+    ++this->mNumberOfFrames;
+  }
+}
+
+std::string cedar::proc::steps::Delay::makeTapSlotName(unsigned int tap)
+{
+  std::stringstream name;
+  name << "tap " << tap;
+  return name.str();
+}
+
+cedar::unit::Time cedar::proc::steps::Delay::getTapDelay(unsigned int tap) const
+{
+  if (tap == 0)
+  {
+    return this->_mDelay->getValue();
+  }
+
+  CEDAR_DEBUG_ASSERT(tap <= this->_mAdditionalDelays->size());
+  return cedar::unit::Time
+         (
+           this->_mAdditionalDelays->getValue().at(tap - 1) * cedar::unit::milli * cedar::unit::seconds
+         );
+}
+
+void cedar::proc::steps::Delay::additionalDelaysChanged()
 {
-  // TODO: you may want to replace this code by using a cedar::proc::InputSlotHelper
+  size_t new_size = this->_mAdditionalDelays->size();
+  size_t old_size = this->mTapOutputs.size();
+
+  for (size_t i = old_size; i > new_size; --i)
+  {
+    this->mTapOutputs.pop_back();
+    this->removeOutputSlot(makeTapSlotName(static_cast<unsigned int>(i)));
+  }
+
+  for (size_t i = old_size; i < new_size; ++i)
+  {
+    cv::Mat initial;
+    if (this->mInput)
+    {
+      initial = this->mInput->getData().clone();
+    }
+    cedar::aux::MatDataPtr output(new cedar::aux::MatData(initial));
+    if (this->mInput)
+    {
+      output->copyAnnotationsFrom(this->mInput);
+    }
+    this->mTapOutputs.push_back(output);
+    this->declareOutput(makeTapSlotName(static_cast<unsigned int>(i + 1)), output);
+    this->emitOutputPropertiesChangedSignal(makeTapSlotName(static_cast<unsigned int>(i + 1)));
+  }
+}
 
+void cedar::proc::steps::Delay::inputConnectionChanged(const std::string& inputName)
+{
   // Again, let's first make sure that this is really the input in case anyone ever changes our interface.
   CEDAR_DEBUG_ASSERT(inputName == "input");
 
@@ -123,7 +280,10 @@ void cedar::proc::steps::Delay::inputConnectionChanged(const std::string& inputN
   {
     // no input -> no output
     this->mOutput->setData(cv::Mat());
-    this->mOldInput->setData(cv::Mat());
+    for (const auto& tap_output : this->mTapOutputs)
+    {
+      tap_output->setData(cv::Mat());
+    }
     output_changed = true;
   }
   else
@@ -137,46 +297,204 @@ void cedar::proc::steps::Delay::inputConnectionChanged(const std::string& inputN
       output_changed = true;
     }
 
-    // Make a copy to create a matrix of the same type, dimensions, ...
-    this->mOutput->setData(input.clone());
-    this->mOldInput->setData(input.clone());
+    // Preallocate the outputs so that compute only ever copies into them.
+    this->resetOutputs();
 
     this->mOutput->copyAnnotationsFrom(this->mInput);
+    for (const auto& tap_output : this->mTapOutputs)
+    {
+      tap_output->copyAnnotationsFrom(this->mInput);
+    }
   }
 
   if (output_changed)
   {
     this->emitOutputPropertiesChangedSignal("output");
+    for (unsigned int tap = 1; tap <= this->mTapOutputs.size(); ++tap)
+    {
+      this->emitOutputPropertiesChangedSignal(makeTapSlotName(tap));
+    }
   }
 
-  mFirstIteration= true;
+  this->clearFrames();
+}
+
+void cedar::proc::steps::Delay::resetOutputs()
+{
+  const cv::Mat& input = this->mInput->getData();
+  this->mOutput->setData(input.clone());
+  for (const auto& tap_output : this->mTapOutputs)
+  {
+    tap_output->setData(input.clone());
+  }
+}
+
+size_t cedar::proc::steps::Delay::frameIndex(size_t i) const
+{
+  CEDAR_DEBUG_ASSERT(i < this->mFrames.size());
+  return (this->mOldestFrame + i) % this->mFrames.size();
+}
+
+void cedar::proc::steps::Delay::clearFrames()
+{
+  this->mOldestFrame = 0;
+  this->mNumberOfFrames = 0;
+}
+
+void cedar::proc::steps::Delay::readDelayed
+     (
+       const cedar::unit::Time& delayedTime,
+       bool interpolate,
+       cv::Mat& output
+     ) const
+{
+  CEDAR_DEBUG_ASSERT(this->mNumberOfFrames > 0);
+
+  // find the first frame that is newer than the delayed time; frame times increase from the oldest to the newest frame
+  size_t lower = 0;
+  size_t upper = this->mNumberOfFrames;
+  while (lower < upper)
+  {
+    size_t middle = lower + (upper - lower) / 2;
+    if (this->mFrameTimes.at(this->frameIndex(middle)) <= delayedTime)
+    {
+      lower = middle + 1;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+
+  if (lower == 0)
+  {
+    // the buffer does not reach back far enough (yet); show the oldest frame available
+    this->mFrames.at(this->frameIndex(0)).copyTo(output);
+  }
+  else if (!interpolate || lower == this->mNumberOfFrames)
+  {
+    this->mFrames.at(this->frameIndex(lower - 1)).copyTo(output);
+  }
+  else
+  {
+    size_t before = this->frameIndex(lower - 1);
+    size_t after = this->frameIndex(lower);
+    const cedar::unit::Time& before_time = this->mFrameTimes.at(before);
+    const cedar::unit::Time& after_time = this->mFrameTimes.at(after);
+    double alpha = (delayedTime - before_time) / (after_time - before_time);
+    alpha = std::min(1.0, std::max(0.0, alpha));
+    cv::addWeighted(this->mFrames.at(before), 1.0 - alpha, this->mFrames.at(after), alpha, 0.0, output);
+  }
+}
+
+void cedar::proc::steps::Delay::pushFrame
+     (
+       const cv::Mat& input,
+       const cedar::unit::Time& time,
+       const cedar::unit::Time& largestDelay
+     )
+{
+  if (this->mNumberOfFrames < this->mFrames.size())
+  {
+    size_t index = this->frameIndex(this->mNumberOfFrames);
+    input.copyTo(this->mFrames.at(index));
+    this->mFrameTimes.at(index) = time;
+    ++this->mNumberOfFrames;
+    return;
+  }
+
+  // The buffer is full. The oldest frame can be overwritten once the frame after it is old enough to serve the largest
+  // delay; otherwise, the buffer grows by one frame (this only happens until it spans the largest delay).
+  bool oldest_needed = true;
+  if (this->mNumberOfFrames > 0)
+  {
+    const cedar::unit::Time& next_time
+      = this->mNumberOfFrames > 1 ? this->mFrameTimes.at(this->frameIndex(1)) : time;
+    oldest_needed = next_time > time - largestDelay;
+  }
+
+  if (oldest_needed && this->mFrames.size() < this->_mMaximumNumberOfFrames->getValue())
+  {
+    // insert the new frame in front of the oldest one, i.e., behind the newest one
+    this->mFrames.insert(this->mFrames.begin() + this->mOldestFrame, input.clone());
+    this->mFrameTimes.insert(this->mFrameTimes.begin() + this->mOldestFrame, time);
+    if (this->mNumberOfFrames > 0)
+    {
+      ++this->mOldestFrame;
+    }
+    ++this->mNumberOfFrames;
+  }
+  else
+  {
+    input.copyTo(this->mFrames.at(this->mOldestFrame));
+    this->mFrameTimes.at(this->mOldestFrame) = time;
+    this->mOldestFrame = (this->mOldestFrame + 1) % this->mFrames.size();
+  }
 }
 
 void cedar::proc::steps::Delay::compute(const cedar::proc::Arguments& )//arguments)
 {
   cedar::unit::Time newtime = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+  const cv::Mat& input = this->mInput->getData();
 
-  if (mFirstIteration)
+  if (this->mFrames.size() > this->_mMaximumNumberOfFrames->getValue())
+  {
+    // the maximum was lowered; start over with a smaller buffer
+    this->mFrames.clear();
+    this->mFrameTimes.clear();
+    this->clearFrames();
+  }
+
+  if (this->mNumberOfFrames > 0)
+  {
+    size_t newest = this->frameIndex(this->mNumberOfFrames - 1);
+    const cv::Mat& newest_frame = this->mFrames.at(newest);
+    // frames of a different size or type cannot be mixed; a clock that went backwards (e.g., was reset) makes the
+    // stored times meaningless
+    if
+    (
+      newest_frame.type() != input.type()
+      || newest_frame.size != input.size
+      || newtime < this->mFrameTimes.at(newest)
+    )
+    {
+      this->clearFrames();
+    }
+  }
+
+  if (this->mNumberOfFrames == 0)
   {
     // no changes, dont generate big jumps
-    this->mOutput->setData( this->mInput->getData().clone() );
+    input.copyTo(this->mOutput->getData());
+    for (const auto& tap_output : this->mTapOutputs)
+    {
+      input.copyTo(tap_output->getData());
+    }
     this->mOutputTimeStep->getData().at<float>(0,0)= 0;
-    mFirstIteration= false;
   }
   else
   {
-    this->mOutput->setData( this->mOldInput->getData().clone() );
-    this->mOldInput->setData( this->mInput->getData().clone() );
-
+    bool interpolate = this->_mInterpolate->getValue();
+    this->readDelayed(newtime - this->getTapDelay(0), interpolate, this->mOutput->getData());
+    for (unsigned int tap = 1; tap <= this->mTapOutputs.size(); ++tap)
+    {
+      this->readDelayed(newtime - this->getTapDelay(tap), interpolate, this->mTapOutputs.at(tap - 1)->getData());
+    }
 
     this->mOutputTimeStep->getData().at<float>(0,0)= (newtime - mLastTime) / boost::units::si::second;
   }
 
+  cedar::unit::Time largest_delay = this->getTapDelay(0);
+  for (unsigned int tap = 1; tap <= this->mTapOutputs.size(); ++tap)
+  {
+    largest_delay = std::max(largest_delay, this->getTapDelay(tap));
+  }
+  this->pushFrame(input, newtime, largest_delay);
+
   mLastTime= newtime;
 }
 
 void cedar::proc::steps::Delay::reset()
 {
-  mFirstIteration= true;
+  this->clearFrames();
 }
-
@@ -44,20 +44,38 @@
 #include <cedar/processing/Step.h>
 #include <cedar/processing/InputSlotHelper.h>
 #include <cedar/auxiliaries/MatData.h>
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/DoubleVectorParameter.h"
+#include "cedar/auxiliaries/TimeParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
 #include "cedar/units/Time.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/processing/steps/Delay.fwd.h"
 
 // SYSTEM INCLUDES
+#include <vector>
 
 
-/*!@todo describe.
+/*!@brief Delays its input by a given time.
  *
- * @todo describe more.
+ *        The step keeps the inputs of its past compute calls, along with the time of the global clock at which they
+ *        arrived, in a ring buffer of preallocated frames. Each output shows the newest of these frames that is at least
+ *        as old as the delay of the output or, if interpolation is enabled, a linear interpolation between the two frames
+ *        around the delayed time. The input of the current compute call is never used, so a delay of zero delays the input
+ *        by exactly one trigger.
+ *
+ *        Besides the main output, any number of additional outputs ("tap 1", "tap 2", ...) with their own delays can be
+ *        read from the same buffer. The buffer grows until it spans the largest delay (or reaches its maximum number of
+ *        frames); afterwards, no memory is allocated as long as the input keeps its size and type.
  */
 class cedar::proc::steps::Delay : public cedar::proc::Step
 {
+  //--------------------------------------------------------------------------------------------------------------------
+  // macros
+  //--------------------------------------------------------------------------------------------------------------------
+  Q_OBJECT
+
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
@@ -73,7 +91,20 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  // none yet
+  //! Sets the delay of the main output.
+  void setDelay(const cedar::unit::Time& delay);
+
+  //! Returns the delay of the main output.
+  cedar::unit::Time getDelay() const;
+
+  //! Returns the number of frames the ring buffer currently holds.
+  unsigned int getNumberOfBufferedFrames() const;
+
+  //! Also stores the frames in the ring buffer and their times.
+  void writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path) const;
+
+  //! Also restores the frames in the ring buffer and their times.
+  void readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path);
 
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
@@ -89,6 +120,31 @@ private:
 
   void compute(const cedar::proc::Arguments& arguments);
 
+  //! Returns the name of the output slot of the given additional tap, counting from 1.
+  static std::string makeTapSlotName(unsigned int tap);
+
+  //! Returns the delay of the given tap; tap 0 is the main output.
+  cedar::unit::Time getTapDelay(unsigned int tap) const;
+
+  //! Returns the index in mFrames of the i-th oldest buffered frame.
+  size_t frameIndex(size_t i) const;
+
+  //! Writes the delayed frame for the given time into the output.
+  void readDelayed(const cedar::unit::Time& delayedTime, bool interpolate, cv::Mat& output) const;
+
+  //! Appends the input to the ring buffer, growing it if the oldest frame is still needed for the largest delay.
+  void pushFrame(const cv::Mat& input, const cedar::unit::Time& time, const cedar::unit::Time& largestDelay);
+
+  //! Empties the ring buffer but keeps the memory of its frames.
+  void clearFrames();
+
+  //! Resets the outputs to the current input.
+  void resetOutputs();
+
+private slots:
+  //! Declares or removes the outputs of additional taps.
+  void additionalDelaysChanged();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -102,7 +158,20 @@ private:
   cedar::aux::MatDataPtr mOutput;
   cedar::aux::MatDataPtr mOutputTimeStep;
 
-  cedar::aux::MatDataPtr mOldInput;
+  //! The outputs of the additional taps.
+  std::vector<cedar::aux::MatDataPtr> mTapOutputs;
+
+  //! Storage of the ring buffer; the memory of a frame is reused when it is overwritten.
+  std::vector<cv::Mat> mFrames;
+
+  //! Time of the global clock at which each frame arrived.
+  std::vector<cedar::unit::Time> mFrameTimes;
+
+  //! Index of the oldest frame in mFrames.
+  size_t mOldestFrame;
+
+  //! Number of frames currently held by the ring buffer.
+  size_t mNumberOfFrames;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
@@ -112,9 +181,19 @@ protected:
 
 private:
   cedar::unit::Time mLastTime;
-  bool              mFirstIteration;
+
+  //! Delay of the main output.
+  cedar::aux::TimeParameterPtr _mDelay;
+
+  //! Delays of the additional taps, in milliseconds.
+  cedar::aux::DoubleVectorParameterPtr _mAdditionalDelays;
+
+  //! Whether outputs are interpolated between the two frames around their delayed time.
+  cedar::aux::BoolParameterPtr _mInterpolate;
+
+  //! Upper limit for the size of the ring buffer; if it is reached, the largest delay is cut short.
+  cedar::aux::UIntParameterPtr _mMaximumNumberOfFrames;
 
 }; // class cedar::proc::steps::Delay
 
 #endif // PROC_STEPS_DELAY_H
-
@@ -43,6 +43,7 @@
 // CEDAR INCLUDES
 #include "cedar/processing/typecheck/IsMatrix.h"
 #include <cedar/processing/ElementDeclaration.h>
+#include "cedar/processing/Checkpoint.h"
 
 // SYSTEM INCLUDES
 
@@ -151,6 +152,30 @@ void cedar::proc::steps::ExponentialSmoothing::compute(const cedar::proc::Argume
   this->recompute();
 }
 
+void cedar::proc::steps::ExponentialSmoothing::writeCheckpoint
+(
+  cedar::proc::Checkpoint& checkpoint,
+  const std::string& path
+) const
+{
+  this->cedar::proc::Step::writeCheckpoint(checkpoint, path);
+
+  checkpoint.store(path + "/data estimate", this->mDataEstimate);
+  checkpoint.store(path + "/trend estimate", this->mTrendEstimate);
+}
+
+void cedar::proc::steps::ExponentialSmoothing::readCheckpoint
+(
+  const cedar::proc::Checkpoint& checkpoint,
+  const std::string& path
+)
+{
+  this->cedar::proc::Step::readCheckpoint(checkpoint, path);
+
+  checkpoint.restore(path + "/data estimate", this->mDataEstimate);
+  checkpoint.restore(path + "/trend estimate", this->mTrendEstimate);
+}
+
 void cedar::proc::steps::ExponentialSmoothing::reset()
 {
   mDataEstimate= cv::Mat();
@@ -74,7 +74,11 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  // none yet
+  //! Also stores the data and trend estimates.
+  void writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path) const;
+
+  //! Also restores the data and trend estimates.
+  void readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path);
 
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
@@ -43,6 +43,7 @@
 // CEDAR INCLUDES
 #include "cedar/processing/typecheck/IsMatrix.h"
 #include <cedar/processing/ElementDeclaration.h>
+#include "cedar/processing/Checkpoint.h"
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/units/Time.h"
 
@@ -201,6 +202,46 @@ void cedar::proc::steps::NumericalDifferentiation::compute(const cedar::proc::Ar
   this->recompute(false);
 }
 
+void cedar::proc::steps::NumericalDifferentiation::writeCheckpoint
+(
+  cedar::proc::Checkpoint& checkpoint,
+  const std::string& path
+) const
+{
+  this->cedar::proc::Step::writeCheckpoint(checkpoint, path);
+
+  checkpoint.store(path + "/one back", this->mOneBack);
+  checkpoint.store(path + "/two back", this->mTwoBack);
+  checkpoint.store(path + "/three back", this->mThreeBack);
+  checkpoint.store(path + "/four back", this->mFourBack);
+
+  // relative to the current time, so that the next step size still fits when the clock was reset in between
+  cedar::unit::Time now = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+  cv::Mat age(1, 1, CV_64F, cv::Scalar((now - mLastTime) / boost::units::si::second));
+  checkpoint.store(path + "/last step age", age);
+}
+
+void cedar::proc::steps::NumericalDifferentiation::readCheckpoint
+(
+  const cedar::proc::Checkpoint& checkpoint,
+  const std::string& path
+)
+{
+  this->cedar::proc::Step::readCheckpoint(checkpoint, path);
+
+  checkpoint.restore(path + "/one back", this->mOneBack);
+  checkpoint.restore(path + "/two back", this->mTwoBack);
+  checkpoint.restore(path + "/three back", this->mThreeBack);
+  checkpoint.restore(path + "/four back", this->mFourBack);
+
+  cv::Mat age;
+  if (checkpoint.restore(path + "/last step age", age))
+  {
+    cedar::unit::Time now = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+    mLastTime = now - age.at<double>(0, 0) * boost::units::si::seconds;
+  }
+}
+
 void cedar::proc::steps::NumericalDifferentiation::reset()
 {
 //std::cout << "\n\n\n  RESET: " << std::endl;
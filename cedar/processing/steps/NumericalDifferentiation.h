@@ -74,7 +74,11 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  // none yet
+  //! Also stores the past inputs and the time of the last step.
+  void writeCheckpoint(cedar::proc::Checkpoint& checkpoint, const std::string& path) const;
+
+  //! Also restores the past inputs and the time of the last step.
+  void readCheckpoint(const cedar::proc::Checkpoint& checkpoint, const std::string& path);
 
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
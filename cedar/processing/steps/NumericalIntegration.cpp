@@ -43,6 +43,7 @@
 // CEDAR INCLUDES
 #include "cedar/processing/typecheck/IsMatrix.h"
 #include <cedar/processing/ElementDeclaration.h>
+#include "cedar/processing/Checkpoint.h"
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/units/Time.h"
 
@@ -165,6 +166,48 @@ void cedar::proc::steps::NumericalIntegration::reinitialize()
   this->mOutput->setData( mLastState.clone() );
 }
 
+void cedar::proc::steps::NumericalIntegration::writeCheckpoint
+(
+  cedar::proc::Checkpoint& checkpoint,
+  const std::string& path
+) const
+{
+  this->cedar::proc::Step::writeCheckpoint(checkpoint, path);
+
+  checkpoint.store(path + "/one back", this->mOneBack);
+  checkpoint.store(path + "/two back", this->mTwoBack);
+  checkpoint.store(path + "/three back", this->mThreeBack);
+  checkpoint.store(path + "/four back", this->mFourBack);
+  checkpoint.store(path + "/last state", this->mLastState);
+
+  // relative to the current time, so that the next step size still fits when the clock was reset in between
+  cedar::unit::Time now = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+  cv::Mat age(1, 1, CV_64F, cv::Scalar((now - mLastTime) / boost::units::si::second));
+  checkpoint.store(path + "/last step age", age);
+}
+
+void cedar::proc::steps::NumericalIntegration::readCheckpoint
+(
+  const cedar::proc::Checkpoint& checkpoint,
+  const std::string& path
+)
+{
+  this->cedar::proc::Step::readCheckpoint(checkpoint, path);
+
+  checkpoint.restore(path + "/one back", this->mOneBack);
+  checkpoint.restore(path + "/two back", this->mTwoBack);
+  checkpoint.restore(path + "/three back", this->mThreeBack);
+  checkpoint.restore(path + "/four back", this->mFourBack);
+  checkpoint.restore(path + "/last state", this->mLastState);
+
+  cv::Mat age;
+  if (checkpoint.restore(path + "/last step age", age))
+  {
+    cedar::unit::Time now = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+    mLastTime = now - age.at<double>(0, 0) * boost::units::si::seconds;
+  }
+}
+
 void cedar::proc::steps::NumericalIntegration::reset()
 {
   if (mInitializeOnReset->getValue())
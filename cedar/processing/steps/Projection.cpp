@@ -43,17 +43,19 @@
 #include "cedar/processing/Arguments.h"
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/processing/DeclarationRegistry.h"
+#include "cedar/processing/exceptions.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/math/tools.h"
-#include "cedar/auxiliaries/MatrixIterator.h"
-#include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/stringFunctions.h"
 
 // SYSTEM INCLUDES
 #include <iostream>
 #include <vector>
 #include <limits>
+#include <algorithm>
+#include <cstdlib>
 
 cedar::aux::EnumType<cedar::proc::steps::Projection::CompressionType>
   cedar::proc::steps::Projection::CompressionType::mType;
@@ -65,6 +67,328 @@ const cedar::proc::steps::Projection::CompressionType::Id cedar::proc::steps::Pr
 const cedar::proc::steps::Projection::CompressionType::Id cedar::proc::steps::Projection::CompressionType::MINIMUM;
 #endif // CEDAR_COMPILER_MSVC
 
+//----------------------------------------------------------------------------------------------------------------------
+// projection plan
+//----------------------------------------------------------------------------------------------------------------------
+
+//!@cond SKIPPED_DOCUMENTATION
+namespace cedar
+{
+  namespace proc
+  {
+    namespace steps
+    {
+      namespace ProjectionScope
+      {
+        //! One loop of a projection: its length and its strides (in elements) in the input and the output.
+        struct Loop
+        {
+          int size;
+          std::ptrdiff_t inputStride;
+          std::ptrdiff_t outputStride;
+        };
+
+        struct ProjectionPlan
+        {
+          //! Whether the plan can be executed; false if input and output do not fit the mapping.
+          bool valid = false;
+
+          //! Why the plan cannot be executed; empty if it is valid.
+          std::string invalidReason;
+
+          //! Whether any dimension is compressed, i.e., whether several inputs are combined into one output entry.
+          bool compresses = false;
+
+          //! Number of input entries combined into each output entry.
+          double numberOfCompressedEntries = 1.0;
+
+          //! Whether the slices are to be computed in parallel.
+          bool parallel = false;
+
+          //! Outermost loop over disjoint parts of the output; the slices can be computed in parallel.
+          Loop slices = {1, 0, 0};
+
+          //! Innermost loop, run by the kernels.
+          Loop inner = {1, 0, 0};
+
+          //! Offsets of all iterations of the remaining (middle) loops within a slice.
+          std::vector<std::ptrdiff_t> inputOffsets;
+          std::vector<std::ptrdiff_t> outputOffsets;
+
+          //! Layout of the matrices the plan was made for, see describeLayout.
+          std::vector<std::size_t> inputLayout;
+          std::vector<std::size_t> outputLayout;
+        };
+      }
+    }
+  }
+}
+//!@endcond
+
+namespace
+{
+  using cedar::proc::steps::ProjectionScope::Loop;
+  using cedar::proc::steps::ProjectionScope::ProjectionPlan;
+
+  //! Type, sizes and steps of a matrix; a plan has to be remade if any of them changes.
+  void describeLayout(const cv::Mat& matrix, std::vector<std::size_t>& layout)
+  {
+    layout.clear();
+    layout.push_back(static_cast<std::size_t>(matrix.type()));
+    for (int d = 0; d < matrix.dims; ++d)
+    {
+      layout.push_back(static_cast<std::size_t>(matrix.size[d]));
+      layout.push_back(matrix.step[d]);
+    }
+  }
+
+  bool layoutMatches(const cv::Mat& matrix, const std::vector<std::size_t>& layout)
+  {
+    if (layout.size() != static_cast<std::size_t>(1 + 2 * matrix.dims)
+        || layout.at(0) != static_cast<std::size_t>(matrix.type()))
+    {
+      return false;
+    }
+    for (int d = 0; d < matrix.dims; ++d)
+    {
+      if (layout.at(1 + 2 * d) != static_cast<std::size_t>(matrix.size[d]) || layout.at(2 + 2 * d) != matrix.step[d])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*! Sizes and strides (in elements) of the dimensions of a matrix as seen by the projection, where 1D matrices have a
+   *  single dimension, regardless of whether they are stored as a row or a column.
+   */
+  bool getLogicalLayout
+  (
+    const cv::Mat& matrix,
+    unsigned int dimensionality,
+    std::vector<int>& sizes,
+    std::vector<std::ptrdiff_t>& strides
+  )
+  {
+    sizes.clear();
+    strides.clear();
+    std::ptrdiff_t element_size = static_cast<std::ptrdiff_t>(matrix.elemSize());
+    if (dimensionality == 0)
+    {
+      return matrix.total() == 1;
+    }
+    else if (dimensionality == 1)
+    {
+      if (matrix.dims != 2 || (matrix.rows != 1 && matrix.cols != 1))
+      {
+        return false;
+      }
+      sizes.push_back(static_cast<int>(matrix.total()));
+      strides.push_back(static_cast<std::ptrdiff_t>(matrix.cols == 1 ? matrix.step[0] : matrix.step[1]) / element_size);
+      return true;
+    }
+
+    if (matrix.dims != static_cast<int>(dimensionality))
+    {
+      return false;
+    }
+    for (int d = 0; d < matrix.dims; ++d)
+    {
+      sizes.push_back(matrix.size[d]);
+      strides.push_back(static_cast<std::ptrdiff_t>(matrix.step[d]) / element_size);
+    }
+    return true;
+  }
+
+  //! Copies input entries to the output; used when nothing is compressed.
+  struct Assign
+  {
+    static const bool compresses = false;
+
+    template<typename T>
+    static T identity()
+    {
+      return T(0);
+    }
+
+    template<typename T>
+    static void combine(T& output, T input)
+    {
+      output = input;
+    }
+  };
+
+  struct Sum
+  {
+    static const bool compresses = true;
+
+    template<typename T>
+    static T identity()
+    {
+      return T(0);
+    }
+
+    template<typename T>
+    static void combine(T& output, T input)
+    {
+      output += input;
+    }
+  };
+
+  struct Maximum
+  {
+    static const bool compresses = true;
+
+    template<typename T>
+    static T identity()
+    {
+      return std::numeric_limits<T>::lowest();
+    }
+
+    template<typename T>
+    static void combine(T& output, T input)
+    {
+      output = std::max(output, input);
+    }
+  };
+
+  struct Minimum
+  {
+    static const bool compresses = true;
+
+    template<typename T>
+    static T identity()
+    {
+      return std::numeric_limits<T>::max();
+    }
+
+    template<typename T>
+    static void combine(T& output, T input)
+    {
+      output = std::min(output, input);
+    }
+  };
+
+  //! Runs the innermost loop of a plan; the common stride patterns get their own loops so they can be vectorized.
+  template<typename T, typename Operation>
+  inline void runInnerLoop(const T* input, T* output, const Loop& loop)
+  {
+    const int size = loop.size;
+    const std::ptrdiff_t input_stride = loop.inputStride;
+    const std::ptrdiff_t output_stride = loop.outputStride;
+
+    if (Operation::compresses && output_stride == 0)
+    {
+      // the whole loop goes into one output entry; separate accumulators shorten the dependency chain
+      const T identity = Operation::template identity<T>();
+      T accumulators[4] = {*output, identity, identity, identity};
+      int i = 0;
+      for (; i + 4 <= size; i += 4)
+      {
+        Operation::combine(accumulators[0], input[i * input_stride]);
+        Operation::combine(accumulators[1], input[(i + 1) * input_stride]);
+        Operation::combine(accumulators[2], input[(i + 2) * input_stride]);
+        Operation::combine(accumulators[3], input[(i + 3) * input_stride]);
+      }
+      for (; i < size; ++i)
+      {
+        Operation::combine(accumulators[0], input[i * input_stride]);
+      }
+      Operation::combine(accumulators[0], accumulators[1]);
+      Operation::combine(accumulators[2], accumulators[3]);
+      Operation::combine(accumulators[0], accumulators[2]);
+      *output = accumulators[0];
+    }
+    else if (input_stride == 1 && output_stride == 1)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        Operation::combine(output[i], input[i]);
+      }
+    }
+    else if (input_stride == 0 && output_stride == 1)
+    {
+      const T value = *input;
+      for (int i = 0; i < size; ++i)
+      {
+        Operation::combine(output[i], value);
+      }
+    }
+    else
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        Operation::combine(output[i * output_stride], input[i * input_stride]);
+      }
+    }
+  }
+
+  template<typename T, typename Operation>
+  void runSlices(const ProjectionPlan& plan, const T* input, T* output, int firstSlice, int endSlice)
+  {
+    const std::size_t number_of_offsets = plan.inputOffsets.size();
+    for (int slice = firstSlice; slice < endSlice; ++slice)
+    {
+      const T* slice_input = input + slice * plan.slices.inputStride;
+      T* slice_output = output + slice * plan.slices.outputStride;
+      for (std::size_t i = 0; i < number_of_offsets; ++i)
+      {
+        runInnerLoop<T, Operation>
+        (
+          slice_input + plan.inputOffsets[i],
+          slice_output + plan.outputOffsets[i],
+          plan.inner
+        );
+      }
+    }
+  }
+
+  //! Lets OpenCV's thread pool compute ranges of slices.
+  template<typename T, typename Operation>
+  class ParallelSlices : public cv::ParallelLoopBody
+  {
+  public:
+    ParallelSlices(const ProjectionPlan& plan, const T* input, T* output)
+    :
+    mPlan(plan),
+    mInput(input),
+    mOutput(output)
+    {
+    }
+
+    void operator()(const cv::Range& range) const
+    {
+      runSlices<T, Operation>(this->mPlan, this->mInput, this->mOutput, range.start, range.end);
+    }
+
+  private:
+    const ProjectionPlan& mPlan;
+    const T* mInput;
+    T* mOutput;
+  };
+
+  template<typename T, typename Operation>
+  void runPlan(const ProjectionPlan& plan, const cv::Mat& input, cv::Mat& output)
+  {
+    const T* input_data = input.ptr<T>();
+    T* output_data = output.ptr<T>();
+
+    if (Operation::compresses)
+    {
+      output.setTo(cv::Scalar(static_cast<double>(Operation::template identity<T>())));
+    }
+
+    if (plan.parallel && plan.slices.size > 1)
+    {
+      cv::parallel_for_(cv::Range(0, plan.slices.size), ParallelSlices<T, Operation>(plan, input_data, output_data));
+    }
+    else
+    {
+      runSlices<T, Operation>(plan, input_data, output_data, 0, plan.slices.size);
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // register the class
 //----------------------------------------------------------------------------------------------------------------------
@@ -111,7 +435,7 @@ cedar::proc::steps::Projection::Projection()
 :
 mOutput(new cedar::aux::MatData(cv::Mat())),
 _mDimensionMappings(new cedar::proc::ProjectionMappingParameter(this, "dimension mapping")),
-_mOutputDimensionality(new cedar::aux::UIntParameter(this, "output dimensionality", 1, 0, 4)),
+_mOutputDimensionality(new cedar::aux::UIntParameter(this, "output dimensionality", 1, 0, 16)),
 _mOutputDimensionSizes(new cedar::aux::UIntVectorParameter(this, "output dimension sizes", 1, 50, 1, 1000)),
 _mCompressionType(new cedar::aux::EnumParameter(
                                                  this,
@@ -119,8 +443,13 @@ _mCompressionType(new cedar::aux::EnumParameter(
                                                  cedar::proc::steps::Projection::CompressionType::typePtr(),
                                                  cedar::proc::steps::Projection::CompressionType::SUM
                                                )
-                  )
+                  ),
+_mParallelize(new cedar::aux::BoolParameter(this, "parallelize", false))
 {
+  this->mPlan.reset(new cedar::proc::steps::ProjectionScope::ProjectionPlan());
+  this->mpProjectionMethod = &cedar::proc::steps::Projection::project;
+  this->_mParallelize->markAdvanced(true);
+
   // declare input and output
   this->declareInput("input");
   this->declareOutput("output", mOutput);
@@ -135,6 +464,10 @@ _mCompressionType(new cedar::aux::EnumParameter(
   QObject::connect(_mOutputDimensionSizes.get(), SIGNAL(valueChanged()), this, SLOT(outputDimensionSizesChanged()), Qt::DirectConnection);
 }
 
+cedar::proc::steps::Projection::~Projection()
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // methods
 //----------------------------------------------------------------------------------------------------------------------
@@ -178,6 +511,7 @@ void cedar::proc::steps::Projection::outputDimensionalityChanged()
 void cedar::proc::steps::Projection::outputDimensionSizesChanged()
 {
   this->initializeOutputMatrix();
+  this->updateProjectionPlan();
   this->emitOutputPropertiesChangedSignal("output");
 }
 
@@ -195,111 +529,29 @@ void cedar::proc::steps::Projection::reconfigure(bool triggerSubsequent)
   unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(this->mInput->getData());
   unsigned int output_dimensionality = _mOutputDimensionality->getValue();
 
-  // if the projection compresses ...
-  if (input_dimensionality > output_dimensionality)
+  // compressions to 0D use OpenCV's reductions over the whole matrix; everything else is done by the projection plan
+  if (input_dimensionality > output_dimensionality && output_dimensionality == 0)
   {
-    CEDAR_DEBUG_ASSERT(input_dimensionality == _mDimensionMappings->getValue()->getNumberOfMappings())
-
-    // ... compute which indices need to be compressed
-    mIndicesToCompress.clear();
-
-    for (unsigned int index = 0; index < input_dimensionality; ++index)
+    if (_mCompressionType->getValue() == cedar::proc::steps::Projection::CompressionType::MAXIMUM)
     {
-      if (_mDimensionMappings->getValue()->isDropped(index))
-      {
-        mIndicesToCompress.push_back(index);
-      }
+      mpProjectionMethod = &cedar::proc::steps::Projection::compressNDto0Dmax;
     }
-
-    // set up the appropriate function pointer for different combinations of
-    // input and output dimensionality
-    if (input_dimensionality == 3 && output_dimensionality == 2)
+    else if (_mCompressionType->getValue() == cedar::proc::steps::Projection::CompressionType::MINIMUM)
     {
-      std::vector<unsigned int> mapped_indices;
-
-      for (unsigned int index = 0; index < input_dimensionality; ++index)
-      {
-        if (!_mDimensionMappings->getValue()->isDropped(index))
-        {
-          mapped_indices.push_back(_mDimensionMappings->getValue()->lookUp(index));
-        }
-      }
-
-      if (mapped_indices.size() == 2)
-      {
-        if (mapped_indices.at(0) == mapped_indices.at(1))
-        {
-          this->setState(
-                          cedar::proc::Triggerable::STATE_EXCEPTION,
-                          "Cannot map the same dimension onto multiple dimensions."
-                        );
-          return;
-        }
-        bool swapped = mapped_indices.at(0) > mapped_indices.at(1);
-
-        if (swapped)
-        {
-          mpProjectionMethod = &cedar::proc::steps::Projection::compress3Dto2DSwapped;
-        }
-        else
-        {
-          mpProjectionMethod = &cedar::proc::steps::Projection::compress3Dto2D;
-        }
-      }
-    }
-    else if (input_dimensionality == 3 && output_dimensionality == 1)
-    {
-      mpProjectionMethod = &cedar::proc::steps::Projection::compress3Dto1D;
+      mpProjectionMethod = &cedar::proc::steps::Projection::compressNDto0Dmin;
     }
-    else if (input_dimensionality == 2 && output_dimensionality == 1)
+    else if (_mCompressionType->getValue() == cedar::proc::steps::Projection::CompressionType::AVERAGE)
     {
-      mpProjectionMethod = &cedar::proc::steps::Projection::compress2Dto1D;
-    }
-    else if (output_dimensionality == 0)
-    {
-      if (_mCompressionType->getValue() == cedar::proc::steps::Projection::CompressionType::MAXIMUM)
-      {
-        mpProjectionMethod = &cedar::proc::steps::Projection::compressNDto0Dmax;
-      }
-      else if (_mCompressionType->getValue() == cedar::proc::steps::Projection::CompressionType::MINIMUM)
-      {
-        mpProjectionMethod = &cedar::proc::steps::Projection::compressNDto0Dmin;
-      }
-      else if (_mCompressionType->getValue() == cedar::proc::steps::Projection::CompressionType::AVERAGE)
-      {
-        mpProjectionMethod = &cedar::proc::steps::Projection::compressNDto0Dmean;
-      }
-      else if (_mCompressionType->getValue() == cedar::proc::steps::Projection::CompressionType::SUM)
-      {
-        mpProjectionMethod = &cedar::proc::steps::Projection::compressNDto0Dsum;
-      }
+      mpProjectionMethod = &cedar::proc::steps::Projection::compressNDto0Dmean;
     }
     else
     {
-      mpProjectionMethod = NULL;
-      CEDAR_THROW(cedar::aux::NotImplementedException, "The projection for this configuration is not implemented.");
+      mpProjectionMethod = &cedar::proc::steps::Projection::compressNDto0Dsum;
     }
   }
-  // if the projection expands ...
   else
   {
-    // ... set up the appropriate function pointer
-    if (input_dimensionality == 0)
-    {
-      this->mpProjectionMethod = &cedar::proc::steps::Projection::expand0DtoND;
-    }
-    else if (input_dimensionality == 1 && output_dimensionality == 3)
-    {
-      this->mpProjectionMethod = &cedar::proc::steps::Projection::expand1Dto3D;
-    }
-    else if (input_dimensionality == 2 && output_dimensionality == 3)
-    {
-      this->mpProjectionMethod = &cedar::proc::steps::Projection::expand2Dto3D;
-    }
-    else
-    {
-      this->mpProjectionMethod = &cedar::proc::steps::Projection::expandMDtoND;
-    }
+    mpProjectionMethod = &cedar::proc::steps::Projection::project;
   }
 
   if (this->_mDimensionMappings->getValue()->getValidity() == cedar::proc::ProjectionMapping::VALIDITY_ERROR)
@@ -329,7 +581,17 @@ void cedar::proc::steps::Projection::reconfigure(bool triggerSubsequent)
     }
     unsigned int output_dim = _mDimensionMappings->getValue()->lookUp(input_dim);
     CEDAR_ASSERT(output_dim < output_dimensionality);
-    this->_mOutputDimensionSizes->setValue(output_dim, this->mInput->getData().size[input_dim]);
+    unsigned int input_size;
+    if (input_dimensionality == 1)
+    {
+      // 1D inputs may be stored as rows or as columns
+      input_size = cedar::aux::math::get1DMatrixSize(this->mInput->getData());
+    }
+    else
+    {
+      input_size = this->mInput->getData().size[input_dim];
+    }
+    this->_mOutputDimensionSizes->setValue(output_dim, input_size);
     this->_mOutputDimensionSizes->setConstantAt(output_dim, true);
   }
 
@@ -340,6 +602,8 @@ void cedar::proc::steps::Projection::reconfigure(bool triggerSubsequent)
     this->emitOutputPropertiesChangedSignal("output");
   }
 
+  this->updateProjectionPlan();
+
   // now do a final step and try to calculate an output with the new configuration
   if (triggerSubsequent)
   {
@@ -384,397 +648,220 @@ void cedar::proc::steps::Projection::initializeOutputMatrix()
 }
 
 
-template<typename T>
-void cedar::proc::steps::Projection::expand0DtoND()
-{
-  CEDAR_DEBUG_ASSERT(mInput->getData().size[0] == 1);
-  // set all values of the output matrix to the single value of the input
-  mOutput->getData() = cv::Scalar(mInput->getData().at<T>(0));
-}
-
-void cedar::proc::steps::Projection::expand0DtoND()
-{
-  switch (mInput->getCvType())
-  {
-    case CV_32F:
-    {
-      this->expand0DtoND<float>();
-      break;
-    }
-    case CV_64F:
-    {
-      this->expand0DtoND<double>();
-      break;
-    }
-    default:
-      CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot project matrices of this type.");
-  }
-}
-
-//! not used at the moment
-void cedar::proc::steps::Projection::expand1Dto2D()
+void cedar::proc::steps::Projection::updateProjectionPlan()
 {
-  const cv::Mat& input = this->mInput->getData();
-  cv::Mat& output = this->mOutput->getData();
-  output = output * 0;
+  using cedar::proc::steps::ProjectionScope::Loop;
 
-  bool transposed = false;
+  cedar::proc::steps::ProjectionScope::ProjectionPlan& plan = *this->mPlan;
+  plan.valid = false;
+  plan.invalidReason.clear();
+  plan.parallel = this->_mParallelize->getValue();
+  plan.inputLayout.clear();
+  plan.outputLayout.clear();
 
-  // if dimension 0 is mapped onto 1
-  if (_mDimensionMappings->getValue()->lookUp(0) == 1)
+  if (!this->mInput || this->mInput->isEmpty())
   {
-    transposed = true;
-    output = output.t();
+    plan.invalidReason = "There is no input.";
+    return;
   }
 
-  for (int i = 0; i < input.rows; ++i)
-  {
-    input.row(i).copyTo(output);
-  }
+  const cv::Mat& input = this->mInput->getData();
+  const cv::Mat& output = this->mOutput->getData();
+  describeLayout(input, plan.inputLayout);
+  describeLayout(output, plan.outputLayout);
 
-  if (transposed)
+  auto mapping = this->_mDimensionMappings->getValue();
+  if (mapping->getValidity() == cedar::proc::ProjectionMapping::VALIDITY_ERROR)
   {
-    output = output.t();
+    plan.invalidReason = "The dimension mapping is invalid.";
+    return;
   }
-}
-
-void cedar::proc::steps::Projection::expand2Dto3D()
-{
-  switch (mInput->getCvType())
+  if (input.type() != output.type())
   {
-    case CV_32F:
-    {
-      this->expand2Dto3D<float>();
-      break;
-    }
-    case CV_64F:
-    {
-      this->expand2Dto3D<double>();
-      break;
-    }
-    default:
-      CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot project matrices of this type.");
+    plan.invalidReason = "Input and output differ in type.";
+    return;
   }
-}
 
-template<typename T>
-void cedar::proc::steps::Projection::expand2Dto3D()
-{
-  const cv::Mat& input = this->mInput->getData();
-  cv::Mat& output = this->mOutput->getData();
-  // sanity check
-  CEDAR_DEBUG_ASSERT
+  unsigned int input_dimensionality = mapping->getNumberOfMappings();
+  unsigned int output_dimensionality = this->_mOutputDimensionality->getValue();
+  std::vector<int> input_sizes, output_sizes;
+  std::vector<std::ptrdiff_t> input_strides, output_strides;
+  if
   (
-    cedar::aux::math::getDimensionalityOf(input) == 2
-      && cedar::aux::math::getDimensionalityOf(output) == 3
-  );
-  auto mapping = _mDimensionMappings->getValue();
-  unsigned int number_of_mappings = mapping->getNumberOfMappings();
-  unsigned int i = 0;
-  // do this lookup only once, assuming that mapping does not change at run time...
-  mMappingLookup.resize(number_of_mappings);
-  for (i = 0; i < number_of_mappings; ++i)
+    !getLogicalLayout(input, input_dimensionality, input_sizes, input_strides)
+    || !getLogicalLayout(output, output_dimensionality, output_sizes, output_strides)
+  )
   {
-    mMappingLookup.at(i) = mapping->lookUp(i);
+    plan.invalidReason = "Input or output do not have the dimensionality of the mapping.";
+    return;
   }
-  CEDAR_DEBUG_ASSERT(mMappingLookup.size() == 2);
-  T value;
-  int x;
-  int y;
-  int target_index;
-  if (std::find(mMappingLookup.begin(), mMappingLookup.end(), 0) == mMappingLookup.end()) // expand over dim 0
+
+  // every dimension of the input and every output dimension that is not mapped from the input becomes a loop
+  std::vector<Loop> loops;
+  std::vector<bool> output_dimension_mapped(output_dimensionality, false);
+  plan.compresses = false;
+  plan.numberOfCompressedEntries = 1.0;
+  for (unsigned int input_dim = 0; input_dim < input_dimensionality; ++input_dim)
   {
-    if (mMappingLookup.at(0) == 1) // not flipped
+    Loop loop = {input_sizes.at(input_dim), input_strides.at(input_dim), 0};
+    if (mapping->isDropped(input_dim))
     {
-      for (x = 0; x < input.size[0]; ++x)
-      {
-        for (y = 0; y < input.size[1]; ++y)
-        {
-          value = input.at<T>(x, y);
-          for (target_index = 0; target_index < output.size[0]; ++ target_index)
-          {
-            output.at<T>(target_index, x, y) = value;
-          }
-        }
-      }
+      plan.compresses = true;
+      plan.numberOfCompressedEntries *= input_sizes.at(input_dim);
     }
-    else // flipped
+    else
     {
-      for (x = 0; x < input.size[0]; ++x)
+      unsigned int output_dim = mapping->lookUp(input_dim);
+      if
+      (
+        output_dim >= output_dimensionality
+        || output_dimension_mapped.at(output_dim)
+        || output_sizes.at(output_dim) != input_sizes.at(input_dim)
+      )
       {
-        for (y = 0; y < input.size[1]; ++y)
-        {
-          value = input.at<T>(x, y);
-          for (target_index = 0; target_index < output.size[0]; ++ target_index)
-          {
-            output.at<T>(target_index, y, x) = value;
-          }
-        }
+        plan.invalidReason = "Input dimension " + cedar::aux::toString(input_dim) + " does not fit the output.";
+        return;
       }
+      output_dimension_mapped.at(output_dim) = true;
+      loop.outputStride = output_strides.at(output_dim);
     }
+    loops.push_back(loop);
   }
-  else if (std::find(mMappingLookup.begin(), mMappingLookup.end(), 1) == mMappingLookup.end()) // expand over dim 1
+
+  for (unsigned int output_dim = 0; output_dim < output_dimensionality; ++output_dim)
   {
-    if (mMappingLookup.at(0) == 0) // not flipped
-    {
-      for (x = 0; x < input.size[0]; ++x)
-      {
-        for (y = 0; y < input.size[1]; ++y)
-        {
-          value = input.at<T>(x, y);
-          for (target_index = 0; target_index < output.size[1]; ++ target_index)
-          {
-            output.at<T>(x, target_index, y) = value;
-          }
-        }
-      }
-    }
-    else // flipped
+    if (!output_dimension_mapped.at(output_dim))
     {
-      for (x = 0; x < input.size[0]; ++x)
-      {
-        for (y = 0; y < input.size[1]; ++y)
-        {
-          value = input.at<T>(x, y);
-          for (target_index = 0; target_index < output.size[0]; ++ target_index)
-          {
-            output.at<T>(y, target_index, x) = value;
-          }
-        }
-      }
+      Loop loop = {output_sizes.at(output_dim), 0, output_strides.at(output_dim)};
+      loops.push_back(loop);
     }
   }
-  else if (std::find(mMappingLookup.begin(), mMappingLookup.end(), 2) == mMappingLookup.end()) // expand over dim 2
-  {
-    if (mMappingLookup.at(0) == 0) // not flipped
-    {
-      for (x = 0; x < input.size[0]; ++x)
-      {
-        for (y = 0; y < input.size[1]; ++y)
-        {
-          value = input.at<T>(x, y);
-          for (target_index = 0; target_index < output.size[2]; ++target_index)
-          {
-            output.at<T>(x, y, target_index) = value;
-          }
-        }
-      }
-    }
-    else // flipped
+
+  // loops of length one do not contribute anything
+  loops.erase
+  (
+    std::remove_if(loops.begin(), loops.end(), [](const Loop& loop) { return loop.size == 1; }),
+    loops.end()
+  );
+
+  // walk through the larger of the two matrices in memory order: the input when compressing, the output otherwise
+  bool compresses = plan.compresses;
+  std::stable_sort
+  (
+    loops.begin(),
+    loops.end(),
+    [compresses](const Loop& a, const Loop& b)
     {
-      for (x = 0; x < input.size[0]; ++x)
+      std::ptrdiff_t a_primary = std::abs(compresses ? a.inputStride : a.outputStride);
+      std::ptrdiff_t b_primary = std::abs(compresses ? b.inputStride : b.outputStride);
+      if (a_primary != b_primary)
       {
-        for (y = 0; y < input.size[1]; ++y)
-        {
-          value = input.at<T>(x, y);
-          for (target_index = 0; target_index < output.size[2]; ++ target_index)
-          {
-            output.at<T>(y, x, target_index) = value;
-          }
-        }
+        return a_primary > b_primary;
       }
+      std::ptrdiff_t a_secondary = std::abs(compresses ? a.outputStride : a.inputStride);
+      std::ptrdiff_t b_secondary = std::abs(compresses ? b.outputStride : b.inputStride);
+      return a_secondary > b_secondary;
     }
-  }
-  else
-  {
-    CEDAR_ASSERT(false);
-  }
-}
+  );
 
-void cedar::proc::steps::Projection::expand1Dto3D()
-{
-  switch (mInput->getCvType())
+  // merge loops that walk through contiguous memory in both matrices
+  std::vector<Loop> merged;
+  for (const auto& loop : loops)
   {
-    case CV_32F:
+    if
+    (
+      !merged.empty()
+      && merged.back().inputStride == loop.inputStride * loop.size
+      && merged.back().outputStride == loop.outputStride * loop.size
+    )
     {
-      this->expand1Dto3D<float>();
-      break;
+      merged.back().size *= loop.size;
+      merged.back().inputStride = loop.inputStride;
+      merged.back().outputStride = loop.outputStride;
     }
-    case CV_64F:
+    else
     {
-      this->expand1Dto3D<double>();
-      break;
+      merged.push_back(loop);
     }
-    default:
-      CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot project matrices of this type.");
   }
-}
 
-template<typename T>
-void cedar::proc::steps::Projection::expand1Dto3D()
-{
-  const cv::Mat& input = this->mInput->getData();
-  cv::Mat& output = this->mOutput->getData();
-  // sanity check
-  CEDAR_DEBUG_ASSERT
-  (
-    cedar::aux::math::getDimensionalityOf(input) == 1
-      && cedar::aux::math::getDimensionalityOf(output) == 3
-  );
-  auto mapping = _mDimensionMappings->getValue();
-  unsigned int number_of_mappings = mapping->getNumberOfMappings();
-  unsigned int i = 0;
-  // do this lookup only once, assuming that mapping does not change at run time...
-  mMappingLookup.resize(number_of_mappings);
-  for (i = 0; i < number_of_mappings; ++i)
+  // for parallel computation, the outermost loop that writes to different parts of the output provides the slices
+  plan.slices = {1, 0, 0};
+  if (plan.parallel)
   {
-    mMappingLookup.at(i) = mapping->lookUp(i);
-  }
-  CEDAR_DEBUG_ASSERT(mMappingLookup.size() == 1);
-  switch (mMappingLookup.at(0))
-  {
-    // do not allocate these for every for loop
-    int x;
-    int y;
-    case 0:
-    {
-      T value;
-      // outer loop
-      for (int source_index = 0; source_index < input.rows; ++ source_index)
-      {
-        // get value
-        value = input.at<T>(source_index, 0);
-        for (x = 0; x < output.size[1]; ++x)
-        {
-          for (y = 0; y < output.size[2]; ++y)
-          {
-            output.at<T>(source_index, x, y) = value;
-          }
-        }
-      }
-      break;
-    }
-    case 1:
-    {
-      T value;
-      // outer loop
-      for (int source_index = 0; source_index < input.rows; ++ source_index)
-      {
-        // get value
-        value = input.at<T>(source_index, 0);
-        for (x = 0; x < output.size[0]; ++x)
-        {
-          for (y = 0; y < output.size[2]; ++y)
-          {
-            output.at<T>(x, source_index, y) = value;
-          }
-        }
-      }
-      break;
-    }
-    case 2:
+    for (size_t i = 0; i < merged.size(); ++i)
     {
-      T value;
-      // outer loop
-      for (int source_index = 0; source_index < input.rows; ++ source_index)
+      if (merged.at(i).outputStride != 0 && (i + 1 < merged.size() || merged.size() == 1))
       {
-        // get value
-        value = input.at<T>(source_index, 0);
-        for (x = 0; x < output.size[0]; ++x)
-        {
-          for (y = 0; y < output.size[1]; ++y)
-          {
-            output.at<T>(x, y, source_index) = value;
-          }
-        }
+        plan.slices = merged.at(i);
+        merged.erase(merged.begin() + i);
+        break;
       }
-      break;
-    }
-    default:
-    {
-      CEDAR_ASSERT(false);
     }
   }
-}
 
-void cedar::proc::steps::Projection::expandMDtoND()
-{
-  switch (mInput->getCvType())
+  plan.inner = {1, 0, 0};
+  if (!merged.empty())
   {
-    case CV_32F:
-    {
-      this->expandMDtoND<float>();
-      break;
-    }
-    case CV_64F:
-    {
-      this->expandMDtoND<double>();
-      break;
-    }
-    default:
-      CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot project matrices of this type.");
+    plan.inner = merged.back();
+    merged.pop_back();
   }
-}
 
-template<typename T>
-void cedar::proc::steps::Projection::expandMDtoND()
-{
-  unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(this->mInput->getData());
-
-  // create an iterator for the output matrix
-  cedar::aux::MatrixIterator output_iterator(mOutput->getData());
-
-  // iterate through all elements of the output matrix
-  std::vector<int> input_index;
-  input_index.resize(input_dimensionality);
-  // if the input dimensionality is 1 ...
-  if (input_dimensionality == 1)
+  // precompute the offsets of all iterations of the remaining loops
+  size_t number_of_offsets = 1;
+  for (const auto& loop : merged)
   {
-    // ... we still need to have an index tuple because of OpenCV limitations
-    input_index.push_back(0);
+    number_of_offsets *= static_cast<size_t>(loop.size);
   }
+  plan.inputOffsets.resize(number_of_offsets);
+  plan.outputOffsets.resize(number_of_offsets);
 
-  auto mapping = _mDimensionMappings->getValue();
-  unsigned int number_of_mappings = mapping->getNumberOfMappings();
-  unsigned int i = 0;
-  // do this lookup only once, assuming that mapping does not change at run time...
-  mMappingLookup.resize(number_of_mappings);
-  for (i = 0; i < number_of_mappings; ++i)
-  {
-    mMappingLookup.at(i) = mapping->lookUp(i);
-  }
-  do
+  std::vector<int> index(merged.size(), 0);
+  std::ptrdiff_t input_offset = 0;
+  std::ptrdiff_t output_offset = 0;
+  for (size_t i = 0; i < number_of_offsets; ++i)
   {
-    // get index pointing to the current element in the output matrix
-    const std::vector<int>& output_index = output_iterator.getCurrentIndexVector();
+    plan.inputOffsets.at(i) = input_offset;
+    plan.outputOffsets.at(i) = output_offset;
 
-    // compute the corresponding index in the input matrix
-    for (i = 0; i < number_of_mappings; ++i)
+    // increment the index, last loop first
+    for (size_t l = merged.size(); l > 0; --l)
     {
-      input_index[i] = output_index.at(mMappingLookup.at(i));
+      const Loop& loop = merged.at(l - 1);
+      input_offset += loop.inputStride;
+      output_offset += loop.outputStride;
+      if (++index.at(l - 1) < loop.size)
+      {
+        break;
+      }
+      input_offset -= loop.inputStride * loop.size;
+      output_offset -= loop.outputStride * loop.size;
+      index.at(l - 1) = 0;
     }
-
-    // copy the activation value in the input matrix to the corresponding output matrix
-    mOutput->getData().at<T>(&(output_index.front()))
-        = mInput->getData().at<T>(&(input_index.front()));
   }
-  while (output_iterator.increment());
+
+  plan.valid = true;
 }
 
-void cedar::proc::steps::Projection::compress2Dto1D()
+bool cedar::proc::steps::Projection::projectionPlanMatches() const
 {
-  CEDAR_DEBUG_ASSERT(mIndicesToCompress.size() == 1);
-
-  cv::reduce(mInput->getData(), mOutput->getData(), mIndicesToCompress.at(0), _mCompressionType->getValue());
-
-  if (mOutput->getData().rows == 1)
-  {
-    mOutput->getData() = mOutput->getData().t();
-  }
+  return this->mPlan->parallel == this->_mParallelize->getValue()
+         && layoutMatches(this->mInput->getData(), this->mPlan->inputLayout)
+         && layoutMatches(this->mOutput->getData(), this->mPlan->outputLayout);
 }
 
-void cedar::proc::steps::Projection::compress3Dto2D()
+void cedar::proc::steps::Projection::project()
 {
   switch (mInput->getCvType())
   {
     case CV_32F:
     {
-      this->compress3Dto2D<float>();
+      this->project<float>();
       break;
     }
     case CV_64F:
     {
-      this->compress3Dto2D<double>();
+      this->project<double>();
       break;
     }
     default:
@@ -783,109 +870,54 @@ void cedar::proc::steps::Projection::compress3Dto2D()
 }
 
 template<typename T>
-void cedar::proc::steps::Projection::compress3Dto2D()
+void cedar::proc::steps::Projection::project()
 {
-  CEDAR_DEBUG_ASSERT(mIndicesToCompress.size() == 1);
-
-  cedar::aux::math::reduceCvMat3D<T>
-  (
-    mInput->getData(),
-    mOutput->getData(),
-    mIndicesToCompress.at(0),
-    _mCompressionType->getValue(),
-    false // don't flip
-  );
-}
-
-void cedar::proc::steps::Projection::compress3Dto2DSwapped()
-{
-  switch (mInput->getCvType())
+  if (!this->projectionPlanMatches())
   {
-    case CV_32F:
-    {
-      this->compress3Dto2DSwapped<float>();
-      break;
-    }
-    case CV_64F:
-    {
-      this->compress3Dto2DSwapped<double>();
-      break;
-    }
-    default:
-      CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot project matrices of this type.");
+    this->updateProjectionPlan();
   }
-}
 
-template<typename T>
-void cedar::proc::steps::Projection::compress3Dto2DSwapped()
-{
-  CEDAR_DEBUG_ASSERT(mIndicesToCompress.size() == 1);
-
-  cedar::aux::math::reduceCvMat3D<T>
-  (
-    mInput->getData(),
-    mOutput->getData(),
-    mIndicesToCompress.at(0),
-    _mCompressionType->getValue(),
-    true // don't flip
-  );
-}
-
-void cedar::proc::steps::Projection::compress3Dto1D()
-{
-  switch (mInput->getCvType())
+  const cedar::proc::steps::ProjectionScope::ProjectionPlan& plan = *this->mPlan;
+  if (!plan.valid)
   {
-    case CV_32F:
-    {
-      this->compress3Dto1D<float>();
-      break;
-    }
-    case CV_64F:
-    {
-      this->compress3Dto1D<double>();
-      break;
-    }
-    default:
-      CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot project matrices of this type.");
+    // the step shows this as its exception state
+    CEDAR_THROW(cedar::proc::InvalidObjectException, "Cannot project: " + plan.invalidReason);
   }
-}
 
-template<typename T>
-void cedar::proc::steps::Projection::compress3Dto1D()
-{
-  CEDAR_DEBUG_ASSERT(mIndicesToCompress.size() == 2);
-
-  unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(this->mInput->getData());
-
-  // the compression from 3D to 1D first compresses the input
-  // cube to a temporary 2D matrix and then compresses that to 1D
+  const cv::Mat& input = this->mInput->getData();
+  cv::Mat& output = this->mOutput->getData();
 
-  // in order to do that, we first have to find a vector containing
-  // the sizes of the temporary 2D matrix ...
-  std::vector<int> sizes;
-  for (unsigned int i = 0; i < input_dimensionality; ++i)
+  if (!plan.compresses)
   {
-    if (i != mIndicesToCompress.at(0))
-    {
-      sizes.push_back(mInput->getData().size[i]);
-    }
+    runPlan<T, Assign>(plan, input, output);
+    return;
   }
 
-  // ... and create the temporary 2D matrix with those sizes
-  cv::Mat tmp_2d(input_dimensionality - 1, &sizes.front(), mInput->getCvType(), cv::Scalar(0.0));
+  switch (_mCompressionType->getValue())
+  {
+    case cedar::proc::steps::Projection::CompressionType::SUM:
+      runPlan<T, Sum>(plan, input, output);
+      break;
 
-  // reduce the 3D input to the (temporary) 2D matrix
-  cedar::aux::math::reduceCvMat3D<T>(mInput->getData(), tmp_2d, mIndicesToCompress.at(0), _mCompressionType->getValue());
+    case cedar::proc::steps::Projection::CompressionType::AVERAGE:
+      runPlan<T, Sum>(plan, input, output);
+      output.convertTo(output, -1, 1.0 / plan.numberOfCompressedEntries);
+      break;
 
-  // reduce the temporary 2D matrix to the final 1D output of the projection
-  cv::reduce(tmp_2d, mOutput->getData(), mIndicesToCompress.at(1) - 1, _mCompressionType->getValue());
+    case cedar::proc::steps::Projection::CompressionType::MAXIMUM:
+      runPlan<T, Maximum>(plan, input, output);
+      break;
 
-  if (mOutput->getData().rows == 1)
-  {
-    mOutput->getData() = mOutput->getData().t();
+    case cedar::proc::steps::Projection::CompressionType::MINIMUM:
+      runPlan<T, Minimum>(plan, input, output);
+      break;
+
+    default:
+      CEDAR_THROW(cedar::aux::UnknownTypeException, "Unknown compression type.");
   }
 }
 
+
 void cedar::proc::steps::Projection::compressNDto0Dsum()
 {
   switch (mInput->getCvType())
@@ -956,38 +988,12 @@ void cedar::proc::steps::Projection::compressNDto0Dmin()
 template<typename T>
 void cedar::proc::steps::Projection::compressNDto0Dmin()
 {
-  double minimum = std::numeric_limits<double>::max();
-  unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(this->mInput->getData());
-
-  // for a dimensionality below 3 ...
-  if (input_dimensionality < 3)
-  {
-    // ... we can use an OpenCV function to determine the minimum
-    double maximum;
-    cv::minMaxLoc(mInput->getData(), &minimum, &maximum);
-  }
-  // for all other dimensionalities, we have to iterate through the
-  // input matrix and find the minimum ourselves
-  else
-  {
-    // create an iterator for the input matrix
-    cedar::aux::MatrixIterator matrix_iterator(mInput->getData());
-
-    // iterate over input matrix and find the maximum value
-    do
-    {
-      double current_value = mInput->getData().at<T>(matrix_iterator.getCurrentIndex());
-
-      if (current_value < minimum)
-      {
-        minimum = current_value;
-      }
-    }
-    while (matrix_iterator.increment());
-  }
+  // minMaxIdx handles matrices of any dimensionality
+  double minimum;
+  cv::minMaxIdx(mInput->getData(), &minimum, nullptr);
 
   // set the minimum of the input matrix as the output of the projection
-  mOutput->getData().at<T>(0) = minimum;
+  mOutput->getData().at<T>(0) = static_cast<T>(minimum);
 }
 
 void cedar::proc::steps::Projection::compressNDto0Dmax()
@@ -1012,38 +1018,12 @@ void cedar::proc::steps::Projection::compressNDto0Dmax()
 template<typename T>
 void cedar::proc::steps::Projection::compressNDto0Dmax()
 {
-  double maximum = std::numeric_limits<double>::min();
-  unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(this->mInput->getData());
-
-  // for a dimensionality below 3 ...
-  if (input_dimensionality < 3)
-  {
-    // ... we can use an OpenCV function to determine the maximum
-    double minimum;
-    cv::minMaxLoc(mInput->getData(), &minimum, &maximum);
-  }
-  // for all other dimensionalities, we have to iterate through the
-  // input matrix and find the maximum ourselves
-  else
-  {
-    // create an iterator for the input matrix
-    cedar::aux::MatrixIterator matrix_iterator(mInput->getData());
-
-    // iterate over input matrix and find the maximum value
-    do
-    {
-      double current_value = mInput->getData().at<T>(matrix_iterator.getCurrentIndex());
-
-      if (current_value > maximum)
-      {
-        maximum = current_value;
-      }
-    }
-    while (matrix_iterator.increment());
-  }
+  // minMaxIdx handles matrices of any dimensionality
+  double maximum;
+  cv::minMaxIdx(mInput->getData(), nullptr, &maximum);
 
   // set the maximum of the input matrix as the output of the projection
-  mOutput->getData().at<T>(0) = maximum;
+  mOutput->getData().at<T>(0) = static_cast<T>(maximum);
 }
 
 cedar::proc::DataSlot::VALIDITY cedar::proc::steps::Projection::determineInputValidity
@@ -44,6 +44,7 @@
 #include "cedar/auxiliaries/UIntParameter.h"
 #include "cedar/auxiliaries/UIntVectorParameter.h"
 #include "cedar/auxiliaries/EnumParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/opencv_helper.h"
 
 // FORWARD DECLARATIONS
@@ -52,13 +53,31 @@
 
 // SYSTEM INCLUDES
 #include <vector>
+#include <memory>
 
+//!@cond SKIPPED_DOCUMENTATION
+namespace cedar
+{
+  namespace proc
+  {
+    namespace steps
+    {
+      namespace ProjectionScope
+      {
+        struct ProjectionPlan;
+      }
+    }
+  }
+}
+//!@endcond
 
 /*!@brief Processing step, which projects neuronal activation between processing steps of different dimensionality.
  *
  * This processing step can be set up to project the output activation of a step A onto step B, where A and B may have
  * a different dimensionality. The projection supports the reduction of dimensionality (A.dims() > B.dims()), the
- * expansion (A.dims() < B.dims()) and also permutation of dimensions (e.g., for A.dims() == B.dims()).
+ * expansion (A.dims() < B.dims()) and also permutation of dimensions (e.g., for A.dims() == B.dims()). Input and
+ * output may have any dimensionality; except for compressions to 0D, all projections are computed by the same strided
+ * loops, which are precomputed whenever the configuration changes (see updateProjectionPlan).
  */
 class cedar::proc::steps::Projection : public cedar::proc::Step
 {
@@ -135,6 +154,9 @@ public:
   //!@brief standard constructor
   Projection();
 
+  //!@brief Destructor
+  ~Projection();
+
   //--------------------------------------------------------------------------------------------------------------------
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -182,34 +204,25 @@ private:
   //!@brief initializes or reconfigures the output matrix
   void initializeOutputMatrix();
 
-  // projection methods
-
-  //!@brief expands a 0D input to an ND output
-  void expand0DtoND();
-  //!@brief expands a 0D input to an ND output (templated)
-  template<typename T>
-  void expand0DtoND();
+  /*!@brief Precomputes the loops and offsets that map the current input onto the current output.
+   *
+   *        All dimensions of input and output are turned into loops that know their stride in the input (zero for
+   *        dimensions that are broadcast) and in the output (zero for dimensions that are compressed). Loops over
+   *        contiguous memory are merged, the innermost one is run by a tight kernel and the offsets of all outer ones
+   *        are stored in flat lists, so compute does not have to do any index arithmetic.
+   */
+  void updateProjectionPlan();
 
-  //!@brief expands a 1D input to an 2D output
-  void expand1Dto2D();
+  //!@brief returns whether the projection plan was made for the current input, output and settings
+  bool projectionPlanMatches() const;
 
-  //!@brief expands a 1D input to an 3D output
-  void expand1Dto3D();
-  //!@brief expands a 1D input to an 3D output (templated)
-  template<typename T>
-  void expand1Dto3D();
-
-  //!@brief expands a 2D input to an 3D output
-  void expand2Dto3D();
-  //!@brief expands a 2D input to an 3D output
-  template<typename T>
-  void expand2Dto3D();
+  // projection methods
 
-  //!@brief expands and permutes MD input to ND output (M <= N)
-  void expandMDtoND();
-  //!@brief expands and permutes MD input to ND output (M <= N) (templated)
+  //!@brief projects MD input to ND output for any M and N using the precomputed projection plan
+  void project();
+  //!@brief projects MD input to ND output for any M and N using the precomputed projection plan (templated)
   template<typename T>
-  void expandMDtoND();
+  void project();
 
   //!@brief compresses ND input to 0D output by computing the minimum over all positions
   void compressNDto0Dmin();
@@ -232,27 +245,6 @@ private:
   template<typename T>
   void compressNDto0Dmean();
 
-  //!@brief compresses 3D input to 2D output
-  void compress3Dto2D();
-  //!@brief compresses 3D input to 2D output
-  template<typename T>
-  void compress3Dto2D();
-
-  //!@brief compresses 3D input to 2D output and swap the two remaining dimensions
-  void compress3Dto2DSwapped();
-  //!@brief compresses 3D input to 2D output and swap the two remaining dimensions
-  template<typename T>
-  void compress3Dto2DSwapped();
-
-  //!@brief compresses 3D input to 1D output
-  void compress3Dto1D();
-  //!@brief compresses 3D input to 1D output
-  template<typename T>
-  void compress3Dto1D();
-
-  //!@brief compresses 2D input to 1D output
-  void compress2Dto1D();
-
   //!@brief gets called once by cedar::proc::LoopedTrigger once prior to starting the trigger
   virtual void onStart();
   //!@brief gets called once by cedar::proc::LoopedTrigger after it stops
@@ -270,9 +262,8 @@ protected:
 private:
   //!@brief function pointer to one of the projection member functions
   ProjectionFunctionPtr mpProjectionMethod;
-  //!@brief vector holding all indices of dimensions that have to be compressed
-  //! this is only in use when the projection is set up to compress the dimensionality of the input
-  std::vector<unsigned int> mIndicesToCompress;
+  //!@brief loops and offsets used by project, see updateProjectionPlan
+  std::unique_ptr<cedar::proc::steps::ProjectionScope::ProjectionPlan> mPlan;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
@@ -292,8 +283,8 @@ private:
   //!@brief type of compression used when reducing the dimensionality (maximum, minimum, average, sum)
   cedar::aux::EnumParameterPtr _mCompressionType;
 
-  //!@brief a lookup table for mappings
-  std::vector<unsigned int> mMappingLookup;
+  //!@brief whether slices of the output are computed in parallel
+  cedar::aux::BoolParameterPtr _mParallelize;
 }; // class cedar::proc::steps::Projection
 
 #endif // CEDAR_PROC_STEPS_PROJECTION_H
@@ -80,10 +80,14 @@ SOFTWARE.
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <boost/filesystem.hpp>
 #include "numpy/ndarrayobject.h"
 
 #include <QReadWriteLock>
 #include <QRegExpValidator>
+#include <ctime>
+#include <fstream>
+#include <sstream>
 
 
 
@@ -181,7 +185,7 @@ public:
     void allocate(int dims, const int* sizes, int type, int*& refcount,
                   uchar*& datastart, uchar*& data, size_t* step)
     {
-      //PyEnsureGIL gil;
+      cedar::proc::steps::PythonScriptScope::PyEnsureGIL gil;
       int depth = CV_MAT_DEPTH(type);
       int cn = CV_MAT_CN(type);
       const int f = (int)(sizeof(size_t)/8);
@@ -215,7 +219,7 @@ public:
 
     void deallocate(int* refcount, uchar*, uchar*)
     {
-      //PyEnsureGIL gil;
+      cedar::proc::steps::PythonScriptScope::PyEnsureGIL gil;
       if( !refcount )
         return;
 
@@ -256,7 +260,7 @@ public:
             // probably this is safe to do in such extreme case
             return stdAllocator->allocate(dims0, sizes, type, data, step, flags, usageFlags);
         }
-        //PyEnsureGIL gil;
+        PyEnsureGIL gil;
 
         int depth = CV_MAT_DEPTH(type);
         int cn = CV_MAT_CN(type);
@@ -286,7 +290,7 @@ public:
     {
         if (!u)
             return;
-        //PyEnsureGIL gil;
+        PyEnsureGIL gil;
         CV_Assert(u->urefcount >= 0);
         CV_Assert(u->refcount >= 0);
         if (u->refcount == 0)
@@ -328,7 +332,7 @@ public:
             // probably this is safe to do in such extreme case
             return stdAllocator->allocate(dims0, sizes, type, data, step, flags, usageFlags);
         }
-        //PyEnsureGIL gil;
+        PyEnsureGIL gil;
 
         int depth = CV_MAT_DEPTH(type);
         int cn = CV_MAT_CN(type);
@@ -358,7 +362,7 @@ public:
     {
         if (!u)
             return;
-        //PyEnsureGIL gil;
+        PyEnsureGIL gil;
         CV_Assert(u->urefcount >= 0);
         CV_Assert(u->refcount >= 0);
         if (u->refcount == 0)
@@ -377,6 +381,80 @@ public:
 
 cedar::proc::steps::PythonScriptScope::NumpyAllocator g_numpyAllocator;
 
+//!@brief Python objects a PythonScript keeps between two executions. Must only be used while holding the GIL.
+class cedar::proc::steps::PythonScriptScope::ExecutionCache
+{
+public:
+  //! The compiled script; None while the script has not been compiled (successfully).
+  boost::python::object code;
+
+  //! Whether code was compiled from the script file rather than from the code parameter.
+  bool compiledFromFile = false;
+
+  //! Modification time of the script file at the time it was compiled.
+  std::time_t scriptFileTime = 0;
+
+  //! Matrix exposed to the script for inputs that are not connected.
+  cv::Mat emptyInput = cv::Mat::zeros(1, 1, CV_32F);
+
+  //! The matrices currently viewed by the entries of inputViews and outputViews.
+  std::vector<cv::Mat> inputMatrices;
+  std::vector<cv::Mat> outputMatrices;
+
+  //! Numpy arrays sharing the buffers of inputMatrices (read-only) and outputMatrices (writeable).
+  std::vector<boost::python::object> inputViews;
+  std::vector<boost::python::object> outputViews;
+
+  //! The lists published as pc.inputs and pc.outputs.
+  boost::python::list inputs;
+  boost::python::list outputs;
+};
+
+namespace
+{
+  //! Capsule destructor releasing the matrix that backs a numpy view.
+  void releaseViewedMatrix(PyObject* capsule)
+  {
+    delete static_cast<cv::Mat*>(PyCapsule_GetPointer(capsule, nullptr));
+  }
+
+  //! Returns true if both matrices describe the same memory with the same layout.
+  bool sharesBuffer(const cv::Mat& a, const cv::Mat& b)
+  {
+    if (a.data != b.data || a.type() != b.type() || a.dims != b.dims)
+    {
+      return false;
+    }
+    for (int d = 0; d < a.dims; ++d)
+    {
+      if (a.size[d] != b.size[d] || a.step[d] != b.step[d])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! Sets the entries of the list to the given objects, rebuilding it if its length changed.
+  void fillList(boost::python::list& list, const std::vector<boost::python::object>& items)
+  {
+    if (static_cast<size_t>(boost::python::len(list)) != items.size())
+    {
+      list = boost::python::list();
+      for (const auto& item : items)
+      {
+        list.append(item);
+      }
+      return;
+    }
+
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+      list[i] = items[i];
+    }
+  }
+}
+
 
 // static member decleration
 int cedar::proc::steps::PythonScriptScope::NDArrayConverter::isInitialized = 0;
@@ -720,6 +798,54 @@ PyObject* cedar::proc::steps::PythonScriptScope::NDArrayConverter::toNDArray(con
 
 
 
+PyObject* cedar::proc::steps::PythonScriptScope::NDArrayConverter::toNDArrayView(const cv::Mat& m, bool writeable)
+{
+  if( !m.data )
+  {
+    Py_RETURN_NONE;
+  }
+
+  int depth = m.depth();
+  int cn = m.channels();
+  const int f = (int)(sizeof(size_t) / 8);
+  int typenum = depth == CV_8U ? NPY_UBYTE : depth == CV_8S ? NPY_BYTE :
+      depth == CV_16U ? NPY_USHORT : depth == CV_16S ? NPY_SHORT :
+      depth == CV_32S ? NPY_INT : depth == CV_32F ? NPY_FLOAT :
+      depth == CV_64F ? NPY_DOUBLE : f * NPY_ULONGLONG + (f ^ 1) * NPY_UINT;
+
+  // same layout as produced by the numpy allocator: channels become the last dimension
+  int dims = m.dims;
+  npy_intp sizes[CV_MAX_DIM + 1];
+  npy_intp strides[CV_MAX_DIM + 1];
+  for (int i = 0; i < dims; ++i)
+  {
+    sizes[i] = m.size[i];
+    strides[i] = static_cast<npy_intp>(m.step[i]);
+  }
+  if (cn > 1)
+  {
+    sizes[dims] = cn;
+    strides[dims] = static_cast<npy_intp>(m.elemSize1());
+    ++dims;
+  }
+
+  int flags = NPY_ARRAY_ALIGNED | (writeable ? NPY_ARRAY_WRITEABLE : 0);
+  PyObject* array = PyArray_New(&PyArray_Type, dims, sizes, typenum, strides, m.data, 0, flags, nullptr);
+  if (!array)
+  {
+    return nullptr;
+  }
+
+  // the array does not own its data; the capsule keeps the matrix buffer alive for as long as the array exists
+  PyObject* owner = PyCapsule_New(new cv::Mat(m), nullptr, &releaseViewedMatrix);
+  if (!owner || PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(array), owner) != 0)
+  {
+    Py_DECREF(array);
+    return nullptr;
+  }
+  return array;
+}
+
 void printFromPython(PyObject* obj)
 {
   char const* text = boost::python::extract<const char*>(obj);
@@ -808,6 +934,7 @@ cedar::proc::Step(isLooped)
 ,
 mInputs(1, cedar::aux::MatDataPtr()),
 mOutputs(1, cedar::aux::MatDataPtr(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F)))),
+mRecompileScript(true),
 
 // Declare Properties
 _mCodeStringForSavingArchitecture (new cedar::aux::StringParameter(this, "code", "import numpy as np\nimport pycedar as pc\n\n#Print to messages tab:\n# pc.messagePrint('text')\n# pc.messagePrint(str(...))\n\n#Inputs: (NumPy Arrays)\n# pc.inputs[0]\n# pc.inputs[1]\n# ...\n\n#Outputs:\n# pc.outputs[0]\n# pc.outputs[1]\n# ...\n\n\ninput = pc.inputs[0]\n\npc.outputs[0] = input * 2\n")),
@@ -824,6 +951,9 @@ _mAutoConvertDoubleToFloat (new cedar::aux::BoolParameter(this, "auto-convert do
   QObject::connect(this->_mHasScriptFile.get(), SIGNAL(valueChanged()), this, SLOT(hasScriptFileChanged()));
   QObject::connect(_mNumberOfInputs.get(), SIGNAL(valueChanged()), this, SLOT(numberOfInputsChanged()));
   QObject::connect(_mNumberOfOutputs.get(), SIGNAL(valueChanged()), this, SLOT(numberOfOutputsChanged()));
+  QObject::connect(_mCodeStringForSavingArchitecture.get(), SIGNAL(valueChanged()), this, SLOT(scriptChanged()));
+  QObject::connect(_mHasScriptFile.get(), SIGNAL(valueChanged()), this, SLOT(scriptChanged()));
+  QObject::connect(_mScriptFile.get(), SIGNAL(valueChanged()), this, SLOT(scriptChanged()));
 
   this->_mScriptFile->setConstant(true);
   this->_mCodeStringForSavingArchitecture->setHidden(true);
@@ -834,18 +964,35 @@ _mAutoConvertDoubleToFloat (new cedar::aux::BoolParameter(this, "auto-convert do
   
   cedar::proc::steps::PythonScript::executionFailed = 0;
 
+  if (!Py_IsInitialized())
+  {
 #if PY_MAJOR_VERSION >= 3
-  PyImport_AppendInittab("pycedar", &PyInit_pycedar);
+    PyImport_AppendInittab("pycedar", &PyInit_pycedar);
 #else // PY_MAJOR_VERSION >= 3
-  PyImport_AppendInittab("pycedar", &initpycedar);
-  PyEval_InitThreads();
+    PyImport_AppendInittab("pycedar", &initpycedar);
+    PyEval_InitThreads();
 #endif // PY_MAJOR_VERSION >= 3
 
-  Py_Initialize();
+    Py_Initialize();
 
+#if PY_MAJOR_VERSION >= 3 && PY_VERSION_HEX < 0x03070000
+    PyEval_InitThreads();
+#endif // PY_MAJOR_VERSION >= 3 && PY_VERSION_HEX < 0x03070000
+
+    // Py_Initialize leaves the GIL with this thread; release it so that scripts can acquire it from any thread.
+    PyEval_SaveThread();
+  }
 }
 
-cedar::proc::steps::PythonScript::~PythonScript() { }
+cedar::proc::steps::PythonScript::~PythonScript()
+{
+  if (this->mExecutionCache)
+  {
+    // the cached python objects may only be released while holding the GIL
+    cedar::proc::steps::PythonScriptScope::PyEnsureGIL gil;
+    this->mExecutionCache.reset();
+  }
+}
 
 template<typename T>
 cv::Mat cedar::proc::steps::PythonScript::convert3DMatToFloat(cv::Mat &mat)
@@ -878,6 +1025,11 @@ void cedar::proc::steps::PythonScript::hasScriptFileChanged()
   }
 }
 
+void cedar::proc::steps::PythonScript::scriptChanged()
+{
+  this->mRecompileScript = true;
+}
+
 void cedar::proc::steps::PythonScript::numberOfInputsChanged()
 {
   unsigned newsize = _mNumberOfInputs->getValue();
@@ -1211,279 +1363,304 @@ void cedar::proc::steps::PythonScript::freePythonVariables() {
   Py_DecRef(poAttrList);
 }
 
-void cedar::proc::steps::PythonScript::executePythonScript()
+void cedar::proc::steps::PythonScript::updateCompiledScript()
 {
-  mutex.lock();
+  cedar::proc::steps::PythonScriptScope::ExecutionCache& cache = *this->mExecutionCache;
 
-  this->mIsExecuting = 1;
-  cedar::proc::steps::PythonScript::executionFailed = 0;
+  // Use the script file if the hasScriptFile parameter is set and the file exists, the code parameter otherwise
+  bool from_file = false;
+  std::string file_name;
+  std::time_t file_time = 0;
+  if(this->_mHasScriptFile->getValue())
+  {
+    cedar::aux::Path path = this->_mScriptFile->getPath();
+    if(path.exists())
+    {
+      from_file = true;
+      file_name = path.absolute(false).toString(false);
+      boost::system::error_code error;
+      file_time = boost::filesystem::last_write_time(file_name, error);
+    }
+  }
 
-  nameOfExecutingStep = this->getName();
+  bool recompile = this->mRecompileScript.exchange(false);
+  if
+  (
+    !recompile
+    && !cache.code.is_none()
+    && from_file == cache.compiledFromFile
+    && (!from_file || file_time == cache.scriptFileTime)
+  )
+  {
+    return;
+  }
 
-  // Swap to the interpreter of this specific PythonScript step
-  
-  // Python...
-  try{
+  std::string source;
+  if(from_file)
+  {
+    std::ifstream file(file_name);
+    std::stringstream stream;
+    stream << file.rdbuf();
+    source = stream.str();
+  }
+  else
+  {
+    source = this->_mCodeStringForSavingArchitecture->getValue();
+  }
 
-    // Loading main module
-    boost::python::object main_module = boost::python::import("__main__");
-    boost::python::object main_namespace = main_module.attr("__dict__");
+  // Drop the old code object first so that a script that fails to compile is not replaced by its predecessor
+  cache.code = boost::python::object();
+  PyObject* code = Py_CompileString(source.c_str(), from_file ? file_name.c_str() : "<string>", Py_file_input);
+  if(code == nullptr)
+  {
+    boost::python::throw_error_already_set();
+  }
+  cache.code = boost::python::object(boost::python::handle<>(code));
+  cache.compiledFromFile = from_file;
+  cache.scriptFileTime = file_time;
+}
 
-    // Loading pycedar module
-    boost::python::object pycedar_module( (boost::python::handle<>(PyImport_ImportModule("pycedar"))) );
+void cedar::proc::steps::PythonScript::updateArrayViews
+     (
+       const std::vector<cv::Mat>& inputs,
+       const std::vector<cv::Mat>& outputs
+     )
+{
+  cedar::proc::steps::PythonScriptScope::ExecutionCache& cache = *this->mExecutionCache;
+  cedar::proc::steps::PythonScriptScope::NDArrayConverter cvt(this);
 
-    std::list<boost::python::handle<>> inputsList;
-    cedar::proc::steps::PythonScriptScope::NDArrayConverter cvt(this);
-    cedar::aux::annotation::ConstColorSpacePtr pColorSpaceAnnotation = nullptr;
-    for(unsigned int i = 0; i < mInputs.size(); i++)
+  // Inputs are exposed read-only: they view the buffers of the preceding steps
+  cache.inputMatrices.resize(inputs.size());
+  cache.inputViews.resize(inputs.size());
+  for(unsigned int i = 0; i < inputs.size(); i++)
+  {
+    const cv::Mat& input = inputs[i].empty() ? cache.emptyInput : inputs[i];
+    if(cache.inputViews[i].is_none() || !sharesBuffer(input, cache.inputMatrices[i]))
     {
-      cedar::aux::ConstDataPtr inputMatrixPointer = this->getInputSlot(makeInputSlotName(i))->getData();
-      if(inputMatrixPointer != 0)
-      {
-        // Lock input matrix
-        auto mat_data = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(inputMatrixPointer);
-        QReadLocker input_l(&mat_data->getLock());
-        try
-        {
-          if(pColorSpaceAnnotation == nullptr)
-          {
-            pColorSpaceAnnotation = inputMatrixPointer->getAnnotation<cedar::aux::annotation::ColorSpace>();
-          }
-        }
-        catch(std::exception)
-        {
-          pColorSpaceAnnotation = nullptr;
-        }
-        cv::Mat inputMatrix = mat_data->getData().clone();
-
-        // Unlock input matrix
-        input_l.unlock();
-        // Convert input matrix to numpy array
-        PyObject* inputMatrix_np = cvt.toNDArray(inputMatrix);
-        // Include it to Python
-        boost::python::handle<> inputMatrix_np_handle(inputMatrix_np);
-        inputsList.push_back(inputMatrix_np_handle);
+      cache.inputViews[i] = boost::python::object(boost::python::handle<>(cvt.toNDArrayView(input, false)));
+      cache.inputMatrices[i] = input;
+    }
+  }
 
-        // Old way: Setting the Input to pc.input1, pc.input2 etc.
-        /*
+  // Outputs start out as writeable views of the current output matrices so scripts can also fill them in place
+  cache.outputMatrices.resize(outputs.size());
+  cache.outputViews.resize(outputs.size());
+  for(unsigned int i = 0; i < outputs.size(); i++)
+  {
+    if(cache.outputViews[i].is_none() || !sharesBuffer(outputs[i], cache.outputMatrices[i]))
+    {
+      cache.outputViews[i] = boost::python::object(boost::python::handle<>(cvt.toNDArrayView(outputs[i], true)));
+      cache.outputMatrices[i] = outputs[i];
+    }
+  }
 
-        boost::python::object inputMatrix_object(inputMatrix_np_handle);
-        // Setting the input directly in the global pycedar scope
-        const char* attrName = std::string("input").append(std::to_string(i + 1)).c_str();
-        boost::python::scope(pycedar_module).attr(attrName) = inputMatrix_object;
+  // Scripts may replace list entries, so the lists are refilled on every call
+  fillList(cache.inputs, cache.inputViews);
+  fillList(cache.outputs, cache.outputViews);
+}
 
-        */
+void cedar::proc::steps::PythonScript::executePythonScript()
+{
+  // Collect the matrices the script works on. The step's data is locked while it executes, so no copies are needed.
+  std::vector<cv::Mat> input_matrices(mInputs.size());
+  cedar::aux::annotation::ConstColorSpacePtr pColorSpaceAnnotation = nullptr;
+  for(unsigned int i = 0; i < mInputs.size(); i++)
+  {
+    cedar::aux::ConstDataPtr inputMatrixPointer = this->getInputSlot(makeInputSlotName(i))->getData();
+    auto mat_data = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(inputMatrixPointer);
+    if(mat_data)
+    {
+      try
+      {
+        if(pColorSpaceAnnotation == nullptr)
+        {
+          pColorSpaceAnnotation = inputMatrixPointer->getAnnotation<cedar::aux::annotation::ColorSpace>();
+        }
       }
-      else
+      catch(std::exception)
       {
-        // Old way: Setting the Input to pc.input1, pc.input2 etc.
-        /*
-
-        const char* attrName = std::string("input").append(std::to_string(i + 1)).c_str();
-        boost::python::scope(pycedar_module).attr(attrName) = -1;
+        pColorSpaceAnnotation = nullptr;
+      }
+      input_matrices[i] = mat_data->getData();
+    }
+  }
 
-        */
+  std::vector<cv::Mat> output_matrices(mOutputs.size());
+  for(unsigned int i = 0; i < mOutputs.size(); i++)
+  {
+    output_matrices[i] = mOutputs[i]->getData();
+  }
 
-        PyObject* matrix_np = cvt.toNDArray(cv::Mat::zeros(1, 1, CV_32F));
-        boost::python::handle<> matrix_np_handle(matrix_np);
-        inputsList.push_back(matrix_np_handle);
+  // Outputs the script replaced (rather than filled in place)
+  std::vector<cv::Mat> results(mOutputs.size());
+  std::vector<bool> replaced(mOutputs.size(), false);
 
-      }
-    }
-    boost::python::scope(pycedar_module).attr("inputs") = inputsList;
-    // Adding empty matrices to the output list so that the length of the list in python is correctly set
-    std::list<boost::python::handle<>> outputsList;
-    boost::python::handle<> hand(cvt.toNDArray( cv::Mat::zeros(1, 1, CV_32F) ));
+  mutex.lock();
 
-    for(unsigned int i = 0; i < mOutputs.size(); i++)
-      outputsList.push_back(hand);
+  this->mIsExecuting = 1;
+  cedar::proc::steps::PythonScript::executionFailed = 0;
 
-    boost::python::scope(pycedar_module).attr("outputs") = outputsList;
-    // Old way: Setting the Output to pc.output1, pc.output2 etc.
-    /*
+  nameOfExecutingStep = this->getName();
 
-    // Remove output data of old calls
-    for(unsigned int i = 0; i < mOutputs.size(); i++){
-      const char* attrName = std::string("output").append(std::to_string(i + 1)).c_str();
+  {
+    // The GIL is only held for the python part of the execution
+    cedar::proc::steps::PythonScriptScope::PyEnsureGIL gil;
 
-      // Test if the output object exists in the pycedar scope
-      try
-      {
-        boost::python::scope(pycedar_module).attr(attrName);
-      }
-      catch(const boost::python::error_already_set&)
+    try
+    {
+      if(!this->mExecutionCache)
       {
-        continue;
+        this->mExecutionCache.reset(new cedar::proc::steps::PythonScriptScope::ExecutionCache());
       }
 
-      // Create empty matrix
-      PyObject* emptyMatrix_np = cvt.toNDArray(cv::Mat::zeros(1, 1, CV_32F));
-
-      // Include it to Python
-      boost::python::handle<> emptyMatrix_np_handle(emptyMatrix_np);
-      boost::python::object emptyMatrix_object(emptyMatrix_np_handle);
+      // Loading main module
+      boost::python::object main_module = boost::python::import("__main__");
+      boost::python::object main_namespace = main_module.attr("__dict__");
 
-      boost::python::scope(pycedar_module).attr(attrName) = emptyMatrix_object;
-    }
+      // Loading pycedar module
+      boost::python::object pycedar_module( (boost::python::handle<>(PyImport_ImportModule("pycedar"))) );
 
-    */
+      // Compiles the script only if it changed since the last execution
+      this->updateCompiledScript();
 
-    bool executedFromFile = false;
-    // Execute script from the specified file, if the hasScriptFile Parameter is set and the file exists
-    if(this->_mHasScriptFile->getValue())
-    {
-      cedar::aux::Path path = this->_mScriptFile->getPath();
-      if(path.exists()){
-        boost::python::exec_file(path.toString().c_str(), main_namespace);
-        executedFromFile = true;
-      }
-    }
-    
-    if(!executedFromFile)
-    {
-      std::string inputString = this->_mCodeStringForSavingArchitecture->getValue();
-      boost::python::str inputString_py(inputString);
-#if CV_MAJOR_VERSION < 3
-      boost::python::exec(inputString_py, main_namespace);
-#else
-      boost::python::exec(boost::python::extract<char const*>(inputString_py), main_namespace);
-#endif
-    }
+      this->updateArrayViews(input_matrices, output_matrices);
+      boost::python::scope(pycedar_module).attr("inputs") = this->mExecutionCache->inputs;
+      boost::python::scope(pycedar_module).attr("outputs") = this->mExecutionCache->outputs;
 
-    // Old way: Setting the Output to pc.output1, pc.output2 etc.
-    /*
+#if PY_MAJOR_VERSION >= 3
+      PyObject* code = this->mExecutionCache->code.ptr();
+#else // PY_MAJOR_VERSION >= 3
+      PyCodeObject* code = reinterpret_cast<PyCodeObject*>(this->mExecutionCache->code.ptr());
+#endif // PY_MAJOR_VERSION >= 3
+      boost::python::handle<> result(PyEval_EvalCode(code, main_namespace.ptr(), main_namespace.ptr()));
 
-    // relegate output from python to the step output
-    for(unsigned int i = 0; i < mOutputs.size(); i++){
-      const char* attrName = std::string("output").append(std::to_string(i + 1)).c_str();
-      boost::python::object output_object;
+      // Get the outputs from python
+      std::list<PyObject*> list = boost::python::extract<std::list<PyObject*>>(boost::python::scope(pycedar_module).attr("outputs"));
 
-      // Test if the output object exists in the pycedar scope
-      try
-      {
-        output_object = boost::python::scope(pycedar_module).attr(attrName);
-      }
-      catch(const boost::python::error_already_set&)
-      {
-        continue;
-      }
+      cedar::proc::steps::PythonScriptScope::NDArrayConverter cvt(this);
+      unsigned int i = 0;
+      for (auto outputPointer : list) {
+        if(i >= mOutputs.size()) break;
 
-      PyObject * outputPointer = output_object.ptr();
-      cv::Mat &outputNodeMatrix = mOutputs[i]->getData();
-      outputNodeMatrix = cvt.toMat(outputPointer);
-      // Convert 1D and 2D matrices of type CV_64F (double) to CV_32F (float)
-      if (this->_autoConvertDoubleToFloat->getValue())
-      {
-        if (outputNodeMatrix.dims <= 2 &&
-            outputNodeMatrix.type() == CV_64F)
+        // Entries that still hold the view of the output were filled in place (or left untouched)
+        if(outputPointer != this->mExecutionCache->outputViews[i].ptr())
         {
-          outputNodeMatrix.convertTo(outputNodeMatrix, CV_32F); // added
+          // Read-only arrays view the buffers of other steps; copy them so that outputs never alias inputs
+          boost::python::handle<> copy;
+          if(PyArray_Check(outputPointer) && !PyArray_ISWRITEABLE(reinterpret_cast<PyArrayObject*>(outputPointer)))
+          {
+            PyArrayObject* array = reinterpret_cast<PyArrayObject*>(outputPointer);
+            copy = boost::python::handle<>(PyArray_NewCopy(array, NPY_CORDER));
+            outputPointer = copy.get();
+          }
+          results[i] = cvt.toMat(outputPointer, i);
+          replaced[i] = true;
         }
+        i++;
       }
     }
+    catch(const boost::python::error_already_set&){
 
-    */
-
-    // Get the outputs from python
-    std::list<PyObject*> list = boost::python::extract<std::list<PyObject*>>(boost::python::scope(pycedar_module).attr("outputs"));
-
-    unsigned int i = 0;
-    for (auto const& outputPointer : list) {
-      if(i >= mOutputs.size()) break;
-
-      cv::Mat &outputNodeMatrix = mOutputs[i]->getData();
-      outputNodeMatrix = cvt.toMat(outputPointer, i);
-
-      // Convert 1D and 2D matrices of type CV_64F (double) to CV_32F (float)
-      if (this->_mAutoConvertDoubleToFloat->getValue())
-      {
-        if (outputNodeMatrix.dims <= 2 &&
-            outputNodeMatrix.type() == CV_64F)
+      cedar::proc::steps::PythonScript::executionFailed = 1;
+  
+      if(PyErr_Occurred() == 0) std::cout << "No PyErr occured!" << std::endl;
+
+      // Try to extract the error message from python
+      std::string errorMessage = "Undefined Error";
+      try{
+        PyObject *exc,*val,*tb;
+        PyErr_Fetch(&exc,&val,&tb);
+        PyErr_NormalizeException(&exc,&val,&tb);
+        boost::python::handle<> hexc(exc),hval(boost::python::allow_null(val)),htb(boost::python::allow_null(tb));
+        if(!hval)
         {
-          outputNodeMatrix.convertTo(outputNodeMatrix, CV_32F); // added
+          errorMessage = boost::python::extract<std::string>(boost::python::str(hexc));
         }
-        else if (outputNodeMatrix.dims == 3 &&
-             outputNodeMatrix.type() == CV_64F)
+        else
         {
-          outputNodeMatrix = convert3DMatToFloat<double>(outputNodeMatrix);
+          // Get Error message
+          boost::python::object traceback(boost::python::import("traceback"));
+          boost::python::object format_exception(traceback.attr("format_exception"));
+          boost::python::object formatted_list(format_exception(hexc,hval,htb));
+          boost::python::object formatted(boost::python::str("").join(formatted_list));
+
+          errorMessage = boost::python::extract<std::string>(formatted);
+
+          // Cutoff empty line at the end
+          if(errorMessage.at(errorMessage.length() - 1) == '\n') errorMessage = errorMessage.substr(0, errorMessage.length() - 1);
+
+          // Extract line number
+          std::string substring = errorMessage.substr(errorMessage.find("line") + 4, errorMessage.length());
+          std::stringstream stream(substring);
+          long lineno;
+          stream >> lineno;
+          if(stream) emit errorMessageLineNumberChanged(lineno);
         }
       }
-      if(outputNodeMatrix.type() == CV_8UC3 && pColorSpaceAnnotation != nullptr)
+      catch(const std::exception& e)
       {
-        mOutputs[i]->setAnnotation(cedar::aux::annotation::ColorSpacePtr(new cedar::aux::annotation::ColorSpace(*pColorSpaceAnnotation)));
+        errorMessage = e.what();
       }
-      else
+      catch(const boost::python::error_already_set&)
       {
-        mOutputs[i]->removeAnnotations<cedar::aux::annotation::ColorSpace>();
+        errorMessage = "Undefined error";
       }
-      i++;
+
+      // Post the error in the Log section of cedar
+      cedar::aux::LogSingleton::getInstance()->error
+        (
+          errorMessage,
+          "void cedar::proc::steps::PythonScript::executePythonScript()",
+          this->getName()
+        );
+
+    }
+
+    freePythonVariables();
+  }
+
+  bool failed = cedar::proc::steps::PythonScript::executionFailed;
+  mutex.unlock();
+
+  for(unsigned int i = 0; i < mOutputs.size(); i++)
+  {
+    cv::Mat &outputNodeMatrix = mOutputs[i]->getData();
+    if(replaced[i])
+    {
+      outputNodeMatrix = results[i];
     }
-    
-  }
-  catch(const boost::python::error_already_set&){
-
-    cedar::proc::steps::PythonScript::executionFailed = 1;
-    
-    if(PyErr_Occurred() == 0) std::cout << "No PyErr occured!" << std::endl;
-
-    // Try to extract the error message from python
-    std::string errorMessage = "Undefined Error";
-    try{
-      PyObject *exc,*val,*tb;
-      PyErr_Fetch(&exc,&val,&tb);
-      PyErr_NormalizeException(&exc,&val,&tb);
-      boost::python::handle<> hexc(exc),hval(boost::python::allow_null(val)),htb(boost::python::allow_null(tb));
-      if(!hval)
+
+    // Convert 1D and 2D matrices of type CV_64F (double) to CV_32F (float)
+    if (this->_mAutoConvertDoubleToFloat->getValue())
+    {
+      if (outputNodeMatrix.dims <= 2 &&
+          outputNodeMatrix.type() == CV_64F)
       {
-        errorMessage = boost::python::extract<std::string>(boost::python::str(hexc));
+        // convert into a new matrix so that the numpy allocator (and with it the GIL) is not involved
+        cv::Mat converted;
+        outputNodeMatrix.convertTo(converted, CV_32F);
+        outputNodeMatrix = converted;
       }
-      else
+      else if (outputNodeMatrix.dims == 3 &&
+           outputNodeMatrix.type() == CV_64F)
       {
-        // Get Error message
-        boost::python::object traceback(boost::python::import("traceback"));
-        boost::python::object format_exception(traceback.attr("format_exception"));
-        boost::python::object formatted_list(format_exception(hexc,hval,htb));
-        boost::python::object formatted(boost::python::str("").join(formatted_list));
-
-        errorMessage = boost::python::extract<std::string>(formatted);
-
-        // Cutoff empty line at the end
-        if(errorMessage.at(errorMessage.length() - 1) == '\n') errorMessage = errorMessage.substr(0, errorMessage.length() - 1);
-
-        // Extract line number
-        std::string substring = errorMessage.substr(errorMessage.find("line") + 4, errorMessage.length());
-        std::stringstream stream(substring);
-        long lineno;
-        stream >> lineno;
-        if(stream) emit errorMessageLineNumberChanged(lineno);
+        outputNodeMatrix = convert3DMatToFloat<double>(outputNodeMatrix);
       }
     }
-    catch(const std::exception& e)
+    if(outputNodeMatrix.type() == CV_8UC3 && pColorSpaceAnnotation != nullptr)
     {
-      errorMessage = e.what();
+      mOutputs[i]->setAnnotation(cedar::aux::annotation::ColorSpacePtr(new cedar::aux::annotation::ColorSpace(*pColorSpaceAnnotation)));
     }
-    catch(const boost::python::error_already_set&)
+    else
     {
-      errorMessage = "Undefined error";
+      mOutputs[i]->removeAnnotations<cedar::aux::annotation::ColorSpace>();
     }
-
-    // Post the error in the Log section of cedar
-    cedar::aux::LogSingleton::getInstance()->error
-      (
-        errorMessage,
-        "void cedar::proc::steps::PythonScript::executePythonScript()",
-        this->getName()
-      );
-
   }
-  
-  if(cedar::proc::steps::PythonScript::executionFailed) this->setState(cedar::proc::Triggerable::STATE_EXCEPTION, "An exception occured");
-  else this->setState(cedar::proc::Triggerable::STATE_UNKNOWN, "");
 
-  freePythonVariables();
+  if(failed) this->setState(cedar::proc::Triggerable::STATE_EXCEPTION, "An exception occured");
+  else this->setState(cedar::proc::Triggerable::STATE_UNKNOWN, "");
 
   this->mIsExecuting = 0;
-  mutex.unlock();
 }
 
 void cedar::proc::steps::PythonScript::inputConnectionChanged(const std::string& inputName)
@@ -1512,7 +1689,12 @@ void cedar::proc::steps::PythonScript::compute(const cedar::proc::Arguments&)
 void cedar::proc::steps::PythonScript::executeButtonClicked(){
   if(!this->mIsExecuting)
   {
+    // the script works on views of the data, so it has to be locked just like during compute
+    this->lockInputs();
+    this->lockOutputs();
     executePythonScript();
+    this->unlockOutputs();
+    this->unlockInputs();
   }
 }
 
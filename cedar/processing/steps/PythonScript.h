@@ -76,7 +76,24 @@
 #include <QPushButton>
 #include <QFormLayout>
 #include <QLabel>
+#include <atomic>
+#include <memory>
 
+//!@cond SKIPPED_DOCUMENTATION
+namespace cedar
+{
+  namespace proc
+  {
+    namespace steps
+    {
+      namespace PythonScriptScope
+      {
+        class ExecutionCache;
+      }
+    }
+  }
+}
+//!@endcond
 
 
 /*!@brief This step implements a python code execution integration of cedar
@@ -141,6 +158,8 @@ public:
 public slots:
   
   void hasScriptFileChanged();
+  //! Marks the compiled script as outdated so that it is compiled again before its next execution.
+  void scriptChanged();
   void numberOfOutputsChanged();
   void numberOfInputsChanged();
 
@@ -162,6 +181,19 @@ private:
   void compute(const cedar::proc::Arguments&);
   void executePythonScript();
 
+  /*!@brief Makes sure the cached code object matches the current code parameter or script file.
+   *
+   *        Must be called while holding the GIL.
+   */
+  void updateCompiledScript();
+
+  /*!@brief Points pc.inputs and pc.outputs at numpy views of the given matrices, reusing the views of the last call
+   *        where the buffers are unchanged.
+   *
+   *        Must be called while holding the GIL.
+   */
+  void updateArrayViews(const std::vector<cv::Mat>& inputs, const std::vector<cv::Mat>& outputs);
+
   void freePythonVariables();
 
   //--------------------------------------------------------------------------------------------------------------------
@@ -185,6 +217,12 @@ private:
   std::vector< cedar::aux::ConstMatDataPtr > mInputs;
   std::vector< cedar::aux::MatDataPtr > mOutputs;
 
+  //! Set whenever the code or the script file changes; the script is then compiled again before it is executed.
+  std::atomic<bool> mRecompileScript;
+
+  //! Python objects reused across executions (compiled script, array views). Only accessed while holding the GIL.
+  std::unique_ptr<cedar::proc::steps::PythonScriptScope::ExecutionCache> mExecutionCache;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -335,6 +373,9 @@ namespace cedar
 
           PyObject *toNDArray(const cv::Mat &mat);
 
+          //! Returns a numpy array that shares the buffer of the matrix instead of copying it.
+          PyObject *toNDArrayView(const cv::Mat &mat, bool writeable);
+
           //void copyTo(cv::Mat src, cv::OutputArray _dst);
           int failmsg(const char *, ...);
 
@@ -121,6 +121,9 @@ _mInterpolationType(new cedar::aux::EnumParameter(this,
 
   this->declareOutput("output", mOutput);
 
+  // the output only depends on the input and the parameters; there is no need to recompute it while they are unchanged
+  this->setSkipUnchangedComputes(true);
+
   // connect the parameter's change signal
   QObject::connect(_mOutputSize.get(), SIGNAL(valueChanged()), this, SLOT(outputSizeChanged()), Qt::DirectConnection);
   QObject::connect(_mInterpolationType.get(), SIGNAL(valueChanged()), this, SLOT(recompute()), Qt::DirectConnection);
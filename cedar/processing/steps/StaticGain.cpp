@@ -97,6 +97,9 @@ _mGainFactor(new cedar::aux::DoubleParameter(this, "gain factor", 1.0, -10000.0,
 
   input->setCheck(cedar::proc::typecheck::IsMatrix());
 
+  // the output only depends on the input and the parameters; there is no need to recompute it while they are unchanged
+  this->setSkipUnchangedComputes(true);
+
   // connect the parameter's change signal
   QObject::connect(_mGainFactor.get(), SIGNAL(valueChanged()), this, SLOT(gainChanged()));
 }
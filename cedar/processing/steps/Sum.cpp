@@ -44,12 +44,17 @@
 #include "cedar/processing/typecheck/SameTypeCollection.h"
 #include "cedar/processing/typecheck/And.h"
 #include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/math/accumulate.h"
+#include "cedar/auxiliaries/CallOnScopeExit.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/casts.h"
 
 // SYSTEM INCLUDES
+#include <QReadWriteLock>
+#include <algorithm>
+#include <vector>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register the class
@@ -112,57 +117,81 @@ mOutput(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F)))
 
 void cedar::proc::steps::Sum::sumSlot(cedar::proc::ExternalDataPtr slot, cv::Mat& sum, bool lock)
 {
-  sum.setTo(0.0);
-  double scalar_additions = 0.0;
+  // reused by all calls in a thread so that summing does not allocate memory
+  thread_local std::vector<cedar::aux::MatData*> inputs;
+  thread_local std::vector<const cv::Mat*> terms;
+  thread_local std::vector<QReadWriteLock*> locks;
 
+  inputs.clear();
   for (size_t i = 0; i < slot->getDataCount(); ++i)
   {
-    auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(slot->getData(i));
-    if (mat_data)
+    if (auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(slot->getData(i)))
+    {
+      inputs.push_back(mat_data.get());
+    }
+  }
+
+  // All inputs are read in one pass, so they are locked together. Like cedar::aux::LockSet, lock in the order of the
+  // lock addresses to avoid deadlocks, and lock inputs connected more than once only once. Such inputs are still
+  // summed once per connection, so only the list of locks is made unique.
+  if (lock)
+  {
+    locks.clear();
+    for (auto p_input : inputs)
+    {
+      locks.push_back(&p_input->getLock());
+    }
+    std::sort(locks.begin(), locks.end());
+    locks.erase(std::unique(locks.begin(), locks.end()), locks.end());
+    for (auto p_lock : locks)
+    {
+      p_lock->lockForRead();
+    }
+  }
+
+  cedar::aux::CallOnScopeExit unlocker
+  (
+    [lock]()
     {
-      boost::shared_ptr<QReadLocker> locker;
       if (lock)
       {
-        locker = boost::shared_ptr<QReadLocker>(new QReadLocker(&mat_data->getLock()));
+        for (auto p_lock : locks)
+        {
+          p_lock->unlock();
+        }
       }
+    }
+  );
+
+  double scalar_additions = 0.0;
+  terms.clear();
+  for (auto p_input : inputs)
+  {
+    const cv::Mat& input_mat = p_input->getData();
 
-      cv::Mat& input_mat = mat_data->getData();
+    unsigned int input_dim = cedar::aux::math::getDimensionalityOf(input_mat);
+    if (input_dim == 0)
+    {
+      scalar_additions += cedar::aux::math::getMatrixEntry<double>(input_mat, 0, 0);
+      continue;
+    }
 
-      unsigned int input_dim = cedar::aux::math::getDimensionalityOf(input_mat);
-      if (input_dim == 0)
+    if (terms.empty() && (!cedar::aux::math::matrixSizesEqual(input_mat, sum) || input_mat.type() != sum.type()))
+    {
+      // 1D sums are column vectors
+      if (input_dim == 1)
       {
-        scalar_additions += cedar::aux::math::getMatrixEntry<double>(input_mat, 0, 0);
+        sum.create(static_cast<int>(cedar::aux::math::get1DMatrixSize(input_mat)), 1, input_mat.type());
       }
       else
       {
-        if (!cedar::aux::math::matrixSizesEqual(input_mat, sum))
-        {
-          if (input_dim == 1)
-          {
-            sum = cedar::aux::math::canonicalRowVector(0.0 * input_mat.clone());
-          }
-          else
-          {
-            sum = 0.0 * input_mat.clone();
-          }
-        }
-
-        cv::Mat to_add;
-        if (input_dim == 1)
-        {
-          sum += cedar::aux::math::canonicalRowVector(input_mat);
-        }
-        else
-        {
-          sum += input_mat;
-        }
+        sum.create(input_mat.dims, input_mat.size, input_mat.type());
       }
     }
+    terms.push_back(&input_mat);
   }
-  if (scalar_additions != 0.0)
-  {
-    sum += scalar_additions;
-  }
+
+  cedar::aux::math::accumulate(sum, terms, scalar_additions);
 }
 
 void cedar::proc::steps::Sum::compute(const cedar::proc::Arguments&)
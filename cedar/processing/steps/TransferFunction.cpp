@@ -148,7 +148,7 @@ void cedar::proc::steps::TransferFunction::recompute()
   cv::Mat& sigmoid_u = this->mOutput->getData();
 
   // calculate output
-  sigmoid_u = _mTransferFunction->getValue()->compute(input);
+  _mTransferFunction->getValue()->compute(input, sigmoid_u);
 }
 
 void cedar::proc::steps::TransferFunction::inputConnectionChanged(const std::string& inputName)
@@ -13,7 +13,6 @@
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/processing/DeclarationRegistry.h"
 #include <cstdlib>
-#include <ctime>
 
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -85,7 +84,6 @@ cedar::proc::steps::WeightedSum::WeightedSum()
   QObject::connect(_mFunctionParameter1.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrixSize()));
   QObject::connect(_mFunctionParameter2.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrixSize()));
   QObject::connect(_mFunctionParameter3.get(), SIGNAL(valueChanged()), this, SLOT(updateMatrixSize()));
-  srand(static_cast<unsigned>(time(0)));
 
 }
 
@@ -176,8 +174,7 @@ void cedar::proc::steps::WeightedSum::initWeights(cedar::aux::MatDataPtr weightP
         {
           float LOW = _mFunctionParameter2->getValue();
           float HIGH = _mFunctionParameter3->getValue();
-          float random = LOW + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (HIGH - LOW)));
-          wI = random;
+          wI = cv::theRNG().uniform(LOW, HIGH);
           if (distance < 0)
             wI = wI * -1;
         }
@@ -250,7 +247,6 @@ void cedar::proc::steps::WeightedSum::updateDimensionality()
 
 void cedar::proc::steps::WeightedSum::reset()
 {
-  srand(static_cast<unsigned>(time(0)));
   initAllWeights();
 }
 
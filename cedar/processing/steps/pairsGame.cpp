@@ -56,11 +56,24 @@
 
 // SYSTEM INCLUDES
 #include <opencv2/core/version.hpp>
+#include <algorithm>
 
 #if (CV_MAJOR_VERSION > 3)
 #define CV_FILLED cv::FILLED
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// helpers
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  //! Draws a shuffle index from the generator of the current thread, so that seeded runs are reproducible.
+  int drawIndex(int n)
+  {
+    return cv::theRNG().uniform(0, n);
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // register the class
 //----------------------------------------------------------------------------------------------------------------------
@@ -184,8 +197,8 @@ cedar::proc::steps::pairsGame::pairsGame()
             row++;
         }
     }
-    std::random_shuffle ( positions.begin(), positions.end() );
-    rot = 1 + (rand() % static_cast<int>(3));
+    std::random_shuffle(positions.begin(), positions.end(), drawIndex);
+    rot = 1 + cv::theRNG().uniform(0, 3);
 
     paintPairs();
 }
@@ -200,8 +213,8 @@ void cedar::proc::steps::pairsGame::reset()
     QObject::disconnect(_mPadding.get(), SIGNAL(valueChanged()), this, SLOT(pairsChanged()));
     QObject::disconnect(_mNumberOfPairs.get(), SIGNAL(valueChanged()), this, SLOT(pairsChanged()));
     QObject::disconnect(_mSingleFeature.get(), SIGNAL(valueChanged()), this, SLOT(pairsChanged()));
-    std::random_shuffle ( positions.begin(), positions.end() );
-    rot = 1 + (rand() % static_cast<int>(3));
+    std::random_shuffle(positions.begin(), positions.end(), drawIndex);
+    rot = 1 + cv::theRNG().uniform(0, 3);
     solved.clear();
     paintPairs();
     QObject::connect(_mSizes.get(), SIGNAL(valueChanged()), this, SLOT(pairsChanged()));
@@ -253,8 +266,8 @@ void cedar::proc::steps::pairsGame::pairsChanged()
             row++;
         }
     }
-    std::random_shuffle ( positions.begin(), positions.end() );
-    rot = 1 + (rand() % static_cast<int>(3));
+    std::random_shuffle(positions.begin(), positions.end(), drawIndex);
+    rot = 1 + cv::theRNG().uniform(0, 3);
 
     paintPairs();
     this->callComputeWithoutTriggering();
@@ -2,6 +2,8 @@
 # FFTW_FOUND - whether FFTW was found or not
 # FFTW_INCLUDE_DIRS - the FFTW include directories
 # FFTW_LIBS - FFTW libraries
+# FFTW_FLOAT_FOUND - whether the single-precision FFTW library was found
+# FFTW_LIBS_FLOAT - single-precision FFTW libraries
 
 # find include dir in set of paths
 find_path(FFTW_INCLUDE_DIRS
@@ -18,6 +20,15 @@ find_library(FFTW_LIBS_THREADED
   NAMES fftw3_omp
   PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
 )
+# single-precision variants
+find_library(FFTW_LIBS_FLOAT
+  NAMES fftw3f libfftw3f libfftw3f-3
+  PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
+)
+find_library(FFTW_LIBS_FLOAT_THREADED
+  NAMES fftw3f_omp
+  PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
+)
 
 # now check if anything is missing
 if(FFTW_INCLUDE_DIRS AND FFTW_LIBS)
@@ -35,3 +46,13 @@ else(FFTW_LIBS_THREADED)
     set(FFTW_THREADED false)
 endif(FFTW_LIBS_THREADED)
 
+if(FFTW_FOUND AND FFTW_LIBS_FLOAT)
+  set(FFTW_FLOAT_FOUND true)
+else(FFTW_FOUND AND FFTW_LIBS_FLOAT)
+  set(FFTW_LIBS_FLOAT "")
+  set(FFTW_FLOAT_FOUND false)
+endif(FFTW_FOUND AND FFTW_LIBS_FLOAT)
+
+if(NOT FFTW_LIBS_FLOAT_THREADED)
+  set(FFTW_LIBS_FLOAT_THREADED "")
+endif(NOT FFTW_LIBS_FLOAT_THREADED)
@@ -0,0 +1,550 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BatchRunner.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Source file for the class cedar::processingCL::BatchRunner.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/processing/Group.h"
+#include "cedar/processing/Connectable.h"
+#include "cedar/processing/DataPath.h"
+#include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/Step.h"
+#include "cedar/auxiliaries/BinaryRecording.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/Tracer.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// LOCAL INCLUDES
+#include "BatchRunner.h"
+
+// SYSTEM INCLUDES
+#ifndef Q_MOC_RUN
+  #include <boost/make_shared.hpp>
+  #include <boost/filesystem.hpp>
+  #include <boost/date_time/posix_time/posix_time.hpp>
+  #include <boost/regex.hpp>
+#endif
+#include <QThreadPool>
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+//----------------------------------------------------------------------------------------------------------------------
+// local functions
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  double seconds_since(const boost::posix_time::ptime& start)
+  {
+    auto elapsed = boost::posix_time::microsec_clock::universal_time() - start;
+    return static_cast<double>(elapsed.total_microseconds()) / 1e6;
+  }
+
+  std::string json_string(const std::string& value)
+  {
+    std::string escaped = "\"";
+    for (char c : value)
+    {
+      switch (c)
+      {
+        case '"':
+          escaped += "\\\"";
+          break;
+        case '\\':
+          escaped += "\\\\";
+          break;
+        case '\n':
+          escaped += "\\n";
+          break;
+        default:
+          escaped += c;
+      }
+    }
+    return escaped + "\"";
+  }
+
+  //! Returns the given quantile of a sorted list of values.
+  double quantile(const std::vector<double>& sorted, double q)
+  {
+    if (sorted.empty())
+    {
+      return 0.0;
+    }
+    size_t index = static_cast<size_t>(q * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted.at(std::min(index, sorted.size() - 1));
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::processingCL::BatchRunner::BatchRunner(int argc, char** argv)
+:
+mStopComparison(Comparison::Greater),
+mStopValue(0.0),
+mRecordingFormat(cedar::aux::SerializationFormat::CSV),
+mLoadTime(0.0),
+mStepsRequested(0),
+mStepsDone(0),
+mStoppedByCondition(false),
+mTimeStep(0.0 * cedar::unit::seconds),
+mRunTime(0.0),
+mRecordTime(0.0)
+{
+  mParser.defineValue("load", "The architecture to run.", 'l');
+  mParser.defineValue("steps", "Maximum number of steps to run.", 1000, 'n');
+  mParser.defineValue
+  (
+    "time-step",
+    "Simulated time step in milliseconds. If zero, the smallest step size of the architecture's looped triggers is "
+    "used.",
+    0.0,
+    't'
+  );
+  mParser.defineValue
+  (
+    "until",
+    "Stop condition of the form \"<data path> <op> <value>\", where <op> is one of <, <=, >, >=. The maximum of the "
+    "data is compared, e.g., \"field[BUFFER].activation > 0\" stops as soon as any activation is positive.",
+    std::string(),
+    'u'
+  );
+  mParser.defineValue
+  (
+    "record",
+    "Comma-separated list of data paths to record, e.g., "
+    "\"field[BUFFER].activation,field[OUTPUT].sigmoided activation\".",
+    std::string(),
+    'r'
+  );
+  mParser.defineValue("record-interval", "Record every n-th step.", 1, 'i');
+  mParser.defineEnum
+  (
+    "format",
+    "Format of the recorded files.",
+    cedar::aux::SerializationFormat::typePtr(),
+    cedar::aux::SerializationFormat::Binary,
+    'f'
+  );
+  mParser.defineValue("output", "Directory for the recorded files.", std::string("batch_output"), 'o');
+  mParser.defineValue
+  (
+    "report",
+    "File the timing report is written to; if empty, it is written to stdout.",
+    std::string(),
+    'p'
+  );
+  mParser.defineValue
+  (
+    "trace",
+    "If given, a trace of the run is recorded and written to this file in the chrome trace format.",
+    std::string()
+  );
+  mParser.defineFlag("no-plugins", "Do not load default plugins.");
+  mParser.parse(argc, argv, true);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+int cedar::processingCL::BatchRunner::exec()
+{
+  try
+  {
+    if (!this->mParser.hasParsedFlag("no-plugins"))
+    {
+      cedar::aux::SettingsSingleton::getInstance()->loadDefaultPlugins();
+    }
+
+    this->loadArchitecture(this->mParser.getValue<std::string>("load"));
+
+    std::string condition = this->mParser.getValue<std::string>("until");
+    if (!condition.empty())
+    {
+      this->parseStopCondition(condition);
+    }
+
+    this->mRecordingFormat = this->mParser.getValue<cedar::aux::Enum>("format").id();
+    this->openRecordings(this->mParser.getValue<std::string>("record"));
+
+    // determine the time step
+    double time_step_ms = this->mParser.getValue<double>("time-step");
+    if (time_step_ms > 0.0)
+    {
+      this->mTimeStep = time_step_ms * cedar::unit::milli * cedar::unit::seconds;
+    }
+    else
+    {
+      auto triggers = this->mArchitecture->listLoopedTriggers();
+      if (triggers.empty())
+      {
+        CEDAR_THROW
+        (
+          cedar::aux::NotFoundException,
+          "The architecture has no looped triggers; please specify a time step."
+        );
+      }
+      this->mTimeStep = triggers.front()->getSimulatedTimeParameter();
+      for (auto trigger : triggers)
+      {
+        this->mTimeStep = std::min(this->mTimeStep, trigger->getSimulatedTimeParameter());
+      }
+    }
+
+    this->mStepsRequested = static_cast<uint64_t>(std::max(0, this->mParser.getValue<int>("steps")));
+    uint64_t record_interval = static_cast<uint64_t>(std::max(1, this->mParser.getValue<int>("record-interval")));
+    this->mStepTimes.reserve(this->mStepsRequested);
+
+    std::string trace_path = this->mParser.getValue<std::string>("trace");
+    if (!trace_path.empty())
+    {
+      cedar::aux::TracerSingleton::getInstance()->clear();
+      cedar::aux::TracerSingleton::getInstance()->setEnabled(true);
+    }
+
+    // run; recording and the stop condition read outputs right after each step, so chains must not lag behind
+    cedar::proc::Step::SynchronousChainScope synchronous_chains;
+    cedar::aux::GlobalClockSingleton::getInstance()->stop();
+    cedar::aux::GlobalClockSingleton::getInstance()->reset();
+    auto run_start = boost::posix_time::microsec_clock::universal_time();
+    for (this->mStepsDone = 0; this->mStepsDone < this->mStepsRequested; )
+    {
+      auto step_start = boost::posix_time::microsec_clock::universal_time();
+      this->mArchitecture->stepTriggers(this->mTimeStep);
+      this->mStepTimes.push_back(seconds_since(step_start));
+      ++this->mStepsDone;
+
+      if (!this->mRecordings.empty() && this->mStepsDone % record_interval == 0)
+      {
+        auto record_start = boost::posix_time::microsec_clock::universal_time();
+        this->record(cedar::aux::GlobalClockSingleton::getInstance()->getTime());
+        this->mRecordTime += seconds_since(record_start);
+      }
+
+      if (this->mStopData && this->stopConditionHolds())
+      {
+        this->mStoppedByCondition = true;
+        break;
+      }
+    }
+    this->mRunTime = seconds_since(run_start);
+    // nothing started by the run may still work on the architecture when it is torn down
+    QThreadPool::globalInstance()->waitForDone();
+
+    if (!trace_path.empty())
+    {
+      cedar::aux::TracerSingleton::getInstance()->setEnabled(false);
+      cedar::aux::TracerSingleton::getInstance()->writeChromeTrace(trace_path);
+    }
+
+    this->closeRecordings();
+  }
+  catch (const cedar::aux::ExceptionBase& e)
+  {
+    std::cerr << e.exceptionInfo() << std::endl;
+    return 1;
+  }
+
+  std::string report_path = this->mParser.getValue<std::string>("report");
+  if (report_path.empty())
+  {
+    this->writeReport(std::cout);
+  }
+  else
+  {
+    std::ofstream report(report_path);
+    if (!report.is_open())
+    {
+      std::cerr << "Could not open \"" << report_path << "\" for writing the report." << std::endl;
+      return 1;
+    }
+    this->writeReport(report);
+  }
+  return 0;
+}
+
+void cedar::processingCL::BatchRunner::loadArchitecture(const std::string& path)
+{
+  auto start = boost::posix_time::microsec_clock::universal_time();
+  this->mArchitecturePath = path;
+  this->mArchitecture = boost::make_shared<cedar::proc::Group>();
+  this->mArchitecture->readJson(path);
+  this->mLoadTime = seconds_since(start);
+}
+
+cedar::aux::ConstDataPtr cedar::processingCL::BatchRunner::findData(const std::string& dataPath) const
+{
+  cedar::proc::DataPath path(dataPath);
+  auto connectable = this->mArchitecture->getElement<cedar::proc::Connectable>(path.getPathToElement());
+  if (!connectable)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::NotFoundException,
+      "The element \"" + path.getPathToElement().toString() + "\" does not exist or has no data."
+    );
+  }
+  return connectable->getData(path.getDataRole(), path.getDataName());
+}
+
+void cedar::processingCL::BatchRunner::parseStopCondition(const std::string& condition)
+{
+  // the operator is surrounded by white space so that it cannot be confused with characters of the data path
+  boost::regex expression("^\\s*(.+?)\\s+(<=|>=|<|>)\\s+(\\S+)\\s*$");
+  boost::smatch match;
+  if (!boost::regex_match(condition, match, expression))
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::ParseException,
+      "Could not parse the stop condition \"" + condition + "\"; expected \"<data path> <op> <value>\"."
+    );
+  }
+
+  std::string op = match[2];
+  if (op == "<")
+  {
+    this->mStopComparison = Comparison::Less;
+  }
+  else if (op == "<=")
+  {
+    this->mStopComparison = Comparison::LessEqual;
+  }
+  else if (op == ">")
+  {
+    this->mStopComparison = Comparison::Greater;
+  }
+  else
+  {
+    this->mStopComparison = Comparison::GreaterEqual;
+  }
+  this->mStopValue = cedar::aux::fromString<double>(match[3]);
+
+  this->mStopData = this->findData(match[1]);
+  if (!boost::dynamic_pointer_cast<const cedar::aux::MatData>(this->mStopData))
+  {
+    CEDAR_THROW(cedar::aux::TypeMismatchException, "Stop conditions can only be used on matrix data.");
+  }
+}
+
+bool cedar::processingCL::BatchRunner::stopConditionHolds() const
+{
+  auto mat_data = boost::static_pointer_cast<const cedar::aux::MatData>(this->mStopData);
+  double maximum;
+  {
+    QReadLocker locker(&mat_data->getLock());
+    const cv::Mat& mat = mat_data->getData();
+    if (mat.empty())
+    {
+      return false;
+    }
+    cv::minMaxIdx(mat, nullptr, &maximum);
+  }
+
+  switch (this->mStopComparison)
+  {
+    case Comparison::Less:
+      return maximum < this->mStopValue;
+    case Comparison::LessEqual:
+      return maximum <= this->mStopValue;
+    case Comparison::Greater:
+      return maximum > this->mStopValue;
+    case Comparison::GreaterEqual:
+      return maximum >= this->mStopValue;
+  }
+  return false;
+}
+
+void cedar::processingCL::BatchRunner::openRecordings(const std::string& paths)
+{
+  std::vector<std::string> data_paths;
+  cedar::aux::split(paths, ",", data_paths);
+
+  std::string output_directory = this->mParser.getValue<std::string>("output");
+  boost::regex replace_expression("[[:space:]/\\[\\]]");
+  for (const auto& data_path : data_paths)
+  {
+    if (data_path.empty())
+    {
+      continue;
+    }
+
+    RecordingPtr recording(new Recording());
+    recording->mPath = data_path;
+    recording->mData = this->findData(data_path);
+    recording->mFrameCount = 0;
+
+    auto mode = this->mRecordingFormat;
+    if
+    (
+      mode == cedar::aux::SerializationFormat::Binary
+      && !boost::dynamic_pointer_cast<const cedar::aux::MatData>(recording->mData)
+    )
+    {
+      cedar::aux::LogSingleton::getInstance()->warning
+      (
+        "Only matrices can be recorded in the binary format; recording \"" + data_path + "\" in the compact format.",
+        "cedar::processingCL::BatchRunner::openRecordings(const std::string&)"
+      );
+      mode = cedar::aux::SerializationFormat::Compact;
+    }
+    recording->mMode = mode;
+
+    std::string extension = "csv";
+    if (mode == cedar::aux::SerializationFormat::Compact)
+    {
+      extension = "data";
+    }
+    else if (mode == cedar::aux::SerializationFormat::Binary)
+    {
+      extension = "bin";
+    }
+
+    boost::filesystem::create_directories(output_directory);
+    std::string file
+      = output_directory + "/" + boost::regex_replace(data_path, replace_expression, "_") + "." + extension;
+    recording->mStream.open(file, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!recording->mStream.is_open())
+    {
+      CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + file + "\" for writing.");
+    }
+
+    recording->mData->serializeHeader(recording->mStream, mode);
+    if (mode == cedar::aux::SerializationFormat::Binary)
+    {
+      auto mat_data = boost::static_pointer_cast<const cedar::aux::MatData>(recording->mData);
+      QReadLocker locker(&mat_data->getLock());
+      recording->mFrameStride = cedar::aux::BinaryRecording::createHeader(mat_data->getData()).mFrameStride;
+    }
+    else
+    {
+      recording->mStream << std::endl;
+    }
+
+    this->mRecordings.push_back(recording);
+  }
+}
+
+void cedar::processingCL::BatchRunner::record(cedar::unit::Time time)
+{
+  for (auto recording : this->mRecordings)
+  {
+    if (recording->mMode == cedar::aux::SerializationFormat::Binary)
+    {
+      // frames are written sequentially, so the file does not have to be preallocated; the frame count in the header
+      // is written when the recording is closed
+      auto mat_data = boost::static_pointer_cast<const cedar::aux::MatData>(recording->mData);
+      {
+        QReadLocker locker(&mat_data->getLock());
+        if (cedar::aux::BinaryRecording::createHeader(mat_data->getData()).mFrameStride != recording->mFrameStride)
+        {
+          continue;
+        }
+      }
+      double time_stamp = time / cedar::unit::seconds;
+      recording->mStream.write(reinterpret_cast<const char*>(&time_stamp), sizeof(double));
+      recording->mData->serializeData(recording->mStream, recording->mMode);
+    }
+    else
+    {
+      recording->mStream << time << ",";
+      recording->mData->serializeData(recording->mStream, recording->mMode);
+      recording->mStream << std::endl;
+    }
+    ++recording->mFrameCount;
+  }
+}
+
+void cedar::processingCL::BatchRunner::closeRecordings()
+{
+  for (auto recording : this->mRecordings)
+  {
+    if (recording->mMode == cedar::aux::SerializationFormat::Binary)
+    {
+      recording->mStream.seekp(static_cast<std::streamoff>(cedar::aux::BinaryRecording::getFrameCountOffset()));
+      recording->mStream.write(reinterpret_cast<const char*>(&recording->mFrameCount), sizeof(uint64_t));
+    }
+    recording->mStream.close();
+  }
+  this->mRecordings.clear();
+}
+
+void cedar::processingCL::BatchRunner::writeReport(std::ostream& stream) const
+{
+  std::vector<double> sorted = this->mStepTimes;
+  std::sort(sorted.begin(), sorted.end());
+  double total_step_time = 0.0;
+  for (double time : sorted)
+  {
+    total_step_time += time;
+  }
+  double mean = sorted.empty() ? 0.0 : total_step_time / static_cast<double>(sorted.size());
+  double simulated_time = static_cast<double>(this->mStepsDone) * (this->mTimeStep / cedar::unit::seconds);
+
+  stream.precision(std::numeric_limits<double>::digits10);
+  stream << "{" << std::endl;
+  stream << "  \"architecture\": " << json_string(this->mArchitecturePath) << "," << std::endl;
+  stream << "  \"load_time_s\": " << this->mLoadTime << "," << std::endl;
+  stream << "  \"steps_requested\": " << this->mStepsRequested << "," << std::endl;
+  stream << "  \"steps\": " << this->mStepsDone << "," << std::endl;
+  stream << "  \"stopped_by\": \"" << (this->mStoppedByCondition ? "condition" : "steps") << "\"," << std::endl;
+  stream << "  \"time_step_s\": " << (this->mTimeStep / cedar::unit::seconds) << "," << std::endl;
+  stream << "  \"simulated_time_s\": " << simulated_time << "," << std::endl;
+  stream << "  \"wall_time_s\": " << this->mRunTime << "," << std::endl;
+  stream << "  \"recording_time_s\": " << this->mRecordTime << "," << std::endl;
+  stream << "  \"steps_per_second\": " << (this->mRunTime > 0.0 ? this->mStepsDone / this->mRunTime : 0.0) << ","
+         << std::endl;
+  stream << "  \"real_time_factor\": " << (this->mRunTime > 0.0 ? simulated_time / this->mRunTime : 0.0) << ","
+         << std::endl;
+  stream << "  \"step_time_s\": {"
+         << "\"mean\": " << mean << ", "
+         << "\"min\": " << (sorted.empty() ? 0.0 : sorted.front()) << ", "
+         << "\"p50\": " << quantile(sorted, 0.5) << ", "
+         << "\"p99\": " << quantile(sorted, 0.99) << ", "
+         << "\"max\": " << (sorted.empty() ? 0.0 : sorted.back())
+         << "}" << std::endl;
+  stream << "}" << std::endl;
+}
@@ -0,0 +1,177 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BatchRunner.h
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Header file for the class cedar::processingCL::BatchRunner.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+#ifndef CEDAR_PROC_CL_BATCH_RUNNER_H
+#define CEDAR_PROC_CL_BATCH_RUNNER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/CommandLineParser.h"
+#include "cedar/auxiliaries/SerializationFormat.h"
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/Data.fwd.h"
+#include "cedar/processing/Group.fwd.h"
+#include "BatchRunner.fwd.h"
+
+// SYSTEM INCLUDES
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+/*!@brief Runs an architecture without any user interaction and without a Qt event loop.
+ *
+ *        The architecture is loaded from a json file and stepped in simulated time from the calling thread: each
+ *        iteration advances the global clock by a fixed time step and single-steps all looped triggers, back to back
+ *        and without sleeping. The run ends after a given number of steps, or earlier when a stop condition on a data
+ *        slot holds. Selected data can be recorded along the way, and a timing report is written in json format.
+ */
+class cedar::processingCL::BatchRunner
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Comparisons that can be used in stop conditions.
+  enum class Comparison
+  {
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual
+  };
+
+  //! A data slot that is written to a file while running.
+  struct Recording
+  {
+    std::string mPath;
+    cedar::aux::ConstDataPtr mData;
+    std::ofstream mStream;
+    cedar::aux::SerializationFormat::Id mMode;
+    uint64_t mFrameCount;
+    //! Binary format only: size of each frame in bytes.
+    uint64_t mFrameStride;
+  };
+  typedef boost::shared_ptr<Recording> RecordingPtr;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  BatchRunner(int argc, char** argv);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Loads and runs the architecture; returns the exit code of the application.
+  int exec();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  void loadArchitecture(const std::string& path);
+
+  //! Parses a condition of the form "<data path> <operator> <value>", e.g., "field[BUFFER].activation > 0.5".
+  void parseStopCondition(const std::string& condition);
+
+  //! Returns true if the stop condition holds, i.e., if the maximum of the observed matrix compares true to the value.
+  bool stopConditionHolds() const;
+
+  //! Looks up the data for the given path (e.g., "group.field[BUFFER].activation") in the architecture.
+  cedar::aux::ConstDataPtr findData(const std::string& dataPath) const;
+
+  //! Opens the output files for all recorded data and writes their headers.
+  void openRecordings(const std::string& paths);
+
+  //! Appends the current value of all recorded data to their files.
+  void record(cedar::unit::Time time);
+
+  //! Finishes the output files.
+  void closeRecordings();
+
+  //! Writes the timing report to the given stream.
+  void writeReport(std::ostream& stream) const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  cedar::aux::CommandLineParser mParser;
+
+  cedar::proc::GroupPtr mArchitecture;
+
+  //! Data observed by the stop condition; null if the run is only limited by the number of steps.
+  cedar::aux::ConstDataPtr mStopData;
+
+  Comparison mStopComparison;
+
+  double mStopValue;
+
+  std::vector<RecordingPtr> mRecordings;
+
+  cedar::aux::SerializationFormat::Id mRecordingFormat;
+
+  // values for the report
+  std::string mArchitecturePath;
+  double mLoadTime;
+  uint64_t mStepsRequested;
+  uint64_t mStepsDone;
+  bool mStoppedByCondition;
+  cedar::unit::Time mTimeStep;
+  double mRunTime;
+  double mRecordTime;
+  std::vector<double> mStepTimes;
+
+}; // class cedar::processingCL::BatchRunner
+
+#endif // CEDAR_PROC_CL_BATCH_RUNNER_H
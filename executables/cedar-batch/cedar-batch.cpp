@@ -0,0 +1,51 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        cedar-batch.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Runs an architecture without user interaction and reports timing information.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+
+// LOCAL INCLUDES
+#include "BatchRunner.h"
+
+// SYSTEM INCLUDES
+
+
+int main(int argc, char** argv)
+{
+  // no Qt application is created here: all steps are run from this thread, so no event loop is needed
+  cedar::processingCL::BatchRunner runner(argc, argv);
+  return runner.exec();
+}
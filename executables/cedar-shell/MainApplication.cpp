@@ -40,6 +40,8 @@
 // CEDAR INCLUDES
 #include "cedar/processing/Group.h"
 #include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/Tracer.h"
+#include "cedar/auxiliaries/exceptions.h"
 
 // LOCAL INCLUDES
 #include "MainApplication.h"
@@ -108,12 +110,30 @@ bool cedar::processingCL::MainApplication::waitForUserInput()
     std::cout << "Available commands:" << std::endl;
     std::cout << "-------------------" << std::endl << std::endl;
     std::cout << "startTriggers()    Starts all triggers of the architecture." << std::endl;
+    std::cout << "startTracing()     Starts recording a trace of the processing." << std::endl;
+    std::cout << "stopTracing()      Stops recording the trace." << std::endl;
+    std::cout << "writeTrace()       Writes the trace to trace.json and prints its statistics." << std::endl;
     std::cout << "quit()             Exit application." << std::endl;
   }
   else if (command == "startTriggers()")
   {
     this->startTriggers();
   }
+  else if (command == "startTracing()")
+  {
+    cedar::aux::TracerSingleton::getInstance()->clear();
+    cedar::aux::TracerSingleton::getInstance()->setEnabled(true);
+    std::cout << "Tracing started." << std::endl;
+  }
+  else if (command == "stopTracing()")
+  {
+    cedar::aux::TracerSingleton::getInstance()->setEnabled(false);
+    std::cout << "Tracing stopped." << std::endl;
+  }
+  else if (command == "writeTrace()")
+  {
+    this->writeTrace("trace.json");
+  }
   else
   {
     std::cout << "Unrecognized command \"" << command << "\". Type \"help\" for a list of available commands." << std::endl;
@@ -133,6 +153,22 @@ void cedar::processingCL::MainApplication::startTriggers()
   std::cout << "Triggers started." << std::endl;
 }
 
+void cedar::processingCL::MainApplication::writeTrace(const std::string& path)
+{
+  auto tracer = cedar::aux::TracerSingleton::getInstance();
+  try
+  {
+    tracer->writeChromeTrace(path);
+  }
+  catch (const cedar::aux::FileNotFoundException& e)
+  {
+    std::cout << e.getMessage() << std::endl;
+    return;
+  }
+  std::cout << "Trace written to \"" << path << "\"." << std::endl;
+  tracer->writeStatistics(std::cout);
+}
+
 void cedar::processingCL::MainApplication::loadArchitecture(const std::string& path)
 {
   std::cout << "Loading architecture \"" << path << "\"" << std::endl;
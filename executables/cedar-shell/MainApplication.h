@@ -97,6 +97,8 @@ private:
 
   void startTriggers();
 
+  void writeTrace(const std::string& path);
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -38,6 +38,11 @@
 // LOCAL INCLUDES
 #include "cedar/testingUtilities/measurementFunctions.h"
 #include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/ExpSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/HeavisideSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/LinearTransferFunction.h"
+#include "cedar/auxiliaries/math/transferFunctions/Logarithm.h"
+#include "cedar/auxiliaries/math/transferFunctions/SemiLinearTransferFunction.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/configuration.h"
 
@@ -47,28 +52,69 @@
   #include <boost/date_time/posix_time/posix_time.hpp>
 #endif
 
+//! The ways of applying a transfer function to a matrix that are compared in this test.
+enum Path
+{
+  // the templated compute function that calls compute(double) for each element
+  PerElement,
+  // the matrix overload that returns a new matrix
+  Matrix,
+  // the matrix overload that writes into a preallocated matrix
+  InPlace
+};
+
 struct TestSet
 {
-  TestSet(unsigned dim, unsigned int imsize, unsigned int reps)
+  TestSet
+  (
+    const std::string& name,
+    cedar::aux::math::TransferFunctionPtr function,
+    unsigned dim,
+    unsigned int imsize,
+    unsigned int reps,
+    Path path = PerElement
+  )
   :
+  mName(name),
+  mFunction(function),
   mDimensionality(dim),
   mMatrixSize(imsize),
   mReps(reps),
+  mPath(path),
   mDuration(-1.0)
   {
   }
 
   std::string id() const
   {
-    std::string case_id = "transfer - dimensionality = " + cedar::aux::toString(this->mDimensionality)
+    std::string path;
+    switch (this->mPath)
+    {
+      case PerElement:
+        path = "per element";
+        break;
+      case Matrix:
+        path = "matrix";
+        break;
+      case InPlace:
+        path = "in place";
+        break;
+    }
+
+    std::string case_id = "transfer - " + this->mName
+                          + ", dimensionality = " + cedar::aux::toString(this->mDimensionality)
                           + ", matrix size = " + cedar::aux::toString(this->mMatrixSize)
-                          + ", reps = " + cedar::aux::toString(this->mReps);
+                          + ", reps = " + cedar::aux::toString(this->mReps)
+                          + ", path = " + path;
     return case_id;
   }
 
+  std::string mName;
+  cedar::aux::math::TransferFunctionPtr mFunction;
   unsigned int mDimensionality;
   unsigned int mMatrixSize;
   unsigned int mReps;
+  Path mPath;
   double mDuration;
 };
 
@@ -79,7 +125,7 @@ void test_sigmoid(TestSet& test)
 
   std::string case_id = test.id();
 
-  cedar::aux::math::TransferFunctionPtr sigmoid(new cedar::aux::math::AbsSigmoid());
+  cedar::aux::math::TransferFunctionPtr sigmoid = test.mFunction;
 
   std::vector<int> sizes;
   for (unsigned int dim = 0; dim < test.mDimensionality; ++dim)
@@ -87,27 +133,68 @@ void test_sigmoid(TestSet& test)
     sizes.push_back(static_cast<int>(test.mMatrixSize));
   }
   cv::Mat matrix(static_cast<int>(test.mDimensionality), &(sizes.front()), CV_32F);
-  matrix = 1.0;
+  // positive values, so the logarithm is defined everywhere
+  cv::randu(matrix, 0.01, 1.0);
+  cv::Mat output(static_cast<int>(test.mDimensionality), &(sizes.front()), CV_32F);
 
   ptime start = microsec_clock::local_time();
   for (unsigned int i = 0; i < test.mReps; ++i)
   {
-    // volatile so this doesn't get optimized away
-    volatile cv::Mat test = sigmoid->compute<float>(matrix);
+    switch (test.mPath)
+    {
+      case PerElement:
+      {
+        // volatile so this doesn't get optimized away
+        volatile cv::Mat test = sigmoid->compute<float>(matrix);
+        break;
+      }
+      case Matrix:
+      {
+        // volatile so this doesn't get optimized away
+        volatile cv::Mat test = sigmoid->compute(matrix);
+        break;
+      }
+      case InPlace:
+        sigmoid->compute(matrix, output);
+        break;
+    }
   }
   ptime end = microsec_clock::local_time();
   test.mDuration = static_cast<double>((end - start).total_milliseconds()) / 1000.0;
   cedar::test::write_measurement(case_id, test.mDuration);
 }
 
+void add_tests
+(
+  std::vector<TestSet>& test,
+  const std::string& name,
+  cedar::aux::math::TransferFunctionPtr function
+)
+{
+  Path paths[] = {PerElement, Matrix, InPlace};
+  for (auto path : paths)
+  {
+    test.push_back(TestSet(name, function, 2, 20, 100, path));
+    test.push_back(TestSet(name, function, 2, 100, 10, path));
+    test.push_back(TestSet(name, function, 3, 20, 100, path));
+    test.push_back(TestSet(name, function, 3, 100, 10, path));
+  }
+}
+
 int main(int, char**)
 {
   std::vector<TestSet> test;
-//  test.push_back(TestSet(1, 100, 100));
-  test.push_back(TestSet(2, 20, 100));
-  test.push_back(TestSet(2, 100, 10));
-  test.push_back(TestSet(3, 20, 100));
-  test.push_back(TestSet(3, 100, 10));
+  add_tests(test, "abs sigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::AbsSigmoid()));
+  add_tests(test, "exp sigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::ExpSigmoid()));
+  add_tests(test, "heaviside", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::HeavisideSigmoid()));
+  add_tests(test, "linear", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::LinearTransferFunction()));
+  add_tests
+  (
+    test,
+    "semi-linear",
+    cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::SemiLinearTransferFunction())
+  );
+  add_tests(test, "logarithm", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::Logarithm()));
   // measure
   for (size_t i = 0; i < test.size(); ++i)
   {
@@ -0,0 +1,146 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        accumulate_perf.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Compares summing several inputs term by term with the single-pass accumulation of the Sum step.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/testingUtilities/measurementFunctions.h"
+#include "cedar/auxiliaries/math/accumulate.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+const unsigned int NUMBER_OF_INPUT_COUNTS = 5;
+const unsigned int INPUT_COUNTS[NUMBER_OF_INPUT_COUNTS] = {2, 4, 8, 16, 32};
+const unsigned int REPETITIONS = 200;
+
+// what the Sum step used to do: clear the sum, then add one input after the other
+void sum_term_by_term(cv::Mat& sum, const std::vector<const cv::Mat*>& terms)
+{
+  sum.setTo(0.0);
+  for (auto p_term : terms)
+  {
+    sum += *p_term;
+  }
+}
+
+int compare(const std::string& name, const std::vector<int>& sizes)
+{
+  int errors = 0;
+  cv::RNG rng(42);
+
+  for (unsigned int c = 0; c < NUMBER_OF_INPUT_COUNTS; ++c)
+  {
+    const unsigned int input_count = INPUT_COUNTS[c];
+    std::vector<cv::Mat> inputs(input_count);
+    std::vector<const cv::Mat*> terms;
+    std::vector<double> weights;
+    for (auto& input : inputs)
+    {
+      input.create(static_cast<int>(sizes.size()), sizes.data(), CV_32F);
+      rng.fill(input, cv::RNG::UNIFORM, -1.0, 1.0);
+      terms.push_back(&input);
+      weights.push_back(rng.uniform(-1.0, 1.0));
+    }
+
+    cv::Mat expected(static_cast<int>(sizes.size()), sizes.data(), CV_32F);
+    cv::Mat sum(static_cast<int>(sizes.size()), sizes.data(), CV_32F);
+
+    // both ways of summing have to agree before their timings mean anything
+    sum_term_by_term(expected, terms);
+    cedar::aux::math::accumulate(sum, terms);
+    if (cv::norm(expected, sum, cv::NORM_INF) > 1e-4)
+    {
+      ++errors;
+      std::cout << "ERROR: accumulation of " << input_count << " " << name << " inputs is wrong." << std::endl;
+    }
+
+    expected.setTo(0.0);
+    for (unsigned int i = 0; i < input_count; ++i)
+    {
+      cv::scaleAdd(inputs[i], weights[i], expected, expected);
+    }
+    cedar::aux::math::accumulate(sum, terms, weights);
+    if (cv::norm(expected, sum, cv::NORM_INF) > 1e-4)
+    {
+      ++errors;
+      std::cout << "ERROR: weighted accumulation of " << input_count << " " << name << " inputs is wrong." << std::endl;
+    }
+
+    const std::string suffix = " - " + std::to_string(input_count) + " " + name + " inputs";
+    cedar::test::test_time
+    (
+      "sum term by term" + suffix,
+      [&]()
+      {
+        sum_term_by_term(sum, terms);
+      },
+      REPETITIONS
+    );
+    cedar::test::test_time
+    (
+      "accumulate" + suffix,
+      [&]()
+      {
+        cedar::aux::math::accumulate(sum, terms);
+      },
+      REPETITIONS
+    );
+    cedar::test::test_time
+    (
+      "weighted accumulate" + suffix,
+      [&]()
+      {
+        cedar::aux::math::accumulate(sum, terms, weights);
+      },
+      REPETITIONS
+    );
+  }
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  errors += compare("100x100", {100, 100});
+  errors += compare("50x50x50", {50, 50, 50});
+
+  std::cout << "test finished, there were " << errors << " errors" << std::endl;
+  return errors;
+}
@@ -51,13 +51,26 @@
 
 struct TestSet
 {
-  TestSet(double sigma, double limit, unsigned int imsize, unsigned int reps, cedar::aux::conv::BorderType::Id borderType)
+  TestSet
+  (
+    double sigma,
+    double limit,
+    unsigned int imsize,
+    unsigned int reps,
+    cedar::aux::conv::BorderType::Id borderType,
+    int type = CV_32F,
+    bool reuseOutput = false,
+    unsigned int numberOfKernels = 1
+  )
   :
   mSigma(sigma),
   mLimit(limit),
   mImsize(imsize),
   mReps(reps),
   mBorderType(borderType),
+  mType(type),
+  mReuseOutput(reuseOutput),
+  mNumberOfKernels(numberOfKernels),
   mDuration(-1.0)
   {
   }
@@ -68,7 +81,10 @@ struct TestSet
                           + ", limit = " + cedar::aux::toString(this->mLimit)
                           + ", imsize = " + cedar::aux::toString(this->mImsize)
                           + ", reps = " + cedar::aux::toString(this->mReps)
-                          + ", border = " + cedar::aux::conv::BorderType::type().get(this->mBorderType).name();
+                          + ", border = " + cedar::aux::conv::BorderType::type().get(this->mBorderType).name()
+                          + ", type = " + (this->mType == CV_32F ? "float" : "double")
+                          + (this->mReuseOutput ? ", reused output" : "")
+                          + ", kernels = " + cedar::aux::toString(this->mNumberOfKernels);
     return case_id;
   }
 
@@ -77,6 +93,9 @@ struct TestSet
   unsigned int mImsize;
   unsigned int mReps;
   cedar::aux::conv::BorderType::Id mBorderType;
+  int mType;
+  bool mReuseOutput;
+  unsigned int mNumberOfKernels;
   double mDuration;
 };
 
@@ -92,22 +111,34 @@ void test_convolution_time_1d(TestSet& test)
   cedar::aux::conv::FFTWPtr fftw(new cedar::aux::conv::FFTW());
   conv->setEngine(fftw);
 
-  cedar::aux::kernel::GaussPtr gauss (new cedar::aux::kernel::Gauss(3, 1.0, test.mSigma, 0.0, test.mLimit));
-
-  conv->getKernelList()->append(gauss);
+  // alternating excitatory and (wider) inhibitory kernels, as in typical lateral interactions
+  for (unsigned int k = 0; k < test.mNumberOfKernels; ++k)
+  {
+    double amplitude = (k % 2 == 0) ? 1.0 : -0.5;
+    double sigma = test.mSigma * static_cast<double>(k + 1);
+    cedar::aux::kernel::GaussPtr gauss (new cedar::aux::kernel::Gauss(3, amplitude, sigma, 0.0, test.mLimit));
+    conv->getKernelList()->append(gauss);
+  }
 
   int size = static_cast<int>(test.mImsize);
   int sizes_3D[3] = {size, size, size};
-  cv::Mat matrix_3D(3, sizes_3D, CV_32F);
+  cv::Mat matrix_3D(3, sizes_3D, test.mType);
   cv::Mat image = matrix_3D;
 //  cv::Mat image = cv::Mat::ones(test.mImsize, 1, CV_32F);
   // do this once before measuring (initializing FFTW)
-  conv->convolve(image);
+  cv::Mat output = conv->convolve(image);
   ptime start = microsec_clock::local_time();
   for (unsigned int i = 0; i < test.mReps; ++i)
   {
-    // volatile so this doesn't get optimized away
-    volatile cv::Mat test = conv->convolve(image);
+    if (test.mReuseOutput)
+    {
+      conv->convolveInto(image, output);
+    }
+    else
+    {
+      // volatile so this doesn't get optimized away
+      volatile cv::Mat test = conv->convolve(image);
+    }
   }
   ptime end = microsec_clock::local_time();
   test.mDuration = static_cast<double>((end - start).total_milliseconds()) / 1000.0;
@@ -121,6 +152,11 @@ int main(int, char**)
 //  test.push_back(TestSet(1.0, 5.0, 30, 10, cedar::aux::conv::BorderType::Cyclic));
 //  test.push_back(TestSet(1.0, 5.0, 40, 10, cedar::aux::conv::BorderType::Cyclic));
   test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic));
+  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, CV_64F));
+  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, CV_32F, true));
+  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, CV_64F, true));
+  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, CV_32F, true, 2));
+  test.push_back(TestSet(1.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, CV_32F, true, 4));
   // measure
   for (size_t i = 0; i < test.size(); ++i)
   {
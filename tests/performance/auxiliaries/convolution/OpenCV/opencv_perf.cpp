@@ -45,6 +45,8 @@
 
 // SYSTEM INCLUDES
 #include <opencv2/opencv.hpp>
+#include <iostream>
+#include <vector>
 #ifndef Q_MOC_RUN
   #include <boost/date_time/posix_time/posix_time.hpp>
 #endif
@@ -107,6 +109,109 @@ void test_convolution_time_1d(TestSet& test)
   cedar::test::write_measurement(case_id, test.mDuration);
 }
 
+// straightforward n-dimensional convolution with a separable kernel, used to check the separable passes
+cv::Mat convolve_naive
+        (
+          const cv::Mat& matrix,
+          cedar::aux::kernel::GaussPtr kernel,
+          cedar::aux::conv::BorderType::Id borderType
+        )
+{
+  int border_type = cedar::aux::conv::BorderType::toCvConstant(borderType);
+  int dims = matrix.dims;
+  std::vector<std::vector<float> > parts(dims);
+  for (int d = 0; d < dims; ++d)
+  {
+    const cv::Mat& part = kernel->getKernelPart(d);
+    for (unsigned int i = 0; i < cedar::aux::math::get1DMatrixSize(part); ++i)
+    {
+      parts[d].push_back(cedar::aux::math::getMatrixEntry<float>(part, i));
+    }
+  }
+
+  cv::Mat result = cv::Mat::zeros(dims, matrix.size, CV_32F);
+  for (auto it = result.begin<float>(); it != result.end<float>(); ++it)
+  {
+    std::vector<int> position(dims);
+    it.pos(position.data());
+
+    std::vector<int> offsets(dims, 0);
+    double sum = 0.0;
+    bool done = false;
+    while (!done)
+    {
+      double weight = 1.0;
+      std::vector<int> source(dims);
+      bool zero = false;
+      for (int d = 0; d < dims; ++d)
+      {
+        int size = static_cast<int>(parts[d].size());
+        weight *= parts[d][offsets[d]];
+        source[d] = cv::borderInterpolate(position[d] - offsets[d] + size / 2, matrix.size[d], border_type);
+        zero = zero || source[d] < 0;
+      }
+      if (!zero)
+      {
+        sum += weight * matrix.at<float>(source.data());
+      }
+
+      done = true;
+      for (int d = 0; d < dims && done; ++d)
+      {
+        if (++offsets[d] < static_cast<int>(parts[d].size()))
+        {
+          done = false;
+        }
+        else
+        {
+          offsets[d] = 0;
+        }
+      }
+    }
+    *it = static_cast<float>(sum);
+  }
+  return result;
+}
+
+// convolves 3D and 4D matrices with separable kernels, which the OpenCV engine does in one pass per dimension
+int test_convolution_nd(const std::vector<int>& sizes, double sigma, cedar::aux::conv::BorderType::Id borderType)
+{
+  int errors = 0;
+  unsigned int dims = static_cast<unsigned int>(sizes.size());
+  std::string case_id = "conv" + cedar::aux::toString(dims) + "d separable - sigma = " + cedar::aux::toString(sigma)
+                        + ", size = " + cedar::aux::toString(sizes.at(0))
+                        + ", border = " + cedar::aux::conv::BorderType::type().get(borderType).name();
+
+  cedar::aux::conv::ConvolutionPtr conv(new cedar::aux::conv::Convolution());
+  conv->setBorderType(borderType);
+  cedar::aux::kernel::GaussPtr gauss(new cedar::aux::kernel::Gauss(dims, 1.0, sigma, 0.0, 3.0));
+  conv->getKernelList()->append(gauss);
+
+  cv::RNG rng(42);
+  cv::Mat matrix(static_cast<int>(dims), sizes.data(), CV_32F);
+  rng.fill(matrix, cv::RNG::UNIFORM, 0.0, 1.0);
+
+  // check against the naive convolution on a small corner of the matrix
+  std::vector<cv::Range> corner(dims, cv::Range(0, 8));
+  cv::Mat small = matrix(corner.data()).clone();
+  if (cv::norm(conv->convolve(small), convolve_naive(small, gauss, borderType), cv::NORM_INF) > 1e-4)
+  {
+    ++errors;
+    std::cout << "ERROR: " << case_id << " differs from the naive convolution." << std::endl;
+  }
+
+  cv::Mat result;
+  cedar::test::test_time
+  (
+    case_id,
+    [&]()
+    {
+      result = conv->convolve(matrix);
+    },
+    20
+  );
+  return errors;
+}
 
 int main(int, char**)
 {
@@ -133,5 +238,19 @@ int main(int, char**)
               << " \t|\t" << test[i].mDuration << " s"
               << std::endl;
   }
-  return 0;
+
+  int errors = 0;
+  std::vector<cedar::aux::conv::BorderType::Id> border_types;
+  border_types.push_back(cedar::aux::conv::BorderType::Zero);
+  border_types.push_back(cedar::aux::conv::BorderType::Cyclic);
+  border_types.push_back(cedar::aux::conv::BorderType::Reflect);
+  border_types.push_back(cedar::aux::conv::BorderType::Replicate);
+  for (auto border_type : border_types)
+  {
+    errors += test_convolution_nd({50, 50, 50}, 3.0, border_type);
+    errors += test_convolution_nd({20, 20, 20, 20}, 2.0, border_type);
+  }
+
+  std::cout << "test finished, there were " << errors << " errors" << std::endl;
+  return errors;
 }
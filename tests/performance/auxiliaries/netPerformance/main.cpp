@@ -28,7 +28,7 @@
     Email:       jean-stephane.jokeit@ini.ruhr-uni-bochum.de
     Date:        2013 06 21
 
-    Description: Test NetReader/Writer performance
+    Description: Test NetReader/Writer and shared memory transport performance
 
     Credits:
 
@@ -37,16 +37,24 @@
 
 // LOCAL INCLUDES
 #include "cedar/configuration.h"
+#include "cedar/testingUtilities/measurementFunctions.h"
+#include "cedar/auxiliaries/SharedMemoryChannel.h"
+#include "cedar/auxiliaries/CallFunctionInThread.h"
+#include "cedar/auxiliaries/stringFunctions.h"
 
 #ifdef CEDAR_USE_YARP
-
-#include "cedar/testingUtilities/measurementFunctions.h"
 #include "cedar/auxiliaries/net/BlockingReader.h"
 #include "cedar/auxiliaries/net/Writer.h"
-#include "cedar/auxiliaries/CallFunctionInThread.h"
+#endif // CEDAR_USE_YARP
 
 // SYSTEM INCLUDES
-
+#ifndef Q_MOC_RUN
+  #include <boost/date_time/posix_time/posix_time_types.hpp>
+#endif // Q_MOC_RUN
+#include <QCoreApplication>
+#include <atomic>
+#include <iostream>
+#include <thread>
 
 
 // global variables
@@ -55,18 +63,21 @@ int errors = 0;
 #define SIZE 15000
 #define MYPORT "CEDAR-PERFORMANCE-TEST"
 
-void mat_read_write()
+cv::Mat create_test_matrix()
 {
-  unsigned int i;
-
   cv::Mat mat = cv::Mat::eye(SIZE, 2, CV_64F);
-  cv::Mat mat2 = cv::Mat::eye(SIZE, 2, CV_64F);
-
-  i = 0;
-  for (; i < SIZE; i++)
+  for (unsigned int i = 0; i < SIZE; i++)
   {
     mat.at<double>(i,0)= i; // fill with anything
   }
+  return mat;
+}
+
+#ifdef CEDAR_USE_YARP
+void mat_read_write()
+{
+  cv::Mat mat = create_test_matrix();
+  cv::Mat mat2 = cv::Mat::eye(SIZE, 2, CV_64F);
 
   cedar::aux::net::Writer<cv::Mat> myMatWriter(MYPORT);
   cedar::aux::net::BlockingReader<cv::Mat> myMatReader(MYPORT);
@@ -76,17 +87,140 @@ void mat_read_write()
 
   // dont need to check all the results, just the last
 
-  if (mat2.at<double>(SIZE - 1 , 0) != i - 1)
+  if (mat2.at<double>(SIZE - 1 , 0) != SIZE - 1)
   {
     errors++;
   }
 }
+#endif // CEDAR_USE_YARP
+
+// the same cycle as mat_read_write, but via shared memory
+void shared_memory_read_write()
+{
+  cv::Mat mat = create_test_matrix();
+  cv::Mat mat2;
+
+  cedar::aux::SharedMemoryChannel writer(MYPORT, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+  cedar::aux::SharedMemoryChannel reader(MYPORT, cedar::aux::SharedMemoryChannel::ROLE_READER);
+
+  writer.write(mat);
+  if (!reader.read(mat2) || mat2.at<double>(SIZE - 1 , 0) != SIZE - 1)
+  {
+    errors++;
+  }
+}
+
+double seconds_since(const boost::posix_time::ptime& start)
+{
+  return static_cast<double>((boost::posix_time::microsec_clock::universal_time() - start).total_microseconds()) / 1e6;
+}
+
+// measures the time from writing a matrix until a reader polling in another thread has a copy of it
+void shared_memory_latency(int rows, int cols)
+{
+  const unsigned int repetitions = 1000;
+  std::string id = "shared memory latency " + cedar::aux::toString(rows) + "x" + cedar::aux::toString(cols);
+
+  cv::Mat mat(rows, cols, CV_32F, cv::Scalar(0));
+  cedar::aux::SharedMemoryChannel writer(MYPORT, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+  cedar::aux::SharedMemoryChannel reader(MYPORT, cedar::aux::SharedMemoryChannel::ROLE_READER);
+
+  std::atomic<unsigned int> received(0);
+  std::thread reader_thread
+  (
+    [&]()
+    {
+      cv::Mat target;
+      while (received < repetitions)
+      {
+        if (reader.read(target))
+        {
+          ++received;
+        }
+      }
+    }
+  );
+
+  boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+  for (unsigned int i = 0; i < repetitions; ++i)
+  {
+    mat.at<float>(0, 0) = static_cast<float>(i);
+    writer.write(mat);
+    // wait for the reader before writing the next matrix
+    while (received <= i)
+    {
+      std::this_thread::yield();
+    }
+  }
+  double elapsed = seconds_since(start);
+  reader_thread.join();
+
+  cedar::test::write_measurement(id, elapsed / static_cast<double>(repetitions));
+}
+
+// measures how many matrices per second a writer can publish while a reader continuously copies them
+void shared_memory_throughput(int rows, int cols)
+{
+  const double duration = 2.0;
+  std::string size = cedar::aux::toString(rows) + "x" + cedar::aux::toString(cols);
+
+  cv::Mat mat(rows, cols, CV_32F, cv::Scalar(0));
+  cedar::aux::SharedMemoryChannel writer(MYPORT, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+  cedar::aux::SharedMemoryChannel reader(MYPORT, cedar::aux::SharedMemoryChannel::ROLE_READER);
+
+  std::atomic<bool> stop(false);
+  unsigned int reads = 0;
+  std::thread reader_thread
+  (
+    [&]()
+    {
+      cv::Mat target;
+      while (!stop)
+      {
+        if (reader.read(target))
+        {
+          ++reads;
+        }
+      }
+    }
+  );
+
+  unsigned int writes = 0;
+  boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+  double elapsed = 0.0;
+  while (elapsed < duration)
+  {
+    writer.write(mat);
+    ++writes;
+    elapsed = seconds_since(start);
+  }
+  stop = true;
+  reader_thread.join();
+
+  double megabytes = static_cast<double>(mat.total() * mat.elemSize()) / (1024.0 * 1024.0);
+  std::cout << "shared memory " << size << ": " << writes / elapsed << " writes/s, " << reads / elapsed
+            << " reads/s, " << reads * megabytes / elapsed << " MB/s read" << std::endl;
+  cedar::test::write_measurement("shared memory write time " + size, elapsed / static_cast<double>(writes));
+  if (reads == 0)
+  {
+    std::cout << "ERROR: the reader did not receive any matrix." << std::endl;
+    errors++;
+  }
+}
 
 void run_test()
 {
   errors = 0;
 
+#ifdef CEDAR_USE_YARP
   cedar::test::test_time("read/write cycle (cv::Mat)", mat_read_write);
+#endif // CEDAR_USE_YARP
+  cedar::test::test_time("read/write cycle (cv::Mat, shared memory)", shared_memory_read_write);
+
+  shared_memory_latency(50, 50);
+  shared_memory_latency(640, 480);
+  shared_memory_throughput(50, 50);
+  shared_memory_throughput(640, 480);
 }
 
 int main(int argc, char* argv[])
@@ -107,6 +241,3 @@ int main(int argc, char* argv[])
 
   return errors;
 }
-
-#endif // CEDAR_USE_YARP
-
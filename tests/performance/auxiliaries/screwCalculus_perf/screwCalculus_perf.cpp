@@ -0,0 +1,231 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        screwCalculus_perf.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Compares the cv::Mat and the fixed-size implementation of the screw calculus on a 7-DOF chain.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/testingUtilities/measurementFunctions.h"
+#include "cedar/auxiliaries/math/screwCalculus.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <iostream>
+#include <vector>
+
+const unsigned int NUMBER_OF_JOINTS = 7;
+const unsigned int NUMBER_OF_CONFIGURATIONS = 100;
+
+typedef cv::Matx<float, 4, 4> Transformation;
+typedef cv::Vec<float, 6> Twist;
+typedef cv::Vec<float, 4> Point;
+
+//! Geometry of a 7-DOF arm resembling a KUKA LWR, both as cv::Mat and as fixed-size matrices.
+struct Chain
+{
+  Chain()
+  {
+    const float positions[NUMBER_OF_JOINTS][3]
+      = {{0, 0, 0.31f}, {0, 0, 0.31f}, {0, 0, 0.71f}, {0, 0, 0.71f}, {0, 0, 1.11f}, {0, 0, 1.11f}, {0, 0, 1.19f}};
+    const float axes[NUMBER_OF_JOINTS][3]
+      = {{0, 0, 1}, {0, 1, 0}, {0, 0, 1}, {0, -1, 0}, {0, 0, 1}, {0, 1, 0}, {0, 0, 1}};
+
+    for (unsigned int j = 0; j < NUMBER_OF_JOINTS; ++j)
+    {
+      cv::Vec<float, 3> p(positions[j][0], positions[j][1], positions[j][2]);
+      cv::Vec<float, 3> omega(axes[j][0], axes[j][1], axes[j][2]);
+      mFixedTwists.push_back(cedar::aux::math::twistCoordinates(p, omega));
+      mMatTwists.push_back(cedar::aux::math::twistCoordinates<float>(cv::Mat(p), cv::Mat(omega)));
+    }
+
+    mFixedEndEffector = Transformation::eye();
+    mFixedEndEffector(2, 3) = 1.27f;
+    mMatEndEffector = cv::Mat(mFixedEndEffector, true);
+  }
+
+  std::vector<cv::Mat> mMatTwists;
+  cv::Mat mMatEndEffector;
+  std::vector<Twist> mFixedTwists;
+  Transformation mFixedEndEffector;
+};
+
+//! One set of joint angles and velocities.
+struct Configuration
+{
+  double mAngles[NUMBER_OF_JOINTS];
+  float mVelocities[NUMBER_OF_JOINTS];
+};
+
+//! Results of one update; position and velocity of the end-effector and its cartesian Jacobian.
+struct Result
+{
+  cv::Mat mPosition;
+  cv::Mat mVelocity;
+  cv::Mat mJacobian;
+};
+
+// the computations ForwardKinematics used to do before it switched to the fixed-size backend
+void update_mat(const Chain& chain, const Configuration& configuration, Result& result)
+{
+  std::vector<cv::Mat> products(NUMBER_OF_JOINTS);
+  std::vector<cv::Mat> twists(NUMBER_OF_JOINTS);
+  cv::Mat exponential = cv::Mat::eye(4, 4, CV_32F);
+  for (unsigned int i = 0; i < NUMBER_OF_JOINTS; ++i)
+  {
+    cedar::aux::math::expTwist<float>(chain.mMatTwists[i], configuration.mAngles[i], exponential);
+    if (i == 0)
+    {
+      products[i] = exponential.clone();
+      twists[i] = chain.mMatTwists[i];
+    }
+    else
+    {
+      products[i] = products[i - 1] * exponential;
+      twists[i] = cedar::aux::math::rigidToAdjointTransformation<float>(products[i]) * chain.mMatTwists[i];
+    }
+  }
+
+  cv::Mat end_effector = products[NUMBER_OF_JOINTS - 1] * chain.mMatEndEffector;
+  cv::Mat point = end_effector(cv::Rect(3, 0, 1, 4)).clone();
+  cv::Mat spatial_velocity = cv::Mat::zeros(6, 1, CV_32F);
+  result.mJacobian = cv::Mat::zeros(3, NUMBER_OF_JOINTS, CV_32F);
+  for (unsigned int j = 0; j < NUMBER_OF_JOINTS; ++j)
+  {
+    cv::Mat column = cedar::aux::math::wedgeTwist<float>(twists[j]) * point;
+    result.mJacobian.at<float>(0, j) = column.at<float>(0, 0);
+    result.mJacobian.at<float>(1, j) = column.at<float>(1, 0);
+    result.mJacobian.at<float>(2, j) = column.at<float>(2, 0);
+    spatial_velocity += twists[j] * configuration.mVelocities[j];
+  }
+  result.mPosition = point;
+  result.mVelocity = cedar::aux::math::wedgeTwist<float>(spatial_velocity) * point;
+}
+
+// the same computations with fixed-size matrices
+void update_fixed
+     (
+       const Chain& chain,
+       const Configuration& configuration,
+       Point& position,
+       Point& velocity,
+       cv::Matx<float, 3, NUMBER_OF_JOINTS>& jacobian
+     )
+{
+  Transformation product = Transformation::eye();
+  Twist twists[NUMBER_OF_JOINTS];
+  for (unsigned int i = 0; i < NUMBER_OF_JOINTS; ++i)
+  {
+    product = product * cedar::aux::math::expTwist(chain.mFixedTwists[i], configuration.mAngles[i]);
+    twists[i] = cedar::aux::math::adjointTransformTwist(product, chain.mFixedTwists[i]);
+  }
+
+  Transformation end_effector = product * chain.mFixedEndEffector;
+  position = Point(end_effector(0, 3), end_effector(1, 3), end_effector(2, 3), end_effector(3, 3));
+  Twist spatial_velocity;
+  for (unsigned int j = 0; j < NUMBER_OF_JOINTS; ++j)
+  {
+    Point column = cedar::aux::math::wedgeTwist(twists[j]) * position;
+    jacobian(0, j) = column[0];
+    jacobian(1, j) = column[1];
+    jacobian(2, j) = column[2];
+    spatial_velocity += twists[j] * configuration.mVelocities[j];
+  }
+  velocity = cedar::aux::math::wedgeTwist(spatial_velocity) * position;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+  Chain chain;
+
+  cv::RNG rng(42);
+  std::vector<Configuration> configurations(NUMBER_OF_CONFIGURATIONS);
+  for (auto& configuration : configurations)
+  {
+    for (unsigned int j = 0; j < NUMBER_OF_JOINTS; ++j)
+    {
+      configuration.mAngles[j] = rng.uniform(-2.0, 2.0);
+      configuration.mVelocities[j] = rng.uniform(-1.0f, 1.0f);
+    }
+  }
+
+  // both implementations have to agree before their timings mean anything
+  Result result;
+  Point position, velocity;
+  cv::Matx<float, 3, NUMBER_OF_JOINTS> jacobian;
+  for (const auto& configuration : configurations)
+  {
+    update_mat(chain, configuration, result);
+    update_fixed(chain, configuration, position, velocity, jacobian);
+    if
+    (
+      cv::norm(result.mPosition, cv::Mat(position)) > 1e-4
+      || cv::norm(result.mVelocity, cv::Mat(velocity)) > 1e-4
+      || cv::norm(result.mJacobian, cv::Mat(jacobian)) > 1e-4
+    )
+    {
+      ++errors;
+      std::cout << "ERROR: cv::Mat and fixed-size implementation disagree." << std::endl;
+    }
+  }
+
+  const unsigned int repetitions = 1000;
+  cedar::test::test_time
+  (
+    "screw calculus - 7-DOF chain update, cv::Mat",
+    [&]()
+    {
+      for (const auto& configuration : configurations)
+      {
+        update_mat(chain, configuration, result);
+      }
+    },
+    repetitions
+  );
+  cedar::test::test_time
+  (
+    "screw calculus - 7-DOF chain update, fixed-size",
+    [&]()
+    {
+      for (const auto& configuration : configurations)
+      {
+        update_fixed(chain, configuration, position, velocity, jacobian);
+      }
+    },
+    repetitions
+  );
+
+  std::cout << "test finished, there were " << errors << " errors" << std::endl;
+  return errors;
+}
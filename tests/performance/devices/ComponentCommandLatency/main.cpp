@@ -0,0 +1,228 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Measures how long commands take from the user side of a simulated kinematic chain to its measurements.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/devices/Robot.h"
+#include "cedar/devices/SimulatedKinematicChain.h"
+#include "cedar/devices/SampleExchange.h"
+#include "cedar/auxiliaries/CallFunctionInThread.h"
+#include "cedar/testingUtilities/measurementFunctions.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <QThread>
+#include <opencv2/opencv.hpp>
+#include <boost/make_shared.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+
+// global variables
+int errors = 0;
+
+// rate at which the component communicates with the (simulated) device and at which commands are sent
+const cedar::unit::Time step_size(1.0 * cedar::unit::milli * cedar::unit::seconds);
+const int64_t command_period_ns = 1000 * 1000;
+const unsigned int number_of_commands = 5000;
+
+// Each command sets all joints to a code, from which the measurement thread recovers the command. Codes repeat after
+// number_of_codes commands, which is far more than can be under way at any time.
+const unsigned int number_of_codes = 4000;
+const float code_step = 0.001f;
+
+float encode(unsigned int command)
+{
+  return static_cast<float>(command % number_of_codes) * code_step;
+}
+
+unsigned int decode(float angle)
+{
+  return static_cast<unsigned int>(angle / code_step + 0.5f) % number_of_codes;
+}
+
+//! Sends commands at a fixed rate and remembers when each of them was sent.
+class CommandThread : public QThread
+{
+public:
+  CommandThread(cedar::dev::SimulatedKinematicChainPtr arm, std::atomic<int64_t>* pSendTimes)
+  :
+  mArm(arm),
+  mpSendTimes(pSendTimes),
+  mFinished(false)
+  {
+  }
+
+  bool isDone() const
+  {
+    return this->mFinished.load();
+  }
+
+protected:
+  void run()
+  {
+    cv::Mat angles(static_cast<int>(this->mArm->getNumberOfJoints()), 1, CV_32F);
+    int64_t deadline = cedar::dev::SampleExchange::now();
+    // command 0 would have the code of the initial angles
+    for (unsigned int command = 1; command <= number_of_commands; ++command)
+    {
+      angles = encode(command);
+      this->mpSendTimes[command % number_of_codes].store(cedar::dev::SampleExchange::now());
+      this->mArm->setJointAngles(angles);
+
+      deadline += command_period_ns;
+      int64_t remaining = deadline - cedar::dev::SampleExchange::now();
+      if (remaining > 0)
+      {
+        QThread::usleep(static_cast<unsigned long>(remaining / 1000));
+      }
+    }
+    this->mFinished.store(true);
+  }
+
+private:
+  cedar::dev::SimulatedKinematicChainPtr mArm;
+  std::atomic<int64_t>* mpSendTimes;
+  std::atomic<bool> mFinished;
+};
+
+double percentile(const std::vector<double>& sorted, double fraction)
+{
+  size_t index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+  return sorted.at(std::min(index, sorted.size() - 1));
+}
+
+void run_test()
+{
+  errors = 0;
+
+  auto robot = boost::make_shared<cedar::dev::Robot>();
+  robot->readJson("test_configuration.json");
+  auto arm = robot->getComponent<cedar::dev::SimulatedKinematicChain>("arm");
+  arm->setCommunicationStepSize(step_size);
+  arm->startCommunication();
+
+  std::unique_ptr<std::atomic<int64_t>[]> send_times(new std::atomic<int64_t>[number_of_codes]);
+  for (unsigned int i = 0; i < number_of_codes; ++i)
+  {
+    send_times[i].store(0);
+  }
+
+  CommandThread commands(arm, send_times.get());
+  commands.start();
+
+  // Poll the measurements. The latency of a command is the time from sending it to the time stamp of the first
+  // measurement that shows it. If the poller skipped a measurement, the first one showing a command may have been
+  // missed, so such measurements are not counted.
+  std::vector<double> latencies;
+  latencies.reserve(number_of_commands);
+  unsigned int skipped = 0;
+  cedar::dev::SampleExchange::Sample sample;
+  unsigned long long last_sequence_number = 0;
+  unsigned int last_code = 0;
+  while (!commands.isDone())
+  {
+    arm->readUserSideMeasurementSample(cedar::dev::KinematicChain::JOINT_ANGLES, sample);
+    if (sample.mSequenceNumber == last_sequence_number || sample.mData.empty())
+    {
+      QThread::yieldCurrentThread();
+      continue;
+    }
+
+    bool consecutive = (sample.mSequenceNumber == last_sequence_number + 1);
+    last_sequence_number = sample.mSequenceNumber;
+
+    unsigned int code = decode(sample.mData.at<float>(0, 0));
+    if (code == last_code)
+    {
+      continue;
+    }
+    last_code = code;
+
+    if (!consecutive)
+    {
+      ++skipped;
+      continue;
+    }
+
+    int64_t sent = send_times[code].load();
+    if (sent > 0 && sample.mTimeStamp >= sent)
+    {
+      latencies.push_back(static_cast<double>(sample.mTimeStamp - sent) * 1e-6);
+    }
+  }
+
+  commands.wait();
+  arm->stopCommunication();
+
+  std::cout << "measured the latency of " << latencies.size() << " of " << number_of_commands << " commands ("
+            << skipped << " skipped by the poller)" << std::endl;
+  if (latencies.empty())
+  {
+    std::cout << "ERROR: no command arrived in the measurements." << std::endl;
+    ++errors;
+    return;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  cedar::test::write_measurement("command latency p50 [ms]", percentile(latencies, 0.5));
+  cedar::test::write_measurement("command latency p90 [ms]", percentile(latencies, 0.9));
+  cedar::test::write_measurement("command latency p99 [ms]", percentile(latencies, 0.99));
+  cedar::test::write_measurement("command latency max [ms]", latencies.back());
+}
+
+int main(int argc, char* argv[])
+{
+  QCoreApplication* app;
+  app = new QCoreApplication(argc,argv);
+
+  auto testThread = new cedar::aux::CallFunctionInThread(run_test);
+
+  QObject::connect(testThread, SIGNAL(finishedThread()), app, SLOT(quit()), Qt::QueuedConnection);
+
+  testThread->start();
+  app->exec();
+
+  delete testThread;
+  delete app;
+
+  return errors;
+}
@@ -0,0 +1,146 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Compares run time and accuracy of the integration methods of neural fields.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/configuration.h"
+#include "cedar/processing/Step.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/dynamics/fields/NeuralField.h"
+#include "cedar/dynamics/IntegrationMethod.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/CallFunctionInThread.h"
+#include "cedar/testingUtilities/measurementFunctions.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <QApplication>
+#include <iostream>
+#include <cmath>
+
+// all fields are simulated for this long
+const double SIMULATED_TIME_MS = 500.0;
+// step size of the simulation all others are compared to
+const double REFERENCE_STEP_MS = 0.1;
+const unsigned int FIELD_SIZE = 100;
+
+cedar::dyn::NeuralFieldPtr create_field(cedar::dyn::IntegrationMethod::Id method)
+{
+  cedar::dyn::NeuralFieldPtr field(new cedar::dyn::NeuralField());
+  field->setDimensionality(1);
+  field->setSize(0, FIELD_SIZE);
+  field->setIntegrationMethod(method);
+  // noise would make the results of different step sizes incomparable
+  field->getParameter<cedar::aux::DoubleParameter>("input noise gain")->setValue(0.0);
+
+  // start from a localized bump that the lateral interaction turns into a self-stabilized peak
+  cv::Mat& activation
+    = boost::dynamic_pointer_cast<cedar::aux::MatData>(field->getBufferSlot("activation")->getData())->getData();
+  for (unsigned int i = 0; i < FIELD_SIZE; ++i)
+  {
+    double x = (static_cast<double>(i) - FIELD_SIZE / 2.0) / 5.0;
+    activation.at<float>(i, 0) = static_cast<float>(-5.0 + 7.0 * std::exp(-0.5 * x * x));
+  }
+  return field;
+}
+
+cv::Mat simulate(cedar::dyn::IntegrationMethod::Id method, double stepMs)
+{
+  cedar::dyn::NeuralFieldPtr field = create_field(method);
+  cedar::proc::StepTimePtr step_time
+  (
+    new cedar::proc::StepTime(cedar::unit::Time(stepMs * cedar::unit::milli * cedar::unit::seconds))
+  );
+
+  unsigned int steps = static_cast<unsigned int>(SIMULATED_TIME_MS / stepMs + 0.5);
+  for (unsigned int i = 0; i < steps; ++i)
+  {
+    field->onTrigger(step_time, cedar::proc::TriggerPtr());
+  }
+  return field->getFieldActivation()->getData().clone();
+}
+
+void measure(cedar::dyn::IntegrationMethod::Id method, double stepMs, const cv::Mat& reference)
+{
+  std::string method_name = cedar::dyn::IntegrationMethod::type().get(method).prettyString();
+  std::string id = method_name + ", step: " + cedar::aux::toString(stepMs) + " ms";
+
+  cv::Mat result;
+  cedar::test::test_time
+  (
+    id + ", simulation of " + cedar::aux::toString(SIMULATED_TIME_MS) + " ms",
+    [&]()
+    {
+      result = simulate(method, stepMs);
+    }
+  );
+
+  std::cout << id << ", maximal error: " << cv::norm(result, reference, cv::NORM_INF) << std::endl;
+}
+
+void measure_all()
+{
+  cv::Mat reference = simulate(cedar::dyn::IntegrationMethod::RungeKutta4, REFERENCE_STEP_MS);
+
+  const cedar::dyn::IntegrationMethod::Id methods[] =
+  {
+    cedar::dyn::IntegrationMethod::ExplicitEuler,
+    cedar::dyn::IntegrationMethod::ExponentialEuler,
+    cedar::dyn::IntegrationMethod::Heun,
+    cedar::dyn::IntegrationMethod::RungeKutta4,
+    cedar::dyn::IntegrationMethod::AdaptiveHeun
+  };
+  const double steps[] = {1.0, 5.0, 10.0};
+
+  for (auto method : methods)
+  {
+    for (auto step : steps)
+    {
+      measure(method, step, reference);
+    }
+  }
+
+  QApplication::exit(0); // no errors -- this is a performance test.
+}
+
+int main(int argc, char** argv)
+{
+  QApplication app(argc, argv);
+
+  cedar::aux::CallFunctionInThread caller(boost::bind(&measure_all));
+  caller.start();
+  return app.exec();
+}
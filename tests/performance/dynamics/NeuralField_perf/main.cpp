@@ -57,7 +57,7 @@ void event_loop()
   }
 }
 
-void measure(unsigned int dim, unsigned int repetitions)
+void measure(unsigned int dim, unsigned int repetitions, bool referenceIntegration)
 {
   cedar::dyn::NeuralFieldPtr field(new cedar::dyn::NeuralField());
   field->setDimensionality(dim);
@@ -65,16 +65,29 @@ void measure(unsigned int dim, unsigned int repetitions)
   {
     field->setSize(i, 50);
   }
+  field->setReferenceIntegration(referenceIntegration);
 
   std::string id;
   id += "dimensions: " + cedar::aux::toString(dim);
   id += ", repetitions: " + cedar::aux::toString(repetitions);
+  id += std::string(", integration: ") + (referenceIntegration ? "reference" : "fused");
   cedar::test::test_time
   (
     id,
     boost::bind(&cedar::proc::Step::onTrigger, field, cedar::proc::StepTimePtr(new cedar::proc::StepTime(0.001 * cedar::unit::seconds)), cedar::proc::TriggerPtr()),
     repetitions
   );
+}
+
+void measure_all()
+{
+  for (unsigned int dim = 1; dim <= 3; ++dim)
+  {
+    // 3D fields are much larger, so fewer repetitions are needed
+    unsigned int repetitions = (dim < 3) ? 1000 : 100;
+    measure(dim, repetitions, true);
+    measure(dim, repetitions, false);
+  }
 
   QApplication::exit(0); // no errors -- this is a performance test.
 }
@@ -83,9 +96,7 @@ int main(int argc, char** argv)
 {
   QApplication app(argc, argv);
 
-  cedar::aux::CallFunctionInThread caller(boost::bind(&measure, 3, 100));
+  cedar::aux::CallFunctionInThread caller(boost::bind(&measure_all));
   caller.start();
-//  measure(2, 20000);
-//  measure(3, 100);
   return app.exec();
 }
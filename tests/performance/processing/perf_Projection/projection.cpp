@@ -41,10 +41,14 @@
 #include "cedar/processing/steps/Projection.h"
 #include "cedar/processing/Step.h"
 #include "cedar/processing/Group.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/EnumParameter.h"
 #include "cedar/testingUtilities/measurementFunctions.h"
 
 // SYSTEM INCLUDES
 #include <QApplication>
+#include <vector>
 
 // helper method
 void event_loop()
@@ -130,6 +134,76 @@ void measure(unsigned int sourceDim, unsigned int targetDim, unsigned int repeti
   }
 }
 
+/*!@brief Measures a projection of a standalone input with the given sizes.
+ *
+ * @param mapping output dimension of each input dimension, -1 to compress it
+ * @param broadcastSize size of the output dimensions no input dimension is mapped to
+ */
+void measureND
+(
+  const std::string& id,
+  const std::vector<int>& inputSizes,
+  const std::vector<int>& mapping,
+  unsigned int outputDimensionality,
+  unsigned int broadcastSize,
+  cedar::aux::EnumId compression,
+  bool parallel,
+  unsigned int repetitions
+)
+{
+  using cedar::proc::steps::Projection;
+  using cedar::proc::ProjectionMappingParameter;
+
+  cv::Mat input_matrix(static_cast<int>(inputSizes.size()), &inputSizes.front(), CV_32F);
+  cv::randu(input_matrix, cv::Scalar(0.0), cv::Scalar(1.0));
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(input_matrix));
+
+  cedar::proc::steps::ProjectionPtr projection(new Projection());
+  projection->setInput("input", input);
+  projection->getParameter<cedar::aux::EnumParameter>("compression type")->setValue(compression);
+  projection->getParameter<cedar::aux::BoolParameter>("parallelize")->setValue(parallel);
+  projection->setOutputDimensionality(outputDimensionality);
+
+  auto mapping_parameter = projection->getParameter<ProjectionMappingParameter>("dimension mapping");
+  std::vector<bool> mapped(outputDimensionality, false);
+  for (unsigned int dim = 0; dim < mapping.size(); ++dim)
+  {
+    if (mapping.at(dim) < 0)
+    {
+      mapping_parameter->drop(dim);
+    }
+    else
+    {
+      mapping_parameter->changeMapping(dim, static_cast<unsigned int>(mapping.at(dim)));
+      mapped.at(mapping.at(dim)) = true;
+    }
+  }
+  for (unsigned int dim = 0; dim < outputDimensionality; ++dim)
+  {
+    if (!mapped.at(dim))
+    {
+      projection->setOutputDimensionSize(dim, broadcastSize);
+    }
+  }
+
+  std::string full_id = id + (parallel ? " (parallel)" : "");
+  cedar::test::test_time
+  (
+    full_id,
+    boost::bind(&cedar::proc::Step::onTrigger, projection, cedar::proc::ArgumentsPtr(), cedar::proc::TriggerPtr()),
+    repetitions
+  );
+
+  if (projection->getState() == cedar::proc::Triggerable::STATE_EXCEPTION)
+  {
+    cedar::aux::LogSingleton::getInstance()->error
+    (
+      "Configuration \"" + full_id + "\" resulted in an exception.",
+      "void measureND(...)"
+    );
+  }
+}
+
 int main(int, char**)
 {
   unsigned int max_dim = 3;
@@ -147,5 +221,17 @@ int main(int, char**)
       measure(source, target, repetitions);
     }
   }
+
+  using CompressionType = cedar::proc::steps::Projection::CompressionType;
+  for (bool parallel : {false, true})
+  {
+    measureND("4 -> 2 (sum)", {30, 30, 30, 30}, {-1, 1, -1, 0}, 2, 0, CompressionType::SUM, parallel, 10);
+    measureND("4 -> 3 (max)", {30, 30, 30, 30}, {2, 1, -1, 0}, 3, 0, CompressionType::MAXIMUM, parallel, 10);
+    measureND("5 -> 2 (mean)", {15, 15, 15, 15, 15}, {-1, 0, -1, 1, -1}, 2, 0, CompressionType::AVERAGE, parallel, 10);
+    measureND("5 -> 3 (min)", {15, 15, 15, 15, 15}, {2, -1, 0, -1, 1}, 3, 0, CompressionType::MINIMUM, parallel, 10);
+    measureND("4 -> 4 (permuted)", {30, 30, 30, 30}, {3, 2, 1, 0}, 4, 0, CompressionType::SUM, parallel, 10);
+    measureND("2 -> 4", {50, 50}, {3, 1}, 4, 20, CompressionType::SUM, parallel, 10);
+    measureND("3 -> 5", {20, 20, 20}, {0, 2, 4}, 5, 15, CompressionType::SUM, parallel, 10);
+  }
   return 0; // no errors -- this is a performance test.
 }
@@ -0,0 +1,217 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Tests the lock-free publishing of data snapshots.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/DataSnapshotChannel.h"
+#include "cedar/auxiliaries/MatData.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <boost/make_shared.hpp>
+#include <QThread>
+#include <atomic>
+#include <iostream>
+
+//! Reads snapshots until it is told to stop and counts the ones that were partially written.
+class SnapshotReader : public QThread
+{
+public:
+  SnapshotReader(const cedar::aux::DataSnapshotChannel& channel)
+  :
+  mChannel(channel),
+  mDone(false),
+  mTorn(0)
+  {
+  }
+
+  void run()
+  {
+    while (!mDone)
+    {
+      auto snapshot = mChannel.acquire();
+      if (snapshot.isValid())
+      {
+        double min, max;
+        cv::minMaxLoc(snapshot.getMatrix(), &min, &max);
+        if (min != max || min != static_cast<double>(snapshot.getVersion()))
+        {
+          ++mTorn;
+        }
+      }
+    }
+  }
+
+  const cedar::aux::DataSnapshotChannel& mChannel;
+  std::atomic<bool> mDone;
+  std::atomic<unsigned int> mTorn;
+};
+
+int main()
+{
+  unsigned int errors = 0;
+
+  std::cout << "Checking that nothing is published while nobody reads." << std::endl;
+  auto data = boost::make_shared<cedar::aux::MatData>(cv::Mat::ones(5, 5, CV_32F));
+  data->getSnapshotChannel().setMaximumRate(1e9);
+  data->lockForRead();
+  data->publishSnapshot();
+  data->unlock();
+  if (data->getSnapshotChannel().getPublishedCount() != 0)
+  {
+    ++errors;
+    std::cout << "ERROR: a snapshot was published without readers." << std::endl;
+  }
+
+  std::cout << "Checking that the first read takes a snapshot." << std::endl;
+  {
+    auto snapshot = data->getSnapshot();
+    if (!snapshot.isValid() || cv::countNonZero(snapshot.getMatrix() != data->getData()) != 0)
+    {
+      ++errors;
+      std::cout << "ERROR: the first snapshot does not match the data." << std::endl;
+    }
+  }
+
+  std::cout << "Checking that held snapshots are not overwritten." << std::endl;
+  {
+    auto old_snapshot = data->getSnapshot();
+    data->setData(cv::Mat::zeros(5, 5, CV_32F));
+    data->lockForRead();
+    data->publishSnapshot();
+    data->unlock();
+    auto new_snapshot = data->getSnapshot();
+    if (!old_snapshot.isValid() || cv::sum(old_snapshot.getMatrix())[0] != 25.0)
+    {
+      ++errors;
+      std::cout << "ERROR: a held snapshot was changed." << std::endl;
+    }
+    if (!new_snapshot.isValid() || cv::sum(new_snapshot.getMatrix())[0] != 0.0)
+    {
+      ++errors;
+      std::cout << "ERROR: the newest snapshot does not match the data." << std::endl;
+    }
+    if (new_snapshot.isValid() && new_snapshot.getVersion() != data->getVersion())
+    {
+      ++errors;
+      std::cout << "ERROR: the newest snapshot has the wrong version." << std::endl;
+    }
+  }
+
+  std::cout << "Checking that the writer skips snapshots instead of waiting." << std::endl;
+  {
+    cedar::aux::DataSnapshotChannel channel(3);
+    channel.setMaximumRate(1e9);
+    auto write = [](cv::Mat& matrix, cedar::aux::annotation::Annotatable&)
+    {
+      matrix = cv::Mat::zeros(1, 1, CV_32F);
+      return true;
+    };
+
+    // mark the channel as read
+    channel.acquire();
+
+    std::vector<cedar::aux::DataSnapshotChannel::Snapshot> held;
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+      if (!channel.publish(i, write))
+      {
+        ++errors;
+        std::cout << "ERROR: could not publish although there are free buffers." << std::endl;
+      }
+      held.push_back(channel.acquire());
+    }
+    if (channel.publish(3, write))
+    {
+      ++errors;
+      std::cout << "ERROR: published into a buffer that is being read." << std::endl;
+    }
+    held.clear();
+    if (!channel.publish(3, write))
+    {
+      ++errors;
+      std::cout << "ERROR: could not publish after all snapshots were released." << std::endl;
+    }
+  }
+
+  std::cout << "Checking the maximum rate." << std::endl;
+  {
+    cedar::aux::DataSnapshotChannel channel;
+    channel.setMaximumRate(0.1);
+    auto write = [](cv::Mat& matrix, cedar::aux::annotation::Annotatable&)
+    {
+      matrix = cv::Mat::zeros(1, 1, CV_32F);
+      return true;
+    };
+    channel.acquire();
+    channel.publish(0, write);
+    if (channel.publish(1, write) || channel.getPublishedCount() != 1)
+    {
+      ++errors;
+      std::cout << "ERROR: published faster than the maximum rate." << std::endl;
+    }
+  }
+
+  std::cout << "Checking that concurrent readers never see partially written snapshots." << std::endl;
+  {
+    cedar::aux::DataSnapshotChannel channel;
+    channel.setMaximumRate(1e9);
+    channel.acquire();
+    SnapshotReader reader(channel);
+    reader.start();
+
+    for (unsigned int i = 1; i <= 20000; ++i)
+    {
+      channel.publish(i, [i](cv::Mat& matrix, cedar::aux::annotation::Annotatable&)
+      {
+        matrix.create(64, 64, CV_32F);
+        matrix = cv::Scalar(static_cast<double>(i));
+        return true;
+      });
+    }
+    reader.mDone = true;
+    reader.wait();
+
+    if (reader.mTorn > 0)
+    {
+      ++errors;
+      std::cout << "ERROR: " << reader.mTorn << " snapshots were read while being written." << std::endl;
+    }
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
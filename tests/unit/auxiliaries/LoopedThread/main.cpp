@@ -37,9 +37,11 @@
 
 #include "cedar/auxiliaries/LoopedThread.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
+#include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
 
 #include <cstdlib>
+#include <cmath>
 #include <iostream>
 #include <random>
 
@@ -137,6 +139,107 @@ class CountingThread : public cedar::aux::LoopedThread
 };
 
 
+//!@brief Checks that it is stepped exactly at the times the lockstep scheduler should step it.
+class LockstepThread : public cedar::aux::LoopedThread
+{
+  public:
+    LockstepThread(cedar::unit::Time simulatedTime)
+    :
+    cedar::aux::LoopedThread
+    (
+      cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second),
+      cedar::unit::Time(0.01 * cedar::unit::milli * cedar::unit::second),
+      simulatedTime,
+      cedar::aux::LoopMode::Simulated
+    ),
+    mCounter(0),
+    mTimingErrors(0),
+    mFirstTime(-1.0 * cedar::unit::seconds),
+    mLastTime(0.0 * cedar::unit::seconds)
+    {
+    }
+
+    void step(cedar::unit::Time time)
+    {
+      // each step must begin exactly where the previous one ended
+      cedar::unit::Time now = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+      if (mCounter > 0 && std::abs((now - mLastTime - time) / cedar::unit::Time(1.0 * cedar::unit::seconds)) > 1e-9)
+      {
+        ++mTimingErrors;
+      }
+      if (mCounter == 0)
+      {
+        mFirstTime = now;
+      }
+      mLastTime = now;
+      ++mCounter;
+    }
+
+    unsigned int mCounter;
+    unsigned int mTimingErrors;
+    cedar::unit::Time mFirstTime;
+    cedar::unit::Time mLastTime;
+};
+
+int testLockstep()
+{
+  int errors = 0;
+  std::cout << "Running two simulated threads in lockstep ..." << std::endl;
+
+  auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+  clock->setLockstep(true);
+  clock->reset();
+
+  LockstepThread fast(cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second));
+  LockstepThread slow(cedar::unit::Time(3.0 * cedar::unit::milli * cedar::unit::second));
+  // start both behind the barrier, as Group::startTriggers does
+  clock->holdLockstep();
+  fast.start();
+  slow.start();
+  cedar::aux::sleep(cedar::unit::Time(0.05 * cedar::unit::second));
+  if (fast.mCounter > 0 || slow.mCounter > 0)
+  {
+    std::cout << "ERROR: a thread stepped while the lockstep schedule was held." << std::endl;
+    ++errors;
+  }
+  clock->releaseLockstep();
+  cedar::aux::sleep(cedar::unit::Time(0.5 * cedar::unit::second));
+  fast.requestStop();
+  slow.requestStop();
+  fast.stop();
+  slow.stop();
+  clock->setLockstep(false);
+
+  if (slow.mCounter < 10)
+  {
+    std::cout << "ERROR: the threads did not step often enough, only " << slow.mCounter << " times." << std::endl;
+    ++errors;
+  }
+
+  if (fast.mTimingErrors > 0 || slow.mTimingErrors > 0)
+  {
+    std::cout << "ERROR: the global clock did not match the simulated time of the threads." << std::endl;
+    ++errors;
+  }
+
+  if (fast.mFirstTime != slow.mFirstTime)
+  {
+    std::cout << "ERROR: the threads did not take their first step together." << std::endl;
+    ++errors;
+  }
+
+  // neither thread may get ahead of the other by more than a step of the slow thread (plus the final step)
+  double difference = std::abs((fast.mLastTime - slow.mLastTime) / cedar::unit::Time(1.0 * cedar::unit::seconds));
+  if (difference > 0.0041)
+  {
+    std::cout << "ERROR: the threads were not stepped in lockstep; their times differ by " << difference << " s."
+              << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
 int testConfiguration
     (
         cedar::unit::Time stepSize,
@@ -241,6 +344,8 @@ void runTests()
               cedar::aux::LoopMode::Fixed
             );
 
+  errors += testLockstep();
+
   std::cout << "Test finished, there were " << errors << " error(s)." << std::endl;
 }
 
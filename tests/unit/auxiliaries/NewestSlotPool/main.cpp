@@ -0,0 +1,238 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests the pool of slots shared by the lock-free exchanges.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/NewestSlotPool.h"
+
+// SYSTEM INCLUDES
+#include <QThread>
+#include <atomic>
+#include <vector>
+#include <iostream>
+
+//! A value that can only be told apart from a partially written one if all of its entries are equal.
+typedef std::vector<unsigned int> Value;
+
+//! Reads the newest value until it is told to stop and counts the ones that were partially written.
+class PoolReader : public QThread
+{
+public:
+  PoolReader(const cedar::aux::NewestSlotPool<Value>& pool)
+  :
+  mPool(pool),
+  mDone(false),
+  mTorn(0),
+  mOutOfOrder(0)
+  {
+  }
+
+  void run()
+  {
+    unsigned int last = 0;
+    while (!mDone)
+    {
+      this->mPool.readNewest
+      (
+        [this, &last](const Value& value)
+        {
+          for (auto entry : value)
+          {
+            if (entry != value.front())
+            {
+              ++this->mTorn;
+              break;
+            }
+          }
+          if (value.front() < last)
+          {
+            ++this->mOutOfOrder;
+          }
+          last = value.front();
+        }
+      );
+    }
+  }
+
+  const cedar::aux::NewestSlotPool<Value>& mPool;
+  std::atomic<bool> mDone;
+  std::atomic<unsigned int> mTorn;
+  std::atomic<unsigned int> mOutOfOrder;
+};
+
+int main()
+{
+  unsigned int errors = 0;
+
+  std::cout << "Checking the empty pool." << std::endl;
+  {
+    cedar::aux::NewestSlotPool<int> pool;
+    if (pool.getNewest() != -1 || pool.pinNewest() != -1)
+    {
+      ++errors;
+      std::cout << "ERROR: a new pool has a newest slot." << std::endl;
+    }
+    if (pool.readNewest([](const int&) {}))
+    {
+      ++errors;
+      std::cout << "ERROR: read a value from an empty pool." << std::endl;
+    }
+    if (pool.findFreeSlot() < 0)
+    {
+      ++errors;
+      std::cout << "ERROR: no free slot in an empty pool." << std::endl;
+    }
+  }
+
+  std::cout << "Checking that the newest and pinned slots are not free." << std::endl;
+  {
+    cedar::aux::NewestSlotPool<int> pool(3);
+    std::vector<int> pinned;
+    for (int i = 0; i < 3; ++i)
+    {
+      int slot = pool.findFreeSlot();
+      if (slot < 0)
+      {
+        ++errors;
+        std::cout << "ERROR: no free slot although " << i << " of three are pinned." << std::endl;
+        break;
+      }
+      pool.at(slot) = i;
+      pool.makeNewest(slot);
+      if (pool.isFree(slot))
+      {
+        ++errors;
+        std::cout << "ERROR: the newest slot is free." << std::endl;
+      }
+
+      int pinned_slot = pool.pinNewest();
+      if (pinned_slot != slot)
+      {
+        ++errors;
+        std::cout << "ERROR: pinned slot " << pinned_slot << " instead of the newest one, " << slot << "." << std::endl;
+      }
+      pinned.push_back(pinned_slot);
+    }
+
+    if (pool.findFreeSlot() != -1)
+    {
+      ++errors;
+      std::cout << "ERROR: found a free slot although all slots are pinned." << std::endl;
+    }
+
+    int value = -1;
+    pool.readNewest([&value](const int& newest) { value = newest; });
+    if (value != 2)
+    {
+      ++errors;
+      std::cout << "ERROR: read " << value << " instead of the newest value, 2." << std::endl;
+    }
+
+    pool.unpin(pinned.front());
+    if (pool.findFreeSlot() != pinned.front())
+    {
+      ++errors;
+      std::cout << "ERROR: an unpinned slot is not free." << std::endl;
+    }
+
+    pool.makeNewest(-1);
+    pool.unpin(pinned.back());
+    if (pool.getNewest() != -1 || !pool.isFree(pinned.back()))
+    {
+      ++errors;
+      std::cout << "ERROR: the pool still has a newest slot after it was cleared." << std::endl;
+    }
+  }
+
+  std::cout << "Checking that readNewest lets go of the slot if the function throws." << std::endl;
+  {
+    cedar::aux::NewestSlotPool<int> pool;
+    pool.makeNewest(0);
+    try
+    {
+      pool.readNewest([](const int&) { throw 1; });
+      ++errors;
+      std::cout << "ERROR: the exception was not passed on." << std::endl;
+    }
+    catch (int)
+    {
+    }
+    pool.makeNewest(1);
+    if (!pool.isFree(0))
+    {
+      ++errors;
+      std::cout << "ERROR: the slot is still pinned after the exception." << std::endl;
+    }
+  }
+
+  std::cout << "Checking that concurrent readers never see partially written values." << std::endl;
+  {
+    cedar::aux::NewestSlotPool<Value> pool(3);
+    std::vector<PoolReader*> readers;
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+      readers.push_back(new PoolReader(pool));
+      readers.back()->start();
+    }
+
+    for (unsigned int i = 1; i <= 20000; ++i)
+    {
+      int slot = pool.waitForFreeSlot();
+      pool.at(slot).assign(256, i);
+      pool.makeNewest(slot);
+    }
+
+    for (auto reader : readers)
+    {
+      reader->mDone = true;
+      reader->wait();
+      if (reader->mTorn > 0)
+      {
+        ++errors;
+        std::cout << "ERROR: " << reader->mTorn << " values were read while being written." << std::endl;
+      }
+      if (reader->mOutOfOrder > 0)
+      {
+        ++errors;
+        std::cout << "ERROR: " << reader->mOutOfOrder << " values were older than ones read before." << std::endl;
+      }
+      delete reader;
+    }
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
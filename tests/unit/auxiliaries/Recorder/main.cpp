@@ -36,6 +36,8 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/Recorder.h"
+#include "cedar/auxiliaries/BinaryRecording.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
@@ -108,6 +110,88 @@ void run_test()
     std::string path = cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory();
     boost::filesystem::remove_all(cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory()+"/UnitTest");
   }
+
+  // the size of the recording buffers
+  cedar::aux::RecorderSingleton::getInstance()->setBufferSize(16);
+  if (cedar::aux::RecorderSingleton::getInstance()->getBufferSize() != 16)
+  {
+    errors++;
+    std::cout << "The buffer size of the recorder was not set." << std::endl;
+  }
+
+  try
+  {
+    cedar::aux::RecorderSingleton::getInstance()->setBufferSize(0);
+    errors++;
+    std::cout << "Setting a buffer size of zero did not throw." << std::endl;
+  }
+  catch (const cedar::aux::RangeException&)
+  {
+    // expected
+  }
+
+  // record in the binary format and read the recording back
+  auto previous_mode = cedar::aux::RecorderSingleton::getInstance()->getSerializationMode();
+  cedar::aux::RecorderSingleton::getInstance()->setSerializationMode(cedar::aux::SerializationFormat::Binary);
+  cedar::aux::RecorderSingleton::getInstance()->registerData(dataPtr, timestep, "Mat1");
+  cedar::aux::RecorderSingleton::getInstance()->registerData(dataPtr2, timestep, "Mat2");
+  cedar::aux::RecorderSingleton::getInstance()->setRecordedProjectName("UnitTest");
+  cedar::aux::RecorderSingleton::getInstance()->start();
+  cedar::aux::sleep(cedar::unit::Time(2.0 * cedar::unit::seconds));
+  cedar::aux::RecorderSingleton::getInstance()->stop();
+  // with the recorder writing regularly, sixteen samples are plenty for a record interval of 200 ms
+  if (cedar::aux::RecorderSingleton::getInstance()->getDroppedFrameCount("Mat1") != 0)
+  {
+    errors++;
+    std::cout << "Samples were dropped during recording." << std::endl;
+  }
+  cedar::aux::RecorderSingleton::getInstance()->clear();
+  cedar::aux::RecorderSingleton::getInstance()->setSerializationMode(previous_mode);
+
+  std::string names[] = {"Mat1", "Mat2"};
+  cv::Mat expected[] = {mat1, mat2};
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    filename = cedar::aux::RecorderSingleton::getInstance()->getOutputDirectory() + "/" + names[i] + ".bin";
+    if (!fileExists(filename))
+    {
+      errors++;
+      std::cout << filename << " can not be found" << std::endl;
+      continue;
+    }
+
+    cedar::aux::BinaryRecording recording(filename);
+    if (recording.getFrameCount() == 0)
+    {
+      errors++;
+      std::cout << "The binary recording " << filename << " contains no frames." << std::endl;
+      continue;
+    }
+
+    if (recording.getMatrixType() != expected[i].type() || recording.getSizes().size() != 3)
+    {
+      errors++;
+      std::cout << "The binary recording " << filename << " has the wrong type or size." << std::endl;
+      continue;
+    }
+
+    for (size_t frame = 0; frame < recording.getFrameCount(); ++frame)
+    {
+      cv::Mat difference = recording.getFrame(frame) != expected[i];
+      if (cv::countNonZero(difference.reshape(1, 1)) != 0)
+      {
+        errors++;
+        std::cout << "Frame " << frame << " of " << filename << " differs from the recorded matrix." << std::endl;
+      }
+
+      if (frame > 0 && recording.getTimeStamp(frame) < recording.getTimeStamp(frame - 1))
+      {
+        errors++;
+        std::cout << "The time stamps of " << filename << " are not ordered." << std::endl;
+      }
+    }
+  }
+  boost::filesystem::remove_all(cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory()+"/UnitTest");
 }
 
 
@@ -0,0 +1,261 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Tests transporting matrices through shared memory channels.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/SharedMemoryChannel.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const std::string CHANNEL_NAME = "unit_test_shared_memory_channel";
+}
+
+cv::Mat make_matrix(int rows, int cols, float offset)
+{
+  cv::Mat matrix(rows, cols, CV_32F);
+  for (int row = 0; row < rows; ++row)
+  {
+    for (int col = 0; col < cols; ++col)
+    {
+      matrix.at<float>(row, col) = offset + static_cast<float>(row * cols + col);
+    }
+  }
+  return matrix;
+}
+
+bool matrices_equal(cv::Mat& first, cv::Mat& second)
+{
+  if (first.type() != second.type() || first.dims != second.dims)
+  {
+    return false;
+  }
+  for (int d = 0; d < first.dims; ++d)
+  {
+    if (first.size[d] != second.size[d])
+    {
+      return false;
+    }
+  }
+  for (int row = 0; row < first.size[0]; ++row)
+  {
+    for (int col = 0; col < first.size[1]; ++col)
+    {
+      if (first.at<float>(row, col) != second.at<float>(row, col))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//! Reads until a new matrix arrives; readers only look for new writers every now and then.
+bool read_within_a_second(cedar::aux::SharedMemoryChannel& reader, cv::Mat& target)
+{
+  for (int attempt = 0; attempt < 100; ++attempt)
+  {
+    if (reader.read(target))
+    {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+int test_size_change()
+{
+  int errors = 0;
+  std::cout << "Testing matrices whose size changes." << std::endl;
+
+  cedar::aux::SharedMemoryChannel writer(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+  cedar::aux::SharedMemoryChannel reader(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_READER);
+
+  cv::Mat target;
+  cv::Mat small = make_matrix(10, 10, 0.0f);
+  writer.write(small);
+  if (!reader.read(target) || !matrices_equal(target, small))
+  {
+    ++errors;
+    std::cout << "ERROR: The first matrix was not read correctly." << std::endl;
+  }
+
+  if (reader.read(target))
+  {
+    ++errors;
+    std::cout << "ERROR: The same matrix was read twice." << std::endl;
+  }
+
+  // the segment has to grow for this one
+  cv::Mat large = make_matrix(100, 80, 1.0f);
+  writer.write(large);
+  if (!reader.read(target) || !matrices_equal(target, large))
+  {
+    ++errors;
+    std::cout << "ERROR: The larger matrix was not read correctly." << std::endl;
+  }
+
+  cv::Mat smaller = make_matrix(3, 7, 2.0f);
+  writer.write(smaller);
+  if (!reader.read(target) || !matrices_equal(target, smaller))
+  {
+    ++errors;
+    std::cout << "ERROR: The smaller matrix was not read correctly." << std::endl;
+  }
+
+  return errors;
+}
+
+int test_buffer_reuse()
+{
+  int errors = 0;
+  std::cout << "Testing that reading matrices of the same size does not allocate memory." << std::endl;
+
+  cedar::aux::SharedMemoryChannel writer(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+  cedar::aux::SharedMemoryChannel reader(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_READER);
+
+  // the target and the buffer of the reader are swapped, so after two reads, the memory is reused
+  cv::Mat target;
+  std::vector<const uchar*> memory;
+  for (int i = 0; i < 4; ++i)
+  {
+    cv::Mat matrix = make_matrix(20, 30, static_cast<float>(i));
+    writer.write(matrix);
+    if (!reader.read(target) || !matrices_equal(target, matrix))
+    {
+      ++errors;
+      std::cout << "ERROR: Matrix " << i << " was not read correctly." << std::endl;
+    }
+    memory.push_back(target.data);
+  }
+
+  if (memory.at(2) != memory.at(0) || memory.at(3) != memory.at(1))
+  {
+    ++errors;
+    std::cout << "ERROR: Reading matrices of the same size allocated new memory." << std::endl;
+  }
+
+  return errors;
+}
+
+int test_writer_restart()
+{
+  int errors = 0;
+  std::cout << "Testing readers following restarted writers." << std::endl;
+
+  cedar::aux::SharedMemoryChannel reader(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_READER);
+  cv::Mat target;
+
+  {
+    cedar::aux::SharedMemoryChannel writer(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+    cv::Mat first = make_matrix(5, 5, 0.0f);
+    writer.write(first);
+    if (!reader.read(target) || !matrices_equal(target, first))
+    {
+      ++errors;
+      std::cout << "ERROR: The matrix of the first writer was not read correctly." << std::endl;
+    }
+  }
+
+  cedar::aux::SharedMemoryChannel restarted_writer(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+  cv::Mat second = make_matrix(6, 4, 10.0f);
+  restarted_writer.write(second);
+  if (!read_within_a_second(reader, target) || !matrices_equal(target, second))
+  {
+    ++errors;
+    std::cout << "ERROR: The reader did not follow the restarted writer." << std::endl;
+  }
+
+  {
+    // replaces the segment of the still existing writer
+    cedar::aux::SharedMemoryChannel replacing_writer(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+    cv::Mat third = make_matrix(2, 9, 20.0f);
+    replacing_writer.write(third);
+    if (!read_within_a_second(reader, target) || !matrices_equal(target, third))
+    {
+      ++errors;
+      std::cout << "ERROR: The reader did not follow the replacing writer." << std::endl;
+    }
+
+    // destroying the replaced writer must not remove the segment of the replacing one
+  }
+
+  return errors;
+}
+
+int test_replaced_writer_shutdown()
+{
+  int errors = 0;
+  std::cout << "Testing the shutdown of a replaced writer." << std::endl;
+
+  cedar::aux::SharedMemoryChannel* p_old_writer
+    = new cedar::aux::SharedMemoryChannel(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+  cedar::aux::SharedMemoryChannel new_writer(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_WRITER);
+  delete p_old_writer;
+
+  cv::Mat matrix = make_matrix(4, 4, 30.0f);
+  new_writer.write(matrix);
+
+  cedar::aux::SharedMemoryChannel reader(CHANNEL_NAME, cedar::aux::SharedMemoryChannel::ROLE_READER);
+  cv::Mat target;
+  if (!reader.read(target) || !matrices_equal(target, matrix))
+  {
+    ++errors;
+    std::cout << "ERROR: The replaced writer removed the segment of the new writer." << std::endl;
+  }
+
+  return errors;
+}
+
+int main()
+{
+  int errors = 0;
+
+  errors += test_size_change();
+  errors += test_buffer_reuse();
+  errors += test_writer_restart();
+  errors += test_replaced_writer_shutdown();
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
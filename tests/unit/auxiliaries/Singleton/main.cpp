@@ -38,6 +38,11 @@
 #include "cedar/auxiliaries/Singleton.h"
 
 // SYSTEM INCLUDES
+#ifdef CEDAR_USE_QT5
+  #include <QtConcurrent/QtConcurrentRun>
+#else
+  #include <QtConcurrentRun>
+#endif
 #include <string>
 #ifndef Q_MOC_RUN
   #include <boost/smart_ptr.hpp>
@@ -104,5 +109,56 @@ int main()
     }
   }
 
+  // isolated instances replace the shared one only within a thread scope
+  TestClassPtr isolated_instance = TestClassSingleton::createIsolatedInstance();
+  if (isolated_instance == TestClassSingleton::getInstance())
+  {
+    ++number_of_errors;
+    std::cout << "An isolated instance is the same as the shared instance.\n";
+  }
+  else if (isolated_instance->getName() != "default name")
+  {
+    ++number_of_errors;
+    std::cout << "An isolated instance did not start in the default state.\n";
+  }
+
+  {
+    TestClassSingleton::ThreadScope scope(isolated_instance);
+    if (TestClassSingleton::getInstance() != isolated_instance)
+    {
+      ++number_of_errors;
+      std::cout << "The singleton did not return the instance of the current thread scope.\n";
+    }
+
+    {
+      TestClassPtr nested_instance = TestClassSingleton::createIsolatedInstance();
+      TestClassSingleton::ThreadScope nested_scope(nested_instance);
+      if (TestClassSingleton::getInstance() != nested_instance)
+      {
+        ++number_of_errors;
+        std::cout << "The singleton did not return the instance of a nested thread scope.\n";
+      }
+    }
+
+    if (TestClassSingleton::getInstance() != isolated_instance)
+    {
+      ++number_of_errors;
+      std::cout << "Closing a nested thread scope did not reinstate the instance of the enclosing one.\n";
+    }
+
+    // other threads keep using the shared instance
+    if (QtConcurrent::run(&TestClassSingleton::getInstance).result() != first_test_instance)
+    {
+      ++number_of_errors;
+      std::cout << "A thread scope changed the instance returned in another thread.\n";
+    }
+  }
+
+  if (TestClassSingleton::getInstance() != first_test_instance)
+  {
+    ++number_of_errors;
+    std::cout << "Closing the thread scope did not reinstate the shared instance.\n";
+  }
+
   return number_of_errors;
 }
@@ -0,0 +1,142 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Implements all unit tests for the @em cedar::aux::Tracer class.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Tracer.h"
+#include "cedar/auxiliaries/ScopedTrace.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <sstream>
+#include <string>
+
+int main()
+{
+  unsigned int errors = 0;
+
+  auto tracer = cedar::aux::TracerSingleton::getInstance();
+  const std::string disabled_name = "disabled";
+  const std::string scope_name = "scope";
+
+  std::cout << "Checking that nothing is recorded while tracing is disabled." << std::endl;
+  tracer->setEnabled(false);
+  {
+    cedar::aux::ScopedTrace trace(disabled_name);
+  }
+  if (!tracer->getStatistics().empty())
+  {
+    ++errors;
+    std::cout << "ERROR: events were recorded while tracing was disabled." << std::endl;
+  }
+
+  std::cout << "Recording scoped events." << std::endl;
+  tracer->clear();
+  tracer->setEnabled(true);
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    CEDAR_TRACE_SCOPE(scope_name);
+    cedar::aux::ScopedTrace trace(scope_name, cedar::aux::Tracer::CATEGORY_COMPUTE);
+  }
+  tracer->setEnabled(false);
+
+  auto statistics = tracer->getStatistics();
+  if (statistics.size() != 2)
+  {
+    ++errors;
+    std::cout << "ERROR: expected statistics for two name/category pairs, got " << statistics.size() << std::endl;
+  }
+  for (const auto& entry : statistics)
+  {
+    if (entry.mName != scope_name)
+    {
+      ++errors;
+      std::cout << "ERROR: unexpected event name \"" << entry.mName << "\"." << std::endl;
+    }
+    if (entry.mCount != 10)
+    {
+      ++errors;
+      std::cout << "ERROR: expected 10 events, got " << entry.mCount << std::endl;
+    }
+    if (entry.mMean < 0.0 || entry.mP50 > entry.mMax || entry.mP99 > entry.mMax)
+    {
+      ++errors;
+      std::cout << "ERROR: inconsistent statistics for category "
+                << cedar::aux::Tracer::categoryToString(entry.mCategory) << std::endl;
+    }
+  }
+
+  std::cout << "Checking the chrome trace output." << std::endl;
+  std::stringstream trace;
+  tracer->writeChromeTrace(trace);
+  std::string json = trace.str();
+  if (json.find("\"traceEvents\"") == std::string::npos || json.find("\"scope\"") == std::string::npos)
+  {
+    ++errors;
+    std::cout << "ERROR: the chrome trace is missing expected entries:" << std::endl << json << std::endl;
+  }
+
+  std::cout << "Checking the buffer size." << std::endl;
+  tracer->setBufferSize(4);
+  tracer->clear();
+  tracer->setEnabled(true);
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    cedar::aux::ScopedTrace trace(scope_name);
+  }
+  tracer->setEnabled(false);
+  statistics = tracer->getStatistics();
+  if (statistics.size() != 1 || statistics.front().mCount != 4)
+  {
+    ++errors;
+    std::cout << "ERROR: the ring buffer did not keep exactly the last four events." << std::endl;
+  }
+
+  try
+  {
+    tracer->setBufferSize(0);
+    ++errors;
+    std::cout << "ERROR: a buffer size of zero was accepted." << std::endl;
+  }
+  catch (const cedar::aux::RangeException&)
+  {
+    // expected
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -39,6 +39,7 @@
 #include "cedar/auxiliaries/convolution/Engine.h"
 #include "cedar/auxiliaries/convolution/OpenCV.h"
 #include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/convolution/AutoTuning.h"
 #include "cedar/auxiliaries/kernel/Kernel.h"
 #include "cedar/auxiliaries/kernel/Separable.h"
 #include "cedar/auxiliaries/math/tools.h"
@@ -1245,5 +1246,9 @@ int main()
   errors += testEngine(fftw);
 #endif // CEDAR_USE_FFTW
 
+  // tunes every case of the tests above, so it has to produce the same results as the engines it chooses from
+  cedar::aux::conv::AutoTuningPtr auto_tuning (new cedar::aux::conv::AutoTuning());
+  errors += testEngine(auto_tuning);
+
   return errors;
 }
@@ -41,6 +41,8 @@
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/convolution/Convolution.h"
 #include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/convolution/KernelList.h"
+#include "cedar/auxiliaries/kernel/Gauss.h"
 #include "cedar/auxiliaries/LoopedThread.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
@@ -110,6 +112,35 @@ void multi_thread_test()
 // global variable
 unsigned int errors;
 
+//! Cyclic convolution of a 2D matrix by summing up the shifted matrix; kernels must be symmetric and of odd size.
+cv::Mat convolve_directly(const cv::Mat& matrix, const cv::Mat& kernel)
+{
+  cv::Mat matrix_64, kernel_64;
+  matrix.convertTo(matrix_64, CV_64F);
+  kernel.convertTo(kernel_64, CV_64F);
+  cv::Mat result = cv::Mat::zeros(matrix.rows, matrix.cols, CV_64F);
+  int center_row = kernel_64.rows / 2;
+  int center_col = kernel_64.cols / 2;
+  for (int row = 0; row < result.rows; ++row)
+  {
+    for (int col = 0; col < result.cols; ++col)
+    {
+      double sum = 0.0;
+      for (int k_row = 0; k_row < kernel_64.rows; ++k_row)
+      {
+        for (int k_col = 0; k_col < kernel_64.cols; ++k_col)
+        {
+          int source_row = (row + k_row - center_row + matrix_64.rows) % matrix_64.rows;
+          int source_col = (col + k_col - center_col + matrix_64.cols) % matrix_64.cols;
+          sum += kernel_64.at<double>(k_row, k_col) * matrix_64.at<double>(source_row, source_col);
+        }
+      }
+      result.at<double>(row, col) = sum;
+    }
+  }
+  return result;
+}
+
 void run_test()
 {
   // the number of errors encountered in this test
@@ -239,6 +270,102 @@ void run_test()
   kernel_pad = cv::Mat(3, sizes_kernel, CV_32F);
   padded = fftw->padTheKernel(matrix_pad, kernel_pad);
 
+  std::cout << "test no " << test_number++ << ": single and double precision give the same result" << std::endl;
+  {
+    cv::Mat matrix_64(40, 30, CV_64F);
+    cv::randu(matrix_64, cv::Scalar(0.0), cv::Scalar(1.0));
+    cv::Mat kernel_64 = cv::Mat::ones(7, 5, CV_64F);
+    cv::Mat matrix_32, kernel_32;
+    matrix_64.convertTo(matrix_32, CV_32F);
+    kernel_64.convertTo(kernel_32, CV_32F);
+
+    cv::Mat result_64 = fftw->convolve(matrix_64, kernel_64, cedar::aux::conv::BorderType::Cyclic);
+    cv::Mat result_32 = fftw->convolve(matrix_32, kernel_32, cedar::aux::conv::BorderType::Cyclic);
+    if (result_32.type() != CV_32F)
+    {
+      errors++;
+      std::cout << "float convolution did not return a float matrix" << std::endl;
+    }
+    cv::Mat result_32_as_64;
+    result_32.convertTo(result_32_as_64, CV_64F);
+    double difference = cv::norm(result_64 - result_32_as_64, cv::NORM_INF);
+    if (difference > 1e-4)
+    {
+      errors++;
+      std::cout << "float and double convolution differ by " << difference << std::endl;
+    }
+  }
+
+  std::cout << "test no " << test_number++ << ": convolveInto reuses the output memory" << std::endl;
+  {
+    cedar::aux::conv::Convolution convolution;
+    convolution.setBorderType(cedar::aux::conv::BorderType::Cyclic);
+    convolution.setEngine(FFTWPtr(new FFTW()));
+    convolution.getKernelList()->append
+    (
+      cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(2, 1.0, 3.0, 0.0, 5.0))
+    );
+
+    cv::Mat input = cv::Mat::zeros(50, 50, CV_32F);
+    input.at<float>(25, 25) = 1.0f;
+    cv::Mat output;
+    convolution.convolveInto(input, output);
+    uchar* first_data = output.data;
+    convolution.convolveInto(input, output);
+    if (output.data != first_data)
+    {
+      errors++;
+      std::cout << "convolveInto reallocated a matching output" << std::endl;
+    }
+    cv::Mat reference = convolution.convolve(input);
+    if (cv::norm(reference - output, cv::NORM_INF) > 1e-6)
+    {
+      errors++;
+      std::cout << "convolveInto and convolve give different results" << std::endl;
+    }
+  }
+
+  std::cout << "test no " << test_number++ << ": kernel lists and explicit kernels can be used alternately" << std::endl;
+  {
+    cedar::aux::conv::KernelListPtr kernel_list(new cedar::aux::conv::KernelList());
+    kernel_list->append(cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(2, 1.0, 2.0, 0.0, 3.0)));
+    cv::Mat explicit_kernel = cv::Mat::ones(5, 5, CV_64F) / 25.0;
+
+    cv::Mat input_64(30, 30, CV_64F);
+    cv::randu(input_64, cv::Scalar(0.0), cv::Scalar(1.0));
+    cv::Mat expected_list = convolve_directly(input_64, kernel_list->getCombinedKernel());
+    cv::Mat expected_explicit = convolve_directly(input_64, explicit_kernel);
+
+    // both precisions cache their own spectrum
+    int types[2] = {CV_64F, CV_32F};
+    for (int type : types)
+    {
+      FFTWPtr engine(new FFTW());
+      cv::Mat input, kernel;
+      input_64.convertTo(input, type);
+      explicit_kernel.convertTo(kernel, type);
+      for (int round = 0; round < 3; ++round)
+      {
+        cv::Mat list_result, explicit_result;
+        engine->convolve(input, kernel_list, cedar::aux::conv::BorderType::Cyclic).convertTo(list_result, CV_64F);
+        engine->convolve(input, kernel, cedar::aux::conv::BorderType::Cyclic).convertTo(explicit_result, CV_64F);
+
+        if (cv::norm(list_result - expected_list, cv::NORM_INF) > 1e-4)
+        {
+          errors++;
+          std::cout << "convolution with the kernel list is wrong in round " << round << " for type " << type
+                    << std::endl;
+        }
+        if (cv::norm(explicit_result - expected_explicit, cv::NORM_INF) > 1e-4)
+        {
+          errors++;
+          std::cout << "convolution with the explicit kernel is wrong in round " << round << " for type " << type
+                    << std::endl;
+        }
+      }
+    }
+  }
+
   multi_thread_test();
 
   std::cout << "test finished, there were " << errors << " errors" << std::endl;
@@ -246,6 +373,7 @@ void run_test()
   {
     errors = 255;
   }
+  ::errors = errors;
 }
 
 int main(int argc, char* argv[])
@@ -0,0 +1,211 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests summing matrices with accumulate.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/math/accumulate.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! Sums the terms with OpenCV; 1D terms are reshaped to the shape of sum.
+cv::Mat reference_sum
+        (
+          const cv::Mat& sum,
+          const std::vector<cv::Mat>& terms,
+          const std::vector<double>& weights,
+          double offset
+        )
+{
+  cv::Mat reference(sum.dims, sum.size, sum.type(), cv::Scalar::all(offset));
+  for (size_t t = 0; t < terms.size(); ++t)
+  {
+    cv::Mat term = terms[t];
+    if (sum.dims <= 2 && term.rows != sum.rows)
+    {
+      term = term.reshape(0, sum.rows);
+    }
+    cv::scaleAdd(term, weights.empty() ? 1.0 : weights[t], reference, reference);
+  }
+  return reference;
+}
+
+int check_sum
+    (
+      const std::string& name,
+      cv::Mat sum,
+      const std::vector<cv::Mat>& terms,
+      const std::vector<double>& weights,
+      double offset
+    )
+{
+  std::vector<const cv::Mat*> pointers;
+  for (const auto& term : terms)
+  {
+    pointers.push_back(&term);
+  }
+
+  const unsigned char* data = sum.data;
+  if (weights.empty())
+  {
+    cedar::aux::math::accumulate(sum, pointers, offset);
+  }
+  else
+  {
+    cedar::aux::math::accumulate(sum, pointers, weights, offset);
+  }
+
+  if (sum.data != data)
+  {
+    std::cout << "ERROR in " << name << ": the sum was reallocated." << std::endl;
+    return 1;
+  }
+
+  cv::Mat reference = reference_sum(sum, terms, weights, offset);
+  double difference = cv::norm(sum, reference, cv::NORM_INF);
+  if (difference > 1e-5)
+  {
+    std::cout << "ERROR in " << name << ": the sum differs from the reference by " << difference << "." << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int test_type(int type, const std::string& typeName)
+{
+  int errors = 0;
+  std::cout << "Testing matrices of type " << typeName << "." << std::endl;
+
+  // more elements than one block, and not a multiple of the block size
+  int sizes[] = {13, 17, 11};
+  std::vector<cv::Mat> terms;
+  for (int t = 0; t < 4; ++t)
+  {
+    cv::Mat term(3, sizes, type);
+    cv::randu(term, cv::Scalar(-1.0), cv::Scalar(1.0));
+    terms.push_back(term);
+  }
+  cv::Mat sum(3, sizes, type);
+
+  errors += check_sum("plain sum (" + typeName + ")", sum, terms, {}, 0.0);
+  errors += check_sum("sum with offset (" + typeName + ")", sum, terms, {}, 2.5);
+  errors += check_sum("weighted sum (" + typeName + ")", sum, terms, {0.5, -1.0, 2.0, 0.0}, -1.5);
+  errors += check_sum("offset only (" + typeName + ")", sum, {}, {}, 3.0);
+  errors += check_sum("single term (" + typeName + ")", sum, {terms[0]}, {}, 1.0);
+
+  // 1D terms may be transposed with respect to the sum
+  cv::Mat column(50, 1, type);
+  cv::Mat row(1, 50, type);
+  cv::randu(column, cv::Scalar(-1.0), cv::Scalar(1.0));
+  cv::randu(row, cv::Scalar(-1.0), cv::Scalar(1.0));
+  cv::Mat sum_1d(50, 1, type);
+  errors += check_sum("transposed 1D terms (" + typeName + ")", sum_1d, {column, row, row}, {}, 0.5);
+  errors += check_sum("weighted transposed 1D terms (" + typeName + ")", sum_1d, {row, column}, {2.0, -0.5}, 0.0);
+
+  // not continuous, so the generic path is taken
+  cv::Mat large(30, 30, type);
+  cv::randu(large, cv::Scalar(-1.0), cv::Scalar(1.0));
+  cv::Mat region = large(cv::Rect(3, 4, 10, 12));
+  cv::Mat other(12, 10, type);
+  cv::randu(other, cv::Scalar(-1.0), cv::Scalar(1.0));
+  cv::Mat sum_2d(12, 10, type);
+  errors += check_sum("non-continuous terms (" + typeName + ")", sum_2d, {region, other}, {}, 1.0);
+  errors += check_sum("weighted non-continuous terms (" + typeName + ")", sum_2d, {other, region}, {-2.0, 3.0}, 0.0);
+
+  return errors;
+}
+
+int test_invalid_terms()
+{
+  int errors = 0;
+  std::cout << "Testing invalid terms." << std::endl;
+
+  cv::Mat sum(5, 5, CV_32F);
+  cv::Mat wrong_type = cv::Mat::zeros(5, 5, CV_64F);
+  cv::Mat wrong_size = cv::Mat::zeros(4, 5, CV_32F);
+  cv::Mat wrong_shape = cv::Mat::zeros(25, 1, CV_32F);
+
+  std::vector<std::pair<std::string, std::vector<const cv::Mat*>>> cases =
+  {
+    {"a term of a different type", {&wrong_type}},
+    {"a term of a different size", {&wrong_size}},
+    {"a term with as many elements, but a different shape", {&wrong_shape}}
+  };
+  for (const auto& case_pair : cases)
+  {
+    try
+    {
+      cedar::aux::math::accumulate(sum, case_pair.second);
+      std::cout << "ERROR: accumulating " << case_pair.first << " did not throw." << std::endl;
+      ++errors;
+    }
+    catch (const cedar::aux::MatrixMismatchException&)
+    {
+      // expected
+    }
+  }
+
+  try
+  {
+    cedar::aux::math::accumulate(sum, {&sum});
+    std::cout << "ERROR: accumulating the sum into itself did not throw." << std::endl;
+    ++errors;
+  }
+  catch (const cedar::aux::InvalidValueException&)
+  {
+    // expected
+  }
+
+  return errors;
+}
+
+int main()
+{
+  int errors = 0;
+
+  errors += test_type(CV_32F, "CV_32F");
+  errors += test_type(CV_64F, "CV_64F");
+  // not summed block by block
+  errors += test_type(CV_32S, "CV_32S");
+  errors += test_invalid_terms();
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
@@ -803,6 +803,34 @@ int main()
     std::cout << "ERROR in function twistCoordinates<float>(const cv::Mat& supportPoint, const cv::Mat& axis)" << std::endl;
   }
 
+  std::cout << "test: fixed-size variants" << std::endl;
+  cv::Vec<float, 6> xi_fixed
+    = cedar::aux::math::twistCoordinates(cv::Vec<float, 3>(0, 0, 1), cv::Vec<float, 3>(1, 0, 0));
+  cv::Mat xi_mat = cedar::aux::math::twistCoordinates<float>(p_float, omega_float);
+  cv::Matx<float, 4, 4> g_fixed = cedar::aux::math::expTwist(xi_fixed, 0.7);
+  cv::Mat g_mat = cedar::aux::math::expTwist<float>(xi_mat, 0.7);
+  if (cv::norm(cv::Mat(xi_fixed), xi_mat) > 1e-6 || cv::norm(cv::Mat(g_fixed), g_mat) > 1e-6)
+  {
+    errors++;
+    std::cout << "ERROR in function expTwist(const cv::Vec<T, 6>& xi, double theta)" << std::endl;
+  }
+  cv::Mat adjoint_mat = cedar::aux::math::rigidToAdjointTransformation<float>(g_mat);
+  if
+  (
+    cv::norm(cv::Mat(cedar::aux::math::rigidToAdjointTransformation(g_fixed)), adjoint_mat) > 1e-6
+    || cv::norm(cv::Mat(cedar::aux::math::adjointTransformTwist(g_fixed, xi_fixed)), adjoint_mat * xi_mat) > 1e-6
+  )
+  {
+    errors++;
+    std::cout << "ERROR in function rigidToAdjointTransformation(const cv::Matx<T, 4, 4>& g)" << std::endl;
+  }
+  cv::Matx<float, 4, 4> g_inverse = cedar::aux::math::invertRigidTransformation(g_fixed);
+  if (cv::norm(cv::Mat(g_inverse * g_fixed), cv::Mat::eye(4, 4, CV_32F)) > 1e-6)
+  {
+    errors++;
+    std::cout << "ERROR in function invertRigidTransformation(const cv::Matx<T, 4, 4>& g)" << std::endl;
+  }
+
   std::cout << "test finished, there were " << errors << " errors" << std::endl;
   std::cout << std::endl;
   if (errors > 255)
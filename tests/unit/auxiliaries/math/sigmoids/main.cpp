@@ -40,11 +40,61 @@
 #include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
 #include "cedar/auxiliaries/math/transferFunctions/ExpSigmoid.h"
 #include "cedar/auxiliaries/math/transferFunctions/HeavisideSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/LinearTransferFunction.h"
+#include "cedar/auxiliaries/math/transferFunctions/Logarithm.h"
+#include "cedar/auxiliaries/math/transferFunctions/SemiLinearTransferFunction.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/math/TransferFunctionDeclaration.h"
 #include "cedar/auxiliaries/utilities.h"
 
 // SYSTEM INCLUDES
+#include <string>
+#include <vector>
+
+template<typename T>
+int test_matrix_overloads(const std::string& name, cedar::aux::math::TransferFunctionPtr function, int type)
+{
+  int errors = 0;
+
+  int sizes[] = {7, 5, 3};
+  for (int dims = 2; dims <= 3; ++dims)
+  {
+    cv::Mat values(dims, sizes, type);
+    // positive values so that the logarithm is defined, spread around the thresholds used below
+    cv::randu(values, 0.01, 2.0);
+
+    // the matrix overloads must give the same result as computing each element separately
+    cv::Mat reference = function->compute<T>(values);
+    cv::Mat result = function->compute(values);
+
+    cv::Mat in_place(dims, sizes, type);
+    const void* in_place_data = in_place.data;
+    function->compute(values, in_place);
+
+    if (result.type() != type || in_place.type() != type)
+    {
+      std::cout << "ERROR: " << name << " changed the matrix type." << std::endl;
+      ++errors;
+      continue;
+    }
+
+    double difference = cv::norm(reference - result, cv::NORM_INF);
+    double in_place_difference = cv::norm(reference - in_place, cv::NORM_INF);
+    if (difference > 1e-5 || in_place_difference > 1e-5)
+    {
+      std::cout << "ERROR: matrix overloads of " << name << " differ from the per-element result by "
+                << difference << " and " << in_place_difference << " (" << dims << "D)." << std::endl;
+      ++errors;
+    }
+
+    if (in_place.data != in_place_data)
+    {
+      std::cout << "ERROR: " << name << " reallocated a matching output matrix." << std::endl;
+      ++errors;
+    }
+  }
+  return errors;
+}
 
 int main()
 {
@@ -120,6 +170,51 @@ int main()
   cedar::aux::write(sigmoid_my_values);
   cedar::aux::write(sigmoid_my_values_double);
 
+  // test the matrix overloads against the per-element computation
+  std::cout << "test no " << test_number++ << std::endl;
+  std::vector<std::pair<std::string, cedar::aux::math::TransferFunctionPtr> > functions;
+  functions.push_back
+  (
+    std::make_pair("AbsSigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::AbsSigmoid(1.0, 10.0)))
+  );
+  functions.push_back
+  (
+    std::make_pair("ExpSigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::ExpSigmoid(1.0, 10.0)))
+  );
+  functions.push_back
+  (
+    std::make_pair
+    (
+      "HeavisideSigmoid",
+      cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::HeavisideSigmoid(1.0))
+    )
+  );
+  functions.push_back
+  (
+    std::make_pair
+    (
+      "SemiLinearTransferFunction",
+      cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::SemiLinearTransferFunction(1.0, 2.0))
+    )
+  );
+  functions.push_back
+  (
+    std::make_pair
+    (
+      "LinearTransferFunction",
+      cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::LinearTransferFunction())
+    )
+  );
+  functions.push_back
+  (
+    std::make_pair("Logarithm", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::Logarithm()))
+  );
+  for (const auto& function : functions)
+  {
+    errors += test_matrix_overloads<float>(function.first, function.second, CV_32F);
+    errors += test_matrix_overloads<double>(function.first, function.second, CV_64F);
+  }
+
   std::cout << "test finished, there were " << errors << " errors" << std::endl;
   if (errors > 255)
   {
@@ -0,0 +1,212 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests publishing and reading samples concurrently.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/devices/SampleExchange.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/core/core.hpp>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const int SAMPLE_SIZE = 64;
+  const unsigned int WRITERS = 2;
+  const unsigned int READERS = 4;
+  const unsigned int SAMPLES_PER_WRITER = 20000;
+}
+
+//! Checks that all elements of the sample were written by the same publish call.
+std::string check_sample(const cedar::dev::SampleExchange::Sample& sample)
+{
+  if (sample.mData.rows != SAMPLE_SIZE || sample.mData.cols != 1 || sample.mData.type() != CV_32F)
+  {
+    return "a sample has the wrong size or type";
+  }
+  float first = sample.mData.at<float>(0, 0);
+  for (int i = 1; i < SAMPLE_SIZE; ++i)
+  {
+    if (sample.mData.at<float>(i, 0) != first)
+    {
+      return "a sample was overwritten while it was read";
+    }
+  }
+  return "";
+}
+
+int test_concurrent_publish_and_read()
+{
+  int errors = 0;
+  std::cout << "Testing concurrent publishing and reading." << std::endl;
+
+  cedar::dev::SampleExchange exchange;
+  exchange.reset(cv::Mat::zeros(SAMPLE_SIZE, 1, CV_32F));
+
+  std::atomic<unsigned int> writers_running(WRITERS);
+  std::vector<std::string> reader_errors(READERS);
+  std::vector<unsigned long long> reads(READERS, 0);
+
+  std::vector<std::thread> threads;
+  for (unsigned int writer = 0; writer < WRITERS; ++writer)
+  {
+    threads.push_back
+    (
+      std::thread
+      (
+        [&exchange, &writers_running, writer]()
+        {
+          cv::Mat data(SAMPLE_SIZE, 1, CV_32F);
+          for (unsigned int i = 0; i < SAMPLES_PER_WRITER; ++i)
+          {
+            // every sample is filled with a value that no other sample has
+            data.setTo(cv::Scalar(static_cast<float>(writer * SAMPLES_PER_WRITER + i + 1)));
+            exchange.publish(data);
+          }
+          --writers_running;
+        }
+      )
+    );
+  }
+
+  for (unsigned int reader = 0; reader < READERS; ++reader)
+  {
+    threads.push_back
+    (
+      std::thread
+      (
+        [&exchange, &writers_running, &reader_errors, &reads, reader]()
+        {
+          cedar::dev::SampleExchange::Sample sample;
+          unsigned long long last_sequence_number = 0;
+          int64_t last_time_stamp = 0;
+          while (writers_running.load() > 0 && reader_errors.at(reader).empty())
+          {
+            exchange.read(sample);
+            ++reads.at(reader);
+
+            std::string error = check_sample(sample);
+            if (error.empty() && sample.mSequenceNumber < last_sequence_number)
+            {
+              error = "the sequence numbers of the samples read went backwards";
+            }
+            if (error.empty() && sample.mTimeStamp < last_time_stamp)
+            {
+              error = "the time stamps of the samples read went backwards";
+            }
+            reader_errors.at(reader) = error;
+            last_sequence_number = sample.mSequenceNumber;
+            last_time_stamp = sample.mTimeStamp;
+          }
+        }
+      )
+    );
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (unsigned int reader = 0; reader < READERS; ++reader)
+  {
+    if (!reader_errors.at(reader).empty())
+    {
+      std::cout << "ERROR: reader " << reader << ": " << reader_errors.at(reader) << "." << std::endl;
+      ++errors;
+    }
+    std::cout << "Reader " << reader << " read " << reads.at(reader) << " samples." << std::endl;
+  }
+
+  if (exchange.getSequenceNumber() != WRITERS * SAMPLES_PER_WRITER)
+  {
+    std::cout << "ERROR: the newest sample has sequence number " << exchange.getSequenceNumber() << " instead of "
+              << WRITERS * SAMPLES_PER_WRITER << "." << std::endl;
+    ++errors;
+  }
+
+  auto newest = exchange.read();
+  if (!check_sample(newest).empty())
+  {
+    std::cout << "ERROR: the newest sample is inconsistent." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int test_publish_element()
+{
+  int errors = 0;
+  std::cout << "Testing publishing single elements." << std::endl;
+
+  cedar::dev::SampleExchange exchange;
+  exchange.reset(cv::Mat::zeros(4, 1, CV_32F));
+  if (exchange.getSequenceNumber() != 0)
+  {
+    std::cout << "ERROR: the initial value does not have sequence number zero." << std::endl;
+    ++errors;
+  }
+
+  exchange.publishElement(2, 5.0f);
+  exchange.publishElement(0, 1.0f);
+  if (exchange.readElement(0) != 1.0f || exchange.readElement(1) != 0.0f || exchange.readElement(2) != 5.0f)
+  {
+    std::cout << "ERROR: publishing elements did not keep the other elements." << std::endl;
+    ++errors;
+  }
+  if (exchange.getSequenceNumber() != 2)
+  {
+    std::cout << "ERROR: the sequence number is " << exchange.getSequenceNumber() << " instead of 2." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int main()
+{
+  int errors = 0;
+
+  errors += test_publish_element();
+  errors += test_concurrent_publish_and_read();
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
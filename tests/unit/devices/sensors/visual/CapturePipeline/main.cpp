@@ -0,0 +1,288 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Unit test for the capture pipeline of the grabbers (frame pool, concurrent capture, recording)
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/devices/sensors/visual/FramePool.h"
+#include "cedar/devices/sensors/visual/PictureGrabber.h"
+#include "cedar/devices/sensors/visual/VideoGrabber.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#ifndef Q_MOC_RUN
+  #include <boost/filesystem.hpp>
+#endif
+#include <iostream>
+#include <vector>
+#include <string>
+
+bool isFilledWith(const cv::Mat& frame, unsigned char value)
+{
+  return !frame.empty() && cv::countNonZero(frame != value) == 0;
+}
+
+int testFramePool()
+{
+  std::cout << "Testing the frame pool." << std::endl;
+  int errors = 0;
+
+  cedar::dev::sensors::visual::FramePool pool(4);
+  if (!pool.getNewest().empty())
+  {
+    std::cout << "ERROR: the pool returned a frame before anything was published." << std::endl;
+    ++errors;
+  }
+
+  cv::Mat frame(8, 8, CV_8U);
+  frame = cv::Scalar(1);
+  pool.publish(frame);
+
+  // frames that are held by a consumer must not be overwritten by later frames
+  cv::Mat held = pool.getNewest();
+  for (unsigned char value = 2; value < 10; ++value)
+  {
+    frame = cv::Scalar(value);
+    pool.publish(frame);
+  }
+
+  if (!isFilledWith(held, 1))
+  {
+    std::cout << "ERROR: a held frame was overwritten." << std::endl;
+    ++errors;
+  }
+
+  unsigned long long frame_number = 0;
+  cv::Mat newest = pool.getNewest(&frame_number);
+  if (!isFilledWith(newest, 9) || frame_number != 9 || pool.getPublishedCount() != 9)
+  {
+    std::cout << "ERROR: the newest frame is wrong; its number is " << frame_number << "." << std::endl;
+    ++errors;
+  }
+
+  if (pool.getDetachedCount() != 0)
+  {
+    std::cout << "ERROR: the pool allocated new memory although there were free buffers." << std::endl;
+    ++errors;
+  }
+
+  // hold on to more frames than there are buffers
+  std::vector<cv::Mat> held_frames;
+  for (unsigned char value = 10; value < 16; ++value)
+  {
+    frame = cv::Scalar(value);
+    pool.publish(frame);
+    held_frames.push_back(pool.getNewest());
+  }
+
+  for (unsigned int i = 0; i < held_frames.size(); ++i)
+  {
+    if (!isFilledWith(held_frames.at(i), static_cast<unsigned char>(10 + i)))
+    {
+      std::cout << "ERROR: held frame " << i << " was overwritten." << std::endl;
+      ++errors;
+    }
+  }
+
+  if (pool.getDetachedCount() == 0)
+  {
+    std::cout << "ERROR: the pool should have detached buffers that were all held." << std::endl;
+    ++errors;
+  }
+
+  pool.clear();
+  if (!pool.getNewest().empty())
+  {
+    std::cout << "ERROR: the pool returned a frame after it was cleared." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int testPictureGrabber(const std::string& fileName0, const std::string& fileName1)
+{
+  std::cout << "Testing concurrent grabbing with a stereo picture grabber." << std::endl;
+  int errors = 0;
+
+  cedar::dev::sensors::visual::PictureGrabber grabber(fileName0, fileName1);
+  if (!grabber.applyParameter())
+  {
+    std::cout << "ERROR: could not create the picture grabber." << std::endl;
+    return 1;
+  }
+
+  cv::Mat first0 = grabber.getImage(0);
+  cv::Mat first1 = grabber.getImage(1);
+  unsigned long long first_number = grabber.getFrameNumber(0);
+  if (first_number == 0 || grabber.getFrameNumber(1) != first_number)
+  {
+    std::cout << "ERROR: the frames read on creation were not published." << std::endl;
+    ++errors;
+  }
+
+  const unsigned int number_of_grabs = 5;
+  for (unsigned int i = 0; i < number_of_grabs; ++i)
+  {
+    grabber.grab();
+  }
+
+  for (unsigned int channel = 0; channel < 2; ++channel)
+  {
+    cv::Mat expected = cv::imread(channel == 0 ? fileName0 : fileName1);
+    cv::Mat image = grabber.getImage(channel);
+    if (image.size() != expected.size() || cv::norm(image, expected) != 0.0)
+    {
+      std::cout << "ERROR: the image of channel " << channel << " does not match its file." << std::endl;
+      ++errors;
+    }
+
+    if (grabber.getFrameNumber(channel) != first_number + number_of_grabs)
+    {
+      std::cout << "ERROR: channel " << channel << " is at frame " << grabber.getFrameNumber(channel)
+                << ", expected " << (first_number + number_of_grabs) << "." << std::endl;
+      ++errors;
+    }
+  }
+
+  if (first0.data == grabber.getImage(0).data || first1.data == grabber.getImage(1).data)
+  {
+    std::cout << "ERROR: a held frame is reused for a later one." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int testRecording(const std::string& fileName0, const std::string& fileName1)
+{
+  std::cout << "Testing recording a stereo picture grabber and playing the recording back." << std::endl;
+  int errors = 0;
+
+  std::string record_name0, record_name1;
+  unsigned long long recorded = 0;
+  const unsigned int number_of_grabs = 20;
+  {
+    cedar::dev::sensors::visual::PictureGrabber grabber(fileName0, fileName1);
+    if (!grabber.applyParameter())
+    {
+      std::cout << "ERROR: could not create the picture grabber." << std::endl;
+      return 1;
+    }
+
+    grabber.setRecordName("capture_pipeline.avi");
+    record_name0 = grabber.getRecordName(0);
+    record_name1 = grabber.getRecordName(1);
+    grabber.startRecording(25.0, cedar::dev::sensors::visual::RecordingFormat::RECORD_MJPG, true, false);
+    for (unsigned int i = 0; i < number_of_grabs; ++i)
+    {
+      grabber.grab();
+    }
+    grabber.stopRecording();
+
+    recorded = grabber.getRecordedFrameCount();
+    unsigned long long dropped = grabber.getDroppedRecordingFrameCount();
+    std::cout << "Recorded " << recorded << " frames, dropped " << dropped << "." << std::endl;
+    if (recorded + dropped != number_of_grabs || recorded == 0)
+    {
+      std::cout << "ERROR: recorded and dropped frames do not add up to the grabbed ones." << std::endl;
+      ++errors;
+    }
+  }
+
+  {
+    cedar::dev::sensors::visual::VideoGrabber grabber(record_name0, record_name1, false);
+    if (!grabber.applyParameter())
+    {
+      std::cout << "ERROR: could not open the recordings." << std::endl;
+      ++errors;
+    }
+    else
+    {
+      if (grabber.getFrameCount() != recorded)
+      {
+        std::cout << "ERROR: the recordings have " << grabber.getFrameCount() << " frames, expected " << recorded
+                  << "." << std::endl;
+        ++errors;
+      }
+
+      unsigned long long first_number = grabber.getFrameNumber(0);
+      grabber.grab();
+      grabber.grab();
+      for (unsigned int channel = 0; channel < 2; ++channel)
+      {
+        cv::Mat expected = cv::imread(channel == 0 ? fileName0 : fileName1);
+        if (grabber.getImage(channel).size() != expected.size())
+        {
+          std::cout << "ERROR: the recording of channel " << channel << " has the wrong size." << std::endl;
+          ++errors;
+        }
+        if (grabber.getFrameNumber(channel) != first_number + 2)
+        {
+          std::cout << "ERROR: the video grabber is at frame " << grabber.getFrameNumber(channel)
+                    << " on channel " << channel << ", expected " << (first_number + 2) << "." << std::endl;
+          ++errors;
+        }
+      }
+    }
+  }
+
+  boost::filesystem::remove(record_name0);
+  boost::filesystem::remove(record_name1);
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  const std::string file_name0 = "capture_pipeline_0.png";
+  const std::string file_name1 = "capture_pipeline_1.png";
+  cv::imwrite(file_name0, cv::Mat(24, 32, CV_8UC3, cv::Scalar(0, 0, 255)));
+  cv::imwrite(file_name1, cv::Mat(30, 40, CV_8UC3, cv::Scalar(0, 255, 0)));
+
+  errors += testFramePool();
+  errors += testPictureGrabber(file_name0, file_name1);
+  errors += testRecording(file_name0, file_name1);
+
+  boost::filesystem::remove(file_name0);
+  boost::filesystem::remove(file_name1);
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
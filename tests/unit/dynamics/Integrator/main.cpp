@@ -0,0 +1,190 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Tests the integration methods of cedar::dyn::Integrator.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Integrator.h"
+#include "cedar/dynamics/IntegrationMethod.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <cmath>
+#include <boost/bind.hpp>
+
+// solutions must match to this precision
+const double PRECISION = 1e-4;
+
+void constant_forcing(double value, const cv::Mat&, cv::Mat& forcing)
+{
+  forcing.setTo(cv::Scalar(value));
+}
+
+void no_forcing(const cv::Mat&, cv::Mat& forcing)
+{
+  forcing.setTo(cv::Scalar(0.0));
+}
+
+// error of one step of du/dt = -u, whose solution is u(t) = u(0) * exp(-t)
+double decay_error(cedar::dyn::IntegrationMethod::Id method, double time)
+{
+  cedar::dyn::Integrator integrator(method);
+  cv::Mat state(3, 1, CV_64F, cv::Scalar(1.0));
+  cv::Mat increment;
+  integrator.computeIncrement(state, 1.0, &no_forcing, time, increment);
+  return std::abs(state.at<double>(0, 0) + increment.at<double>(0, 0) - std::exp(-time));
+}
+
+int test_exponential_euler()
+{
+  int errors = 0;
+  std::cout << "Testing the exponential Euler method." << std::endl;
+
+  cedar::dyn::Integrator integrator(cedar::dyn::IntegrationMethod::ExponentialEuler);
+  const double time = 20.0;
+  const double forcing = 0.5;
+  cv::Mat increment;
+
+  // scalar rate: the solution u(t) = f/r + (u(0) - f/r) * exp(-r * t) must be matched exactly, even for large steps
+  const double rate = 0.1;
+  cv::Mat state(2, 2, CV_32F, cv::Scalar(-5.0));
+  integrator.computeIncrement(state, rate, boost::bind(&constant_forcing, forcing, _1, _2), time, increment);
+  double expected = forcing / rate + (-5.0 - forcing / rate) * std::exp(-rate * time);
+  double result = state.at<float>(1, 1) + increment.at<float>(1, 1);
+  if (std::abs(result - expected) > PRECISION)
+  {
+    std::cout << "ERROR: scalar rate; expected " << expected << ", got " << result << std::endl;
+    ++errors;
+  }
+
+  // rate per element, including an element without decay
+  cv::Mat rates = (cv::Mat_<float>(2, 1) << 0.1f, 0.0f);
+  cv::Mat vector_state(2, 1, CV_32F, cv::Scalar(1.0));
+  integrator.computeIncrement(vector_state, rates, boost::bind(&constant_forcing, forcing, _1, _2), time, increment);
+  expected = forcing / 0.1 + (1.0 - forcing / 0.1) * std::exp(-0.1 * time);
+  result = vector_state.at<float>(0, 0) + increment.at<float>(0, 0);
+  if (std::abs(result - expected) > PRECISION)
+  {
+    std::cout << "ERROR: rate matrix; expected " << expected << ", got " << result << std::endl;
+    ++errors;
+  }
+  expected = 1.0 + forcing * time;
+  result = vector_state.at<float>(1, 0) + increment.at<float>(1, 0);
+  if (std::abs(result - expected) > PRECISION)
+  {
+    std::cout << "ERROR: zero rate; expected " << expected << ", got " << result << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int test_order()
+{
+  int errors = 0;
+  std::cout << "Testing the order of the fixed step methods." << std::endl;
+
+  struct Expectation
+  {
+    cedar::dyn::IntegrationMethod::Id method;
+    // the error of a single step shrinks by 2^(order + 1) when halving the step
+    double order;
+  };
+  const Expectation expectations[] =
+  {
+    {cedar::dyn::IntegrationMethod::ExplicitEuler, 1.0},
+    {cedar::dyn::IntegrationMethod::Heun, 2.0},
+    {cedar::dyn::IntegrationMethod::RungeKutta4, 4.0}
+  };
+
+  for (const auto& expectation : expectations)
+  {
+    double ratio = decay_error(expectation.method, 0.1) / decay_error(expectation.method, 0.05);
+    double expected = std::pow(2.0, expectation.order + 1.0);
+    if (std::abs(ratio / expected - 1.0) > 0.1)
+    {
+      std::cout << "ERROR: method " << expectation.method << " reduces its error by " << ratio << " instead of "
+                << expected << " when halving the step." << std::endl;
+      ++errors;
+    }
+  }
+
+  return errors;
+}
+
+int test_adaptive()
+{
+  int errors = 0;
+  std::cout << "Testing the adaptive method." << std::endl;
+
+  cedar::dyn::Integrator integrator(cedar::dyn::IntegrationMethod::AdaptiveHeun);
+  integrator.setTolerance(1e-4);
+
+  const double time = 2.0;
+  cv::Mat state(1, 1, CV_64F, cv::Scalar(1.0));
+  cv::Mat increment;
+  integrator.computeIncrement(state, 1.0, &no_forcing, time, increment);
+
+  if (integrator.getLastStepCount() <= 1)
+  {
+    std::cout << "ERROR: the adaptive method did not split the time step." << std::endl;
+    ++errors;
+  }
+  if (std::abs(integrator.getLastStepSize() * integrator.getLastStepCount() - time) > 1e-9)
+  {
+    std::cout << "ERROR: the reported step size does not match the number of steps." << std::endl;
+    ++errors;
+  }
+
+  double error = std::abs(state.at<double>(0, 0) + increment.at<double>(0, 0) - std::exp(-time));
+  if (error > 1e-4)
+  {
+    std::cout << "ERROR: the adaptive method has an error of " << error << "." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  errors += test_exponential_euler();
+  errors += test_order();
+  errors += test_adaptive();
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
@@ -59,13 +59,68 @@
 #include "cedar/auxiliaries/ObjectListParameter.h"
 #include "cedar/auxiliaries/ObjectParameter.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 
 // SYSTEM INCLUDES
 #include <iostream>
+#include <string>
 
 // global variables
 unsigned int global_errors;
 
+void compare_integration(unsigned int dimensionality, const std::string& multiplicativeNoise)
+{
+  using cedar::dyn::NeuralField;
+
+  std::cout << "Comparing fused and reference integration for " << dimensionality << "D fields";
+  if (!multiplicativeNoise.empty())
+  {
+    std::cout << " with " << multiplicativeNoise;
+  }
+  std::cout << "." << std::endl;
+
+  cedar::dyn::NeuralFieldPtr fields[2];
+  for (unsigned int f = 0; f < 2; ++f)
+  {
+    fields[f] = cedar::dyn::NeuralFieldPtr(new NeuralField());
+    fields[f]->setDimensionality(dimensionality);
+    for (unsigned int d = 0; d < dimensionality; ++d)
+    {
+      fields[f]->setSize(d, 15);
+    }
+    // a resting level at the threshold of the sigmoid so that lateral interaction and global inhibition contribute
+    fields[f]->setRestingLevel(0.0);
+    if (!multiplicativeNoise.empty())
+    {
+      cedar::aux::asserted_pointer_cast<cedar::aux::BoolParameter>
+      (
+        fields[f]->getParameter(multiplicativeNoise)
+      )->setValue(true);
+    }
+  }
+  fields[1]->setReferenceIntegration(true);
+
+  cedar::proc::StepTimePtr step_time(new cedar::proc::StepTime(0.01 * cedar::unit::seconds));
+  for (unsigned int step = 0; step < 50; ++step)
+  {
+    for (unsigned int f = 0; f < 2; ++f)
+    {
+      // both fields have to draw the same noise
+      cv::theRNG() = cv::RNG(step + 1);
+      fields[f]->onTrigger(step_time, cedar::proc::TriggerPtr());
+    }
+  }
+
+  const cv::Mat& fused = fields[0]->getFieldActivation()->getData();
+  const cv::Mat& reference = fields[1]->getFieldActivation()->getData();
+  double difference = cv::norm(fused - reference, cv::NORM_INF);
+  if (difference > 1e-4)
+  {
+    std::cout << "ERROR: Fused integration differs from the reference integration by " << difference << std::endl;
+    ++global_errors;
+  }
+}
+
 void run_test()
 {
   using cedar::proc::LoopedTrigger;
@@ -105,6 +160,13 @@ void run_test()
   network->getElement<LoopedTrigger>("Main Trigger")->stop();
 #endif
 
+  for (unsigned int dimensionality = 0; dimensionality <= 3; ++dimensionality)
+  {
+    compare_integration(dimensionality, "");
+  }
+  compare_integration(2, "multiplicative noise (input)");
+  compare_integration(2, "multiplicative noise (activation)");
+
   std::cout << "Copying..." << std::endl;
   // check if copying configuration works
   network->getElement<NeuralField>("Field")->copyTo(network->getElement<NeuralField>("Field 1"));
@@ -0,0 +1,289 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Tests storing and restoring the matrices of groups with checkpoints.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/Checkpoint.h"
+#include "cedar/processing/Group.h"
+#include "cedar/processing/sources/GaussInput.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+bool matrices_equal(const cv::Mat& first, const cv::Mat& second)
+{
+  return first.type() == second.type()
+         && cedar::aux::math::matrixSizesEqual(first, second)
+         && cv::norm(first, second, cv::NORM_INF) == 0.0;
+}
+
+int test_matrices()
+{
+  int errors = 0;
+  std::cout << "Testing storing and restoring matrices." << std::endl;
+
+  cedar::proc::Checkpoint checkpoint;
+
+  int sizes[] = {4, 5, 6};
+  cv::Mat cube(3, sizes, CV_32F);
+  cv::randu(cube, cv::Scalar(-1.0), cv::Scalar(1.0));
+  cv::Mat image(20, 30, CV_64F);
+  cv::randu(image, cv::Scalar(0.0), cv::Scalar(1.0));
+  // not continuous
+  cv::Mat region = image(cv::Rect(5, 5, 10, 10));
+
+  checkpoint.store("cube", cube);
+  checkpoint.store("region", region);
+  checkpoint.store("empty", cv::Mat());
+
+  if (checkpoint.getNumberOfEntries() != 3)
+  {
+    std::cout << "ERROR: checkpoint has " << checkpoint.getNumberOfEntries() << " entries instead of 3." << std::endl;
+    ++errors;
+  }
+
+  // restoring into a matrix of the right size must reuse its memory
+  cv::Mat restored_cube(3, sizes, CV_32F, cv::Scalar(0.0));
+  const unsigned char* data = restored_cube.data;
+  if (!checkpoint.restore("cube", restored_cube) || !matrices_equal(cube, restored_cube))
+  {
+    std::cout << "ERROR: cube was not restored correctly." << std::endl;
+    ++errors;
+  }
+  if (restored_cube.data != data)
+  {
+    std::cout << "ERROR: restoring the cube reallocated the matrix." << std::endl;
+    ++errors;
+  }
+
+  cv::Mat restored_region;
+  if (!checkpoint.restore("region", restored_region) || !matrices_equal(region, restored_region))
+  {
+    std::cout << "ERROR: region was not restored correctly." << std::endl;
+    ++errors;
+  }
+
+  cv::Mat restored_empty(2, 2, CV_32F);
+  if (!checkpoint.restore("empty", restored_empty) || !restored_empty.empty())
+  {
+    std::cout << "ERROR: empty matrix was not restored correctly." << std::endl;
+    ++errors;
+  }
+
+  cv::Mat untouched = cv::Mat::ones(2, 2, CV_32F);
+  if (checkpoint.restore("missing", untouched) || cv::sum(untouched)[0] != 4.0)
+  {
+    std::cout << "ERROR: restoring a missing entry changed the matrix." << std::endl;
+    ++errors;
+  }
+
+  // storing the same key again must not grow the checkpoint
+  size_t data_size = checkpoint.getDataSize();
+  cube *= 2.0;
+  checkpoint.store("cube", cube);
+  if (checkpoint.getDataSize() != data_size)
+  {
+    std::cout << "ERROR: storing a matrix again grew the checkpoint." << std::endl;
+    ++errors;
+  }
+
+  // storing a matrix of a different size must release the old memory
+  cv::Mat large_cube(3, sizes, CV_64F, cv::Scalar(3.0));
+  checkpoint.store("cube", large_cube);
+  checkpoint.store("cube", cube);
+  if (checkpoint.getDataSize() != data_size)
+  {
+    std::cout << "ERROR: storing matrices of different sizes leaked memory in the checkpoint." << std::endl;
+    ++errors;
+  }
+  if
+  (
+    !checkpoint.restore("cube", restored_cube) || !matrices_equal(cube, restored_cube)
+    || !checkpoint.restore("region", restored_region) || !matrices_equal(region, restored_region)
+  )
+  {
+    std::cout << "ERROR: matrices were not restored correctly after resizing an entry." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Testing serialization." << std::endl;
+  std::stringstream stream;
+  checkpoint.serialize(stream);
+  cedar::proc::Checkpoint read_checkpoint;
+  read_checkpoint.deserialize(stream);
+  if
+  (
+    read_checkpoint.getNumberOfEntries() != checkpoint.getNumberOfEntries()
+    || !read_checkpoint.restore("cube", restored_cube)
+    || !matrices_equal(cube, restored_cube)
+  )
+  {
+    std::cout << "ERROR: checkpoint was not read back correctly." << std::endl;
+    ++errors;
+  }
+
+  std::stringstream garbage("not a checkpoint");
+  try
+  {
+    read_checkpoint.deserialize(garbage);
+    std::cout << "ERROR: reading invalid data did not throw." << std::endl;
+    ++errors;
+  }
+  catch (const cedar::aux::ParseException&)
+  {
+    // expected
+  }
+
+  return errors;
+}
+
+//! Serializes a checkpoint with a single 2x2 matrix under the key "m" and overwrites a value in the entry.
+std::string corrupted_checkpoint(size_t position, uint64_t value)
+{
+  cedar::proc::Checkpoint checkpoint;
+  checkpoint.store("m", cv::Mat::ones(2, 2, CV_32F));
+  std::stringstream stream;
+  checkpoint.serialize(stream);
+  std::string data = stream.str();
+  data.replace(position, sizeof(value), reinterpret_cast<const char*>(&value), sizeof(value));
+  return data;
+}
+
+int test_invalid_data()
+{
+  int errors = 0;
+  std::cout << "Testing reading invalid checkpoints." << std::endl;
+
+  // magic, number of entries, key length, key, type, number of dimensions, sizes
+  const size_t offset_position = 8 + 8 + 8 + 1 + 4 + 4 + 2 * 4;
+  const size_t bytes_position = offset_position + 8;
+
+  std::vector<std::pair<std::string, std::string>> cases =
+  {
+    {"wrong number of bytes", corrupted_checkpoint(bytes_position, 15)},
+    {"data out of bounds", corrupted_checkpoint(offset_position, 1024)},
+    {"overflowing offset", corrupted_checkpoint(offset_position, std::numeric_limits<uint64_t>::max() - 4)}
+  };
+
+  for (const auto& description_data_pair : cases)
+  {
+    cedar::proc::Checkpoint checkpoint;
+    checkpoint.store("untouched", cv::Mat::zeros(3, 3, CV_8U));
+    std::stringstream stream(description_data_pair.second);
+    try
+    {
+      checkpoint.deserialize(stream);
+      std::cout << "ERROR: reading a checkpoint with " << description_data_pair.first << " did not throw." << std::endl;
+      ++errors;
+    }
+    catch (const cedar::aux::ParseException&)
+    {
+      // expected
+    }
+
+    if (!checkpoint.contains("untouched") || checkpoint.getNumberOfEntries() != 1)
+    {
+      std::cout << "ERROR: a failed read changed the checkpoint." << std::endl;
+      ++errors;
+    }
+  }
+
+  return errors;
+}
+
+cv::Mat& output_of(cedar::proc::GroupPtr group, const std::string& name)
+{
+  auto step = group->getElement<cedar::proc::sources::GaussInput>(name);
+  return boost::dynamic_pointer_cast<cedar::aux::MatData>(step->getOutputSlot("Gauss input")->getData())->getData();
+}
+
+int test_group()
+{
+  int errors = 0;
+  std::cout << "Testing checkpoints of groups." << std::endl;
+
+  cedar::proc::GroupPtr root(new cedar::proc::Group());
+  cedar::proc::GroupPtr nested(new cedar::proc::Group());
+  root->add(nested, "nested");
+  root->add(cedar::proc::sources::GaussInputPtr(new cedar::proc::sources::GaussInput()), "outer");
+  nested->add(cedar::proc::sources::GaussInputPtr(new cedar::proc::sources::GaussInput()), "inner");
+
+  cv::Mat outer = output_of(root, "outer").clone();
+  cv::Mat inner = output_of(nested, "inner").clone();
+
+  cedar::proc::Checkpoint checkpoint;
+  root->writeCheckpoint(checkpoint);
+
+  output_of(root, "outer").setTo(cv::Scalar(-1.0));
+  output_of(nested, "inner").setTo(cv::Scalar(-1.0));
+
+  root->readCheckpoint(checkpoint);
+
+  if (!matrices_equal(outer, output_of(root, "outer")))
+  {
+    std::cout << "ERROR: output of the outer step was not restored." << std::endl;
+    ++errors;
+  }
+  if (!matrices_equal(inner, output_of(nested, "inner")))
+  {
+    std::cout << "ERROR: output of the step in the nested group was not restored." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc, argv);
+
+  int errors = 0;
+
+  errors += test_matrices();
+  errors += test_invalid_data();
+  errors += test_group();
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
@@ -0,0 +1,199 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        parallelTriggering.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Tests parallel dispatch of the levels of a triggering chain.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// LOCAL INCLUDES
+
+// CEDAR INCLUDES
+#include "cedar/processing/Group.h"
+#include "cedar/processing/Step.h"
+#include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/Trigger.h"
+#include "cedar/auxiliaries/DataTemplate.h"
+#include "cedar/auxiliaries/CallFunctionInThread.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/Log.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <boost/make_shared.hpp>
+#include <vector>
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int global_errors = 0;
+
+typedef cedar::aux::DataTemplate<unsigned int> UIntData;
+CEDAR_GENERATE_POINTER_TYPES(UIntData);
+
+class SumTest : public cedar::proc::Step
+{
+public:
+  SumTest(bool looped = false)
+  :
+  cedar::proc::Step(looped),
+  mTriggerCount(0),
+  mDataOut(new UIntData(0))
+  {
+    this->declareInputCollection("in");
+    this->declareOutput("out", mDataOut);
+  }
+
+  void compute(const cedar::proc::Arguments&)
+  {
+    ++mTriggerCount;
+    unsigned int sum = 1;
+    auto collection = this->getInputSlot("in");
+    for (unsigned int i = 0; i < collection->getDataCount(); ++i)
+    {
+      if (auto data = boost::dynamic_pointer_cast<ConstUIntData>(collection->getData(i)))
+      {
+        sum += data->getData();
+      }
+    }
+    this->mDataOut->setData(sum);
+  }
+
+  unsigned int mTriggerCount;
+  UIntDataPtr mDataOut;
+};
+
+CEDAR_GENERATE_POINTER_TYPES(SumTest);
+
+/* Builds a source -> N independent steps -> sink architecture and triggers the chain of the source. Returns the value
+ * computed by the sink.
+ */
+unsigned int run_chain(bool parallel, unsigned int width)
+{
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  cedar::proc::LoopedTriggerPtr trigger(new cedar::proc::LoopedTrigger());
+  trigger->setParallelDispatchEnabled(parallel);
+  group->add(trigger, "trigger");
+
+  SumTestPtr source(new SumTest(true));
+  group->add(source, "source");
+  group->connectTrigger(trigger, source);
+
+  SumTestPtr sink(new SumTest());
+  group->add(sink, "sink");
+
+  std::vector<SumTestPtr> middle;
+  for (unsigned int i = 0; i < width; ++i)
+  {
+    std::string name = "middle" + cedar::aux::toString(i);
+    SumTestPtr step(new SumTest());
+    group->add(step, name);
+    group->connectSlots("source.out", name + ".in");
+    group->connectSlots(name + ".out", "sink.in");
+    middle.push_back(step);
+  }
+
+  // the triggering order should contain two levels: the middle steps, and then the sink
+  auto order = source->getFinishedTrigger()->getTriggeringOrder();
+  if (order.size() != 2)
+  {
+    std::cout << "ERROR: triggering order has " << order.size() << " levels instead of 2." << std::endl;
+    ++global_errors;
+  }
+
+  source->mDataOut->setData(1);
+  for (auto step : middle)
+  {
+    step->mTriggerCount = 0;
+  }
+  sink->mTriggerCount = 0;
+
+  source->getFinishedTrigger()->trigger();
+
+  for (auto step : middle)
+  {
+    if (step->mTriggerCount != 1)
+    {
+      std::cout << "ERROR: step " << step->getName() << " was triggered " << step->mTriggerCount << " times." << std::endl;
+      ++global_errors;
+    }
+  }
+  if (sink->mTriggerCount != 1)
+  {
+    std::cout << "ERROR: sink was triggered " << sink->mTriggerCount << " times." << std::endl;
+    ++global_errors;
+  }
+
+  auto level_times = source->getFinishedTrigger()->getLevelTimeMeasurementAverages();
+  if (level_times.size() != order.size())
+  {
+    std::cout << "ERROR: got " << level_times.size() << " level time measurements instead of " << order.size()
+              << "." << std::endl;
+    ++global_errors;
+  }
+
+  return sink->mDataOut->getData();
+}
+
+void run_test()
+{
+  for (unsigned int width : {1, 2, 8, 32})
+  {
+    std::cout << "Testing chain of width " << width << std::endl;
+    unsigned int serial = run_chain(false, width);
+    unsigned int parallel = run_chain(true, width);
+    // each middle step computes 1 + 1, the sink adds one to that
+    unsigned int expected = 2 * width + 1;
+    if (serial != expected || parallel != expected)
+    {
+      std::cout << "ERROR: serial result is " << serial << ", parallel result is " << parallel
+                << ", expected " << expected << "." << std::endl;
+      ++global_errors;
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc,argv);
+
+  cedar::aux::CallFunctionInThread testThread(run_test);
+
+  QObject::connect(&testThread, SIGNAL(finishedThread()), &app, SLOT(quit()), Qt::QueuedConnection);
+
+  testThread.start();
+  app.exec();
+
+  std::cout << "Test finished with " << global_errors << " error(s)." << std::endl;
+
+  return global_errors;
+}
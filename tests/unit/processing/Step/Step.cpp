@@ -40,6 +40,7 @@
 #include "cedar/processing/Group.h"
 #include "cedar/processing/LoopedTrigger.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
 
 // SYSTEM INCLUDES
 #include <iostream>
@@ -240,6 +241,97 @@ int testThrowInAction()
   return 0;
 }
 
+class CountsComputes : public cedar::proc::Step
+{
+public:
+  CountsComputes()
+  :
+  mComputeCount(0),
+  mOutput(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F))),
+  _mGain(new cedar::aux::DoubleParameter(this, "gain", 1.0))
+  {
+    this->declareInput("input", false);
+    this->declareOutput("output", this->mOutput);
+    this->setSkipUnchangedComputes(true);
+  }
+
+  void setGain(double gain)
+  {
+    this->_mGain->setValue(gain);
+  }
+
+  unsigned int mComputeCount;
+
+private:
+  void compute(const cedar::proc::Arguments&)
+  {
+    ++mComputeCount;
+  }
+
+  cedar::aux::MatDataPtr mOutput;
+  cedar::aux::DoubleParameterPtr _mGain;
+};
+CEDAR_GENERATE_POINTER_TYPES(CountsComputes);
+
+int testSkipUnchangedComputes()
+{
+  int errors = 0;
+  std::cout << "Testing skipping of unchanged compute calls" << std::endl;
+
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  CountsComputesPtr source(new CountsComputes());
+  CountsComputesPtr target(new CountsComputes());
+  group->add(source, "source");
+  group->add(target, "target");
+  group->connectSlots("source.output", "target.input");
+
+  source->onTrigger();
+  unsigned int source_computes = source->mComputeCount;
+  unsigned int target_computes = target->mComputeCount;
+  unsigned long long source_skipped = source->getSkippedComputeCount();
+
+  std::cout << "Triggering unchanged steps." << std::endl;
+  source->onTrigger();
+  if (source->mComputeCount != source_computes || source->getSkippedComputeCount() != source_skipped + 1)
+  {
+    std::cout << "ERROR: the compute call of an unchanged step was not skipped." << std::endl;
+    ++errors;
+  }
+  if (target->mComputeCount != target_computes)
+  {
+    std::cout << "ERROR: a step was computed although its input did not change." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Changing a parameter." << std::endl;
+  source->setGain(2.0);
+  source->onTrigger();
+  if (source->mComputeCount <= source_computes)
+  {
+    std::cout << "ERROR: the step was not computed after a parameter changed." << std::endl;
+    ++errors;
+  }
+  if (target->mComputeCount <= target_computes)
+  {
+    std::cout << "ERROR: a step was not computed after its input changed." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Disabling skipping." << std::endl;
+  source->setSkipUnchangedComputes(false);
+  source_computes = source->mComputeCount;
+  source->onTrigger();
+  source->onTrigger();
+  if (source->mComputeCount != source_computes + 2)
+  {
+    std::cout << "ERROR: compute calls were skipped although skipping is disabled." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Skipping test uncovered " << errors << " error(s)." << std::endl;
+  return errors;
+}
+
 // global variable:
 int global_errors;
 
@@ -268,6 +360,7 @@ void run_test()
 
   global_errors += testStartingStopping();
   global_errors += testThrowInAction();
+  global_errors += testSkipUnchangedComputes();
 
   std::cout << "test finished with " << global_errors << " error(s)." << std::endl;
 }
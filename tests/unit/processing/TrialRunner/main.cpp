@@ -0,0 +1,271 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 18
+
+    Description: Tests running the trials of an experiment concurrently on copies of its group.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/experiment/TrialRunner.h"
+#include "cedar/processing/experiment/Experiment.h"
+#include "cedar/processing/Checkpoint.h"
+#include "cedar/processing/ElementDeclaration.h"
+#include "cedar/processing/Group.h"
+#include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/Step.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/Recorder.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <QMutex>
+#include <QMutexLocker>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <set>
+
+//! What the probes of one trial saw; trials are told apart by their clocks.
+struct TrialObservation
+{
+  std::set<cedar::aux::Recorder*> mRecorders;
+  unsigned int mComputeCalls = 0;
+};
+
+QMutex observations_lock;
+// the clocks are kept alive here so that the clocks of later trials cannot get the addresses of earlier ones
+std::map<boost::shared_ptr<cedar::aux::GlobalClock>, TrialObservation> observations;
+
+//! Counts its compute calls and notes the clock and recorder it sees.
+class Probe : public cedar::proc::Step
+{
+public:
+  Probe()
+  :
+  cedar::proc::Step(true),
+  mCount(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F)))
+  {
+    this->declareOutput("count", this->mCount);
+  }
+
+  void compute(const cedar::proc::Arguments&)
+  {
+    this->mCount->getData().at<float>(0, 0) += 1.0f;
+
+    QMutexLocker locker(&observations_lock);
+    auto& observation = observations[cedar::aux::GlobalClockSingleton::getInstance()];
+    observation.mRecorders.insert(cedar::aux::RecorderSingleton::getInstance().get());
+    ++observation.mComputeCalls;
+  }
+
+  float getCount() const
+  {
+    return this->mCount->getData().at<float>(0, 0);
+  }
+
+private:
+  cedar::aux::MatDataPtr mCount;
+};
+
+CEDAR_GENERATE_POINTER_TYPES(Probe);
+
+cedar::proc::GroupPtr create_group()
+{
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  cedar::proc::LoopedTriggerPtr trigger
+  (
+    new cedar::proc::LoopedTrigger(10.0 * cedar::unit::milli * cedar::unit::seconds)
+  );
+  group->add(trigger, "trigger");
+  ProbePtr probe(new Probe());
+  group->add(probe, "probe");
+  group->connectTrigger(trigger, probe);
+  return group;
+}
+
+int test_trials()
+{
+  int errors = 0;
+  std::cout << "Testing running trials concurrently." << std::endl;
+
+  const unsigned int trials = 6;
+  const unsigned int steps = 10;
+  const cedar::unit::Time step_size = 10.0 * cedar::unit::milli * cedar::unit::seconds;
+
+  auto group = create_group();
+  cedar::aux::ConfigurationNode configuration_before;
+  group->writeConfiguration(configuration_before);
+  auto global_clock = cedar::aux::GlobalClockSingleton::getInstance();
+  auto global_recorder = cedar::aux::RecorderSingleton::getInstance();
+  cedar::unit::Time global_time_before = global_clock->getTime();
+
+  cedar::proc::experiment::ExperimentPtr experiment(new cedar::proc::experiment::Experiment(group));
+  experiment->setTrialCount(trials);
+
+  cedar::proc::experiment::TrialRunner runner(experiment);
+  runner.setNumberOfWorkers(3);
+  runner.setStepSize(step_size);
+  runner.setMaximumTrialDuration(static_cast<double>(steps) * step_size);
+  runner.setSeed(42);
+  runner.setKeepsFinalStates(true);
+
+  auto results = runner.run();
+
+  std::cout << "Checking the results of the trials." << std::endl;
+  if (results.size() != trials)
+  {
+    std::cout << "ERROR: there are " << results.size() << " results instead of " << trials << "." << std::endl;
+    return errors + 1;
+  }
+
+  for (unsigned int trial = 0; trial < trials; ++trial)
+  {
+    const auto& result = results.at(trial);
+    if (!result.mError.empty())
+    {
+      std::cout << "ERROR: trial " << trial << " failed: " << result.mError << std::endl;
+      ++errors;
+      continue;
+    }
+    if (result.mTrial != trial || result.mSeed != 42 + trial)
+    {
+      std::cout << "ERROR: result " << trial << " has the number or seed of another trial." << std::endl;
+      ++errors;
+    }
+    if (!result.mCompleted || result.mEndedByAction)
+    {
+      std::cout << "ERROR: trial " << trial << " did not run until the maximum trial duration." << std::endl;
+      ++errors;
+    }
+    // a clock shared with other trials would advance with their steps, too
+    double simulated_steps = result.mDuration / step_size;
+    if (result.mNumberOfSteps != steps || std::abs(simulated_steps - static_cast<double>(steps)) > 1e-6)
+    {
+      std::cout << "ERROR: trial " << trial << " took " << result.mNumberOfSteps << " steps and the time of "
+                << simulated_steps << " steps instead of " << steps << "." << std::endl;
+      ++errors;
+    }
+
+    // the final state is restored into a group of its own, so its values can be read
+    auto restored = create_group();
+    if (!result.mFinalState)
+    {
+      std::cout << "ERROR: trial " << trial << " has no final state." << std::endl;
+      ++errors;
+      continue;
+    }
+    restored->readCheckpoint(*result.mFinalState);
+    float count = restored->getElement<Probe>("probe")->getCount();
+    if (count != static_cast<float>(steps))
+    {
+      std::cout << "ERROR: the probe of trial " << trial << " was computed " << count << " times." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking the clocks and recorders of the trials." << std::endl;
+  std::set<cedar::aux::Recorder*> recorders;
+  QMutexLocker locker(&observations_lock);
+  if (observations.size() != trials)
+  {
+    std::cout << "ERROR: the probes saw " << observations.size() << " clocks instead of " << trials << "." << std::endl;
+    ++errors;
+  }
+  if (observations.find(global_clock) != observations.end())
+  {
+    std::cout << "ERROR: a trial used the global clock." << std::endl;
+    ++errors;
+  }
+  for (const auto& clock_observation_pair : observations)
+  {
+    const auto& observation = clock_observation_pair.second;
+    if (observation.mComputeCalls != steps)
+    {
+      std::cout << "ERROR: a clock was seen in " << observation.mComputeCalls << " compute calls instead of " << steps
+                << "." << std::endl;
+      ++errors;
+    }
+    if (observation.mRecorders.size() != 1)
+    {
+      std::cout << "ERROR: the steps of one trial saw " << observation.mRecorders.size() << " recorders." << std::endl;
+      ++errors;
+    }
+    recorders.insert(observation.mRecorders.begin(), observation.mRecorders.end());
+  }
+  if (recorders.size() != observations.size())
+  {
+    std::cout << "ERROR: trials shared their recorders." << std::endl;
+    ++errors;
+  }
+  if (recorders.find(global_recorder.get()) != recorders.end())
+  {
+    std::cout << "ERROR: a trial used the global recorder." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking that the source group is untouched." << std::endl;
+  cedar::aux::ConfigurationNode configuration_after;
+  group->writeConfiguration(configuration_after);
+  if (configuration_after != configuration_before)
+  {
+    std::cout << "ERROR: the configuration of the source group changed." << std::endl;
+    ++errors;
+  }
+  if (group->getElement<Probe>("probe")->getCount() != 0.0f)
+  {
+    std::cout << "ERROR: the probe of the source group was computed." << std::endl;
+    ++errors;
+  }
+  if (global_clock->getTime() != global_time_before)
+  {
+    std::cout << "ERROR: the global clock was advanced by the trials." << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc, argv);
+
+  cedar::proc::ElementDeclarationPtr probe_declaration(new cedar::proc::ElementDeclarationTemplate<Probe>("Test"));
+  probe_declaration->declare();
+
+  int errors = 0;
+
+  errors += test_trials();
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
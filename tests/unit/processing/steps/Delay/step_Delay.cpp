@@ -0,0 +1,246 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        step_Delay.cpp
+
+    Maintainer:  Oliver Lomp
+    Email:       oliver.lomp@ini.ruhr-uni-bochum.de
+    Date:        2026 10 17
+
+    Description: Unit test for the cedar::proc::steps::Delay class.
+
+    Credits:
+
+======================================================================================================================*/
+
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/processing/steps/Delay.h"
+#include "cedar/processing/Checkpoint.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/DoubleVectorParameter.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+
+//! Lets the global clock advance by the given number of milliseconds.
+void advanceClock(double milliseconds)
+{
+  cedar::aux::GlobalClockSingleton::getInstance()->addTime
+  (
+    cedar::unit::Time(milliseconds * cedar::unit::milli * cedar::unit::seconds)
+  );
+}
+
+//! Returns the value of the first entry of the given output.
+float outputValue(cedar::proc::steps::DelayPtr delay, const std::string& slot)
+{
+  cedar::aux::ConstMatDataPtr output = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(delay->getOutput(slot));
+  return output->getData().at<float>(0, 0, 0);
+}
+
+/*!@brief Feeds the values 0, 1, 2, ... into a delay step, one every 10 ms, and compares the given output with the
+ *        value that arrived the given number of steps ago.
+ */
+int testDelay(double delayMs, bool interpolate, double expectedLag)
+{
+  int errors = 0;
+  std::cout << "Testing a delay of " << delayMs << " ms (interpolate: " << interpolate << ")." << std::endl;
+
+  int sizes[] = {3, 4, 5};
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(cv::Mat(3, sizes, CV_32F, cv::Scalar(0))));
+  cedar::proc::steps::DelayPtr delay(new cedar::proc::steps::Delay());
+  delay->setDelay(cedar::unit::Time(delayMs * cedar::unit::milli * cedar::unit::seconds));
+  boost::dynamic_pointer_cast<cedar::aux::BoolParameter>(delay->getParameter("interpolate"))->setValue(interpolate);
+  delay->setInput("input", input);
+
+  const unsigned int steps = 50;
+  const uchar* output_buffer = nullptr;
+  unsigned int frames_after_warmup = 0;
+  for (unsigned int step = 0; step < steps; ++step)
+  {
+    advanceClock(10.0);
+    input->getData().setTo(cv::Scalar(static_cast<double>(step)));
+    delay->onTrigger();
+
+    double expected = std::max(0.0, static_cast<double>(step) - expectedLag);
+    float value = outputValue(delay, "output");
+    if (std::abs(value - expected) > 1e-4)
+    {
+      ++errors;
+      std::cout << "ERROR: step " << step << ": output is " << value << ", expected " << expected << std::endl;
+    }
+
+    if (step == steps / 2)
+    {
+      output_buffer = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(delay->getOutput("output"))->getData().data;
+      frames_after_warmup = delay->getNumberOfBufferedFrames();
+    }
+  }
+
+  if (boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(delay->getOutput("output"))->getData().data != output_buffer)
+  {
+    ++errors;
+    std::cout << "ERROR: the output was reallocated after the buffer was warmed up." << std::endl;
+  }
+
+  if (delay->getNumberOfBufferedFrames() != frames_after_warmup)
+  {
+    ++errors;
+    std::cout << "ERROR: the buffer kept growing after it spanned the delay: " << frames_after_warmup << " vs. "
+              << delay->getNumberOfBufferedFrames() << " frames." << std::endl;
+  }
+
+  if (delay->getNumberOfBufferedFrames() > static_cast<unsigned int>(std::ceil(expectedLag)) + 2)
+  {
+    ++errors;
+    std::cout << "ERROR: the buffer holds more frames than needed: " << delay->getNumberOfBufferedFrames() << std::endl;
+  }
+
+  return errors;
+}
+
+//! Checks that additional taps read from the same buffer with their own delays.
+int testTaps()
+{
+  int errors = 0;
+  std::cout << "Testing additional taps." << std::endl;
+
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(cv::Mat(2, 2, CV_32F, cv::Scalar(0))));
+  cedar::proc::steps::DelayPtr delay(new cedar::proc::steps::Delay());
+  delay->setInput("input", input);
+
+  auto additional_delays
+    = boost::dynamic_pointer_cast<cedar::aux::DoubleVectorParameter>(delay->getParameter("additional delays"));
+  additional_delays->setValue(std::vector<double>({25.0, 55.0}));
+
+  if (!delay->hasOutputSlot("tap 1") || !delay->hasOutputSlot("tap 2"))
+  {
+    ++errors;
+    std::cout << "ERROR: outputs for the additional delays were not declared." << std::endl;
+    return errors;
+  }
+
+  for (unsigned int step = 0; step < 20; ++step)
+  {
+    advanceClock(10.0);
+    input->getData().setTo(cv::Scalar(static_cast<double>(step)));
+    delay->onTrigger();
+  }
+
+  // the last input was 19; the main output lags one step behind
+  float expected[] = {18.0f, 16.0f, 13.0f};
+  std::string slots[] = {"output", "tap 1", "tap 2"};
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    cedar::aux::ConstMatDataPtr output
+      = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(delay->getOutput(slots[i]));
+    float value = output->getData().at<float>(0, 0);
+    if (value != expected[i])
+    {
+      ++errors;
+      std::cout << "ERROR: output \"" << slots[i] << "\" is " << value << ", expected " << expected[i] << std::endl;
+    }
+  }
+
+  additional_delays->setValue(std::vector<double>({25.0}));
+  if (delay->hasOutputSlot("tap 2"))
+  {
+    ++errors;
+    std::cout << "ERROR: output of a removed delay still exists." << std::endl;
+  }
+
+  return errors;
+}
+
+//! Checks that the ring buffer is part of checkpoints, also when the clock was reset before restoring them.
+int testCheckpoint()
+{
+  int errors = 0;
+  std::cout << "Testing checkpoints." << std::endl;
+
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(cv::Mat(2, 2, CV_32F, cv::Scalar(0))));
+  cedar::proc::steps::DelayPtr delay(new cedar::proc::steps::Delay());
+  delay->setDelay(cedar::unit::Time(25.0 * cedar::unit::milli * cedar::unit::seconds));
+  delay->setInput("input", input);
+
+  for (unsigned int step = 0; step < 10; ++step)
+  {
+    advanceClock(10.0);
+    input->getData().setTo(cv::Scalar(static_cast<double>(step)));
+    delay->onTrigger();
+  }
+
+  cedar::proc::Checkpoint checkpoint;
+  delay->writeCheckpoint(checkpoint, "delay");
+
+  // overwrite the buffer with other values
+  for (unsigned int step = 0; step < 10; ++step)
+  {
+    advanceClock(10.0);
+    input->getData().setTo(cv::Scalar(-1.0));
+    delay->onTrigger();
+  }
+
+  cedar::aux::GlobalClockSingleton::getInstance()->reset();
+  delay->readCheckpoint(checkpoint, "delay");
+
+  // continue as if nothing happened after the checkpoint: the input that arrived three steps ago was 7
+  advanceClock(10.0);
+  input->getData().setTo(cv::Scalar(10.0));
+  delay->onTrigger();
+  float value = outputValue(delay, "output");
+  if (value != 7.0f)
+  {
+    ++errors;
+    std::cout << "ERROR: after restoring the checkpoint, the output is " << value << ", expected 7" << std::endl;
+  }
+
+  return errors;
+}
+
+int main(int, char**)
+{
+  int errors = 0;
+
+  // a delay of zero keeps the legacy behavior of delaying by one step
+  errors += testDelay(0.0, false, 1.0);
+  errors += testDelay(25.0, false, 3.0);
+  errors += testDelay(35.0, false, 4.0);
+  errors += testDelay(25.0, true, 2.5);
+  errors += testTaps();
+  errors += testCheckpoint();
+
+  std::cout << "Test finished with " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -44,10 +44,17 @@
 #include "cedar/processing/StepTime.h"
 #include "cedar/auxiliaries/logFilter/Type.h"
 #include "cedar/auxiliaries/NullLogger.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/EnumParameter.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 
 // SYSTEM INCLUDES
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cmath>
 
 /*!@brief Check whether the (only) projection of the network is in the given state.
  *
@@ -135,6 +142,186 @@ void checkInvalidProjection(const std::string& configurationFile, unsigned int&
   stepArchitecture(network, numberOfErrors);
 }
 
+//! Returns the offset of an index in a continuous matrix of the given sizes.
+size_t linearOffset(const std::vector<int>& index, const std::vector<int>& sizes)
+{
+  size_t offset = 0;
+  for (size_t d = 0; d < sizes.size(); ++d)
+  {
+    offset = offset * sizes.at(d) + index.at(d);
+  }
+  return offset;
+}
+
+//! Increments an index over the given sizes; returns false once all indices have been visited.
+bool incrementIndex(std::vector<int>& index, const std::vector<int>& sizes)
+{
+  for (size_t d = sizes.size(); d > 0; --d)
+  {
+    if (++index.at(d - 1) < sizes.at(d - 1))
+    {
+      return true;
+    }
+    index.at(d - 1) = 0;
+  }
+  return false;
+}
+
+/*!@brief Compares a projection of random data with a brute-force computation.
+ *
+ * @param inputSizes sizes of the input; a single size denotes a row vector
+ * @param outputSizes sizes of the output
+ * @param mapping output dimension of each input dimension, -1 to drop (compress) it
+ * @param compression the compression type to use
+ * @param parallel whether the projection should compute slices of the output in parallel
+ * @param numberOfErrors counter for the number of errors
+ */
+void checkProjectionValues
+(
+  const std::vector<int>& inputSizes,
+  const std::vector<int>& outputSizes,
+  const std::vector<int>& mapping,
+  cedar::aux::EnumId compression,
+  bool parallel,
+  unsigned int& numberOfErrors
+)
+{
+  std::cout << "Checking values of a " << inputSizes.size() << "D to " << outputSizes.size() << "D projection"
+            << (parallel ? " (parallel)" : "") << std::endl;
+
+  cv::Mat input_matrix;
+  if (inputSizes.size() == 1)
+  {
+    input_matrix = cv::Mat(1, inputSizes.front(), CV_32F);
+  }
+  else
+  {
+    input_matrix = cv::Mat(static_cast<int>(inputSizes.size()), &inputSizes.front(), CV_32F);
+  }
+  cv::randu(input_matrix, cv::Scalar(-1.0), cv::Scalar(1.0));
+  cedar::aux::MatDataPtr input(new cedar::aux::MatData(input_matrix));
+
+  cedar::proc::steps::ProjectionPtr projection(new cedar::proc::steps::Projection());
+  projection->setInput("input", input);
+  projection->getParameter<cedar::aux::EnumParameter>("compression type")->setValue(compression);
+  projection->getParameter<cedar::aux::BoolParameter>("parallelize")->setValue(parallel);
+  projection->setOutputDimensionality(static_cast<unsigned int>(outputSizes.size()));
+
+  auto mapping_parameter = projection->getParameter<cedar::proc::ProjectionMappingParameter>("dimension mapping");
+  std::vector<bool> output_mapped(outputSizes.size(), false);
+  for (unsigned int dim = 0; dim < mapping.size(); ++dim)
+  {
+    if (mapping.at(dim) < 0)
+    {
+      mapping_parameter->drop(dim);
+    }
+    else
+    {
+      mapping_parameter->changeMapping(dim, static_cast<unsigned int>(mapping.at(dim)));
+      output_mapped.at(mapping.at(dim)) = true;
+    }
+  }
+  for (unsigned int dim = 0; dim < outputSizes.size(); ++dim)
+  {
+    if (!output_mapped.at(dim))
+    {
+      projection->setOutputDimensionSize(dim, static_cast<unsigned int>(outputSizes.at(dim)));
+    }
+  }
+
+  projection->onTrigger();
+
+  if (projection->getState() == cedar::proc::Triggerable::STATE_EXCEPTION)
+  {
+    std::cout << "ERROR: Projection is not in a valid state." << std::endl;
+    ++numberOfErrors;
+    return;
+  }
+
+  auto output_data = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(projection->getOutput("output"));
+  const cv::Mat& output = output_data->getData();
+  size_t expected_total = 1;
+  for (auto size : outputSizes)
+  {
+    expected_total *= static_cast<size_t>(size);
+  }
+  if (output.total() != expected_total || !output.isContinuous())
+  {
+    std::cout << "ERROR: The output has an unexpected layout." << std::endl;
+    ++numberOfErrors;
+    return;
+  }
+
+  std::vector<int> dropped_sizes;
+  for (unsigned int dim = 0; dim < mapping.size(); ++dim)
+  {
+    if (mapping.at(dim) < 0)
+    {
+      dropped_sizes.push_back(inputSizes.at(dim));
+    }
+  }
+
+  std::vector<int> output_index(outputSizes.size(), 0);
+  do
+  {
+    double expected = 0.0;
+    if (compression == cedar::proc::steps::Projection::CompressionType::MAXIMUM)
+    {
+      expected = -std::numeric_limits<double>::max();
+    }
+    else if (compression == cedar::proc::steps::Projection::CompressionType::MINIMUM)
+    {
+      expected = std::numeric_limits<double>::max();
+    }
+
+    double count = 0.0;
+    std::vector<int> dropped_index(dropped_sizes.size(), 0);
+    do
+    {
+      std::vector<int> input_index(inputSizes.size(), 0);
+      for (unsigned int dim = 0, dropped = 0; dim < mapping.size(); ++dim)
+      {
+        input_index.at(dim) = mapping.at(dim) < 0 ? dropped_index.at(dropped++) : output_index.at(mapping.at(dim));
+      }
+      double value = input_matrix.ptr<float>()[linearOffset(input_index, inputSizes)];
+      count += 1.0;
+
+      if (dropped_sizes.empty())
+      {
+        expected = value;
+      }
+      else if (compression == cedar::proc::steps::Projection::CompressionType::MAXIMUM)
+      {
+        expected = std::max(expected, value);
+      }
+      else if (compression == cedar::proc::steps::Projection::CompressionType::MINIMUM)
+      {
+        expected = std::min(expected, value);
+      }
+      else
+      {
+        expected += value;
+      }
+    }
+    while (incrementIndex(dropped_index, dropped_sizes));
+
+    if (compression == cedar::proc::steps::Projection::CompressionType::AVERAGE && !dropped_sizes.empty())
+    {
+      expected /= count;
+    }
+
+    double actual = output.ptr<float>()[linearOffset(output_index, outputSizes)];
+    if (std::abs(actual - expected) > 1e-4 * std::max(1.0, std::abs(expected)))
+    {
+      std::cout << "ERROR: Output entry " << linearOffset(output_index, outputSizes) << " is " << actual
+                << ", expected " << expected << std::endl;
+      ++numberOfErrors;
+      return;
+    }
+  }
+  while (incrementIndex(output_index, outputSizes));
+}
+
 int main()
 {
   // Filter out mem-debug messages so the output reamins readable
@@ -283,6 +470,21 @@ int main()
   map->getValue()->changeMapping(0, 0);
   projection->setOutputDimensionality(0);
 
+  //===================================================================================================================
+  // values of projections between higher-dimensional matrices
+  //===================================================================================================================
+  std::cout << "Checking values of N-dimensional projections" << std::endl;
+  using CompressionType = cedar::proc::steps::Projection::CompressionType;
+  unsigned int& e = number_of_errors;
+  checkProjectionValues({4, 5, 6, 7}, {7, 5}, {-1, 1, -1, 0}, CompressionType::SUM, false, e);
+  checkProjectionValues({4, 5, 6, 7}, {7, 5}, {-1, 1, -1, 0}, CompressionType::AVERAGE, true, e);
+  checkProjectionValues({4, 5, 6, 7}, {6}, {-1, -1, 0, -1}, CompressionType::MAXIMUM, false, e);
+  checkProjectionValues({3, 4, 2, 5, 3}, {2, 3, 3}, {2, -1, 0, -1, 1}, CompressionType::MINIMUM, true, e);
+  checkProjectionValues({3, 4, 2, 5, 3}, {3, 4, 2, 5, 3}, {0, 1, 2, 3, 4}, CompressionType::SUM, false, e);
+  checkProjectionValues({3, 4, 2, 5, 3}, {3, 2, 3, 5, 4}, {0, 4, 1, 3, 2}, CompressionType::SUM, true, e);
+  checkProjectionValues({4, 5}, {3, 5, 2, 4}, {3, 1}, CompressionType::SUM, false, e);
+  checkProjectionValues({6}, {2, 6, 3}, {1}, CompressionType::SUM, true, e);
+
   std::cout << "Done. There were " << number_of_errors << " errors.\n";
 
   return number_of_errors;
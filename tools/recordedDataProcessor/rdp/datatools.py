@@ -38,6 +38,7 @@
 ========================================================================================================================
 '''
 
+import os
 import csv
 import numpy as np
 import re
@@ -68,9 +69,51 @@ def prepare_plot_configuration(directory, x_label, y_label, z_label, marked, ste
     return save_object
 
 
+# layout of the header written for cedar's binary (memory-mappable) recording format
+BINARY_HEADER_DTYPE = np.dtype([('magic', 'S8'), ('version', '<u4'), ('header_size', '<u4'), ('type', '<i4'),
+                                ('dims', '<u4'), ('sizes', '<i4', (16,)), ('frame_stride', '<u8'),
+                                ('frame_count', '<u8')])
+
+# OpenCV depth codes and the corresponding numpy types
+BINARY_DEPTHS = {0: ('CV_8U', np.uint8), 1: ('CV_8S', np.int8), 2: ('CV_16U', np.uint16), 3: ('CV_16S', np.int16),
+                 4: ('CV_32S', np.int32), 5: ('CV_32F', np.float32), 6: ('CV_64F', np.float64)}
+
+
+def read_binary_header(bin_f):
+    '''Reads the fixed-size header of a binary recording.'''
+    header = np.fromfile(bin_f, dtype=BINARY_HEADER_DTYPE, count=1)[0]
+    if header['magic'] != b'CEDARREC':
+        raise IOError(bin_f + ' is not a binary cedar recording.')
+    return header
+
+
+def read_binary_recording(bin_f):
+    '''Maps a binary recording into memory; returns the time stamps (in seconds) and the frames as a numpy array
+    whose first index is the frame number. No data is copied until the frames are accessed.'''
+    header = read_binary_header(bin_f)
+    dtype = BINARY_DEPTHS[int(header['type']) & 7][1]
+    sizes = tuple(int(size) for size in header['sizes'][:header['dims']])
+    stride = int(header['frame_stride'])
+    data_size = int(np.prod(sizes)) * np.dtype(dtype).itemsize
+    frame_dtype = np.dtype({'names': ['time', 'data'], 'formats': ['<f8', (dtype, sizes)],
+                            'offsets': [0, 8], 'itemsize': stride})
+
+    available = (os.path.getsize(bin_f) - int(header['header_size'])) // stride
+    count = min(int(header['frame_count']), available)
+    if count == 0 or data_size == 0:
+        return np.zeros(0), np.zeros((0,) + sizes, dtype=dtype)
+    frames = np.memmap(bin_f, dtype=frame_dtype, mode='r', offset=int(header['header_size']), shape=(count,))
+    return frames['time'], frames['data']
+
+
 def get_csv_header(csv_f):
     '''Gets header from given csv file.'''
     
+    if csv_f.endswith('.bin'):
+        header = read_binary_header(csv_f)
+        return ['Mat', BINARY_DEPTHS[int(header['type']) & 7][0]] \
+               + [str(size) for size in header['sizes'][:header['dims']]]
+
     csv_file = open(csv_f, 'rb')   
     reader = csv.reader(csv_file)
     header = reader.next()
@@ -84,6 +127,11 @@ def get_csv_header(csv_f):
 
 def get_csv_data(csv_f, header):
     '''Gets data and time codes from given csv file.'''
+    if csv_f.endswith('.bin'):
+        times, frames = read_binary_recording(csv_f)
+        data = np.asarray(frames, dtype=np.float64).reshape(len(times), -1)
+        return data, ['%g s' % time for time in times]
+
     time_stamps = []
     data = None
     count = 0
@@ -248,7 +248,8 @@ def initialize_start_values(parent):
     parent.style = ''
     parent.mode = ''
     parent.labelling_mode = 'off'
-    parent.flist = [record_file for record_file in os.listdir(parent.dir) if record_file.lower().endswith('.csv') or record_file.lower().endswith('.data')]
+    parent.flist = [record_file for record_file in os.listdir(parent.dir) if record_file.lower().endswith('.csv') or record_file.lower().endswith('.data')
+                  or record_file.lower().endswith('.bin')]
     parent.flist_sorted = np.asarray(rdp.datatools.sort_alphnum(parent.flist))
     parent.data = None
     parent.reduced_data = None